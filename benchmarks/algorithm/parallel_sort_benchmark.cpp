@@ -0,0 +1,338 @@
+/**
+ * @file parallel_sort_benchmark.cpp
+ * @brief Fork-join scheduling: work-stealing ThreadPool vs a single shared task queue
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * The same fork-join code runs on two schedulers:
+ * - Shared queue (baseline): every task goes through one std::deque
+ *   guarded by one mutex (submit, take and help-while-waiting all lock it)
+ * - Work stealing: ThreadPool/TaskGroup, one Chase-Lev deque per worker
+ *
+ * Workloads (best of ROUNDS runs, for each worker count in THREAD_COUNTS):
+ * - Parallel QuickSort: partition, spawn the smaller side, continue with
+ *   the larger; ranges below PARALLEL_THRESHOLD use Sorter::quick_sort.
+ *   Sorter::parallel_quick_sort (the library entry point) and the
+ *   sequential Sorter::quick_sort are listed for reference.
+ * - Fork-join Fibonacci: fib(FIB_N) with one task per call above
+ *   FIB_CUTOFF, i.e. tens of thousands of tiny tasks, so scheduler
+ *   overhead dominates.
+ *
+ * Speed-ups over the sequential sort need as many cores as workers; on a
+ * machine with fewer cores the comparison shows scheduling overhead only.
+ *
+ * Datasets: 1M and 10M random ints by default. Pass sizes on the command
+ * line to run other sizes, e.g. `benchmark_parallel_sort 50000000`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "algorithm/sorting.hpp"
+#include "algorithm/thread_pool.hpp"
+
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <algorithm>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::algorithm;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SIZES = {
+    1000000,     // 1M
+    10000000     // 10M
+};
+
+const std::vector<std::size_t> THREAD_COUNTS = {1, 2, 4};
+
+const std::size_t PARALLEL_THRESHOLD = 10000;
+const int FIB_N = 30;
+const int FIB_CUTOFF = 8;
+const int ROUNDS = 3;
+
+/**
+ * @brief Prevent the optimizer from discarding results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Shared-queue scheduler (baseline)
+// ============================================
+
+/**
+ * @class SharedQueuePool
+ * @brief Workers pulling tasks from one mutex-guarded queue
+ */
+class SharedQueuePool {
+public:
+    explicit SharedQueuePool(std::size_t threads) {
+        for (std::size_t i = 0; i < threads; ++i) {
+            m_workers.emplace_back([this] { worker_loop(); });
+        }
+    }
+
+    ~SharedQueuePool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_ready.notify_all();
+        for (std::thread& worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    void push(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.push_back(std::move(task));
+        }
+        m_ready.notify_one();
+    }
+
+    bool run_one() {
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_tasks.empty()) {
+                return false;
+            }
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+        task();
+        return true;
+    }
+
+private:
+    void worker_loop() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_ready.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+                if (m_tasks.empty()) {
+                    return;
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_ready;
+    std::deque<std::function<void()>> m_tasks;
+    bool m_stopping = false;
+};
+
+/**
+ * @class SharedQueueGroup
+ * @brief TaskGroup equivalent on SharedQueuePool (waiters help run tasks)
+ */
+class SharedQueueGroup {
+public:
+    explicit SharedQueueGroup(SharedQueuePool& pool) : m_pool(pool) {}
+
+    template <typename F>
+    void run(F func) {
+        m_outstanding.fetch_add(1, std::memory_order_relaxed);
+        m_pool.push([this, func] {
+            func();
+            m_outstanding.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    void wait() {
+        while (m_outstanding.load(std::memory_order_acquire) != 0) {
+            if (!m_pool.run_one()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+private:
+    SharedQueuePool& m_pool;
+    std::atomic<std::size_t> m_outstanding{0};
+};
+
+// ============================================
+// Fork-join workloads (generic over the scheduler)
+// ============================================
+
+template <typename Group>
+void fork_join_quick_sort(std::vector<int>::iterator first, std::vector<int>::iterator last,
+                          Group& group) {
+    while (last - first > static_cast<std::ptrdiff_t>(PARALLEL_THRESHOLD)) {
+        auto mid = first + (last - first) / 2;
+        int a = *first, b = *mid, c = *(last - 1);
+        int pivot = std::max(std::min(a, b), std::min(std::max(a, b), c));
+        auto lower = std::partition(first, last, [pivot](int x) { return x < pivot; });
+        auto upper = std::partition(lower, last, [pivot](int x) { return !(pivot < x); });
+
+        if (lower - first < last - upper) {
+            group.run([first, lower, &group] { fork_join_quick_sort(first, lower, group); });
+            first = upper;
+        } else {
+            group.run([upper, last, &group] { fork_join_quick_sort(upper, last, group); });
+            last = lower;
+        }
+    }
+    Sorter<int>().quick_sort_range(first, last);
+}
+
+template <typename Group, typename Pool>
+double time_fork_join_sort(const std::vector<int>& data, Pool& pool) {
+    std::vector<int> v = data;
+    Timer timer;
+    timer.start();
+    {
+        Group group(pool);
+        fork_join_quick_sort(v.begin(), v.end(), group);
+        group.wait();
+    }
+    timer.stop();
+    g_sink = v[v.size() / 2];
+    return timer.elapsed_ms();
+}
+
+template <typename Group, typename Pool>
+long long fork_join_fib(Pool& pool, int n) {
+    if (n <= FIB_CUTOFF) {
+        long long a = 0, b = 1;
+        for (int i = 0; i < n; ++i) {
+            long long next = a + b;
+            a = b;
+            b = next;
+        }
+        return a;
+    }
+    long long left = 0;
+    Group group(pool);
+    group.run([&pool, &left, n] { left = fork_join_fib<Group>(pool, n - 1); });
+    long long right = fork_join_fib<Group>(pool, n - 2);
+    group.wait();
+    return left + right;
+}
+
+template <typename Group, typename Pool>
+double time_fork_join_fib(Pool& pool) {
+    Timer timer;
+    timer.start();
+    g_sink = fork_join_fib<Group>(pool, FIB_N);
+    timer.stop();
+    return timer.elapsed_ms();
+}
+
+/**
+ * @brief Fastest of ROUNDS runs of a timed workload
+ */
+template <typename Workload>
+double best_of(Workload&& workload) {
+    double best = workload();
+    for (int round = 1; round < ROUNDS; ++round) {
+        best = std::min(best, workload());
+    }
+    return best;
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = DEFAULT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Parallel Sort / Fork-Join Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: single shared task queue vs work-stealing ThreadPool" << std::endl;
+    std::cout << "Parallel threshold: " << PARALLEL_THRESHOLD << std::endl;
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    // Fork-join Fibonacci: task overhead only
+    std::cout << "\n" << std::string(90, '=') << std::endl;
+    std::cout << "Fork-join fib(" << FIB_N << "), cutoff " << FIB_CUTOFF << std::endl;
+    std::cout << std::string(90, '=') << std::endl;
+    for (std::size_t threads : THREAD_COUNTS) {
+        SharedQueuePool shared(threads);
+        ThreadPool stealing(threads);
+        std::vector<BenchmarkResult> results = {
+            BenchmarkResult("Shared queue", 1,
+                            best_of([&] { return time_fork_join_fib<SharedQueueGroup>(shared); })),
+            BenchmarkResult("Work stealing", 1,
+                            best_of([&] { return time_fork_join_fib<TaskGroup>(stealing); })),
+        };
+        ResultFormatter::print_section("Fibonacci: " + std::to_string(threads) + " worker(s)");
+        ResultFormatter::print_comparison_with_baseline(results, 0);
+    }
+
+    DataGenerator<int> gen(42);
+    for (std::size_t size : sizes) {
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Dataset Size: " << size << " elements" << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        std::vector<int> data = gen.random(size, 0, static_cast<int>(size));
+
+        double sequential = best_of([&] {
+            std::vector<int> v = data;
+            Timer timer;
+            timer.start();
+            Sorter<int>().quick_sort(v);
+            timer.stop();
+            g_sink = v[v.size() / 2];
+            return timer.elapsed_ms();
+        });
+
+        for (std::size_t threads : THREAD_COUNTS) {
+            SharedQueuePool shared(threads);
+            ThreadPool stealing(threads);
+            std::vector<BenchmarkResult> results = {
+                BenchmarkResult("Shared queue", size,
+                                best_of([&] { return time_fork_join_sort<SharedQueueGroup>(data, shared); })),
+                BenchmarkResult("Work stealing", size,
+                                best_of([&] { return time_fork_join_sort<TaskGroup>(data, stealing); })),
+                BenchmarkResult("Sorter::parallel_quick_sort", size, best_of([&] {
+                    std::vector<int> v = data;
+                    Timer timer;
+                    timer.start();
+                    Sorter<int>().set_parallel_threshold(PARALLEL_THRESHOLD).parallel_quick_sort(v, stealing);
+                    timer.stop();
+                    g_sink = v[v.size() / 2];
+                    return timer.elapsed_ms();
+                })),
+                BenchmarkResult("Sorter::quick_sort (sequential)", size, sequential),
+            };
+            ResultFormatter::print_section("QuickSort: " + std::to_string(threads) + " worker(s)");
+            ResultFormatter::print_comparison_with_baseline(results, 0);
+        }
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,228 @@
+/**
+ * @file alt_benchmark.cpp
+ * @brief Point-to-point queries: plain Dijkstra vs A* (user heuristic),
+ *        bidirectional Dijkstra and ALT (landmark lower bounds)
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * Contenders (same CsrGraph<int, int>, same query pairs):
+ * - CsrGraph::dijkstra (baseline): stops when the target is settled, fresh
+ *   O(V) arrays per query
+ * - AStar, h = 0: the same search with scratch arrays reused across queries
+ * - AStar, Manhattan heuristic: grid distance times the smallest weight
+ * - BidirectionalDijkstra
+ * - ALT: AStar guided by an AltIndex with LANDMARKS landmarks
+ *
+ * Workloads:
+ * - ALT preprocessing: landmark selection and distance tables; Memory is
+ *   the table size
+ * - QUERIES random (source, target) pairs; the time is the total, and the
+ *   average number of settled vertices per query is printed per contender
+ *
+ * Datasets: road-network-like W x W grids, every cell joined to its four
+ * neighbours by an undirected edge of random weight 1..MAX_WEIGHT; W = 500
+ * and 1000 by default (best of ROUNDS runs). Pass widths on the command
+ * line to run other sizes, e.g. `benchmark_alt 2000`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "graph/csr_graph.hpp"
+#include "algorithm/shortest_paths.hpp"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::graph;
+using namespace mylib::algorithm;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_WIDTHS = {
+    500,     // 250K vertices
+    1000     // 1M vertices
+};
+
+const int MAX_WEIGHT = 10;
+const std::size_t LANDMARKS = 16;
+const std::size_t QUERIES = 100;
+const int ROUNDS = 3;
+
+/**
+ * @brief Prevent the optimizer from discarding results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Workloads
+// ============================================
+
+using Csr = CsrGraph<int, int>;
+using Edge = Csr::Edge;
+using Id = Csr::id_type;
+using Pair = std::pair<Id, Id>;
+
+/**
+ * @brief Fastest of ROUNDS runs of a timed workload
+ */
+template <typename Workload>
+double best_of(Workload&& workload) {
+    double best = workload();
+    for (int round = 1; round < ROUNDS; ++round) {
+        best = std::min(best, workload());
+    }
+    return best;
+}
+
+/**
+ * @brief Grid with vertex r * width + c at row r, column c
+ */
+Csr grid_graph(std::size_t width, std::mt19937_64& rng) {
+    std::uniform_int_distribution<int> weight(1, MAX_WEIGHT);
+    std::vector<Edge> edges;
+    edges.reserve(2 * width * width);
+    for (std::size_t r = 0; r < width; ++r) {
+        for (std::size_t c = 0; c < width; ++c) {
+            int v = static_cast<int>(r * width + c);
+            if (c + 1 < width) {
+                edges.emplace_back(v, v + 1, weight(rng));
+            }
+            if (r + 1 < width) {
+                edges.emplace_back(v, v + static_cast<int>(width), weight(rng));
+            }
+        }
+    }
+    return Csr(edges, false);
+}
+
+/**
+ * @brief Time all pairs; query returns (distance, settled vertices)
+ * @param settled Receives the average settled vertices per query
+ */
+template <typename Query>
+double time_pairs(const std::vector<Pair>& pairs, std::size_t& settled, Query&& query) {
+    return best_of([&] {
+        long long total = 0;
+        std::size_t count = 0;
+        Timer timer;
+        timer.start();
+        for (const Pair& pair : pairs) {
+            auto result = query(pair.first, pair.second);
+            total += result.first;
+            count += result.second;
+        }
+        timer.stop();
+        g_sink = total;
+        settled = count / pairs.size();
+        return timer.elapsed_ms();
+    });
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> widths;
+    for (int i = 1; i < argc; ++i) {
+        widths.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (widths.empty()) {
+        widths = DEFAULT_WIDTHS;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Point-to-Point Shortest Path Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: Dijkstra vs A* vs bidirectional Dijkstra vs ALT" << std::endl;
+    std::cout << "Workload: " << QUERIES << " random pairs, " << LANDMARKS << " landmarks" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::mt19937_64 rng(42);
+    for (std::size_t width : widths) {
+        Csr graph = grid_graph(width, rng);
+        const std::size_t n = graph.vertex_count();
+
+        std::uniform_int_distribution<Id> vertex(0, static_cast<Id>(n - 1));
+        std::vector<Pair> pairs(QUERIES);
+        for (Pair& pair : pairs) {
+            pair = {vertex(rng), vertex(rng)};
+        }
+
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Grid " << width << " x " << width << ": vertices: " << n
+                  << ", edges: " << graph.edge_count() << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        Timer timer;
+        timer.start();
+        AltIndex<int, int> alt(graph, LANDMARKS);
+        timer.stop();
+        ResultFormatter::print_section("ALT preprocessing (Memory = distance tables)");
+        ResultFormatter::print_comparison({
+            BenchmarkResult("AltIndex, " + std::to_string(LANDMARKS) + " landmarks", n,
+                            timer.elapsed_ms(), n * LANDMARKS * sizeof(int)),
+        });
+
+        // Manhattan distance times the cheapest weight (1) never overestimates
+        const int w = static_cast<int>(width);
+        auto manhattan = [&graph, w](Id target) {
+            int t = graph.vertex_of(target);
+            return [&graph, w, t](Id id) {
+                int v = graph.vertex_of(id);
+                return std::abs(v / w - t / w) + std::abs(v % w - t % w);
+            };
+        };
+
+        AStar<int, int> search(graph);
+        BidirectionalDijkstra<int, int> bidirectional(graph);
+        std::size_t unused = 0;
+        std::size_t zero_settled = 0;
+        std::size_t manhattan_settled = 0;
+        std::size_t bidirectional_settled = 0;
+        std::size_t alt_settled = 0;
+
+        ResultFormatter::print_section("Random point-to-point queries");
+        ResultFormatter::print_comparison_with_baseline({
+            BenchmarkResult("CsrGraph::dijkstra", QUERIES, time_pairs(pairs, unused, [&](Id s, Id t) {
+                // Does not report settled vertices; AStar with h = 0 settles the same ones
+                return std::make_pair(graph.dijkstra(graph.vertex_of(s), graph.vertex_of(t)).second,
+                                      std::size_t{0});
+            })),
+            BenchmarkResult("AStar, h = 0", QUERIES, time_pairs(pairs, zero_settled, [&](Id s, Id t) {
+                auto result = search.run(s, t);
+                return std::make_pair(result.distance, result.settled);
+            })),
+            BenchmarkResult("AStar, Manhattan", QUERIES, time_pairs(pairs, manhattan_settled, [&](Id s, Id t) {
+                auto result = search.run(s, t, manhattan(t));
+                return std::make_pair(result.distance, result.settled);
+            })),
+            BenchmarkResult("Bidirectional", QUERIES, time_pairs(pairs, bidirectional_settled, [&](Id s, Id t) {
+                auto result = bidirectional.run(s, t);
+                return std::make_pair(result.distance, result.settled);
+            })),
+            BenchmarkResult("ALT", QUERIES, time_pairs(pairs, alt_settled, [&](Id s, Id t) {
+                auto result = search.run(s, t, alt.heuristic(t));
+                return std::make_pair(result.distance, result.settled);
+            })),
+        }, 0);
+        std::cout << "Average settled per query: Dijkstra " << zero_settled
+                  << ", A* Manhattan " << manhattan_settled
+                  << ", bidirectional " << bidirectional_settled
+                  << ", ALT " << alt_settled << std::endl;
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,319 @@
+/**
+ * @file csr_graph_benchmark.cpp
+ * @brief Graph (adjacency lists) vs CsrGraph (compressed sparse row) on
+ *        large sparse graphs
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * Contenders:
+ * - Graph<int, int> (baseline): unordered_map of std::list adjacency,
+ *   unordered_set/map algorithm state
+ * - CsrGraph<int, int>: offsets/targets/weights arrays, dense ids, flat
+ *   vector algorithm state
+ *
+ * Workloads:
+ * - Build: Graph by add_edge, CsrGraph from the edge list and CsrGraph
+ *   converted from the Graph; Memory is the heap bytes the result holds
+ * - bfs / dfs from vertex 0 with a counting visitor
+ * - dijkstra_all from vertex 0
+ * - topological_sort
+ * - connected_components on the undirected version of the same edges
+ *
+ * Datasets: a random DAG with V = E / 10 vertices and E distinct edges
+ * u -> v (u < v), weights 1..100; 10M edges by default. Traversals report
+ * the best of ROUNDS runs, builds a single run. Pass edge counts on the
+ * command line to run other sizes, e.g. `benchmark_csr_graph 1000000`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "graph/graph.hpp"
+#include "graph/csr_graph.hpp"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+using namespace benchmark;
+using namespace mylib::graph;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_EDGE_COUNTS = {
+    10000000   // 10M
+};
+
+const std::size_t EDGES_PER_VERTEX = 10;
+const int ROUNDS = 3;
+
+/**
+ * @brief Prevent the optimizer from discarding results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Heap Accounting
+// ============================================
+
+/**
+ * @brief Bytes currently allocated through global operator new
+ */
+std::size_t g_live_bytes = 0;
+
+void* operator new(std::size_t bytes) {
+    // Stash the size in front of the block so delete can subtract it
+    void* block = std::malloc(bytes + alignof(std::max_align_t));
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    *static_cast<std::size_t*>(block) = bytes;
+    g_live_bytes += bytes;
+    return static_cast<char*>(block) + alignof(std::max_align_t);
+}
+
+void operator delete(void* p) noexcept {
+    if (p == nullptr) {
+        return;
+    }
+    void* block = static_cast<char*>(p) - alignof(std::max_align_t);
+    g_live_bytes -= *static_cast<std::size_t*>(block);
+    std::free(block);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    operator delete(p);
+}
+
+// ============================================
+// Workloads
+// ============================================
+
+using AdjGraph = Graph<int, int>;
+using Csr = CsrGraph<int, int>;
+using Edge = Csr::Edge;
+
+/**
+ * @brief Fastest of ROUNDS runs of a timed workload
+ */
+template <typename Workload>
+double best_of(Workload&& workload) {
+    double best = workload();
+    for (int round = 1; round < ROUNDS; ++round) {
+        best = std::min(best, workload());
+    }
+    return best;
+}
+
+/**
+ * @brief Time a single build into out; reports the heap bytes it holds
+ */
+template <typename G, typename Build>
+BenchmarkResult timed_build(const std::string& name, std::size_t n, G& out, Build&& build) {
+    std::size_t before = g_live_bytes;
+    Timer timer;
+    timer.start();
+    out = build();
+    timer.stop();
+    std::size_t footprint = g_live_bytes - before;
+    g_sink = static_cast<long long>(out.edge_count());
+    return BenchmarkResult(name, n, timer.elapsed_ms(), footprint);
+}
+
+/**
+ * @brief E distinct edges u -> v with u < v among E / EDGES_PER_VERTEX vertices
+ */
+std::vector<Edge> random_dag_edges(std::size_t edge_count, std::mt19937_64& rng) {
+    const std::size_t vertex_count = std::max<std::size_t>(2, edge_count / EDGES_PER_VERTEX);
+    std::uniform_int_distribution<int> vertex(0, static_cast<int>(vertex_count) - 1);
+    std::uniform_int_distribution<int> weight(1, 100);
+
+    std::vector<std::pair<int, int>> pairs;
+    pairs.reserve(edge_count + edge_count / 8);
+    while (pairs.size() < edge_count) {
+        while (pairs.size() < edge_count + edge_count / 16) {
+            int a = vertex(rng);
+            int b = vertex(rng);
+            if (a != b) {
+                pairs.emplace_back(std::min(a, b), std::max(a, b));
+            }
+        }
+        std::sort(pairs.begin(), pairs.end());
+        pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+    }
+    // Keep a random subset in random order so adjacency order is not sorted
+    std::shuffle(pairs.begin(), pairs.end(), rng);
+    pairs.resize(edge_count);
+
+    std::vector<Edge> edges;
+    edges.reserve(edge_count);
+    for (const auto& pair : pairs) {
+        edges.emplace_back(pair.first, pair.second, weight(rng));
+    }
+    return edges;
+}
+
+AdjGraph build_graph(const std::vector<Edge>& edges, bool directed) {
+    AdjGraph graph(directed);
+    for (const Edge& edge : edges) {
+        graph.add_edge(edge.from, edge.to, edge.weight);
+    }
+    return graph;
+}
+
+template <typename G>
+double time_bfs(const G& graph) {
+    return best_of([&] {
+        long long visited = 0;
+        Timer timer;
+        timer.start();
+        graph.bfs(0, [&visited](const int&) { ++visited; });
+        timer.stop();
+        g_sink = visited;
+        return timer.elapsed_ms();
+    });
+}
+
+template <typename G>
+double time_dfs(const G& graph) {
+    return best_of([&] {
+        long long visited = 0;
+        Timer timer;
+        timer.start();
+        graph.dfs(0, [&visited](const int&) { ++visited; });
+        timer.stop();
+        g_sink = visited;
+        return timer.elapsed_ms();
+    });
+}
+
+template <typename G>
+double time_dijkstra_all(const G& graph) {
+    return best_of([&] {
+        Timer timer;
+        timer.start();
+        auto dist = graph.dijkstra_all(0);
+        timer.stop();
+        g_sink = static_cast<long long>(dist.size());
+        return timer.elapsed_ms();
+    });
+}
+
+template <typename G>
+double time_topological_sort(const G& graph) {
+    return best_of([&] {
+        Timer timer;
+        timer.start();
+        auto order = graph.topological_sort();
+        timer.stop();
+        g_sink = order.front();
+        return timer.elapsed_ms();
+    });
+}
+
+template <typename G>
+double time_components(const G& graph) {
+    return best_of([&] {
+        Timer timer;
+        timer.start();
+        auto components = graph.connected_components();
+        timer.stop();
+        g_sink = static_cast<long long>(components.size());
+        return timer.elapsed_ms();
+    });
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> edge_counts;
+    for (int i = 1; i < argc; ++i) {
+        edge_counts.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (edge_counts.empty()) {
+        edge_counts = DEFAULT_EDGE_COUNTS;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "CSR Graph Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: Graph (adjacency lists) vs CsrGraph" << std::endl;
+    std::cout << "Workloads: build, bfs, dfs, dijkstra_all, topological_sort, connected_components" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::mt19937_64 rng(42);
+    for (std::size_t edge_count : edge_counts) {
+        std::vector<Edge> edges = random_dag_edges(edge_count, rng);
+        const std::size_t vertex_count = std::max<std::size_t>(2, edge_count / EDGES_PER_VERTEX);
+
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Vertices: " << vertex_count << ", edges: " << edge_count << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        {
+            // Both representations stay alive for the directed workloads
+            AdjGraph graph;
+            Csr csr;
+            {
+                Csr from_edges;
+                ResultFormatter::print_section("Build, directed (Memory = heap bytes held)");
+                ResultFormatter::print_comparison_with_baseline({
+                    timed_build("Graph add_edge", edge_count, graph,
+                                [&] { return build_graph(edges, true); }),
+                    timed_build("CsrGraph from edge list", edge_count, from_edges,
+                                [&] { return Csr(edges, true); }),
+                    timed_build("CsrGraph from Graph", edge_count, csr,
+                                [&] { return Csr(graph); }),
+                }, 0);
+            }
+
+            ResultFormatter::print_section("bfs from vertex 0");
+            ResultFormatter::print_comparison_with_baseline({
+                BenchmarkResult("Graph", vertex_count, time_bfs(graph)),
+                BenchmarkResult("CsrGraph", vertex_count, time_bfs(csr)),
+            }, 0);
+
+            ResultFormatter::print_section("dfs from vertex 0");
+            ResultFormatter::print_comparison_with_baseline({
+                BenchmarkResult("Graph", vertex_count, time_dfs(graph)),
+                BenchmarkResult("CsrGraph", vertex_count, time_dfs(csr)),
+            }, 0);
+
+            ResultFormatter::print_section("dijkstra_all from vertex 0");
+            ResultFormatter::print_comparison_with_baseline({
+                BenchmarkResult("Graph", vertex_count, time_dijkstra_all(graph)),
+                BenchmarkResult("CsrGraph", vertex_count, time_dijkstra_all(csr)),
+            }, 0);
+
+            ResultFormatter::print_section("topological_sort");
+            ResultFormatter::print_comparison_with_baseline({
+                BenchmarkResult("Graph", vertex_count, time_topological_sort(graph)),
+                BenchmarkResult("CsrGraph", vertex_count, time_topological_sort(csr)),
+            }, 0);
+        }
+
+        {
+            AdjGraph graph = build_graph(edges, false);
+            Csr csr(graph);
+            ResultFormatter::print_section("connected_components, undirected");
+            ResultFormatter::print_comparison_with_baseline({
+                BenchmarkResult("Graph", vertex_count, time_components(graph)),
+                BenchmarkResult("CsrGraph", vertex_count, time_components(csr)),
+            }, 0);
+        }
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,229 @@
+/**
+ * @file graph_dense_ids_benchmark.cpp
+ * @brief Graph traversals with hash-container state vs the dense integer id
+ *        fast path (bitsets and flat vectors)
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * Contenders (same topology, same Graph<long, int> class):
+ * - Sparse ids (baseline): vertex v is named v * SPARSE_STRIDE, so the key
+ *   range is not compact and traversals keep visited/dist/parent state in
+ *   unordered_set / unordered_map
+ * - Dense ids: vertex v is named v, so the state is a bitset and flat
+ *   vectors indexed by id
+ *
+ * Workloads:
+ * - bfs from vertex 0 with a counting visitor
+ * - has_path from vertex 0 to an unreachable vertex (full BFS)
+ * - dijkstra from vertex 0 to the vertex it reaches last
+ * - dijkstra_all from vertex 0
+ *
+ * Datasets: random directed graphs with V vertices and 8 * V edges, weights
+ * 1..100; 100K and 1M vertices by default (best of ROUNDS runs). Pass vertex
+ * counts on the command line to run other sizes, e.g.
+ * `benchmark_graph_dense_ids 2000000`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "graph/graph.hpp"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <limits>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::graph;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SIZES = {
+    100000,    // 100K
+    1000000    // 1M
+};
+
+const std::size_t EDGES_PER_VERTEX = 8;
+const long SPARSE_STRIDE = 1000003;
+const int ROUNDS = 3;
+
+/**
+ * @brief Prevent the optimizer from discarding results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Workloads
+// ============================================
+
+using LongGraph = Graph<long, int>;
+
+/**
+ * @struct EdgeSpec
+ * @brief Topology shared by both graphs, in 0..V-1 ids
+ */
+struct EdgeSpec {
+    long from;
+    long to;
+    int weight;
+};
+
+/**
+ * @brief Fastest of ROUNDS runs of a timed workload
+ */
+template <typename Workload>
+double best_of(Workload&& workload) {
+    double best = workload();
+    for (int round = 1; round < ROUNDS; ++round) {
+        best = std::min(best, workload());
+    }
+    return best;
+}
+
+/**
+ * @brief Graph over the shared topology with vertex v named v * stride
+ *
+ * One extra vertex (id V) has no edges, as the has_path target.
+ */
+LongGraph build(std::size_t n, const std::vector<EdgeSpec>& edges, long stride) {
+    LongGraph graph(true);
+    for (std::size_t v = 0; v <= n; ++v) {
+        graph.add_vertex(static_cast<long>(v) * stride);
+    }
+    for (const EdgeSpec& edge : edges) {
+        graph.add_edge(edge.from * stride, edge.to * stride, edge.weight);
+    }
+    return graph;
+}
+
+double time_bfs(const LongGraph& graph) {
+    return best_of([&] {
+        long long visited = 0;
+        Timer timer;
+        timer.start();
+        graph.bfs(0, [&visited](const long&) { ++visited; });
+        timer.stop();
+        g_sink = visited;
+        return timer.elapsed_ms();
+    });
+}
+
+double time_has_path(const LongGraph& graph, long unreachable) {
+    return best_of([&] {
+        Timer timer;
+        timer.start();
+        bool found = graph.has_path(0, unreachable);
+        timer.stop();
+        g_sink = found;
+        return timer.elapsed_ms();
+    });
+}
+
+double time_dijkstra(const LongGraph& graph, long target) {
+    return best_of([&] {
+        Timer timer;
+        timer.start();
+        auto result = graph.dijkstra(0, target);
+        timer.stop();
+        g_sink = result.second;
+        return timer.elapsed_ms();
+    });
+}
+
+double time_dijkstra_all(const LongGraph& graph) {
+    return best_of([&] {
+        Timer timer;
+        timer.start();
+        auto dist = graph.dijkstra_all(0);
+        timer.stop();
+        g_sink = static_cast<long long>(dist.size());
+        return timer.elapsed_ms();
+    });
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = DEFAULT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Graph Dense Vertex Id Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: sparse ids (hash state) vs dense ids (bitset / flat vectors)" << std::endl;
+    std::cout << "Workloads: bfs, has_path, dijkstra, dijkstra_all" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::mt19937_64 rng(42);
+    for (std::size_t n : sizes) {
+        std::uniform_int_distribution<long> vertex(0, static_cast<long>(n) - 1);
+        std::uniform_int_distribution<int> weight(1, 100);
+        std::vector<EdgeSpec> edges(n * EDGES_PER_VERTEX);
+        for (EdgeSpec& edge : edges) {
+            edge = {vertex(rng), vertex(rng), weight(rng)};
+        }
+
+        LongGraph sparse = build(n, edges, SPARSE_STRIDE);
+        LongGraph dense = build(n, edges, 1);
+
+        // The vertex settled last is the most expensive point-to-point query
+        long farthest = 0;
+        int farthest_dist = 0;
+        for (const auto& entry : dense.dijkstra_all(0)) {
+            if (entry.second != std::numeric_limits<int>::max() && entry.second > farthest_dist) {
+                farthest = entry.first;
+                farthest_dist = entry.second;
+            }
+        }
+        const long unreachable = static_cast<long>(n);
+
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Vertices: " << n << ", edges: " << edges.size() << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        ResultFormatter::print_section("bfs from vertex 0");
+        ResultFormatter::print_comparison_with_baseline({
+            BenchmarkResult("Sparse ids (hash state)", n, time_bfs(sparse)),
+            BenchmarkResult("Dense ids (flat state)", n, time_bfs(dense)),
+        }, 0);
+
+        ResultFormatter::print_section("has_path to an unreachable vertex");
+        ResultFormatter::print_comparison_with_baseline({
+            BenchmarkResult("Sparse ids (hash state)", n,
+                            time_has_path(sparse, unreachable * SPARSE_STRIDE)),
+            BenchmarkResult("Dense ids (flat state)", n, time_has_path(dense, unreachable)),
+        }, 0);
+
+        ResultFormatter::print_section("dijkstra to the farthest vertex");
+        ResultFormatter::print_comparison_with_baseline({
+            BenchmarkResult("Sparse ids (hash state)", n,
+                            time_dijkstra(sparse, farthest * SPARSE_STRIDE)),
+            BenchmarkResult("Dense ids (flat state)", n, time_dijkstra(dense, farthest)),
+        }, 0);
+
+        ResultFormatter::print_section("dijkstra_all from vertex 0");
+        ResultFormatter::print_comparison_with_baseline({
+            BenchmarkResult("Sparse ids (hash state)", n, time_dijkstra_all(sparse)),
+            BenchmarkResult("Dense ids (flat state)", n, time_dijkstra_all(dense)),
+        }, 0);
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
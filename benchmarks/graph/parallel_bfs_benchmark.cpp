@@ -0,0 +1,195 @@
+/**
+ * @file parallel_bfs_benchmark.cpp
+ * @brief Queue-based top-down BFS vs direction-optimizing BFS on power-law
+ *        graphs
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * Contenders (same CsrGraph<int, int>):
+ * - CsrGraph::bfs (baseline): FIFO queue, top-down only, counting visitor
+ * - DirectionOptimizingBfs, top-down only (alpha ~ 0): bitmap visited set,
+ *   level/parent arrays, never switches
+ * - DirectionOptimizingBfs, sequential: Beamer's switching, default
+ *   alpha = 15, beta = 18
+ * - DirectionOptimizingBfs on a ThreadPool: the same search with every
+ *   level split across ThreadPool::default_thread_count() workers
+ *
+ * Workload: full searches from SOURCES random non-isolated vertices; the
+ * time is the total over the sources (best of ROUNDS runs).
+ *
+ * Datasets: undirected R-MAT graphs as in Graph500 (a = 0.57, b = c = 0.19,
+ * 2^scale vertex labels, 16 * 2^scale edges, labels shuffled; isolated
+ * labels never appear); scale 20 (about 650K vertices, 16M edges) by default. Pass scales on the command line to run
+ * other sizes, e.g. `benchmark_parallel_bfs 18 22`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "graph/csr_graph.hpp"
+#include "algorithm/parallel_bfs.hpp"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <numeric>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::graph;
+using namespace mylib::algorithm;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SCALES = {
+    20    // 2^20 labels, 16M edges
+};
+
+const std::size_t EDGE_FACTOR = 16;
+const std::size_t SOURCES = 4;
+const int ROUNDS = 3;
+
+/**
+ * @brief Prevent the optimizer from discarding results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Workloads
+// ============================================
+
+using Csr = CsrGraph<int, int>;
+using Edge = Csr::Edge;
+using Bfs = DirectionOptimizingBfs<int, int>;
+
+/**
+ * @brief Fastest of ROUNDS runs of a timed workload
+ */
+template <typename Workload>
+double best_of(Workload&& workload) {
+    double best = workload();
+    for (int round = 1; round < ROUNDS; ++round) {
+        best = std::min(best, workload());
+    }
+    return best;
+}
+
+/**
+ * @brief Graph500-style R-MAT edge list with shuffled vertex labels
+ */
+std::vector<Edge> rmat_edges(std::size_t scale, std::mt19937_64& rng) {
+    const std::size_t n = std::size_t{1} << scale;
+    std::vector<int> label(n);
+    std::iota(label.begin(), label.end(), 0);
+    std::shuffle(label.begin(), label.end(), rng);
+
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    std::vector<Edge> edges;
+    edges.reserve(n * EDGE_FACTOR);
+    for (std::size_t i = 0; i < n * EDGE_FACTOR; ++i) {
+        std::size_t from = 0;
+        std::size_t to = 0;
+        for (std::size_t bit = 0; bit < scale; ++bit) {
+            // Quadrants: a = 0.57 (0,0), b = 0.19 (0,1), c = 0.19 (1,0), d = 0.05 (1,1)
+            double r = coin(rng);
+            from = from << 1 | (r >= 0.76 ? 1 : 0);
+            to = to << 1 | ((r >= 0.57 && r < 0.76) || r >= 0.95 ? 1 : 0);
+        }
+        edges.emplace_back(label[from], label[to], 1);
+    }
+    return edges;
+}
+
+template <typename Search>
+double time_sources(const std::vector<Csr::id_type>& sources, Search&& search) {
+    return best_of([&] {
+        long long reached = 0;
+        Timer timer;
+        timer.start();
+        for (Csr::id_type source : sources) {
+            reached += static_cast<long long>(search(source));
+        }
+        timer.stop();
+        g_sink = reached;
+        return timer.elapsed_ms();
+    });
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> scales;
+    for (int i = 1; i < argc; ++i) {
+        scales.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (scales.empty()) {
+        scales = DEFAULT_SCALES;
+    }
+
+    ThreadPool pool;
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Direction-Optimizing BFS Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: CsrGraph::bfs vs DirectionOptimizingBfs (top-down, hybrid, parallel)" << std::endl;
+    std::cout << "Workload: " << SOURCES << " full searches from random sources" << std::endl;
+    std::cout << "Threads: " << pool.thread_count() << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::mt19937_64 rng(42);
+    for (std::size_t scale : scales) {
+        Csr graph(rmat_edges(scale, rng), false);
+        const std::size_t n = graph.vertex_count();
+
+        std::vector<Csr::id_type> sources;
+        std::uniform_int_distribution<Csr::id_type> vertex(0, static_cast<Csr::id_type>(n - 1));
+        while (sources.size() < SOURCES) {
+            Csr::id_type source = vertex(rng);
+            if (graph.degree(source) > 0) {
+                sources.push_back(source);
+            }
+        }
+
+        Bfs hybrid(graph);
+        Bfs top_down(graph);
+        top_down.set_alpha(1e-9);
+
+        auto steps = hybrid.run(sources.front());
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Scale " << scale << ": vertices: " << n << ", edges: " << graph.edge_count()
+                  << ", reached from first source: " << steps.reached
+                  << " (" << steps.top_down_steps << " top-down / "
+                  << steps.bottom_up_steps << " bottom-up levels)" << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        ResultFormatter::print_section("Full BFS from each source");
+        ResultFormatter::print_comparison_with_baseline({
+            BenchmarkResult("CsrGraph::bfs (queue)", n, time_sources(sources, [&](Csr::id_type s) {
+                std::size_t visited = 0;
+                graph.bfs(graph.vertex_of(s), [&visited](const int&) { ++visited; });
+                return visited;
+            })),
+            BenchmarkResult("DO-BFS top-down only", n, time_sources(sources, [&](Csr::id_type s) {
+                return top_down.run(s).reached;
+            })),
+            BenchmarkResult("DO-BFS sequential", n, time_sources(sources, [&](Csr::id_type s) {
+                return hybrid.run(s).reached;
+            })),
+            BenchmarkResult("DO-BFS ThreadPool", n, time_sources(sources, [&](Csr::id_type s) {
+                return hybrid.run(s, pool).reached;
+            })),
+        }, 0);
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,260 @@
+/**
+ * @file shortest_paths_benchmark.cpp
+ * @brief Lazy-deletion Dijkstra vs the indexed decrease-key heap, Dial's
+ *        bucket queue and bidirectional Dijkstra on grid graphs
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * Contenders (same CsrGraph<int, int>):
+ * - Lazy heap (baseline): std::priority_queue of (distance, id) pairs; a
+ *   vertex whose distance drops is pushed again and the stale entry is
+ *   skipped when popped. This is what dijkstra used before.
+ * - CsrGraph::dijkstra / dijkstra_all: tree::MinIndexedHeap (4-ary) with
+ *   decrease_key, one entry per vertex
+ * - dial_dijkstra: ring of max_weight + 1 linked buckets (single source)
+ * - BidirectionalDijkstra::run: forward and backward searches meeting in
+ *   the middle (single pair)
+ *
+ * Workloads:
+ * - Single source: distances to every vertex from the grid centre
+ * - Single pair: QUERIES random (source, target) pairs, each search stopping
+ *   when the target is settled; also reports the average number of settled
+ *   vertices per query
+ *
+ * Datasets: road-network-like W x W grids, every cell joined to its four
+ * neighbours by an undirected edge of random weight 1..MAX_WEIGHT; W = 500
+ * and 1000 by default (best of ROUNDS runs). Pass widths on the command
+ * line to run other sizes, e.g. `benchmark_shortest_paths 2000`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "graph/csr_graph.hpp"
+#include "algorithm/shortest_paths.hpp"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <queue>
+#include <functional>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::graph;
+using namespace mylib::algorithm;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_WIDTHS = {
+    500,     // 250K vertices
+    1000     // 1M vertices
+};
+
+const int MAX_WEIGHT = 10;
+const std::size_t QUERIES = 50;
+const int ROUNDS = 3;
+
+/**
+ * @brief Prevent the optimizer from discarding results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Workloads
+// ============================================
+
+using Csr = CsrGraph<int, int>;
+using Edge = Csr::Edge;
+using Id = Csr::id_type;
+using Pair = std::pair<Id, Id>;
+
+/**
+ * @brief Fastest of ROUNDS runs of a timed workload
+ */
+template <typename Workload>
+double best_of(Workload&& workload) {
+    double best = workload();
+    for (int round = 1; round < ROUNDS; ++round) {
+        best = std::min(best, workload());
+    }
+    return best;
+}
+
+/**
+ * @brief Grid with vertex r * width + c at row r, column c
+ */
+Csr grid_graph(std::size_t width, std::mt19937_64& rng) {
+    std::uniform_int_distribution<int> weight(1, MAX_WEIGHT);
+    std::vector<Edge> edges;
+    edges.reserve(2 * width * width);
+    for (std::size_t r = 0; r < width; ++r) {
+        for (std::size_t c = 0; c < width; ++c) {
+            int v = static_cast<int>(r * width + c);
+            if (c + 1 < width) {
+                edges.emplace_back(v, v + 1, weight(rng));
+            }
+            if (r + 1 < width) {
+                edges.emplace_back(v, v + static_cast<int>(width), weight(rng));
+            }
+        }
+    }
+    return Csr(edges, false);
+}
+
+/**
+ * @brief Dijkstra with a lazy std::priority_queue, as it was before
+ * @param target Stop once settled; pass vertex_count() to settle everything
+ * @param settled Receives the number of vertices settled
+ * @param peak Receives the largest heap size reached
+ */
+std::vector<int> lazy_dijkstra(const Csr& graph, Id source, Id target,
+                               std::size_t& settled, std::size_t& peak) {
+    std::vector<int> dist(graph.vertex_count(), Csr::infinity());
+    dist[source] = 0;
+    using PQElement = std::pair<int, Id>;
+    std::priority_queue<PQElement, std::vector<PQElement>, std::greater<PQElement>> pq;
+    pq.emplace(0, source);
+    settled = 0;
+    peak = 1;
+    while (!pq.empty()) {
+        auto [d, u] = pq.top();
+        pq.pop();
+        if (d > dist[u]) {
+            continue;  // Outdated entry
+        }
+        ++settled;
+        if (u == target) {
+            break;
+        }
+        for (std::size_t e = graph.offsets()[u]; e < graph.offsets()[u + 1]; ++e) {
+            Id v = graph.targets()[e];
+            int new_dist = d + graph.weights()[e];
+            if (new_dist < dist[v]) {
+                dist[v] = new_dist;
+                pq.emplace(new_dist, v);
+            }
+        }
+        peak = std::max(peak, pq.size());
+    }
+    return dist;
+}
+
+template <typename Search>
+double time_single_source(Search&& search) {
+    return best_of([&] {
+        Timer timer;
+        timer.start();
+        std::vector<int> dist = search();
+        timer.stop();
+        g_sink = dist.back();
+        return timer.elapsed_ms();
+    });
+}
+
+template <typename Query>
+double time_pairs(const std::vector<Pair>& pairs, Query&& query) {
+    return best_of([&] {
+        long long total = 0;
+        Timer timer;
+        timer.start();
+        for (const Pair& pair : pairs) {
+            total += query(pair.first, pair.second);
+        }
+        timer.stop();
+        g_sink = total;
+        return timer.elapsed_ms();
+    });
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> widths;
+    for (int i = 1; i < argc; ++i) {
+        widths.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (widths.empty()) {
+        widths = DEFAULT_WIDTHS;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Shortest Paths Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: lazy heap vs indexed heap vs Dial vs bidirectional Dijkstra" << std::endl;
+    std::cout << "Workloads: single source, " << QUERIES << " single-pair queries" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::mt19937_64 rng(42);
+    for (std::size_t width : widths) {
+        Csr graph = grid_graph(width, rng);
+        const std::size_t n = graph.vertex_count();
+        const Id centre = graph.id_of(static_cast<int>(width / 2 * width + width / 2));
+
+        std::uniform_int_distribution<Id> vertex(0, static_cast<Id>(n - 1));
+        std::vector<Pair> pairs(QUERIES);
+        for (Pair& pair : pairs) {
+            pair = {vertex(rng), vertex(rng)};
+        }
+
+        std::size_t settled = 0;
+        std::size_t peak = 0;
+        lazy_dijkstra(graph, centre, static_cast<Id>(n), settled, peak);
+
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Grid " << width << " x " << width << ": vertices: " << n
+                  << ", edges: " << graph.edge_count() << std::endl;
+        std::cout << "Lazy heap peak entries (single source, stale ones included): " << peak
+                  << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        ResultFormatter::print_section("Single source from the centre");
+        ResultFormatter::print_comparison_with_baseline({
+            BenchmarkResult("Lazy heap (priority_queue)", n, time_single_source([&] {
+                return lazy_dijkstra(graph, centre, static_cast<Id>(n), settled, peak);
+            })),
+            BenchmarkResult("Indexed 4-ary heap", n, time_single_source([&] {
+                return graph.dijkstra_all(graph.vertex_of(centre));
+            })),
+            BenchmarkResult("Dial buckets", n, time_single_source([&] {
+                return dial_dijkstra(graph, centre);
+            })),
+        }, 0);
+
+        std::size_t lazy_settled = 0;
+        std::size_t bidirectional_settled = 0;
+        BidirectionalDijkstra<int, int> bidirectional(graph);
+        for (const Pair& pair : pairs) {
+            lazy_dijkstra(graph, pair.first, pair.second, settled, peak);
+            lazy_settled += settled;
+            bidirectional_settled += bidirectional.run(pair.first, pair.second).settled;
+        }
+
+        ResultFormatter::print_section("Single-pair queries");
+        ResultFormatter::print_comparison_with_baseline({
+            BenchmarkResult("Lazy heap, stop at target", QUERIES, time_pairs(pairs, [&](Id s, Id t) {
+                return lazy_dijkstra(graph, s, t, settled, peak)[t];
+            })),
+            BenchmarkResult("Indexed heap, stop at target", QUERIES, time_pairs(pairs, [&](Id s, Id t) {
+                return graph.dijkstra(graph.vertex_of(s), graph.vertex_of(t)).second;
+            })),
+            BenchmarkResult("Bidirectional", QUERIES, time_pairs(pairs, [&](Id s, Id t) {
+                return bidirectional.run(s, t).distance;
+            })),
+        }, 0);
+        std::cout << "Average settled per query: unidirectional " << lazy_settled / QUERIES
+                  << ", bidirectional " << bidirectional_settled / QUERIES << std::endl;
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
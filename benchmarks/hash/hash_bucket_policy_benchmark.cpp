@@ -0,0 +1,192 @@
+/**
+ * @file hash_bucket_policy_benchmark.cpp
+ * @brief Benchmark of HashTable bucket policies (prime modulo vs division-free)
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * This benchmark compares the three bucket policies of HashTable:
+ * - PrimeBucketPolicy: prime bucket counts, hash % count (baseline)
+ * - PowerOfTwoBucketPolicy: power-of-two counts, Fibonacci multiply-shift
+ * - FastRangeBucketPolicy: any count, Lemire's fastrange (mixed hash)
+ *
+ * Key types:
+ * - long long (identity std::hash, exercises the hash-quality guard)
+ * - std::string (16-24 characters)
+ *
+ * Measurements:
+ * - Random insertion
+ * - Lookup hit (find)
+ * - Lookup miss (contains)
+ *
+ * Datasets: 1M keys by default. Pass sizes on the command line to run
+ * other sizes, e.g. `benchmark_hash_bucket_policy 100000 1000000 10000000`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "hash/hash_table.hpp"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::hash;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SIZES = {
+    1000000      // 1M
+};
+
+template <typename Key, typename Value, typename Policy>
+using PolicyTable = HashTable<Key, Value, std::hash<Key>, std::equal_to<Key>, Policy>;
+
+/**
+ * @brief Prevent the optimizer from discarding lookup results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Helper Functions
+// ============================================
+
+/**
+ * @brief Generate count distinct random strings of 16-24 characters
+ */
+std::vector<std::string> generate_strings(std::size_t count, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<int> length_dist(16, 24);
+    std::uniform_int_distribution<int> char_dist('a', 'z');
+    std::vector<std::string> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        // Numeric prefix keeps the strings distinct
+        std::string s = std::to_string(i) + "_";
+        int length = length_dist(rng);
+        while (static_cast<int>(s.size()) < length) {
+            s.push_back(static_cast<char>(char_dist(rng)));
+        }
+        result.push_back(std::move(s));
+    }
+    return result;
+}
+
+// ============================================
+// Benchmark Functions
+// ============================================
+
+/**
+ * @brief Run insert / hit / miss phases on one table type
+ */
+template <typename Table, typename Key>
+std::vector<BenchmarkResult> benchmark_table(const std::string& name,
+                                             const std::vector<Key>& keys,
+                                             const std::vector<Key>& misses) {
+    std::vector<BenchmarkResult> results;
+    Timer timer;
+    Table table;
+
+    timer.start();
+    for (const Key& k : keys) {
+        table.insert(k, 1);
+    }
+    timer.stop();
+    results.emplace_back(name, keys.size(), timer.elapsed_ms());
+
+    long long sum = 0;
+    timer.start();
+    for (const Key& k : keys) {
+        sum += *table.find(k);
+    }
+    timer.stop();
+    g_sink = sum;
+    results.emplace_back(name, keys.size(), timer.elapsed_ms());
+
+    std::size_t found = 0;
+    timer.start();
+    for (const Key& k : misses) {
+        found += table.contains(k) ? 1 : 0;
+    }
+    timer.stop();
+    g_sink = static_cast<long long>(found);
+    results.emplace_back(name, misses.size(), timer.elapsed_ms());
+
+    return results;
+}
+
+/**
+ * @brief Benchmark all three policies for one key type and print each phase
+ */
+template <typename Key, typename Value>
+void benchmark_policies(const std::string& key_name,
+                        const std::vector<Key>& keys,
+                        const std::vector<Key>& misses) {
+    auto prime = benchmark_table<PolicyTable<Key, Value, PrimeBucketPolicy>>(
+        "Prime (modulo)", keys, misses);
+    auto pow2 = benchmark_table<PolicyTable<Key, Value, PowerOfTwoBucketPolicy>>(
+        "Power of two (fibonacci)", keys, misses);
+    auto fastrange = benchmark_table<PolicyTable<Key, Value, FastRangeBucketPolicy>>(
+        "Fastrange", keys, misses);
+
+    const char* phases[] = {"Insert", "Lookup Hit", "Lookup Miss"};
+    for (std::size_t i = 0; i < 3; ++i) {
+        ResultFormatter::print_section(key_name + " keys: " + phases[i]);
+        ResultFormatter::print_comparison_with_baseline({prime[i], pow2[i], fastrange[i]}, 0);
+    }
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = DEFAULT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Hash Bucket Policy Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: Prime modulo vs Power-of-two vs Fastrange" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    DataGenerator<long long> gen(42);
+
+    for (std::size_t size : sizes) {
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Dataset Size: " << size << " keys" << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        // Even keys are inserted, odd keys are guaranteed misses
+        std::vector<long long> int_keys = gen.shuffled(size, 0);
+        std::vector<long long> int_misses(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            int_misses[i] = int_keys[i] * 2 + 1;
+            int_keys[i] *= 2;
+        }
+        benchmark_policies<long long, long long>("Integer", int_keys, int_misses);
+
+        std::vector<std::string> str_keys = generate_strings(size, 7);
+        std::vector<std::string> str_misses = generate_strings(size, 8);
+        for (auto& s : str_misses) {
+            s.insert(0, "miss_");
+        }
+        benchmark_policies<std::string, int>("String", str_keys, str_misses);
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,202 @@
+/**
+ * @file hash_frozen_index_benchmark.cpp
+ * @brief Start-up cost of a re-inserted HashTable vs a memory-mapped FrozenHashIndex
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * Simulates process start-up with a large persisted table:
+ * - Re-insert: read a raw (key, value) dump and insert every pair into a
+ *   HashTable (baseline)
+ * - Frozen load: FrozenHashIndex::load() maps a file written by save()
+ *
+ * Reported per dataset:
+ * - Load time (until the first lookup can be served)
+ * - Time for 1M random lookups right after loading (the frozen index pays
+ *   its page faults here)
+ * - Load + lookups combined
+ *
+ * Both files are read from the page cache (written just before), so the
+ * numbers compare CPU work, not disk bandwidth.
+ *
+ * Datasets: 1M and 10M keys by default. Pass sizes on the command line to
+ * run other sizes, e.g. `benchmark_hash_frozen_index 50000000`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "hash/hash_table.hpp"
+#include "hash/frozen_hash_index.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::hash;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SIZES = {
+    1000000,     // 1M
+    10000000     // 10M
+};
+
+const std::size_t LOOKUPS = 1000000;
+
+const char* RAW_PATH = "benchmark_frozen_raw.bin";
+const char* INDEX_PATH = "benchmark_frozen_index.idx";
+
+using Key = long long;
+using Table = HashTable<Key, Key>;
+using Index = FrozenHashIndex<Key, Key>;
+
+/**
+ * @brief Prevent the optimizer from discarding lookup results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Helper Functions
+// ============================================
+
+/**
+ * @brief Write keys as a flat array of (key, value) pairs
+ */
+void write_raw_dump(const std::vector<Key>& keys) {
+    std::vector<Key> pairs;
+    pairs.reserve(keys.size() * 2);
+    for (Key k : keys) {
+        pairs.push_back(k);
+        pairs.push_back(k * 3);
+    }
+    std::ofstream out(RAW_PATH, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(pairs.data()),
+              static_cast<std::streamsize>(pairs.size() * sizeof(Key)));
+}
+
+/**
+ * @brief Rebuild a HashTable from the raw dump
+ */
+Table load_by_reinsert() {
+    std::ifstream in(RAW_PATH, std::ios::binary | std::ios::ate);
+    std::size_t bytes = static_cast<std::size_t>(in.tellg());
+    in.seekg(0);
+    std::vector<Key> pairs(bytes / sizeof(Key));
+    in.read(reinterpret_cast<char*>(pairs.data()), static_cast<std::streamsize>(bytes));
+
+    Table table;
+    table.reserve(pairs.size() / 2);
+    for (std::size_t i = 0; i + 1 < pairs.size(); i += 2) {
+        table.insert(pairs[i], pairs[i + 1]);
+    }
+    return table;
+}
+
+template <typename Lookup>
+double time_lookups(const std::vector<Key>& probes, Lookup&& lookup) {
+    long long sum = 0;
+    Timer timer;
+    timer.start();
+    for (Key k : probes) {
+        sum += *lookup(k);
+    }
+    timer.stop();
+    g_sink = sum;
+    return timer.elapsed_ms();
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = DEFAULT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Hash Frozen Index Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: re-inserting into HashTable vs FrozenHashIndex::load (mmap)" << std::endl;
+    std::cout << "Lookups after load: " << LOOKUPS << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    DataGenerator<Key> gen(42);
+
+    for (std::size_t size : sizes) {
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Dataset Size: " << size << " keys" << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        std::vector<Key> keys = gen.shuffled(size, 0);
+        write_raw_dump(keys);
+        {
+            Table source;
+            for (Key k : keys) {
+                source.insert(k, k * 3);
+            }
+            Index::save(source, INDEX_PATH);
+        }
+
+        std::mt19937_64 rng(7);
+        std::uniform_int_distribution<std::size_t> pick(0, size - 1);
+        std::vector<Key> probes(LOOKUPS);
+        for (Key& k : probes) {
+            k = keys[pick(rng)];
+        }
+
+        Timer timer;
+        std::vector<BenchmarkResult> load_results;
+        std::vector<BenchmarkResult> lookup_results;
+        std::vector<BenchmarkResult> total_results;
+
+        {
+            timer.start();
+            Table table = load_by_reinsert();
+            timer.stop();
+            double load_ms = timer.elapsed_ms();
+            double lookup_ms = time_lookups(probes, [&table](Key k) { return table.find(k); });
+            load_results.emplace_back("Re-insert into HashTable", size, load_ms);
+            lookup_results.emplace_back("Re-insert into HashTable", LOOKUPS, lookup_ms);
+            total_results.emplace_back("Re-insert into HashTable", size, load_ms + lookup_ms);
+        }
+
+        {
+            timer.start();
+            Index index = Index::load(INDEX_PATH);
+            timer.stop();
+            double load_ms = timer.elapsed_ms();
+            double lookup_ms = time_lookups(probes, [&index](Key k) { return index.find(k); });
+            load_results.emplace_back("FrozenHashIndex::load", size, load_ms);
+            lookup_results.emplace_back("FrozenHashIndex::load", LOOKUPS, lookup_ms);
+            total_results.emplace_back("FrozenHashIndex::load", size, load_ms + lookup_ms);
+        }
+
+        ResultFormatter::print_section("Load");
+        ResultFormatter::print_comparison_with_baseline(load_results, 0);
+        ResultFormatter::print_section("First Lookups After Load");
+        ResultFormatter::print_comparison_with_baseline(lookup_results, 0);
+        ResultFormatter::print_section("Load + Lookups");
+        ResultFormatter::print_comparison_with_baseline(total_results, 0);
+
+        std::remove(RAW_PATH);
+        std::remove(INDEX_PATH);
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
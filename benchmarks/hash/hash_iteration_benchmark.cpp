@@ -0,0 +1,192 @@
+/**
+ * @file hash_iteration_benchmark.cpp
+ * @brief Benchmark of HashTable full-table scans and drains
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * Scans (sum every value):
+ * - for_each(std::function): type-erased call per entry (baseline)
+ * - Iterator: range-based for over begin()/end()
+ * - for_each(visitor): templated overload, inlined lambda
+ *
+ * Drains (move every entry into a second table):
+ * - Copy: keys() + values() into vectors, insert into target, clear() (baseline)
+ * - Extract: extract(it++) + insert(node), no allocation or copy per entry
+ * - Merge: target.merge(source), entries spliced in one call
+ *
+ * Datasets: 100K and 1M keys by default. Pass sizes on the command line to
+ * run other sizes, e.g. `benchmark_hash_iteration 10000000`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "hash/hash_table.hpp"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <functional>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::hash;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SIZES = {
+    100000,      // 100K
+    1000000      // 1M
+};
+
+const int SCAN_REPEATS = 10;
+
+using Key = long long;
+using Table = HashTable<Key, Key>;
+
+/**
+ * @brief Prevent the optimizer from discarding scan results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Helper Functions
+// ============================================
+
+Table build_table(const std::vector<Key>& keys) {
+    Table table;
+    table.reserve(keys.size());
+    for (Key k : keys) {
+        table.insert(k, k);
+    }
+    return table;
+}
+
+// ============================================
+// Benchmark Functions
+// ============================================
+
+std::vector<BenchmarkResult> benchmark_scans(const Table& table) {
+    std::vector<BenchmarkResult> results;
+    Timer timer;
+    long long sum = 0;
+
+    std::function<void(const Key&, const Key&)> erased =
+        [&sum](const Key&, const Key& value) { sum += value; };
+    timer.start();
+    for (int r = 0; r < SCAN_REPEATS; ++r) {
+        table.for_each(erased);
+    }
+    timer.stop();
+    results.emplace_back("for_each(std::function)", table.size(), timer.elapsed_ms());
+
+    timer.start();
+    for (int r = 0; r < SCAN_REPEATS; ++r) {
+        for (const auto& entry : table) {
+            sum += entry.second;
+        }
+    }
+    timer.stop();
+    results.emplace_back("Iterator", table.size(), timer.elapsed_ms());
+
+    timer.start();
+    for (int r = 0; r < SCAN_REPEATS; ++r) {
+        table.for_each([&sum](const Key&, const Key& value) { sum += value; });
+    }
+    timer.stop();
+    results.emplace_back("for_each(visitor)", table.size(), timer.elapsed_ms());
+
+    g_sink = sum;
+    return results;
+}
+
+std::vector<BenchmarkResult> benchmark_drains(const std::vector<Key>& keys) {
+    std::vector<BenchmarkResult> results;
+    Timer timer;
+
+    {
+        Table source = build_table(keys);
+        Table target;
+        timer.start();
+        std::vector<Key> ks = source.keys();
+        std::vector<Key> vs = source.values();
+        for (std::size_t i = 0; i < ks.size(); ++i) {
+            target.insert(ks[i], vs[i]);
+        }
+        source.clear();
+        timer.stop();
+        g_sink = static_cast<long long>(target.size());
+        results.emplace_back("Copy (keys/values + insert)", keys.size(), timer.elapsed_ms());
+    }
+
+    {
+        Table source = build_table(keys);
+        Table target;
+        timer.start();
+        for (auto it = source.begin(); it != source.end();) {
+            target.insert(source.extract(it++));
+        }
+        timer.stop();
+        g_sink = static_cast<long long>(target.size());
+        results.emplace_back("Extract + insert(node)", keys.size(), timer.elapsed_ms());
+    }
+
+    {
+        Table source = build_table(keys);
+        Table target;
+        timer.start();
+        target.merge(source);
+        timer.stop();
+        g_sink = static_cast<long long>(target.size());
+        results.emplace_back("Merge", keys.size(), timer.elapsed_ms());
+    }
+
+    return results;
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = DEFAULT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Hash Iteration Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: std::function vs iterator vs inlined visitor scans," << std::endl;
+    std::cout << "           copy vs extract vs merge drains (HashTable)" << std::endl;
+    std::cout << "Scan repeats: " << SCAN_REPEATS << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    DataGenerator<Key> gen(42);
+
+    for (std::size_t size : sizes) {
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Dataset Size: " << size << " keys" << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        std::vector<Key> keys = gen.shuffled(size, 0);
+        Table table = build_table(keys);
+
+        ResultFormatter::print_section("Full Scan (x" + std::to_string(SCAN_REPEATS) + ")");
+        ResultFormatter::print_comparison_with_baseline(benchmark_scans(table), 0);
+
+        ResultFormatter::print_section("Drain Into Another Table");
+        ResultFormatter::print_comparison_with_baseline(benchmark_drains(keys), 0);
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
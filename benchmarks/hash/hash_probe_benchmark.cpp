@@ -0,0 +1,144 @@
+/**
+ * @file hash_probe_benchmark.cpp
+ * @brief Probe-cost microbenchmark for OpenHashTable group probing
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * Measures the per-lookup cost of OpenHashTable at fixed capacity while the
+ * load factor rises from 0.5 to 0.9. The same source is built twice:
+ * - benchmark_hash_probe:          SSE2 groups (16 control bytes per compare)
+ * - benchmark_hash_probe_portable: SWAR groups (8 control bytes per compare)
+ *
+ * Measurements (ns per operation):
+ * - Lookup hit
+ * - Lookup miss
+ *
+ * Pass a capacity exponent on the command line to change the table size,
+ * e.g. `benchmark_hash_probe 22` for 4M slots (default 2^20).
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "hash/open_hash_table.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::hash;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<double> LOAD_FACTORS = {0.5, 0.6, 0.7, 0.8, 0.875, 0.9};
+
+const std::size_t DEFAULT_CAPACITY_LOG2 = 20;
+
+using Key = long long;
+using Table = OpenHashTable<Key, Key>;
+
+/**
+ * @brief Prevent the optimizer from discarding lookup results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Benchmark Functions
+// ============================================
+
+/**
+ * @brief Fill a table of the given capacity to load_factor and time lookups
+ */
+void benchmark_load_factor(std::size_t capacity, double load_factor,
+                           const std::vector<Key>& keys,
+                           const std::vector<Key>& misses) {
+    const std::size_t count = static_cast<std::size_t>(capacity * load_factor);
+
+    Table table(capacity);
+    table.max_load_factor(0.95f);
+    for (std::size_t i = 0; i < count; ++i) {
+        table.insert(keys[i], keys[i]);
+    }
+
+    Timer timer;
+
+    long long sum = 0;
+    timer.start();
+    for (std::size_t i = 0; i < count; ++i) {
+        sum += *table.find(keys[i]);
+    }
+    timer.stop();
+    g_sink = sum;
+    double hit_ns = timer.elapsed_ms() * 1e6 / static_cast<double>(count);
+
+    std::size_t found = 0;
+    timer.start();
+    for (std::size_t i = 0; i < count; ++i) {
+        found += table.contains(misses[i]) ? 1 : 0;
+    }
+    timer.stop();
+    g_sink = static_cast<long long>(found);
+    double miss_ns = timer.elapsed_ms() * 1e6 / static_cast<double>(count);
+
+    std::cout << std::left << std::setw(14) << load_factor
+              << std::setw(12) << count
+              << std::setw(14) << table.bucket_count()
+              << std::fixed << std::setprecision(2)
+              << std::setw(16) << hit_ns
+              << std::setw(16) << miss_ns
+              << std::defaultfloat << std::setprecision(6) << std::endl;
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::size_t log2 = DEFAULT_CAPACITY_LOG2;
+    if (argc > 1) {
+        log2 = static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+    }
+    const std::size_t capacity = std::size_t{1} << log2;
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Hash Probe Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+#if defined(__SSE2__) && !defined(MYLIB_HASH_NO_SIMD)
+    std::cout << "Group: SSE2 (" << mylib::hash::detail::Group::WIDTH << " slots)" << std::endl;
+#else
+    std::cout << "Group: portable SWAR (" << mylib::hash::detail::Group::WIDTH << " slots)" << std::endl;
+#endif
+    std::cout << "Capacity: " << capacity << " slots" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    // Even keys are inserted, odd keys are guaranteed misses
+    DataGenerator<Key> gen(42);
+    std::vector<Key> keys = gen.shuffled(capacity, 0);
+    std::vector<Key> misses(capacity);
+    for (std::size_t i = 0; i < capacity; ++i) {
+        misses[i] = keys[i] * 2 + 1;
+        keys[i] *= 2;
+    }
+
+    std::cout << "\n" << std::left << std::setw(14) << "Load Factor"
+              << std::setw(12) << "Keys"
+              << std::setw(14) << "Capacity"
+              << std::setw(16) << "Hit (ns/op)"
+              << std::setw(16) << "Miss (ns/op)" << std::endl;
+    std::cout << std::string(72, '-') << std::endl;
+
+    for (double lf : LOAD_FACTORS) {
+        benchmark_load_factor(capacity, lf, keys, misses);
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,176 @@
+/**
+ * @file hash_rehash_latency_benchmark.cpp
+ * @brief Per-insert latency of HashTable with synchronous vs incremental rehash
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * Every insert is timed individually, so the inserts that trigger a rehash
+ * show up in the tail of the distribution instead of disappearing in an
+ * average.
+ *
+ * Modes:
+ * - Synchronous: the insert that crosses max_load_factor moves every entry
+ * - Incremental: old and new bucket arrays coexist and each insert migrates
+ *   DEFAULT_REHASH_STEP old buckets
+ *
+ * Reported: p50, p99, p99.9, p99.99 and max insert latency in ns, plus
+ * total insert time.
+ *
+ * Datasets: 1M and 10M keys by default. Pass sizes on the command line to
+ * run other sizes, e.g. `benchmark_hash_rehash_latency 50000000`
+ * (50M keys needs roughly 5 GB of RAM).
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "hash/hash_table.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::hash;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SIZES = {
+    1000000,     // 1M
+    10000000     // 10M
+};
+
+using Key = long long;
+using Table = HashTable<Key, Key>;
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @struct LatencySummary
+ * @brief Percentiles of one insert run
+ */
+struct LatencySummary {
+    std::string name;
+    double p50_ns;
+    double p99_ns;
+    double p999_ns;
+    double p9999_ns;
+    double max_ns;
+    double total_ms;
+};
+
+// ============================================
+// Helper Functions
+// ============================================
+
+/**
+ * @brief Value at quantile q of latencies (reorders the vector)
+ */
+double percentile(std::vector<std::uint32_t>& latencies, double q) {
+    std::size_t index = static_cast<std::size_t>(q * (latencies.size() - 1));
+    std::nth_element(latencies.begin(), latencies.begin() + index, latencies.end());
+    return static_cast<double>(latencies[index]);
+}
+
+// ============================================
+// Benchmark Functions
+// ============================================
+
+/**
+ * @brief Insert all keys one by one, recording each insert's latency
+ */
+LatencySummary benchmark_inserts(const std::string& name,
+                                 const std::vector<Key>& keys,
+                                 bool incremental) {
+    Table table;
+    table.incremental_rehash(incremental);
+
+    std::vector<std::uint32_t> latencies(keys.size());
+    Timer timer;
+    timer.start();
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        auto begin = Clock::now();
+        table.insert(keys[i], keys[i]);
+        auto end = Clock::now();
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+        latencies[i] = static_cast<std::uint32_t>(std::min<long long>(ns, UINT32_MAX));
+    }
+    timer.stop();
+
+    LatencySummary summary;
+    summary.name = name;
+    summary.total_ms = timer.elapsed_ms();
+    summary.max_ns = static_cast<double>(*std::max_element(latencies.begin(), latencies.end()));
+    summary.p9999_ns = percentile(latencies, 0.9999);
+    summary.p999_ns = percentile(latencies, 0.999);
+    summary.p99_ns = percentile(latencies, 0.99);
+    summary.p50_ns = percentile(latencies, 0.50);
+    return summary;
+}
+
+void print_summary(const LatencySummary& s) {
+    std::cout << std::left << std::setw(14) << s.name
+              << std::fixed << std::setprecision(0)
+              << std::setw(10) << s.p50_ns
+              << std::setw(10) << s.p99_ns
+              << std::setw(10) << s.p999_ns
+              << std::setw(12) << s.p9999_ns
+              << std::setw(16) << s.max_ns
+              << std::setprecision(2) << s.total_ms
+              << std::defaultfloat << std::setprecision(6) << std::endl;
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = DEFAULT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Hash Rehash Latency Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: synchronous vs incremental rehash (HashTable)" << std::endl;
+    std::cout << "Incremental step: " << Table::DEFAULT_REHASH_STEP << " buckets/insert" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    DataGenerator<Key> gen(42);
+
+    for (std::size_t size : sizes) {
+        ResultFormatter::print_section("Dataset Size: " + std::to_string(size) + " inserts");
+
+        std::vector<Key> keys = gen.shuffled(size, 0);
+
+        auto sync = benchmark_inserts("Synchronous", keys, false);
+        auto incremental = benchmark_inserts("Incremental", keys, true);
+
+        std::cout << std::left << std::setw(14) << "Mode"
+                  << std::setw(10) << "p50 ns"
+                  << std::setw(10) << "p99 ns"
+                  << std::setw(10) << "p99.9 ns"
+                  << std::setw(12) << "p99.99 ns"
+                  << std::setw(16) << "max ns"
+                  << "total ms" << std::endl;
+        std::cout << std::string(80, '-') << std::endl;
+        print_summary(sync);
+        print_summary(incremental);
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
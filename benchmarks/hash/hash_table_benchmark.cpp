@@ -0,0 +1,183 @@
+/**
+ * @file hash_table_benchmark.cpp
+ * @brief Benchmark comparing chained HashTable and open-addressing OpenHashTable
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * This benchmark compares two hash table implementations:
+ * - HashTable: Separate chaining with std::list buckets
+ * - OpenHashTable: Open addressing with Swiss-table-style control bytes
+ *
+ * Measurements:
+ * - Random insertion
+ * - Lookup hit (find)
+ * - Lookup miss (contains)
+ * - Erase
+ *
+ * Datasets: 1M and 10M keys by default. Pass sizes on the command line to
+ * run other sizes, e.g. `benchmark_hash_table 1000000 10000000 100000000`
+ * (100M keys needs roughly 8 GB of RAM for the chained table).
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "hash/hash_table.hpp"
+#include "hash/open_hash_table.hpp"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::hash;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SIZES = {
+    1000000,     // 1M
+    10000000     // 10M
+};
+
+using Key = long long;
+using Chained = HashTable<Key, Key>;
+using Open = OpenHashTable<Key, Key>;
+
+/**
+ * @brief Prevent the optimizer from discarding lookup results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Helper Functions
+// ============================================
+
+/**
+ * @brief Estimate memory of a chained table (bucket heads + list nodes)
+ */
+std::size_t estimate_memory(const Chained& table) {
+    const std::size_t node_bytes = 2 * sizeof(void*) + 2 * sizeof(Key);
+    return table.bucket_count() * 3 * sizeof(void*) + table.size() * node_bytes;
+}
+
+/**
+ * @brief Estimate memory of an open-addressing table (slots + control bytes)
+ */
+std::size_t estimate_memory(const Open& table) {
+    return table.bucket_count() * (2 * sizeof(Key) + 1);
+}
+
+// ============================================
+// Benchmark Functions
+// ============================================
+
+/**
+ * @brief Run insert / hit / miss / erase phases on one table type
+ */
+template <typename Table>
+std::vector<BenchmarkResult> benchmark_table(const std::string& name,
+                                             const std::vector<Key>& keys,
+                                             const std::vector<Key>& misses) {
+    std::vector<BenchmarkResult> results;
+    Timer timer;
+    Table table;
+
+    timer.start();
+    for (Key k : keys) {
+        table.insert(k, k);
+    }
+    timer.stop();
+    results.emplace_back(name + " insert", keys.size(), timer.elapsed_ms(),
+                         estimate_memory(table));
+
+    long long sum = 0;
+    timer.start();
+    for (Key k : keys) {
+        sum += *table.find(k);
+    }
+    timer.stop();
+    g_sink = sum;
+    results.emplace_back(name + " find hit", keys.size(), timer.elapsed_ms());
+
+    std::size_t found = 0;
+    timer.start();
+    for (Key k : misses) {
+        found += table.contains(k) ? 1 : 0;
+    }
+    timer.stop();
+    g_sink = static_cast<long long>(found);
+    results.emplace_back(name + " find miss", misses.size(), timer.elapsed_ms());
+
+    timer.start();
+    for (Key k : keys) {
+        table.erase(k);
+    }
+    timer.stop();
+    results.emplace_back(name + " erase", keys.size(), timer.elapsed_ms());
+
+    return results;
+}
+
+/**
+ * @brief Print one phase (chained baseline vs open addressing)
+ */
+void print_phase(const std::string& title,
+                 const BenchmarkResult& chained,
+                 const BenchmarkResult& open) {
+    ResultFormatter::print_section(title);
+    ResultFormatter::print_comparison_with_baseline({chained, open}, 0);
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = DEFAULT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Hash Table Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: HashTable (chaining) vs OpenHashTable (open addressing)" << std::endl;
+    std::cout << "Key/Value: long long / long long" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    DataGenerator<Key> gen(42);
+
+    for (std::size_t size : sizes) {
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Dataset Size: " << size << " keys" << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        // Even keys are inserted, odd keys are guaranteed misses
+        std::vector<Key> keys = gen.shuffled(size, 0);
+        std::vector<Key> misses(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            misses[i] = keys[i] * 2 + 1;
+            keys[i] *= 2;
+        }
+
+        auto chained = benchmark_table<Chained>("HashTable", keys, misses);
+        auto open = benchmark_table<Open>("OpenHashTable", keys, misses);
+
+        print_phase("Random Insert", chained[0], open[0]);
+        print_phase("Lookup Hit", chained[1], open[1]);
+        print_phase("Lookup Miss", chained[2], open[2]);
+        print_phase("Erase", chained[3], open[3]);
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,265 @@
+/**
+ * @file deque_benchmark.cpp
+ * @brief Block-map Deque vs the previous LinkedList-backed Deque vs std::deque
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * The previous Deque forwarded every call to a LinkedList<T>, so it is
+ * measured here through LinkedList directly (baseline).
+ *
+ * Workloads per dataset:
+ * - push_back N elements
+ * - push_front N elements
+ * - Queue churn: N push_back + pop_front pairs at a steady size of 1000
+ * - Random access: RANDOM_ACCESSES reads of operator[] at random indices
+ * - Indexed scan: sum of operator[] over every index (skipped for the
+ *   linked list, which is O(n^2) there)
+ *
+ * Every workload runs ROUNDS times and the fastest run is reported, so no
+ * container pays for first-touch page faults the others skip.
+ *
+ * Datasets: 100K and 1M elements by default. Pass sizes on the command line
+ * to run other sizes, e.g. `benchmark_deque 10000000`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "linear/deque.hpp"
+#include "linear/linked_list.hpp"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <deque>
+#include <random>
+#include <cstdlib>
+#include <algorithm>
+
+using namespace benchmark;
+using namespace mylib::linear;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SIZES = {
+    100000,      // 100K
+    1000000      // 1M
+};
+
+const std::size_t RANDOM_ACCESSES = 1000;
+const std::size_t CHURN_WINDOW = 1000;
+const int ROUNDS = 3;
+
+using Value = long long;
+
+const std::string PREVIOUS = "LinkedList-backed (previous)";
+const std::string BLOCK_MAP = "Deque (block map)";
+const std::string STD_DEQUE = "std::deque";
+
+/**
+ * @brief Prevent the optimizer from discarding results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Workloads
+// ============================================
+
+/**
+ * @brief Fastest of ROUNDS runs of a timed workload
+ */
+template <typename Workload>
+double best_of(Workload&& workload) {
+    double best = workload();
+    for (int round = 1; round < ROUNDS; ++round) {
+        best = std::min(best, workload());
+    }
+    return best;
+}
+
+template <typename Container>
+double time_push_back(std::size_t n) {
+    Timer timer;
+    timer.start();
+    {
+        Container c;
+        for (std::size_t i = 0; i < n; ++i) {
+            c.push_back(static_cast<Value>(i));
+        }
+        g_sink = c.back();
+    }
+    timer.stop();
+    return timer.elapsed_ms();
+}
+
+template <typename Container>
+double time_push_front(std::size_t n) {
+    Timer timer;
+    timer.start();
+    {
+        Container c;
+        for (std::size_t i = 0; i < n; ++i) {
+            c.push_front(static_cast<Value>(i));
+        }
+        g_sink = c.front();
+    }
+    timer.stop();
+    return timer.elapsed_ms();
+}
+
+template <typename Container>
+double time_churn(std::size_t n) {
+    Container c;
+    for (std::size_t i = 0; i < CHURN_WINDOW; ++i) {
+        c.push_back(static_cast<Value>(i));
+    }
+    Timer timer;
+    timer.start();
+    for (std::size_t i = 0; i < n; ++i) {
+        c.push_back(static_cast<Value>(i));
+        c.pop_front();
+    }
+    timer.stop();
+    g_sink = c.front();
+    return timer.elapsed_ms();
+}
+
+template <typename Container>
+double time_random_access(const Container& c, const std::vector<std::size_t>& indices) {
+    long long sum = 0;
+    Timer timer;
+    timer.start();
+    for (std::size_t index : indices) {
+        sum += c[index];
+    }
+    timer.stop();
+    g_sink = sum;
+    return timer.elapsed_ms();
+}
+
+template <typename Container>
+double time_indexed_scan(const Container& c) {
+    long long sum = 0;
+    Timer timer;
+    timer.start();
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        sum += c[i];
+    }
+    timer.stop();
+    g_sink = sum;
+    return timer.elapsed_ms();
+}
+
+template <typename Container>
+Container filled(std::size_t n) {
+    Container c;
+    for (std::size_t i = 0; i < n; ++i) {
+        c.push_back(static_cast<Value>(i));
+    }
+    return c;
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = DEFAULT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Deque Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: LinkedList-backed Deque (previous), block-map Deque, std::deque" << std::endl;
+    std::cout << "Random accesses: " << RANDOM_ACCESSES << ", churn window: " << CHURN_WINDOW << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    using Previous = LinkedList<Value>;
+    using BlockMap = Deque<Value>;
+    using Std = std::deque<Value>;
+
+    for (std::size_t size : sizes) {
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Dataset Size: " << size << " elements" << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        std::vector<BenchmarkResult> results;
+
+        results = {
+            BenchmarkResult(PREVIOUS, size,
+                            best_of([size] { return time_push_back<Previous>(size); })),
+            BenchmarkResult(BLOCK_MAP, size,
+                            best_of([size] { return time_push_back<BlockMap>(size); })),
+            BenchmarkResult(STD_DEQUE, size,
+                            best_of([size] { return time_push_back<Std>(size); })),
+        };
+        ResultFormatter::print_section("push_back");
+        ResultFormatter::print_comparison_with_baseline(results, 0);
+
+        results = {
+            BenchmarkResult(PREVIOUS, size,
+                            best_of([size] { return time_push_front<Previous>(size); })),
+            BenchmarkResult(BLOCK_MAP, size,
+                            best_of([size] { return time_push_front<BlockMap>(size); })),
+            BenchmarkResult(STD_DEQUE, size,
+                            best_of([size] { return time_push_front<Std>(size); })),
+        };
+        ResultFormatter::print_section("push_front");
+        ResultFormatter::print_comparison_with_baseline(results, 0);
+
+        results = {
+            BenchmarkResult(PREVIOUS, size,
+                            best_of([size] { return time_churn<Previous>(size); })),
+            BenchmarkResult(BLOCK_MAP, size,
+                            best_of([size] { return time_churn<BlockMap>(size); })),
+            BenchmarkResult(STD_DEQUE, size,
+                            best_of([size] { return time_churn<Std>(size); })),
+        };
+        ResultFormatter::print_section("Queue churn (push_back + pop_front)");
+        ResultFormatter::print_comparison_with_baseline(results, 0);
+
+        std::mt19937_64 rng(42);
+        std::uniform_int_distribution<std::size_t> pick(0, size - 1);
+        std::vector<std::size_t> indices(RANDOM_ACCESSES);
+        for (std::size_t& index : indices) {
+            index = pick(rng);
+        }
+
+        Previous previous = filled<Previous>(size);
+        BlockMap block_map = filled<BlockMap>(size);
+        Std std_deque = filled<Std>(size);
+
+        results = {
+            BenchmarkResult(PREVIOUS, RANDOM_ACCESSES,
+                            best_of([&] { return time_random_access(previous, indices); })),
+            BenchmarkResult(BLOCK_MAP, RANDOM_ACCESSES,
+                            best_of([&] { return time_random_access(block_map, indices); })),
+            BenchmarkResult(STD_DEQUE, RANDOM_ACCESSES,
+                            best_of([&] { return time_random_access(std_deque, indices); })),
+        };
+        ResultFormatter::print_section("Random access (operator[])");
+        ResultFormatter::print_comparison_with_baseline(results, 0);
+
+        results = {
+            BenchmarkResult(BLOCK_MAP, size,
+                            best_of([&] { return time_indexed_scan(block_map); })),
+            BenchmarkResult(STD_DEQUE, size,
+                            best_of([&] { return time_indexed_scan(std_deque); })),
+        };
+        ResultFormatter::print_section("Indexed scan (block map vs std::deque)");
+        ResultFormatter::print_comparison_with_baseline(results, 0);
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,220 @@
+/**
+ * @file dynamic_array_allocation_benchmark.cpp
+ * @brief Allocation policies of DynamicArray (v2) on large numeric buffers
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * Contenders:
+ * - DynamicArray<T> (baseline): MallocAllocation, grows with realloc
+ * - std::vector<T>
+ * - DynamicArray<T, AlignedAllocation<64>>: 64-byte aligned, grows by copy
+ * - DynamicArray<T, HugePageAllocation<>>: mmap + MADV_HUGEPAGE from
+ *   2 MiB, grows with mremap
+ *
+ * Workloads:
+ * - Grow: push_back n uint64_t without reserve
+ * - Scan: sum n floats front to back (4 passes)
+ * - Random gather: sum 16M uint64_t at random positions (TLB-bound: one
+ *   page walk per access with 4 KiB pages once the array outgrows the TLB)
+ *
+ * Huge pages only apply when transparent huge pages are set to `always`
+ * or `madvise` (/sys/kernel/mm/transparent_hugepage/enabled).
+ *
+ * Datasets: 16M and 64M elements by default (best of ROUNDS runs). Pass
+ * counts on the command line to run other sizes, e.g.
+ * `benchmark_dynamic_array_allocation 134217728`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "linear/dynamic_array/dynamic_array.hpp"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <cstdint>
+#include <algorithm>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::linear;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SIZES = {
+    16 * 1024 * 1024,    // 16M
+    64 * 1024 * 1024     // 64M
+};
+
+const std::size_t GATHER_COUNT = 16 * 1024 * 1024;
+const int SCAN_PASSES = 4;
+const int ROUNDS = 3;
+
+/**
+ * @brief Prevent the optimizer from discarding results
+ */
+volatile double g_sink = 0;
+
+// ============================================
+// Workloads
+// ============================================
+
+/**
+ * @brief Fastest of ROUNDS runs of a timed workload
+ */
+template <typename Workload>
+double best_of(Workload&& workload) {
+    double best = workload();
+    for (int round = 1; round < ROUNDS; ++round) {
+        best = std::min(best, workload());
+    }
+    return best;
+}
+
+/**
+ * @brief push_back n elements into an empty array
+ */
+template <typename Array>
+double grow(std::size_t n) {
+    Timer timer;
+    timer.start();
+    Array arr;
+    for (std::size_t i = 0; i < n; ++i) {
+        arr.push_back(static_cast<std::uint64_t>(i));
+    }
+    timer.stop();
+    g_sink = static_cast<double>(arr[n / 2]);
+    return timer.elapsed_ms();
+}
+
+/**
+ * @brief SCAN_PASSES sequential sums over n floats
+ */
+template <typename Array>
+double scan(std::size_t n) {
+    Array arr;
+    arr.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        arr[i] = static_cast<float>(i & 1023);
+    }
+    Timer timer;
+    timer.start();
+    float total = 0;
+    for (int pass = 0; pass < SCAN_PASSES; ++pass) {
+        const float* data = arr.data();
+        float sum = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            sum += data[i];
+        }
+        total += sum;
+    }
+    timer.stop();
+    g_sink = total;
+    return timer.elapsed_ms();
+}
+
+/**
+ * @brief Sum GATHER_COUNT elements at precomputed random positions
+ */
+template <typename Array>
+double gather(std::size_t n, const std::vector<std::uint32_t>& positions) {
+    Array arr;
+    arr.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        arr[i] = static_cast<std::uint64_t>(i);
+    }
+    Timer timer;
+    timer.start();
+    std::uint64_t sum = 0;
+    for (std::uint32_t position : positions) {
+        sum += arr[position];
+    }
+    timer.stop();
+    g_sink = static_cast<double>(sum);
+    return timer.elapsed_ms();
+}
+
+template <typename T>
+using DefaultArray = DynamicArray<T>;
+
+template <typename T>
+using AlignedArray = DynamicArray<T, AlignedAllocation<64>>;
+
+template <typename T>
+using HugePageArray = DynamicArray<T, HugePageAllocation<>>;
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = DEFAULT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "DynamicArray Allocation Policy Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: malloc (default), std::vector, AlignedAllocation<64>, HugePageAllocation<>" << std::endl;
+    std::cout << "Workloads: grow, sequential scan, random gather" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    for (std::size_t size : sizes) {
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Elements: " << size << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        using U64 = std::uint64_t;
+        std::vector<BenchmarkResult> grow_results = {
+            BenchmarkResult("DynamicArray (malloc)", size, best_of([&] { return grow<DefaultArray<U64>>(size); })),
+            BenchmarkResult("std::vector", size, best_of([&] { return grow<std::vector<U64>>(size); })),
+            BenchmarkResult("AlignedAllocation<64>", size, best_of([&] { return grow<AlignedArray<U64>>(size); })),
+            BenchmarkResult("HugePageAllocation<>", size, best_of([&] { return grow<HugePageArray<U64>>(size); })),
+        };
+        ResultFormatter::print_section("Grow: push_back uint64_t without reserve");
+        ResultFormatter::print_comparison_with_baseline(grow_results, 0);
+
+        std::size_t scanned = size * SCAN_PASSES;
+        std::vector<BenchmarkResult> scan_results = {
+            BenchmarkResult("DynamicArray (malloc)", scanned, best_of([&] { return scan<DefaultArray<float>>(size); })),
+            BenchmarkResult("std::vector", scanned, best_of([&] { return scan<std::vector<float>>(size); })),
+            BenchmarkResult("AlignedAllocation<64>", scanned, best_of([&] { return scan<AlignedArray<float>>(size); })),
+            BenchmarkResult("HugePageAllocation<>", scanned, best_of([&] { return scan<HugePageArray<float>>(size); })),
+        };
+        ResultFormatter::print_section("Scan: sum floats");
+        ResultFormatter::print_comparison_with_baseline(scan_results, 0);
+
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<std::uint32_t> dist(0, static_cast<std::uint32_t>(size - 1));
+        std::vector<std::uint32_t> positions(GATHER_COUNT);
+        for (std::uint32_t& position : positions) {
+            position = dist(rng);
+        }
+        std::vector<BenchmarkResult> gather_results = {
+            BenchmarkResult("DynamicArray (malloc)", GATHER_COUNT,
+                            best_of([&] { return gather<DefaultArray<U64>>(size, positions); })),
+            BenchmarkResult("std::vector", GATHER_COUNT,
+                            best_of([&] { return gather<std::vector<U64>>(size, positions); })),
+            BenchmarkResult("AlignedAllocation<64>", GATHER_COUNT,
+                            best_of([&] { return gather<AlignedArray<U64>>(size, positions); })),
+            BenchmarkResult("HugePageAllocation<>", GATHER_COUNT,
+                            best_of([&] { return gather<HugePageArray<U64>>(size, positions); })),
+        };
+        ResultFormatter::print_section("Random gather: uint64_t");
+        ResultFormatter::print_comparison_with_baseline(gather_results, 0);
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,229 @@
+/**
+ * @file dynamic_array_ingest_benchmark.cpp
+ * @brief Filling a DynamicArray (v2) from packet buffers
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * Copies n bytes into an array in packet-sized chunks, the way a network
+ * reader fills its receive buffer.
+ *
+ * Contenders:
+ * - push_back loop (baseline): one capacity check per byte
+ * - resize + memcpy: value-initializes (zeroes) every byte before the copy
+ * - append(data, count): reserves once per chunk, then one memcpy
+ * - resize_uninitialized + memcpy: what a recv() into data() + old size does
+ * - std::vector::insert(end, first, last)
+ *
+ * Workloads:
+ * - Fresh buffer: starts empty, so growth is included
+ * - Reserved buffer: capacity for all n bytes up front, so only the copy
+ *   (and any zeroing) is measured
+ *
+ * Chunk sizes: 64 B (small messages) and 1500 B (Ethernet MTU)
+ *
+ * Datasets: 16M and 64M bytes by default (best of ROUNDS runs). Pass
+ * counts on the command line to run other sizes, e.g.
+ * `benchmark_dynamic_array_ingest 268435456`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "linear/dynamic_array/dynamic_array.hpp"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::linear;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SIZES = {
+    16 * 1024 * 1024,    // 16M
+    64 * 1024 * 1024     // 64M
+};
+
+const std::size_t PACKET_POOL_SIZE = 1 << 16;
+const int ROUNDS = 3;
+
+/**
+ * @brief Prevent the optimizer from discarding results
+ */
+volatile long long g_sink = 0;
+
+using Byte = std::uint8_t;
+
+// ============================================
+// Ingest Strategies
+// ============================================
+
+struct PushBackLoop {
+    static void ingest(DynamicArray<Byte>& buffer, const Byte* data, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            buffer.push_back(data[i]);
+        }
+    }
+};
+
+struct ResizeThenCopy {
+    static void ingest(DynamicArray<Byte>& buffer, const Byte* data, std::size_t count) {
+        std::size_t old_size = buffer.size();
+        buffer.resize(old_size + count);
+        std::memcpy(buffer.data() + old_size, data, count);
+    }
+};
+
+struct Append {
+    static void ingest(DynamicArray<Byte>& buffer, const Byte* data, std::size_t count) {
+        buffer.append(data, count);
+    }
+};
+
+struct ResizeUninitialized {
+    static void ingest(DynamicArray<Byte>& buffer, const Byte* data, std::size_t count) {
+        std::size_t old_size = buffer.size();
+        buffer.resize_uninitialized(old_size + count);
+        std::memcpy(buffer.data() + old_size, data, count);
+    }
+};
+
+struct VectorInsert {
+    static void ingest(std::vector<Byte>& buffer, const Byte* data, std::size_t count) {
+        buffer.insert(buffer.end(), data, data + count);
+    }
+};
+
+// ============================================
+// Workloads
+// ============================================
+
+/**
+ * @brief Fastest of ROUNDS runs of a timed workload
+ */
+template <typename Workload>
+double best_of(Workload&& workload) {
+    double best = workload();
+    for (int round = 1; round < ROUNDS; ++round) {
+        best = std::min(best, workload());
+    }
+    return best;
+}
+
+/**
+ * @brief Copy n bytes into buffer in chunk-sized pieces of the packet pool
+ */
+template <typename Strategy, typename Buffer>
+double ingest(Buffer& buffer, const std::vector<Byte>& pool, std::size_t n, std::size_t chunk) {
+    Timer timer;
+    timer.start();
+    std::size_t offset = 0;
+    for (std::size_t done = 0; done < n; done += chunk) {
+        std::size_t count = std::min(chunk, n - done);
+        if (offset + count > pool.size()) {
+            offset = 0;
+        }
+        Strategy::ingest(buffer, pool.data() + offset, count);
+        offset += count;
+    }
+    timer.stop();
+    g_sink = buffer[n / 2];
+    return timer.elapsed_ms();
+}
+
+/**
+ * @brief Ingest into a new, empty buffer
+ */
+template <typename Strategy, typename Buffer>
+struct Fresh {
+    static double time(const std::vector<Byte>& pool, std::size_t n, std::size_t chunk) {
+        Buffer buffer;
+        return ingest<Strategy>(buffer, pool, n, chunk);
+    }
+};
+
+/**
+ * @brief Ingest into a buffer that already has capacity for n bytes
+ */
+template <typename Strategy, typename Buffer>
+struct Reserved {
+    static double time(const std::vector<Byte>& pool, std::size_t n, std::size_t chunk) {
+        Buffer buffer;
+        buffer.reserve(n);
+        return ingest<Strategy>(buffer, pool, n, chunk);
+    }
+};
+
+template <template <typename, typename> class Run>
+std::vector<BenchmarkResult> run_all(const std::vector<Byte>& pool, std::size_t n, std::size_t chunk) {
+    using Array = DynamicArray<Byte>;
+    return {
+        BenchmarkResult("push_back loop", n,
+                        best_of([&] { return Run<PushBackLoop, Array>::time(pool, n, chunk); })),
+        BenchmarkResult("resize + memcpy", n,
+                        best_of([&] { return Run<ResizeThenCopy, Array>::time(pool, n, chunk); })),
+        BenchmarkResult("append(data, count)", n,
+                        best_of([&] { return Run<Append, Array>::time(pool, n, chunk); })),
+        BenchmarkResult("resize_uninitialized + memcpy", n,
+                        best_of([&] { return Run<ResizeUninitialized, Array>::time(pool, n, chunk); })),
+        BenchmarkResult("std::vector::insert", n,
+                        best_of([&] { return Run<VectorInsert, std::vector<Byte>>::time(pool, n, chunk); })),
+    };
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = DEFAULT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "DynamicArray Ingest Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: push_back loop, resize + memcpy, append, resize_uninitialized, std::vector" << std::endl;
+    std::cout << "Workload: copy n bytes in packet-sized chunks" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::vector<Byte> pool(PACKET_POOL_SIZE);
+    for (std::size_t i = 0; i < pool.size(); ++i) {
+        pool[i] = static_cast<Byte>(i * 31 + 7);
+    }
+
+    const std::size_t chunks[] = {64, 1500};
+
+    for (std::size_t size : sizes) {
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Bytes: " << size << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        for (std::size_t chunk : chunks) {
+            std::string suffix = " (" + std::to_string(chunk) + " B chunks)";
+
+            ResultFormatter::print_section("Fresh buffer" + suffix);
+            ResultFormatter::print_comparison_with_baseline(run_all<Fresh>(pool, size, chunk), 0);
+
+            ResultFormatter::print_section("Reserved buffer" + suffix);
+            ResultFormatter::print_comparison_with_baseline(run_all<Reserved>(pool, size, chunk), 0);
+        }
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
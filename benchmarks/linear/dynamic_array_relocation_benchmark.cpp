@@ -0,0 +1,256 @@
+/**
+ * @file dynamic_array_relocation_benchmark.cpp
+ * @brief Trivially-relocatable fast path of DynamicArray (v2)
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * DynamicArray relocates is_trivially_relocatable elements with
+ * realloc/memcpy/memmove instead of a move-construct + destroy per element.
+ * To measure that path alone, the baseline stores the same payload in
+ * Opaque<T>, a wrapper with a user-provided move constructor: identical
+ * layout, but the trait is false, so every relocation goes element by
+ * element.
+ *
+ * Contenders (per element type):
+ * - DynamicArray<Opaque<T>> (baseline): element-wise relocation
+ * - std::vector<T>
+ * - DynamicArray<T>: trait fast path where it applies
+ *
+ * Element types:
+ * - int
+ * - std::unique_ptr<int> (specialized as trivially relocatable)
+ * - std::string (not relocatable in libstdc++: the short-string buffer
+ *   is referenced by its own data pointer, so both DynamicArray rows
+ *   take the element-wise path and should match)
+ *
+ * Workloads (elements are built before the timer starts and moved in):
+ * - Grow: push_back n elements without reserve
+ * - Middle insert/erase: n / 100 insert-then-erase pairs at the middle of
+ *   a 1000-element array
+ *
+ * Datasets: 1M and 5M elements by default (best of ROUNDS runs). Pass
+ * counts on the command line to run other sizes, e.g.
+ * `benchmark_dynamic_array_relocation 20000000`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "linear/dynamic_array/dynamic_array.hpp"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <algorithm>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::linear;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SIZES = {
+    1000000,     // 1M
+    5000000      // 5M
+};
+
+const std::size_t SHIFT_ARRAY_SIZE = 1000;
+const int ROUNDS = 3;
+
+/**
+ * @brief Prevent the optimizer from discarding results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Element Types
+// ============================================
+
+/**
+ * @brief Same payload as T, but hides its relocatability
+ */
+template <typename T>
+struct Opaque {
+    T value;
+
+    explicit Opaque(T v) noexcept : value(std::move(v)) {}
+    Opaque(Opaque&& other) noexcept : value(std::move(other.value)) {}
+    Opaque& operator=(Opaque&& other) noexcept {
+        value = std::move(other.value);
+        return *this;
+    }
+};
+
+static_assert(!is_trivially_relocatable_v<Opaque<int>>, "baseline must take the slow path");
+
+long long weight(int value) { return value; }
+long long weight(const std::unique_ptr<int>& value) { return *value; }
+long long weight(const std::string& value) { return static_cast<long long>(value.size()); }
+
+template <typename T>
+long long weight(const Opaque<T>& value) { return weight(value.value); }
+
+/**
+ * @brief Element number i of the given type
+ */
+template <typename T>
+struct Make;
+
+template <>
+struct Make<int> {
+    static int of(std::size_t i) { return static_cast<int>(i); }
+};
+
+template <>
+struct Make<std::unique_ptr<int>> {
+    static std::unique_ptr<int> of(std::size_t i) {
+        return std::make_unique<int>(static_cast<int>(i));
+    }
+};
+
+template <>
+struct Make<std::string> {
+    // Longer than the short-string buffer, like most real payloads
+    static std::string of(std::size_t i) { return std::string(24 + i % 8, 'x'); }
+};
+
+template <typename T>
+struct Make<Opaque<T>> {
+    static Opaque<T> of(std::size_t i) { return Opaque<T>(Make<T>::of(i)); }
+};
+
+// ============================================
+// Workloads
+// ============================================
+
+/**
+ * @brief Fastest of ROUNDS runs of a timed workload
+ */
+template <typename Workload>
+double best_of(Workload&& workload) {
+    double best = workload();
+    for (int round = 1; round < ROUNDS; ++round) {
+        best = std::min(best, workload());
+    }
+    return best;
+}
+
+/**
+ * @brief Elements 0..n-1, built before timing so only the container is measured
+ */
+template <typename Value>
+std::vector<Value> make_source(std::size_t n) {
+    std::vector<Value> source;
+    source.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        source.push_back(Make<Value>::of(i));
+    }
+    return source;
+}
+
+/**
+ * @brief push_back n elements (moved in) into an array that starts empty
+ */
+template <typename Array>
+double grow(std::size_t n) {
+    using Value = typename Array::value_type;
+    std::vector<Value> source = make_source<Value>(n);
+    Timer timer;
+    timer.start();
+    Array arr;
+    for (std::size_t i = 0; i < n; ++i) {
+        arr.push_back(std::move(source[i]));
+    }
+    timer.stop();
+    g_sink = weight(arr[n / 2]);
+    return timer.elapsed_ms();
+}
+
+/**
+ * @brief ops insert + erase pairs at the middle of a fixed-size array
+ */
+template <typename Array>
+double middle_insert_erase(std::size_t ops) {
+    using Value = typename Array::value_type;
+    Array arr;
+    for (std::size_t i = 0; i < SHIFT_ARRAY_SIZE; ++i) {
+        arr.push_back(Make<Value>::of(i));
+    }
+    std::vector<Value> source = make_source<Value>(ops);
+    Timer timer;
+    timer.start();
+    for (std::size_t i = 0; i < ops; ++i) {
+        arr.insert(arr.begin() + SHIFT_ARRAY_SIZE / 2, std::move(source[i]));
+        arr.erase(arr.begin() + SHIFT_ARRAY_SIZE / 3);
+    }
+    timer.stop();
+    g_sink = weight(arr[SHIFT_ARRAY_SIZE / 2]);
+    return timer.elapsed_ms();
+}
+
+template <typename T>
+void run_type(const char* type_name, std::size_t size) {
+    std::string opaque_name = std::string("DynamicArray<Opaque<") + type_name + ">>";
+    std::string vector_name = std::string("std::vector<") + type_name + ">";
+    std::string array_name = std::string("DynamicArray<") + type_name + ">";
+
+    std::vector<BenchmarkResult> grow_results = {
+        BenchmarkResult(opaque_name, size, best_of([&] { return grow<DynamicArray<Opaque<T>>>(size); })),
+        BenchmarkResult(vector_name, size, best_of([&] { return grow<std::vector<T>>(size); })),
+        BenchmarkResult(array_name, size, best_of([&] { return grow<DynamicArray<T>>(size); })),
+    };
+    ResultFormatter::print_section(std::string("Grow: ") + type_name);
+    ResultFormatter::print_comparison_with_baseline(grow_results, 0);
+
+    std::size_t ops = size / 100;
+    std::vector<BenchmarkResult> shift_results = {
+        BenchmarkResult(opaque_name, ops,
+                        best_of([&] { return middle_insert_erase<DynamicArray<Opaque<T>>>(ops); })),
+        BenchmarkResult(vector_name, ops,
+                        best_of([&] { return middle_insert_erase<std::vector<T>>(ops); })),
+        BenchmarkResult(array_name, ops,
+                        best_of([&] { return middle_insert_erase<DynamicArray<T>>(ops); })),
+    };
+    ResultFormatter::print_section(std::string("Middle insert/erase: ") + type_name);
+    ResultFormatter::print_comparison_with_baseline(shift_results, 0);
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = DEFAULT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "DynamicArray Relocation Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: element-wise relocation, std::vector, trivially-relocatable path" << std::endl;
+    std::cout << "Workloads: grow without reserve, middle insert/erase" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    for (std::size_t size : sizes) {
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Elements: " << size << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        run_type<int>("int", size);
+        run_type<std::unique_ptr<int>>("unique_ptr<int>", size);
+        run_type<std::string>("string", size);
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
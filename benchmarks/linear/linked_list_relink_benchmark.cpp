@@ -0,0 +1,267 @@
+/**
+ * @file linked_list_relink_benchmark.cpp
+ * @brief Relinking operations: LinkedList::sort and LRU touches with
+ *        LinkedList, std::list and IntrusiveList
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * Sort contenders:
+ * - Copy out, std::sort, rebuild (baseline): what callers did before
+ *   LinkedList had sort()
+ * - LinkedList::sort(): bottom-up merge sort relinking nodes
+ * - std::list::sort()
+ *
+ * LRU contenders (touch = move an entry to the front):
+ * - LinkedList<int> by index (baseline): erase(find(id)) + push_front, the
+ *   only way without iterators
+ * - LinkedList<int> splice: splice(begin(), list, it) with stored iterators
+ * - std::list<Object> splice: 256-byte objects stored in the list nodes
+ * - IntrusiveList<Object>: objects in an array, splice(begin(), list,
+ *   iterator_to(object)); no allocation at all
+ *
+ * Datasets: sort of 100K and 1M long long; LRU of 1K and 10K entries with
+ * TOUCH_COUNT random touches (best of ROUNDS runs). Pass element counts on
+ * the command line to run other sort sizes, e.g.
+ * `benchmark_linked_list_relink 4000000`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "linear/linked_list.hpp"
+#include "linear/intrusive_list.hpp"
+
+#include <iostream>
+#include <vector>
+#include <list>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <iterator>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::linear;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SORT_SIZES = {
+    100000,    // 100K
+    1000000    // 1M
+};
+
+const std::vector<std::size_t> LRU_SIZES = {
+    1000,      // 1K
+    10000      // 10K
+};
+
+const std::size_t TOUCH_COUNT = 20000;
+const int ROUNDS = 3;
+
+/**
+ * @brief Prevent the optimizer from discarding results
+ */
+volatile long long g_sink = 0;
+
+/**
+ * @struct Object
+ * @brief Cached object of 256 bytes, linkable into an IntrusiveList
+ */
+struct Object : IntrusiveListHook<> {
+    int id = 0;
+    char payload[256 - sizeof(IntrusiveListHook<>) - sizeof(int)] = {};
+};
+
+// ============================================
+// Workloads
+// ============================================
+
+/**
+ * @brief Fastest of ROUNDS runs of a timed workload
+ */
+template <typename Workload>
+double best_of(Workload&& workload) {
+    double best = workload();
+    for (int round = 1; round < ROUNDS; ++round) {
+        best = std::min(best, workload());
+    }
+    return best;
+}
+
+template <typename List>
+void fill_random(List& list, const std::vector<long long>& values) {
+    for (long long value : values) {
+        list.push_back(value);
+    }
+}
+
+double sort_by_copy(const std::vector<long long>& values) {
+    LinkedList<long long> list;
+    fill_random(list, values);
+    Timer timer;
+    timer.start();
+    std::vector<long long> buffer(list.begin(), list.end());
+    std::sort(buffer.begin(), buffer.end());
+    LinkedList<long long> rebuilt;
+    for (long long value : buffer) {
+        rebuilt.push_back(value);
+    }
+    list = std::move(rebuilt);
+    timer.stop();
+    g_sink = list.front();
+    return timer.elapsed_ms();
+}
+
+template <typename List>
+double sort_in_place(const std::vector<long long>& values) {
+    List list;
+    fill_random(list, values);
+    Timer timer;
+    timer.start();
+    list.sort();
+    timer.stop();
+    g_sink = list.front();
+    return timer.elapsed_ms();
+}
+
+double lru_by_index(std::size_t n, const std::vector<int>& touches) {
+    LinkedList<int> lru;
+    for (std::size_t i = 0; i < n; ++i) {
+        lru.push_front(static_cast<int>(i));
+    }
+    Timer timer;
+    timer.start();
+    for (int id : touches) {
+        lru.erase(lru.find(id));
+        lru.push_front(id);
+    }
+    timer.stop();
+    g_sink = lru.front();
+    return timer.elapsed_ms();
+}
+
+double lru_linked_list_splice(std::size_t n, const std::vector<int>& touches) {
+    LinkedList<int> lru;
+    std::vector<LinkedList<int>::iterator> where(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        lru.push_front(static_cast<int>(i));
+        where[i] = lru.begin();
+    }
+    Timer timer;
+    timer.start();
+    for (int id : touches) {
+        lru.splice(lru.begin(), lru, where[id]);
+    }
+    timer.stop();
+    g_sink = lru.front();
+    return timer.elapsed_ms();
+}
+
+double lru_std_list_splice(std::size_t n, const std::vector<int>& touches) {
+    std::list<Object> lru;
+    std::vector<std::list<Object>::iterator> where(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        lru.emplace_front();
+        lru.front().id = static_cast<int>(i);
+        where[i] = lru.begin();
+    }
+    Timer timer;
+    timer.start();
+    for (int id : touches) {
+        lru.splice(lru.begin(), lru, where[id]);
+    }
+    timer.stop();
+    g_sink = lru.front().id;
+    return timer.elapsed_ms();
+}
+
+double lru_intrusive(std::size_t n, const std::vector<int>& touches) {
+    std::vector<Object> objects(n);
+    IntrusiveList<Object> lru;
+    for (std::size_t i = 0; i < n; ++i) {
+        objects[i].id = static_cast<int>(i);
+        lru.push_front(objects[i]);
+    }
+    Timer timer;
+    timer.start();
+    for (int id : touches) {
+        lru.splice(lru.begin(), lru, lru.iterator_to(objects[id]));
+    }
+    timer.stop();
+    g_sink = lru.front().id;
+    return timer.elapsed_ms();
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sort_sizes;
+    for (int i = 1; i < argc; ++i) {
+        sort_sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sort_sizes.empty()) {
+        sort_sizes = DEFAULT_SORT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Linked List Relink Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Sort: copy-out + std::sort vs LinkedList::sort vs std::list::sort" << std::endl;
+    std::cout << "LRU touch: LinkedList by index / splice, std::list splice, IntrusiveList" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::mt19937_64 rng(42);
+    for (std::size_t size : sort_sizes) {
+        std::vector<long long> values(size);
+        for (long long& value : values) {
+            value = static_cast<long long>(rng() >> 1);
+        }
+
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Sort elements: " << size << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        ResultFormatter::print_section("Sort: random long long");
+        ResultFormatter::print_comparison_with_baseline({
+            BenchmarkResult("Copy out, std::sort, rebuild", size, best_of([&] { return sort_by_copy(values); })),
+            BenchmarkResult("LinkedList::sort", size,
+                            best_of([&] { return sort_in_place<LinkedList<long long>>(values); })),
+            BenchmarkResult("std::list::sort", size,
+                            best_of([&] { return sort_in_place<std::list<long long>>(values); })),
+        }, 0);
+    }
+
+    for (std::size_t size : LRU_SIZES) {
+        std::uniform_int_distribution<int> dist(0, static_cast<int>(size) - 1);
+        std::vector<int> touches(TOUCH_COUNT);
+        for (int& id : touches) {
+            id = dist(rng);
+        }
+
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "LRU entries: " << size << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        ResultFormatter::print_section("LRU touch: move a random entry to the front");
+        ResultFormatter::print_comparison_with_baseline({
+            BenchmarkResult("LinkedList erase(find) + push_front", TOUCH_COUNT,
+                            best_of([&] { return lru_by_index(size, touches); })),
+            BenchmarkResult("LinkedList splice", TOUCH_COUNT,
+                            best_of([&] { return lru_linked_list_splice(size, touches); })),
+            BenchmarkResult("std::list<Object> splice", TOUCH_COUNT,
+                            best_of([&] { return lru_std_list_splice(size, touches); })),
+            BenchmarkResult("IntrusiveList<Object>", TOUCH_COUNT,
+                            best_of([&] { return lru_intrusive(size, touches); })),
+        }, 0);
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
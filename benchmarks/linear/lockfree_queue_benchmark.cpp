@@ -0,0 +1,355 @@
+/**
+ * @file lockfree_queue_benchmark.cpp
+ * @brief Throughput and latency of SpscQueue / MpmcQueue vs a mutex-guarded Queue
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * Contenders (all bounded to CAPACITY elements):
+ * - Mutex + Queue (baseline): bounded Queue behind one std::mutex
+ * - SpscQueue: single producer / single consumer only
+ * - MpmcQueue
+ *
+ * Each is run with single-element try_push/try_pop and with batches of up
+ * to BATCH elements (the mutex baseline then takes the lock once per batch).
+ *
+ * Workloads (best of ROUNDS runs):
+ * - Throughput: P producers push N items in total while C consumers pop
+ *   them, for P x C in THREAD_CONFIGS. Reported as items per second.
+ * - Latency: two threads bounce one token through a pair of queues
+ *   PING_PONGS times. Reported as round trips per second (the inverse is
+ *   the round-trip latency).
+ *
+ * A thread that finds its queue full or empty yields, so the numbers stay
+ * meaningful when there are fewer cores than threads. On a single core the
+ * scheduler, not the queue, dominates cross-thread hand-off; compare
+ * contenders against each other rather than across machines.
+ *
+ * Datasets: 1M and 10M items by default. Pass sizes on the command line to
+ * run other sizes, e.g. `benchmark_lockfree_queue 50000000`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "linear/lockfree_queue.hpp"
+#include "linear/queue.hpp"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::linear;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SIZES = {
+    1000000,     // 1M
+    10000000     // 10M
+};
+
+struct ThreadConfig {
+    int producers;
+    int consumers;
+};
+
+const std::vector<ThreadConfig> THREAD_CONFIGS = {{1, 1}, {2, 2}, {4, 4}};
+
+const std::size_t CAPACITY = 1024;
+const std::size_t BATCH = 32;
+const std::size_t PING_PONGS = 100000;
+const int ROUNDS = 3;
+
+using Item = long long;
+
+/**
+ * @brief Prevent the optimizer from discarding results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Adapters (uniform push / pop interface)
+// ============================================
+
+struct LockedQueue {
+    std::mutex mutex;
+    Queue<Item> queue = Queue<Item>::bounded(CAPACITY);
+
+    bool push(Item item) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return queue.try_push(item);
+    }
+    std::size_t push_batch(const Item* items, std::size_t count) {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::size_t n = 0;
+        while (n < count && queue.try_push(items[n])) {
+            ++n;
+        }
+        return n;
+    }
+    std::size_t pop_batch(Item* out, std::size_t max_count) {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::size_t n = 0;
+        while (n < max_count && queue.try_pop(out[n])) {
+            ++n;
+        }
+        return n;
+    }
+    bool pop(Item& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return queue.try_pop(out);
+    }
+};
+
+template <typename LockFree>
+struct LockFreeAdapter {
+    LockFree queue{CAPACITY};
+    bool push(Item item) { return queue.try_push(item); }
+    bool pop(Item& out) { return queue.try_pop(out); }
+    std::size_t push_batch(const Item* items, std::size_t count) {
+        return queue.try_push_batch(items, count);
+    }
+    std::size_t pop_batch(Item* out, std::size_t max_count) {
+        return queue.try_pop_batch(out, max_count);
+    }
+};
+
+using Spsc = LockFreeAdapter<SpscQueue<Item>>;
+using Mpmc = LockFreeAdapter<MpmcQueue<Item>>;
+
+// ============================================
+// Workloads
+// ============================================
+
+/**
+ * @brief Fastest of ROUNDS runs of a timed workload
+ */
+template <typename Workload>
+double best_of(Workload&& workload) {
+    double best = workload();
+    for (int round = 1; round < ROUNDS; ++round) {
+        best = std::min(best, workload());
+    }
+    return best;
+}
+
+/**
+ * @brief Items [begin, end) for one producer
+ */
+template <typename Q>
+void produce_single(Q& q, std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end;) {
+        if (q.push(static_cast<Item>(i))) {
+            ++i;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+template <typename Q>
+void produce_batch(Q& q, std::size_t begin, std::size_t end) {
+    Item batch[BATCH];
+    for (std::size_t i = begin; i < end;) {
+        std::size_t n = std::min(BATCH, end - i);
+        for (std::size_t k = 0; k < n; ++k) {
+            batch[k] = static_cast<Item>(i + k);
+        }
+        std::size_t pushed = q.push_batch(batch, n);
+        i += pushed;
+        if (pushed == 0) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+template <typename Q>
+std::size_t consume_single(Q& q, long long& sum) {
+    Item item;
+    if (!q.pop(item)) {
+        return 0;
+    }
+    sum += item;
+    return 1;
+}
+
+template <typename Q>
+std::size_t consume_batch(Q& q, long long& sum) {
+    Item buffer[BATCH];
+    std::size_t n = q.pop_batch(buffer, BATCH);
+    for (std::size_t k = 0; k < n; ++k) {
+        sum += buffer[k];
+    }
+    return n;
+}
+
+/**
+ * @brief P producers and C consumers move n items through one queue
+ */
+template <typename Q, bool Batched>
+double throughput(std::size_t n, ThreadConfig config) {
+    Q q;
+    std::atomic<bool> go{false};
+    std::atomic<std::size_t> consumed{0};
+    std::atomic<long long> total_sum{0};
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < config.producers; ++p) {
+        std::size_t begin = n * p / config.producers;
+        std::size_t end = n * (p + 1) / config.producers;
+        threads.emplace_back([&, begin, end]() {
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            if constexpr (Batched) {
+                produce_batch(q, begin, end);
+            } else {
+                produce_single(q, begin, end);
+            }
+        });
+    }
+    for (int c = 0; c < config.consumers; ++c) {
+        threads.emplace_back([&]() {
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            long long sum = 0;
+            while (consumed.load(std::memory_order_relaxed) < n) {
+                std::size_t got;
+                if constexpr (Batched) {
+                    got = consume_batch(q, sum);
+                } else {
+                    got = consume_single(q, sum);
+                }
+                if (got == 0) {
+                    std::this_thread::yield();
+                } else {
+                    consumed.fetch_add(got, std::memory_order_relaxed);
+                }
+            }
+            total_sum.fetch_add(sum);
+        });
+    }
+
+    Timer timer;
+    timer.start();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    timer.stop();
+    g_sink = total_sum.load();
+    return timer.elapsed_ms();
+}
+
+/**
+ * @brief Bounce a token between two threads through two queues
+ */
+template <typename Q>
+double ping_pong(std::size_t round_trips) {
+    Q to_echo;
+    Q to_main;
+    std::thread echo([&]() {
+        Item item;
+        for (std::size_t i = 0; i < round_trips; ++i) {
+            while (!to_echo.pop(item)) {
+                std::this_thread::yield();
+            }
+            while (!to_main.push(item + 1)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    Item token = 0;
+    Timer timer;
+    timer.start();
+    for (std::size_t i = 0; i < round_trips; ++i) {
+        while (!to_echo.push(token)) {
+            std::this_thread::yield();
+        }
+        while (!to_main.pop(token)) {
+            std::this_thread::yield();
+        }
+    }
+    timer.stop();
+    echo.join();
+    g_sink = token;
+    return timer.elapsed_ms();
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = DEFAULT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Lock-free Queue Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: mutex + bounded Queue, SpscQueue, MpmcQueue (single and batch)" << std::endl;
+    std::cout << "Capacity: " << CAPACITY << ", batch: " << BATCH << std::endl;
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::vector<BenchmarkResult> results = {
+        BenchmarkResult("Mutex + Queue", PING_PONGS,
+                        best_of([] { return ping_pong<LockedQueue>(PING_PONGS); })),
+        BenchmarkResult("SpscQueue", PING_PONGS,
+                        best_of([] { return ping_pong<Spsc>(PING_PONGS); })),
+        BenchmarkResult("MpmcQueue", PING_PONGS,
+                        best_of([] { return ping_pong<Mpmc>(PING_PONGS); })),
+    };
+    ResultFormatter::print_section("Latency (ping-pong round trips)");
+    ResultFormatter::print_comparison_with_baseline(results, 0);
+
+    for (std::size_t size : sizes) {
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Items: " << size << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        for (ThreadConfig config : THREAD_CONFIGS) {
+            results = {
+                BenchmarkResult("Mutex + Queue", size,
+                                best_of([&] { return throughput<LockedQueue, false>(size, config); })),
+                BenchmarkResult("Mutex + Queue (batch)", size,
+                                best_of([&] { return throughput<LockedQueue, true>(size, config); })),
+            };
+            if (config.producers == 1 && config.consumers == 1) {
+                results.emplace_back("SpscQueue", size,
+                                     best_of([&] { return throughput<Spsc, false>(size, config); }));
+                results.emplace_back("SpscQueue (batch)", size,
+                                     best_of([&] { return throughput<Spsc, true>(size, config); }));
+            }
+            results.emplace_back("MpmcQueue", size,
+                                 best_of([&] { return throughput<Mpmc, false>(size, config); }));
+            results.emplace_back("MpmcQueue (batch)", size,
+                                 best_of([&] { return throughput<Mpmc, true>(size, config); }));
+
+            ResultFormatter::print_section("Throughput: " + std::to_string(config.producers) +
+                                           " producer(s) x " + std::to_string(config.consumers) +
+                                           " consumer(s)");
+            ResultFormatter::print_comparison_with_baseline(results, 0);
+        }
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,221 @@
+/**
+ * @file queue_benchmark.cpp
+ * @brief Throughput of the circular-buffer Queue vs the previous LinkedList-backed Queue
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * The previous Queue forwarded push/pop to LinkedList::push_back/pop_front,
+ * so it is measured here through LinkedList directly (baseline).
+ *
+ * Contenders:
+ * - LinkedList-backed (previous): one node allocation per push
+ * - Queue (unbounded): circular buffer doubling on demand
+ * - Queue (bounded): fixed capacity, try_push/try_pop, no allocation
+ * - std::queue (std::deque underneath), for reference
+ *
+ * Workloads (N operations each, best of ROUNDS runs):
+ * - Fill then drain: N pushes followed by N pops
+ * - Event loop: a backlog of EVENT_BACKLOG items, then N push + pop pairs
+ *
+ * Results are reported as push/pop operations per second.
+ *
+ * Datasets: 1M and 10M operations by default. Pass sizes on the command
+ * line to run other sizes, e.g. `benchmark_queue 50000000`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "linear/queue.hpp"
+#include "linear/linked_list.hpp"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <queue>
+#include <algorithm>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::linear;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SIZES = {
+    1000000,     // 1M
+    10000000     // 10M
+};
+
+const std::size_t EVENT_BACKLOG = 1024;
+const int ROUNDS = 3;
+
+using Event = long long;
+
+/**
+ * @brief Prevent the optimizer from discarding results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Adapters (uniform push / pop-into interface)
+// ============================================
+
+struct PreviousQueue {
+    LinkedList<Event> list;
+    bool push(Event e) { list.push_back(e); return true; }
+    bool pop(Event& out) {
+        if (list.empty()) return false;
+        out = list.front();
+        list.pop_front();
+        return true;
+    }
+};
+
+struct UnboundedQueue {
+    Queue<Event> queue;
+    bool push(Event e) { queue.push(e); return true; }
+    bool pop(Event& out) { return queue.try_pop(out); }
+};
+
+struct BoundedQueue {
+    Queue<Event> queue;
+    explicit BoundedQueue(std::size_t capacity) : queue(Queue<Event>::bounded(capacity)) {}
+    bool push(Event e) { return queue.try_push(e); }
+    bool pop(Event& out) { return queue.try_pop(out); }
+};
+
+struct StdQueue {
+    std::queue<Event> queue;
+    bool push(Event e) { queue.push(e); return true; }
+    bool pop(Event& out) {
+        if (queue.empty()) return false;
+        out = queue.front();
+        queue.pop();
+        return true;
+    }
+};
+
+// ============================================
+// Workloads
+// ============================================
+
+/**
+ * @brief Fastest of ROUNDS runs of a timed workload
+ */
+template <typename Workload>
+double best_of(Workload&& workload) {
+    double best = workload();
+    for (int round = 1; round < ROUNDS; ++round) {
+        best = std::min(best, workload());
+    }
+    return best;
+}
+
+template <typename Q, typename Make>
+double fill_then_drain(std::size_t n, Make make) {
+    Q q = make();
+    long long sum = 0;
+    Event e = 0;
+    Timer timer;
+    timer.start();
+    for (std::size_t i = 0; i < n; ++i) {
+        q.push(static_cast<Event>(i));
+    }
+    while (q.pop(e)) {
+        sum += e;
+    }
+    timer.stop();
+    g_sink = sum;
+    return timer.elapsed_ms();
+}
+
+template <typename Q, typename Make>
+double event_loop(std::size_t n, Make make) {
+    Q q = make();
+    for (std::size_t i = 0; i < EVENT_BACKLOG; ++i) {
+        q.push(static_cast<Event>(i));
+    }
+    long long sum = 0;
+    Event e = 0;
+    Timer timer;
+    timer.start();
+    for (std::size_t i = 0; i < n; ++i) {
+        q.push(static_cast<Event>(i));
+        q.pop(e);
+        sum += e;
+    }
+    timer.stop();
+    g_sink = sum;
+    return timer.elapsed_ms();
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = DEFAULT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Queue Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: LinkedList-backed Queue (previous), circular-buffer Queue" << std::endl;
+    std::cout << "(unbounded and bounded), std::queue" << std::endl;
+    std::cout << "Event loop backlog: " << EVENT_BACKLOG << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    for (std::size_t size : sizes) {
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Operations: " << size << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        auto previous = [] { return PreviousQueue(); };
+        auto unbounded = [] { return UnboundedQueue(); };
+        auto std_queue = [] { return StdQueue(); };
+        auto bounded_all = [size] { return BoundedQueue(size); };
+        auto bounded_backlog = [] { return BoundedQueue(EVENT_BACKLOG + 1); };
+
+        // Every operation is either a push or a pop
+        std::size_t ops = 2 * size;
+
+        std::vector<BenchmarkResult> results = {
+            BenchmarkResult("LinkedList-backed (previous)", ops,
+                            best_of([&] { return fill_then_drain<PreviousQueue>(size, previous); })),
+            BenchmarkResult("Queue (unbounded)", ops,
+                            best_of([&] { return fill_then_drain<UnboundedQueue>(size, unbounded); })),
+            BenchmarkResult("Queue (bounded)", ops,
+                            best_of([&] { return fill_then_drain<BoundedQueue>(size, bounded_all); })),
+            BenchmarkResult("std::queue", ops,
+                            best_of([&] { return fill_then_drain<StdQueue>(size, std_queue); })),
+        };
+        ResultFormatter::print_section("Fill then drain");
+        ResultFormatter::print_comparison_with_baseline(results, 0);
+
+        results = {
+            BenchmarkResult("LinkedList-backed (previous)", ops,
+                            best_of([&] { return event_loop<PreviousQueue>(size, previous); })),
+            BenchmarkResult("Queue (unbounded)", ops,
+                            best_of([&] { return event_loop<UnboundedQueue>(size, unbounded); })),
+            BenchmarkResult("Queue (bounded)", ops,
+                            best_of([&] { return event_loop<BoundedQueue>(size, bounded_backlog); })),
+            BenchmarkResult("std::queue", ops,
+                            best_of([&] { return event_loop<StdQueue>(size, std_queue); })),
+        };
+        ResultFormatter::print_section("Event loop (push + pop at a steady backlog)");
+        ResultFormatter::print_comparison_with_baseline(results, 0);
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
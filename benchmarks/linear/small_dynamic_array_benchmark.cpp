@@ -0,0 +1,163 @@
+/**
+ * @file small_dynamic_array_benchmark.cpp
+ * @brief Creating many short arrays: SmallDynamicArray vs DynamicArray vs std::vector
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * Each iteration creates an array, push_backs k ints, sums them and
+ * destroys the array. k is drawn per array from a fixed table so every
+ * contender sees the same lengths.
+ *
+ * Contenders:
+ * - DynamicArray (baseline): allocates on the first push_back
+ * - std::vector
+ * - SmallDynamicArray<int, 16>: no allocation while k <= 16
+ *
+ * Length distributions:
+ * - Short (k in [0, 16]): the common case, every array fits inline
+ * - Mixed (k in [0, 32]): about half of the arrays spill to the heap
+ * - Tiny (k in [0, 4])
+ *
+ * Datasets: 1M and 10M arrays by default (best of ROUNDS runs). Pass
+ * counts on the command line to run other sizes, e.g.
+ * `benchmark_small_dynamic_array 50000000`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "linear/dynamic_array.hpp"
+#include "linear/dynamic_array/small_dynamic_array.hpp"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib::linear;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SIZES = {
+    1000000,     // 1M
+    10000000     // 10M
+};
+
+const std::size_t LENGTH_TABLE_SIZE = 4096;
+const int ROUNDS = 3;
+
+/**
+ * @brief Prevent the optimizer from discarding results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Workloads
+// ============================================
+
+/**
+ * @brief Fastest of ROUNDS runs of a timed workload
+ */
+template <typename Workload>
+double best_of(Workload&& workload) {
+    double best = workload();
+    for (int round = 1; round < ROUNDS; ++round) {
+        best = std::min(best, workload());
+    }
+    return best;
+}
+
+std::vector<int> make_lengths(int max_length) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(0, max_length);
+    std::vector<int> lengths(LENGTH_TABLE_SIZE);
+    for (int& k : lengths) {
+        k = dist(rng);
+    }
+    return lengths;
+}
+
+/**
+ * @brief Create, fill, read and destroy `arrays` arrays
+ */
+template <typename Array>
+double create_short_arrays(std::size_t arrays, const std::vector<int>& lengths) {
+    long long sum = 0;
+    Timer timer;
+    timer.start();
+    for (std::size_t i = 0; i < arrays; ++i) {
+        int k = lengths[i % LENGTH_TABLE_SIZE];
+        Array arr;
+        for (int j = 0; j < k; ++j) {
+            arr.push_back(j + static_cast<int>(i));
+        }
+        for (std::size_t j = 0; j < arr.size(); ++j) {
+            sum += arr[j];
+        }
+    }
+    timer.stop();
+    g_sink = sum;
+    return timer.elapsed_ms();
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = DEFAULT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "SmallDynamicArray Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: DynamicArray, std::vector, SmallDynamicArray<int, 16>" << std::endl;
+    std::cout << "Workload: create, push_back k ints, sum, destroy" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    struct Distribution {
+        const char* name;
+        int max_length;
+    };
+    const Distribution distributions[] = {
+        {"Short arrays (k in [0, 16])", 16},
+        {"Mixed arrays (k in [0, 32])", 32},
+        {"Tiny arrays (k in [0, 4])", 4},
+    };
+
+    for (std::size_t size : sizes) {
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Arrays: " << size << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        for (const Distribution& dist : distributions) {
+            std::vector<int> lengths = make_lengths(dist.max_length);
+            std::vector<BenchmarkResult> results = {
+                BenchmarkResult("DynamicArray", size,
+                                best_of([&] { return create_short_arrays<DynamicArray<int>>(size, lengths); })),
+                BenchmarkResult("std::vector", size,
+                                best_of([&] { return create_short_arrays<std::vector<int>>(size, lengths); })),
+                BenchmarkResult("SmallDynamicArray<int, 16>", size,
+                                best_of([&] { return create_short_arrays<SmallDynamicArray<int, 16>>(size, lengths); })),
+            };
+            ResultFormatter::print_section(dist.name);
+            ResultFormatter::print_comparison_with_baseline(results, 0);
+        }
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,315 @@
+/**
+ * @file unrolled_linked_list_benchmark.cpp
+ * @brief LinkedList vs UnrolledLinkedList: traversal, indexed access,
+ *        middle insertion and memory footprint
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * Contenders:
+ * - LinkedList<int> (baseline): one element per node
+ * - std::list<int>
+ * - UnrolledLinkedList<int, 32>
+ * - UnrolledLinkedList<int, 64>
+ *
+ * Workloads:
+ * - Build: push_back n ints; Memory is the heap bytes the list holds
+ *   afterwards (requested sizes, without malloc's own headers)
+ * - Traverse: find() of an absent value, i.e. a full scan (TRAVERSE_PASSES
+ *   passes)
+ * - Indexed access: at() of LOOKUP_COUNT random positions (std::list:
+ *   std::next from the nearer end)
+ * - Middle insertion: insert(size() / 2, value) INSERT_COUNT times; Memory
+ *   is the footprint afterwards, with unrolled nodes split to half full
+ *
+ * Datasets: 10K and 100K elements by default (best of ROUNDS runs). Pass
+ * counts on the command line to run other sizes, e.g.
+ * `benchmark_unrolled_linked_list 1000000`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "linear/linked_list.hpp"
+#include "linear/unrolled_linked_list.hpp"
+
+#include <iostream>
+#include <vector>
+#include <list>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <iterator>
+#include <cstdlib>
+#include <new>
+
+using namespace benchmark;
+using namespace mylib::linear;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SIZES = {
+    10000,     // 10K
+    100000     // 100K
+};
+
+const int TRAVERSE_PASSES = 10;
+const std::size_t LOOKUP_COUNT = 2000;
+const std::size_t INSERT_COUNT = 2000;
+const int ROUNDS = 3;
+
+/**
+ * @brief Prevent the optimizer from discarding results
+ */
+volatile long long g_sink = 0;
+
+// ============================================
+// Heap Accounting
+// ============================================
+
+/**
+ * @brief Bytes currently allocated through global operator new
+ */
+std::size_t g_live_bytes = 0;
+
+void* operator new(std::size_t bytes) {
+    // Stash the size in front of the block so delete can subtract it
+    void* block = std::malloc(bytes + alignof(std::max_align_t));
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    *static_cast<std::size_t*>(block) = bytes;
+    g_live_bytes += bytes;
+    return static_cast<char*>(block) + alignof(std::max_align_t);
+}
+
+void operator delete(void* p) noexcept {
+    if (p == nullptr) {
+        return;
+    }
+    void* block = static_cast<char*>(p) - alignof(std::max_align_t);
+    g_live_bytes -= *static_cast<std::size_t*>(block);
+    std::free(block);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    operator delete(p);
+}
+
+// ============================================
+// Adapters
+// ============================================
+
+/**
+ * @brief Uniform interface over the contenders
+ */
+template <typename List>
+struct Ops {
+    static long long at(const List& list, std::size_t index) { return list.at(index); }
+    static void insert(List& list, std::size_t index, int value) { list.insert(index, value); }
+    static bool contains(const List& list, int value) { return list.contains(value); }
+};
+
+template <>
+struct Ops<std::list<int>> {
+    using List = std::list<int>;
+
+    static List::const_iterator position(const List& list, std::size_t index) {
+        if (index < list.size() / 2) {
+            return std::next(list.begin(), static_cast<long>(index));
+        }
+        return std::prev(list.end(), static_cast<long>(list.size() - index));
+    }
+
+    static long long at(const List& list, std::size_t index) { return *position(list, index); }
+    static void insert(List& list, std::size_t index, int value) {
+        list.insert(position(list, index), value);
+    }
+    static bool contains(const List& list, int value) {
+        return std::find(list.begin(), list.end(), value) != list.end();
+    }
+};
+
+// ============================================
+// Workloads
+// ============================================
+
+/**
+ * @brief Fastest of ROUNDS runs of a timed workload
+ */
+template <typename Workload>
+double best_of(Workload&& workload) {
+    double best = workload();
+    for (int round = 1; round < ROUNDS; ++round) {
+        best = std::min(best, workload());
+    }
+    return best;
+}
+
+template <typename List>
+void fill(List& list, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        list.push_back(static_cast<int>(i));
+    }
+}
+
+/**
+ * @brief push_back n elements; reports the heap bytes held afterwards
+ */
+template <typename List>
+BenchmarkResult build(const std::string& name, std::size_t n) {
+    std::size_t footprint = 0;
+    double ms = best_of([&] {
+        std::size_t before = g_live_bytes;
+        Timer timer;
+        timer.start();
+        List list;
+        fill(list, n);
+        timer.stop();
+        footprint = g_live_bytes - before;
+        g_sink = list.size();
+        return timer.elapsed_ms();
+    });
+    return BenchmarkResult(name, n, ms, footprint);
+}
+
+/**
+ * @brief TRAVERSE_PASSES full scans looking for an absent value
+ */
+template <typename List>
+BenchmarkResult traverse(const std::string& name, std::size_t n) {
+    List list;
+    fill(list, n);
+    double ms = best_of([&] {
+        Timer timer;
+        timer.start();
+        long long found = 0;
+        for (int pass = 0; pass < TRAVERSE_PASSES; ++pass) {
+            found += Ops<List>::contains(list, -1 - pass);
+        }
+        timer.stop();
+        g_sink = found;
+        return timer.elapsed_ms();
+    });
+    return BenchmarkResult(name, n * TRAVERSE_PASSES, ms);
+}
+
+/**
+ * @brief at() of LOOKUP_COUNT precomputed random positions
+ */
+template <typename List>
+BenchmarkResult indexed(const std::string& name, std::size_t n,
+                        const std::vector<std::size_t>& positions) {
+    List list;
+    fill(list, n);
+    double ms = best_of([&] {
+        Timer timer;
+        timer.start();
+        long long sum = 0;
+        for (std::size_t position : positions) {
+            sum += Ops<List>::at(list, position);
+        }
+        timer.stop();
+        g_sink = sum;
+        return timer.elapsed_ms();
+    });
+    return BenchmarkResult(name, positions.size(), ms);
+}
+
+/**
+ * @brief INSERT_COUNT insertions at the middle; reports the final footprint
+ */
+template <typename List>
+BenchmarkResult middle_insert(const std::string& name, std::size_t n) {
+    std::size_t footprint = 0;
+    double ms = best_of([&] {
+        std::size_t before = g_live_bytes;
+        List list;
+        fill(list, n);
+        Timer timer;
+        timer.start();
+        for (std::size_t i = 0; i < INSERT_COUNT; ++i) {
+            Ops<List>::insert(list, list.size() / 2, static_cast<int>(i));
+        }
+        timer.stop();
+        footprint = g_live_bytes - before;
+        g_sink = list.size();
+        return timer.elapsed_ms();
+    });
+    return BenchmarkResult(name, INSERT_COUNT, ms, footprint);
+}
+
+using Unrolled32 = UnrolledLinkedList<int, 32>;
+using Unrolled64 = UnrolledLinkedList<int, 64>;
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = DEFAULT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Unrolled Linked List Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: LinkedList, std::list, UnrolledLinkedList<32>, UnrolledLinkedList<64>" << std::endl;
+    std::cout << "Workloads: build, traverse, indexed access, middle insertion" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    for (std::size_t size : sizes) {
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Elements: " << size << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        ResultFormatter::print_section("Build: push_back (Memory = heap bytes held)");
+        ResultFormatter::print_comparison_with_baseline({
+            build<LinkedList<int>>("LinkedList", size),
+            build<std::list<int>>("std::list", size),
+            build<Unrolled32>("UnrolledLinkedList<32>", size),
+            build<Unrolled64>("UnrolledLinkedList<64>", size),
+        }, 0);
+
+        ResultFormatter::print_section("Traverse: find() of an absent value");
+        ResultFormatter::print_comparison_with_baseline({
+            traverse<LinkedList<int>>("LinkedList", size),
+            traverse<std::list<int>>("std::list", size),
+            traverse<Unrolled32>("UnrolledLinkedList<32>", size),
+            traverse<Unrolled64>("UnrolledLinkedList<64>", size),
+        }, 0);
+
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<std::size_t> dist(0, size - 1);
+        std::vector<std::size_t> positions(LOOKUP_COUNT);
+        for (std::size_t& position : positions) {
+            position = dist(rng);
+        }
+        ResultFormatter::print_section("Indexed access: at(random index)");
+        ResultFormatter::print_comparison_with_baseline({
+            indexed<LinkedList<int>>("LinkedList", size, positions),
+            indexed<std::list<int>>("std::list", size, positions),
+            indexed<Unrolled32>("UnrolledLinkedList<32>", size, positions),
+            indexed<Unrolled64>("UnrolledLinkedList<64>", size, positions),
+        }, 0);
+
+        ResultFormatter::print_section("Middle insertion: insert(size() / 2) (Memory = final footprint)");
+        ResultFormatter::print_comparison_with_baseline({
+            middle_insert<LinkedList<int>>("LinkedList", size),
+            middle_insert<std::list<int>>("std::list", size),
+            middle_insert<Unrolled32>("UnrolledLinkedList<32>", size),
+            middle_insert<Unrolled64>("UnrolledLinkedList<64>", size),
+        }, 0);
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+/**
+ * @file node_pool_benchmark.cpp
+ * @brief Build and destroy cost of node-based containers: std::allocator vs PoolAllocator
+ * @author Jinhyeok
+ * @date 2026-10-16
+ *
+ * Each container is filled with shuffled keys and then destroyed, once with
+ * the default std::allocator (baseline) and once with
+ * memory::PoolAllocator:
+ * - Build: one node allocation per insert (malloc vs slab bump/free list)
+ * - Destroy: node-by-node free vs one release() of all slabs for containers
+ *   whose nodes are trivially destructible (LinkedList, BST, AVL, RB tree,
+ *   SkipList); Trie and HashTable nodes still run their destructors and go
+ *   back to the pool's free lists
+ *
+ * Datasets: 100K and 1M keys by default. Pass sizes on the command line to
+ * run other sizes, e.g. `benchmark_node_pool 5000000`.
+ *
+ * Environment: GitHub Codespaces
+ */
+
+#include "benchmark_utils.hpp"
+#include "memory/node_pool.hpp"
+#include "linear/linked_list.hpp"
+#include "tree/binary_search_tree.hpp"
+#include "tree/avl_tree.hpp"
+#include "tree/red_black_tree.hpp"
+#include "tree/skip_list.hpp"
+#include "tree/trie.hpp"
+#include "hash/hash_table.hpp"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstdlib>
+
+using namespace benchmark;
+using namespace mylib;
+
+// ============================================
+// Configuration
+// ============================================
+
+const std::vector<std::size_t> DEFAULT_SIZES = {
+    100000,      // 100K
+    1000000      // 1M
+};
+
+using Key = long long;
+template <typename T>
+using Pool = memory::PoolAllocator<T>;
+using Entry = std::pair<const Key, Key>;
+
+// ============================================
+// Helper Functions
+// ============================================
+
+/**
+ * @brief Build a container from keys, then destroy it, timing both phases
+ */
+template <typename Container, typename Insert>
+void run_build_destroy(const std::string& label, std::size_t size, Insert insert,
+                       std::vector<BenchmarkResult>& build_results,
+                       std::vector<BenchmarkResult>& destroy_results) {
+    Timer timer;
+    auto container = std::make_unique<Container>();
+
+    timer.start();
+    insert(*container);
+    timer.stop();
+    build_results.emplace_back(label + " build", size, timer.elapsed_ms());
+
+    timer.start();
+    container.reset();
+    timer.stop();
+    destroy_results.emplace_back(label + " destroy", size, timer.elapsed_ms());
+}
+
+/**
+ * @brief Compare one container with both allocators
+ */
+template <typename Plain, typename Pooled, typename Insert>
+void compare(const std::string& title, std::size_t size, Insert insert) {
+    std::vector<BenchmarkResult> build_results;
+    std::vector<BenchmarkResult> destroy_results;
+    run_build_destroy<Plain>("std::allocator", size, insert, build_results, destroy_results);
+    run_build_destroy<Pooled>("PoolAllocator", size, insert, build_results, destroy_results);
+
+    ResultFormatter::print_section(title);
+    ResultFormatter::print_comparison_with_baseline(build_results, 0);
+    std::cout << std::endl;
+    ResultFormatter::print_comparison_with_baseline(destroy_results, 0);
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = DEFAULT_SIZES;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Node Pool Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Comparing: std::allocator vs memory::PoolAllocator" << std::endl;
+    std::cout << "Phases: build (insert all keys), destroy (destructor)" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    DataGenerator<Key> gen(42);
+
+    for (std::size_t size : sizes) {
+        std::cout << "\n" << std::string(90, '=') << std::endl;
+        std::cout << "Dataset Size: " << size << " keys" << std::endl;
+        std::cout << std::string(90, '=') << std::endl;
+
+        std::vector<Key> keys = gen.shuffled(size, 0);
+        std::vector<std::string> words;
+        words.reserve(size);
+        for (Key k : keys) {
+            words.push_back(std::to_string(k));
+        }
+
+        compare<linear::LinkedList<Key>, linear::LinkedList<Key, Pool<Key>>>(
+            "LinkedList", size, [&keys](auto& list) {
+                for (Key k : keys) {
+                    list.push_back(k);
+                }
+            });
+
+        compare<tree::BinarySearchTree<Key>, tree::BinarySearchTree<Key, Pool<Key>>>(
+            "BinarySearchTree", size, [&keys](auto& tree) {
+                for (Key k : keys) {
+                    tree.insert(k);
+                }
+            });
+
+        compare<tree::AVLTree<Key>, tree::AVLTree<Key, Pool<Key>>>(
+            "AVLTree", size, [&keys](auto& tree) {
+                for (Key k : keys) {
+                    tree.insert(k);
+                }
+            });
+
+        compare<tree::RedBlackTree<Key>, tree::RedBlackTree<Key, std::less<Key>, Pool<Key>>>(
+            "RedBlackTree", size, [&keys](auto& tree) {
+                for (Key k : keys) {
+                    tree.insert(k);
+                }
+            });
+
+        compare<tree::SkipList<Key>, tree::SkipList<Key, std::less<Key>, Pool<Key>>>(
+            "SkipList", size, [&keys](auto& list) {
+                for (Key k : keys) {
+                    list.insert(k);
+                }
+            });
+
+        compare<tree::Trie<char>, tree::Trie<char, Pool<char>>>(
+            "Trie (decimal keys)", size, [&words](auto& trie) {
+                for (const std::string& w : words) {
+                    trie.insert(w);
+                }
+            });
+
+        compare<hash::HashTable<Key, Key>,
+                hash::HashTable<Key, Key, std::hash<Key>, std::equal_to<Key>,
+                                hash::PrimeBucketPolicy, Pool<Entry>>>(
+            "HashTable", size, [&keys](auto& table) {
+                for (Key k : keys) {
+                    table.insert(k, k);
+                }
+            });
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Benchmark Complete!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
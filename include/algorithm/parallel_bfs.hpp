@@ -0,0 +1,405 @@
+/**
+ * @file parallel_bfs.hpp
+ * @brief Direction-optimizing (top-down / bottom-up) breadth-first search
+ *        over a CsrGraph, parallel on a ThreadPool
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ *
+ * Level-synchronous BFS that picks a direction per level (Beamer, Asanović
+ * and Patterson, "Direction-Optimizing Breadth-First Search", SC 2012):
+ * - Top-down: every frontier vertex scans its out-arcs and claims unvisited
+ *   targets. Cheap while the frontier is small.
+ * - Bottom-up: every unvisited vertex scans its in-arcs until it finds a
+ *   parent in the frontier, then stops. On low-diameter (power-law) graphs
+ *   the middle levels hold most vertices, and most of their arcs are never
+ *   examined.
+ *
+ * The search switches to bottom-up when the arcs leaving the frontier exceed
+ * 1/alpha of the arcs still to be checked, and back to top-down when the
+ * frontier shrinks below 1/beta of the vertices. Each level is split into
+ * chunks run as TaskGroup tasks: top-down chunks claim vertices with an
+ * atomic visited bitmap, bottom-up chunks own whole 64-vertex bitmap words.
+ *
+ * @code
+ * graph::CsrGraph<int> graph(edges, false);
+ * DirectionOptimizingBfs<int> bfs(graph);
+ * ThreadPool pool;
+ * auto result = bfs.run(graph.id_of(0), pool);
+ * // result.level[id], result.parent[id]
+ * @endcode
+ *
+ * Copyright (c) 2026 Jinhyeok
+ * MIT License
+ */
+
+#ifndef MYLIB_ALGORITHM_PARALLEL_BFS_HPP
+#define MYLIB_ALGORITHM_PARALLEL_BFS_HPP
+
+#include "algorithm/thread_pool.hpp"
+#include "graph/csr_graph.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace mylib {
+namespace algorithm {
+
+/**
+ * @class DirectionOptimizingBfs
+ * @brief Hybrid top-down / bottom-up BFS returning level and parent arrays
+ *
+ * The constructor builds the incoming-arc index bottom-up steps need (a
+ * directed graph only; undirected arcs already go both ways). The graph
+ * must outlive this object. run() is const and may be called concurrently.
+ *
+ * @tparam Vertex The CsrGraph vertex type
+ * @tparam Weight The CsrGraph weight type (unused by the search)
+ */
+template <typename Vertex, typename Weight = double>
+class DirectionOptimizingBfs {
+public:
+    using graph_type = graph::CsrGraph<Vertex, Weight>;
+    using size_type = std::size_t;
+    using id_type = typename graph_type::id_type;
+    using level_type = std::uint32_t;
+
+    static constexpr level_type NO_LEVEL = std::numeric_limits<level_type>::max();
+    static constexpr id_type NO_PARENT = std::numeric_limits<id_type>::max();
+
+    /**
+     * @struct Result
+     * @brief BFS tree of one search, indexed by CsrGraph id
+     */
+    struct Result {
+        std::vector<level_type> level;    ///< Hops from the source, NO_LEVEL if unreached
+        std::vector<id_type> parent;      ///< Tree parent (the source's is itself), NO_PARENT if unreached
+        size_type reached = 0;            ///< Vertices reached, including the source
+        size_type top_down_steps = 0;     ///< Levels expanded top-down
+        size_type bottom_up_steps = 0;    ///< Levels expanded bottom-up
+    };
+
+    /**
+     * @brief Prepare searches over graph
+     * @param graph Graph to search; must outlive this object
+     */
+    explicit DirectionOptimizingBfs(const graph_type& graph) : m_graph(graph) {
+        if (graph.is_directed()) {
+            graph.reverse_arcs(m_in_offsets, m_sources);
+        }
+    }
+
+    /**
+     * @brief Set the top-down to bottom-up threshold (default 15)
+     *
+     * Bottom-up starts once frontier arcs > unexplored arcs / alpha; a tiny
+     * alpha keeps the search top-down.
+     */
+    DirectionOptimizingBfs& set_alpha(double alpha) {
+        m_alpha = alpha;
+        return *this;
+    }
+
+    /**
+     * @brief Set the bottom-up to top-down threshold (default 18)
+     *
+     * Top-down resumes once a shrinking frontier holds < vertices / beta; a
+     * huge beta keeps the search bottom-up once it has switched.
+     */
+    DirectionOptimizingBfs& set_beta(double beta) {
+        m_beta = beta;
+        return *this;
+    }
+
+    /**
+     * @brief Search from source on the calling thread
+     * @param source Id in [0, vertex_count())
+     * @throws std::out_of_range if source is out of range
+     */
+    Result run(id_type source) const {
+        return search(source, nullptr);
+    }
+
+    /**
+     * @brief Search from source, splitting each level across pool
+     * @param source Id in [0, vertex_count())
+     * @param pool Pool that runs the chunks of each level
+     * @throws std::out_of_range if source is out of range
+     */
+    Result run(id_type source, ThreadPool& pool) const {
+        return search(source, &pool);
+    }
+
+private:
+    using Word = std::uint64_t;
+
+    static constexpr size_type WORD_BITS = 64;
+    static constexpr size_type TOP_DOWN_GRAIN = 256;           ///< Min frontier vertices per task
+    static constexpr size_type BOTTOM_UP_GRAIN = 64 * WORD_BITS;  ///< Min vertices per task
+    static constexpr size_type CHUNKS_PER_THREAD = 8;
+
+    /**
+     * @brief Per-chunk output of one level
+     */
+    struct StepStats {
+        size_type found = 0;        ///< Vertices added to the next frontier
+        size_type out_arcs = 0;     ///< Their out-degrees
+        size_type in_arcs = 0;      ///< Their in-degrees (arcs bottom-up no longer checks)
+    };
+
+    const graph_type& m_graph;
+    std::vector<size_type> m_in_offsets;   ///< Directed graphs only
+    std::vector<id_type> m_sources;        ///< Directed graphs only
+    double m_alpha = 15.0;
+    double m_beta = 18.0;
+
+    const std::vector<size_type>& in_offsets() const noexcept {
+        return m_graph.is_directed() ? m_in_offsets : m_graph.offsets();
+    }
+
+    const std::vector<id_type>& sources() const noexcept {
+        return m_graph.is_directed() ? m_sources : m_graph.targets();
+    }
+
+    /**
+     * @brief Chunk size for count items: one chunk without a pool, otherwise
+     *        about CHUNKS_PER_THREAD chunks per worker, rounded to align
+     */
+    static size_type grain_for(size_type count, ThreadPool* pool, size_type min_grain, size_type align) {
+        if (pool == nullptr) {
+            return count == 0 ? 1 : count;
+        }
+        size_type grain = count / (pool->thread_count() * CHUNKS_PER_THREAD);
+        grain = grain < min_grain ? min_grain : grain;
+        return (grain + align - 1) / align * align;
+    }
+
+    /**
+     * @brief Call body(chunk, begin, end) for each grain-sized chunk of
+     *        [0, count), as pool tasks if there is a pool and several chunks
+     */
+    template <typename Body>
+    static void for_each_chunk(ThreadPool* pool, size_type count, size_type grain, Body& body) {
+        size_type chunks = (count + grain - 1) / grain;
+        if (pool == nullptr || chunks <= 1) {
+            for (size_type c = 0; c < chunks; ++c) {
+                body(c, c * grain, c + 1 == chunks ? count : (c + 1) * grain);
+            }
+            return;
+        }
+        TaskGroup group(*pool);
+        for (size_type c = 0; c < chunks; ++c) {
+            size_type begin = c * grain;
+            size_type end = c + 1 == chunks ? count : begin + grain;
+            group.run([&body, c, begin, end] { body(c, begin, end); });
+        }
+        group.wait();
+    }
+
+    Result search(id_type source, ThreadPool* pool) const {
+        const size_type n = m_graph.vertex_count();
+        if (source >= n) {
+            throw std::out_of_range("DirectionOptimizingBfs::run: source out of range");
+        }
+
+        const std::vector<size_type>& offsets = m_graph.offsets();
+        const std::vector<size_type>& in_off = in_offsets();
+        const size_type words = (n + WORD_BITS - 1) / WORD_BITS;
+
+        Result result;
+        result.level.assign(n, NO_LEVEL);
+        result.parent.assign(n, NO_PARENT);
+
+        // std::atomic is not zero-initialized by default before C++20
+        std::vector<std::atomic<Word>> visited(words);
+        for (std::atomic<Word>& word : visited) {
+            word.store(0, std::memory_order_relaxed);
+        }
+        std::vector<Word> front_bits(words, 0);
+        std::vector<Word> next_bits(words, 0);
+        std::vector<id_type> frontier{source};
+        std::vector<id_type> next;
+
+        visited[source / WORD_BITS].store(Word{1} << (source % WORD_BITS), std::memory_order_relaxed);
+        result.level[source] = 0;
+        result.parent[source] = source;
+        result.reached = 1;
+
+        size_type frontier_size = 1;
+        size_type frontier_arcs = offsets[source + 1] - offsets[source];
+        size_type unexplored_arcs = in_off[n] - (in_off[source + 1] - in_off[source]);
+        bool bottom_up = false;
+
+        for (level_type depth = 1; frontier_size > 0; ++depth) {
+            size_type previous_size = frontier_size;
+            if (!bottom_up && static_cast<double>(frontier_arcs) >
+                                  static_cast<double>(unexplored_arcs) / m_alpha) {
+                std::fill(front_bits.begin(), front_bits.end(), Word{0});
+                for (id_type u : frontier) {
+                    front_bits[u / WORD_BITS] |= Word{1} << (u % WORD_BITS);
+                }
+                bottom_up = true;
+            }
+
+            StepStats step;
+            if (bottom_up) {
+                step = bottom_up_step(depth, front_bits, next_bits, visited, result, pool);
+                front_bits.swap(next_bits);
+                ++result.bottom_up_steps;
+            } else {
+                step = top_down_step(depth, frontier, next, visited, result, pool);
+                frontier.swap(next);
+                ++result.top_down_steps;
+            }
+
+            frontier_size = step.found;
+            frontier_arcs = step.out_arcs;
+            unexplored_arcs -= step.in_arcs;
+            result.reached += step.found;
+
+            if (bottom_up && frontier_size < previous_size &&
+                static_cast<double>(frontier_size) < static_cast<double>(n) / m_beta) {
+                frontier.clear();
+                for (size_type w = 0; w < words; ++w) {
+                    for (Word bits = front_bits[w]; bits != 0; bits &= bits - 1) {
+                        frontier.push_back(static_cast<id_type>(w * WORD_BITS + count_trailing_zeros(bits)));
+                    }
+                }
+                bottom_up = false;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Expand frontier by scanning out-arcs; next receives the new
+     *        frontier in chunk order
+     */
+    StepStats top_down_step(level_type depth, const std::vector<id_type>& frontier,
+                            std::vector<id_type>& next, std::vector<std::atomic<Word>>& visited,
+                            Result& result, ThreadPool* pool) const {
+        const std::vector<size_type>& offsets = m_graph.offsets();
+        const std::vector<id_type>& targets = m_graph.targets();
+        const std::vector<size_type>& in_off = in_offsets();
+
+        size_type grain = grain_for(frontier.size(), pool, TOP_DOWN_GRAIN, 1);
+        size_type chunks = (frontier.size() + grain - 1) / grain;
+        std::vector<std::vector<id_type>> found(chunks);
+        std::vector<StepStats> stats(chunks);
+
+        auto body = [&](size_type chunk, size_type begin, size_type end) {
+            std::vector<id_type>& out = found[chunk];
+            StepStats& local = stats[chunk];
+            for (size_type i = begin; i < end; ++i) {
+                id_type u = frontier[i];
+                for (size_type e = offsets[u]; e < offsets[u + 1]; ++e) {
+                    id_type v = targets[e];
+                    std::atomic<Word>& word = visited[v / WORD_BITS];
+                    Word mask = Word{1} << (v % WORD_BITS);
+                    // Cheap load first; only the winning fetch_or may write v
+                    if ((word.load(std::memory_order_relaxed) & mask) != 0 ||
+                        (word.fetch_or(mask, std::memory_order_relaxed) & mask) != 0) {
+                        continue;
+                    }
+                    result.level[v] = depth;
+                    result.parent[v] = u;
+                    out.push_back(v);
+                    local.out_arcs += offsets[v + 1] - offsets[v];
+                    local.in_arcs += in_off[v + 1] - in_off[v];
+                }
+            }
+            local.found = out.size();
+        };
+        for_each_chunk(pool, frontier.size(), grain, body);
+
+        StepStats total;
+        next.clear();
+        for (size_type c = 0; c < chunks; ++c) {
+            next.insert(next.end(), found[c].begin(), found[c].end());
+            total.found += stats[c].found;
+            total.out_arcs += stats[c].out_arcs;
+            total.in_arcs += stats[c].in_arcs;
+        }
+        return total;
+    }
+
+    /**
+     * @brief Let every unvisited vertex look for a parent in front_bits;
+     *        next_bits receives the new frontier
+     */
+    StepStats bottom_up_step(level_type depth, const std::vector<Word>& front_bits,
+                             std::vector<Word>& next_bits, std::vector<std::atomic<Word>>& visited,
+                             Result& result, ThreadPool* pool) const {
+        const std::vector<size_type>& offsets = m_graph.offsets();
+        const std::vector<size_type>& in_off = in_offsets();
+        const std::vector<id_type>& sources = this->sources();
+        const size_type n = m_graph.vertex_count();
+
+        // Chunks cover whole words, so each task owns the bits it writes
+        size_type grain = grain_for(n, pool, BOTTOM_UP_GRAIN, WORD_BITS);
+        size_type chunks = (n + grain - 1) / grain;
+        std::vector<StepStats> stats(chunks);
+
+        auto body = [&](size_type chunk, size_type begin, size_type end) {
+            StepStats& local = stats[chunk];
+            std::fill(next_bits.begin() + static_cast<std::ptrdiff_t>(begin / WORD_BITS),
+                      next_bits.begin() + static_cast<std::ptrdiff_t>((end + WORD_BITS - 1) / WORD_BITS),
+                      Word{0});
+            for (size_type v = begin; v < end; ++v) {
+                if (result.level[v] != NO_LEVEL) {
+                    continue;
+                }
+                for (size_type e = in_off[v]; e < in_off[v + 1]; ++e) {
+                    id_type u = sources[e];
+                    if ((front_bits[u / WORD_BITS] >> (u % WORD_BITS) & 1) == 0) {
+                        continue;
+                    }
+                    Word mask = Word{1} << (v % WORD_BITS);
+                    result.level[v] = depth;
+                    result.parent[v] = u;
+                    next_bits[v / WORD_BITS] |= mask;
+                    // This task owns the word, so a plain read-modify-write is enough
+                    std::atomic<Word>& word = visited[v / WORD_BITS];
+                    word.store(word.load(std::memory_order_relaxed) | mask, std::memory_order_relaxed);
+                    ++local.found;
+                    local.out_arcs += offsets[v + 1] - offsets[v];
+                    local.in_arcs += in_off[v + 1] - in_off[v];
+                    break;
+                }
+            }
+        };
+        for_each_chunk(pool, n, grain, body);
+
+        StepStats total;
+        for (const StepStats& local : stats) {
+            total.found += local.found;
+            total.out_arcs += local.out_arcs;
+            total.in_arcs += local.in_arcs;
+        }
+        return total;
+    }
+
+    static unsigned count_trailing_zeros(Word bits) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctzll(bits));
+#else
+        unsigned count = 0;
+        while ((bits & 1) == 0) {
+            bits >>= 1;
+            ++count;
+        }
+        return count;
+#endif
+    }
+};
+
+} // namespace algorithm
+} // namespace mylib
+
+#endif // MYLIB_ALGORITHM_PARALLEL_BFS_HPP
@@ -0,0 +1,566 @@
+/**
+ * @file shortest_paths.hpp
+ * @brief Shortest-path variants over a CsrGraph: bidirectional Dijkstra,
+ *        A* and ALT for single-pair queries, Dial's bucket queue for small
+ *        integer weights
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ *
+ * CsrGraph::dijkstra and dijkstra_all cover the plain cases. This header adds:
+ * - BidirectionalDijkstra: searches forward from the source and backward
+ *   from the target at the same time and stops when they meet. On
+ *   road-like graphs each search covers a ball of about half the radius.
+ * - AStar: Dijkstra ordered by distance + a lower bound on the remaining
+ *   distance, supplied by the caller.
+ * - AltIndex: landmark distance tables that give AStar a lower bound for
+ *   any pair by the triangle inequality (ALT: A*, landmarks, triangle
+ *   inequality; Goldberg and Harrelson, SODA 2005).
+ * - dial_dijkstra: single-source distances with a circular array of
+ *   max_weight + 1 buckets in place of a heap, for integer weights.
+ *
+ * @code
+ * graph::CsrGraph<int, int> graph(edges, false);
+ * BidirectionalDijkstra<int, int> query(graph);
+ * auto route = query.run(graph.id_of(from), graph.id_of(to));
+ * // route.distance, route.path (ids), route.settled
+ *
+ * AltIndex<int, int> landmarks(graph, 16);      // Once per graph
+ * AStar<int, int> search(graph);                // One per thread
+ * auto fast = search.run(s, t, landmarks.heuristic(t));
+ *
+ * std::vector<int> dist = dial_dijkstra(graph, graph.id_of(from));
+ * @endcode
+ *
+ * Copyright (c) 2026 Jinhyeok
+ * MIT License
+ */
+
+#ifndef MYLIB_ALGORITHM_SHORTEST_PATHS_HPP
+#define MYLIB_ALGORITHM_SHORTEST_PATHS_HPP
+
+#include "graph/csr_graph.hpp"
+#include "tree/indexed_heap.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace mylib {
+namespace algorithm {
+
+/**
+ * @struct PathResult
+ * @brief Outcome of one point-to-point query, in CsrGraph ids
+ */
+template <typename Vertex, typename Weight>
+struct PathResult {
+    using id_type = typename graph::CsrGraph<Vertex, Weight>::id_type;
+
+    Weight distance = graph::CsrGraph<Vertex, Weight>::infinity();  ///< infinity() if unreachable
+    std::vector<id_type> path;   ///< source .. target ids, empty if unreachable
+    std::size_t settled = 0;     ///< Vertices taken off the queue (all searches)
+};
+
+namespace detail {
+
+/**
+ * @class SearchLabels
+ * @brief Distance/parent labels and queue of one search, reusable across
+ *        queries
+ *
+ * Labels are reset in time proportional to what the last query touched,
+ * not to the vertex count.
+ */
+template <typename Weight, typename Id>
+class SearchLabels {
+public:
+    static constexpr Id NO_ID = std::numeric_limits<Id>::max();
+
+    std::vector<Weight> dist;
+    std::vector<Id> parent;
+    tree::MinIndexedHeap<Weight> heap;
+
+    explicit SearchLabels(std::size_t n = 0)
+        : dist(n, std::numeric_limits<Weight>::max()), parent(n, NO_ID), heap(n) {}
+
+    bool reached(Id v) const noexcept { return dist[v] != std::numeric_limits<Weight>::max(); }
+
+    void label(Id v, Weight distance, Id from) {
+        if (!reached(v)) {
+            m_touched.push_back(v);
+        }
+        dist[v] = distance;
+        parent[v] = from;
+    }
+
+    /// Queue v at key, or move it up if it is already queued; keys only
+    /// drop, since a relaxation lowers dist[v] and h(v) is fixed per query
+    void queue(Id v, Weight key) {
+        if (heap.contains(v)) {
+            heap.decrease_key(v, key);
+        } else {
+            heap.push(v, key);
+        }
+    }
+
+    void reset() {
+        for (Id v : m_touched) {
+            dist[v] = std::numeric_limits<Weight>::max();
+            parent[v] = NO_ID;
+        }
+        m_touched.clear();
+        heap.clear();
+    }
+
+    /// Ids from the search root to v
+    std::vector<Id> path_to(Id v) const {
+        std::vector<Id> path;
+        for (; v != NO_ID; v = parent[v]) {
+            path.push_back(v);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+private:
+    std::vector<Id> m_touched;   ///< Ids whose label must be reset
+};
+
+} // namespace detail
+
+/**
+ * @class BidirectionalDijkstra
+ * @brief Point-to-point Dijkstra meeting in the middle
+ *
+ * Each step settles the vertex with the smaller tentative distance of the
+ * two frontiers. Every relaxed arc that reaches a vertex the other side has
+ * labelled offers a candidate path length mu, and the search stops once the
+ * two frontier minima add up to at least mu.
+ *
+ * A directed graph is transposed once in the constructor for the backward
+ * search. Scratch arrays are kept between queries, so one object should
+ * serve many queries, one at a time. The graph must outlive this object and
+ * weights must be non-negative.
+ *
+ * @tparam Vertex The CsrGraph vertex type
+ * @tparam Weight The CsrGraph weight type
+ */
+template <typename Vertex, typename Weight = double>
+class BidirectionalDijkstra {
+public:
+    using graph_type = graph::CsrGraph<Vertex, Weight>;
+    using size_type = std::size_t;
+    using id_type = typename graph_type::id_type;
+    using Result = PathResult<Vertex, Weight>;
+
+    static constexpr id_type NO_ID = std::numeric_limits<id_type>::max();
+
+    /**
+     * @brief Prepare queries over graph
+     * @param graph Graph to search; must outlive this object
+     */
+    explicit BidirectionalDijkstra(const graph_type& graph)
+        : m_graph(graph), m_forward(graph.vertex_count()), m_backward(graph.vertex_count()) {
+        if (graph.is_directed()) {
+            m_reverse = graph.transpose();
+        }
+    }
+
+    /**
+     * @brief Shortest path from source to target
+     * @param source Id in [0, vertex_count())
+     * @param target Id in [0, vertex_count())
+     * @throws std::out_of_range if an id is out of range
+     */
+    Result run(id_type source, id_type target) {
+        const size_type n = m_graph.vertex_count();
+        if (source >= n || target >= n) {
+            throw std::out_of_range("BidirectionalDijkstra::run: id out of range");
+        }
+        m_forward.reset();
+        m_backward.reset();
+
+        Result result;
+        if (source == target) {
+            result.distance = Weight{0};
+            result.path.push_back(source);
+            return result;
+        }
+
+        m_forward.label(source, Weight{0}, NO_ID);
+        m_backward.label(target, Weight{0}, NO_ID);
+        m_forward.heap.push(source, Weight{0});
+        m_backward.heap.push(target, Weight{0});
+
+        Weight best = graph_type::infinity();
+        id_type meet = NO_ID;
+        while (!m_forward.heap.empty() && !m_backward.heap.empty()) {
+            const Weight& f = m_forward.heap.top_priority();
+            const Weight& b = m_backward.heap.top_priority();
+            if (best != graph_type::infinity() && !(f + b < best)) {
+                break;
+            }
+
+            bool go_forward = !(b < f);
+            Labels& side = go_forward ? m_forward : m_backward;
+            const Labels& other = go_forward ? m_backward : m_forward;
+            const graph_type& graph = go_forward ? m_graph : backward_graph();
+
+            auto [u, d] = side.heap.extract();
+            ++result.settled;
+            for (size_type e = graph.offsets()[u]; e < graph.offsets()[u + 1]; ++e) {
+                id_type v = graph.targets()[e];
+                Weight new_dist = d + graph.weights()[e];
+                if (!(new_dist < side.dist[v])) {
+                    continue;
+                }
+                side.queue(v, new_dist);
+                side.label(v, new_dist, static_cast<id_type>(u));
+                if (other.reached(v) && new_dist + other.dist[v] < best) {
+                    best = new_dist + other.dist[v];
+                    meet = v;
+                }
+            }
+        }
+
+        if (meet == NO_ID) {
+            return result;
+        }
+        result.distance = best;
+        result.path = m_forward.path_to(meet);
+        for (id_type v = m_backward.parent[meet]; v != NO_ID; v = m_backward.parent[v]) {
+            result.path.push_back(v);
+        }
+        return result;
+    }
+
+private:
+    using Labels = detail::SearchLabels<Weight, id_type>;
+
+    const graph_type& m_graph;
+    graph_type m_reverse;   ///< Directed graphs only
+    Labels m_forward;
+    Labels m_backward;
+
+    const graph_type& backward_graph() const noexcept {
+        return m_graph.is_directed() ? m_reverse : m_graph;
+    }
+};
+
+/**
+ * @class AStar
+ * @brief Point-to-point search guided by a lower bound on the distance left
+ *
+ * Vertices leave the queue in order of dist(source, v) + h(v), so the
+ * search leans towards the target and settles fewer vertices than Dijkstra.
+ * h(v) must never overestimate dist(v, target) (admissible); h == 0 is
+ * plain Dijkstra. A consistent h (h(u) <= w(u, v) + h(v)) settles each
+ * vertex once; an admissible but inconsistent one may reopen vertices and
+ * is still exact.
+ *
+ * Like BidirectionalDijkstra, scratch arrays are kept between queries: use
+ * one object per thread. The graph must outlive this object and weights
+ * must be non-negative.
+ *
+ * @tparam Vertex The CsrGraph vertex type
+ * @tparam Weight The CsrGraph weight type
+ */
+template <typename Vertex, typename Weight = double>
+class AStar {
+public:
+    using graph_type = graph::CsrGraph<Vertex, Weight>;
+    using size_type = std::size_t;
+    using id_type = typename graph_type::id_type;
+    using Result = PathResult<Vertex, Weight>;
+
+    /**
+     * @brief Prepare queries over graph
+     * @param graph Graph to search; must outlive this object
+     */
+    explicit AStar(const graph_type& graph) : m_graph(graph), m_labels(graph.vertex_count()) {}
+
+    /**
+     * @brief Shortest path from source to target
+     * @param source Id in [0, vertex_count())
+     * @param target Id in [0, vertex_count())
+     * @param heuristic Callable id_type -> Weight, a lower bound on the
+     *        distance from that id to target
+     * @throws std::out_of_range if an id is out of range
+     */
+    template <typename Heuristic>
+    Result run(id_type source, id_type target, Heuristic&& heuristic) {
+        const size_type n = m_graph.vertex_count();
+        if (source >= n || target >= n) {
+            throw std::out_of_range("AStar::run: id out of range");
+        }
+        m_labels.reset();
+
+        Result result;
+        m_labels.label(source, Weight{0}, Labels::NO_ID);
+        m_labels.heap.push(source, heuristic(source));
+
+        while (!m_labels.heap.empty()) {
+            id_type u = static_cast<id_type>(m_labels.heap.extract().first);
+            ++result.settled;
+            if (u == target) {
+                result.distance = m_labels.dist[u];
+                result.path = m_labels.path_to(u);
+                break;
+            }
+            const Weight d = m_labels.dist[u];
+            for (size_type e = m_graph.offsets()[u]; e < m_graph.offsets()[u + 1]; ++e) {
+                id_type v = m_graph.targets()[e];
+                Weight new_dist = d + m_graph.weights()[e];
+                if (new_dist < m_labels.dist[v]) {
+                    m_labels.label(v, new_dist, u);
+                    m_labels.queue(v, new_dist + heuristic(v));
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Plain Dijkstra through the same code path (h == 0)
+     */
+    Result run(id_type source, id_type target) {
+        return run(source, target, [](id_type) { return Weight{0}; });
+    }
+
+private:
+    using Labels = detail::SearchLabels<Weight, id_type>;
+
+    const graph_type& m_graph;
+    Labels m_labels;
+};
+
+/**
+ * @class AltIndex
+ * @brief Landmark distance tables giving A* lower bounds for any pair
+ *
+ * For a landmark L the triangle inequality gives
+ *   dist(v, t) >= dist(L, t) - dist(L, v)   and
+ *   dist(v, t) >= dist(v, L) - dist(t, L),
+ * and heuristic(t) takes the largest such bound over all landmarks. The
+ * bound is admissible, and consistent on a strongly connected graph, where
+ * AStar then settles each vertex at most once.
+ *
+ * Landmarks are chosen farthest-first: the first is the vertex farthest
+ * from id 0, each next one the vertex farthest from all landmarks chosen so
+ * far (a vertex none of them reaches counts as farthest). Landmarks on the
+ * rim of the graph give the tightest bounds. Preprocessing runs one
+ * Dijkstra per landmark (two on a directed graph) and the tables hold
+ * landmarks x vertices distances per direction, laid out vertex-major so a
+ * bound reads contiguous memory. The object is immutable once built and may
+ * be shared by many AStar searches on different threads.
+ *
+ * @tparam Vertex The CsrGraph vertex type
+ * @tparam Weight The CsrGraph weight type
+ */
+template <typename Vertex, typename Weight = double>
+class AltIndex {
+public:
+    using graph_type = graph::CsrGraph<Vertex, Weight>;
+    using size_type = std::size_t;
+    using id_type = typename graph_type::id_type;
+
+    /**
+     * @brief Pick landmarks and compute their distance tables
+     * @param graph Graph the bounds are for; not referenced afterwards
+     * @param landmark_count Landmarks wanted, capped at the vertex count
+     */
+    AltIndex(const graph_type& graph, size_type landmark_count)
+        : m_count(std::min(landmark_count, graph.vertex_count())), m_directed(graph.is_directed()) {
+        const size_type n = graph.vertex_count();
+        m_from.assign(n * m_count, graph_type::infinity());
+        if (m_directed) {
+            m_to.assign(n * m_count, graph_type::infinity());
+        }
+        graph_type reverse = m_directed ? graph.transpose() : graph_type();
+
+        // Distance from the nearest landmark so far; all infinity() at first
+        std::vector<Weight> nearest(n, graph_type::infinity());
+        std::vector<bool> chosen(n, false);
+        id_type next = n > 0 ? farthest(graph.dijkstra_all(graph.vertex_of(0)), chosen) : 0;
+        for (size_type i = 0; i < m_count; ++i) {
+            m_landmarks.push_back(next);
+            chosen[next] = true;
+
+            std::vector<Weight> from = graph.dijkstra_all(graph.vertex_of(next));
+            for (size_type v = 0; v < n; ++v) {
+                m_from[v * m_count + i] = from[v];
+                nearest[v] = std::min(nearest[v], from[v]);
+            }
+            if (m_directed) {
+                std::vector<Weight> to = reverse.dijkstra_all(reverse.vertex_of(next));
+                for (size_type v = 0; v < n; ++v) {
+                    m_to[v * m_count + i] = to[v];
+                }
+            }
+            next = farthest(nearest, chosen);
+        }
+    }
+
+    /**
+     * @brief Chosen landmark ids, in the order they were picked
+     */
+    const std::vector<id_type>& landmarks() const noexcept { return m_landmarks; }
+
+    /**
+     * @brief Lower bound on dist(v, target); 0 if no landmark constrains it
+     * @param v Id in [0, vertex_count())
+     * @param target Id in [0, vertex_count())
+     */
+    Weight lower_bound(id_type v, id_type target) const {
+        Weight best{0};
+        const Weight* from_v = m_from.data() + static_cast<size_type>(v) * m_count;
+        const Weight* from_t = m_from.data() + static_cast<size_type>(target) * m_count;
+        const Weight* to_v = m_directed ? m_to.data() + static_cast<size_type>(v) * m_count : from_v;
+        const Weight* to_t = m_directed ? m_to.data() + static_cast<size_type>(target) * m_count : from_t;
+        const Weight INF = graph_type::infinity();
+        for (size_type i = 0; i < m_count; ++i) {
+            // A term with an unreachable side bounds nothing useful; skip it
+            if (from_v[i] != INF && from_t[i] != INF && from_v[i] < from_t[i]) {
+                best = std::max(best, static_cast<Weight>(from_t[i] - from_v[i]));
+            }
+            if (to_v[i] != INF && to_t[i] != INF && to_t[i] < to_v[i]) {
+                best = std::max(best, static_cast<Weight>(to_v[i] - to_t[i]));
+            }
+        }
+        return best;
+    }
+
+    /**
+     * @brief Heuristic for AStar::run towards target
+     * @return Callable id_type -> Weight; valid while this object lives
+     */
+    auto heuristic(id_type target) const {
+        return [this, target](id_type v) { return lower_bound(v, target); };
+    }
+
+private:
+    size_type m_count;
+    bool m_directed;
+    std::vector<id_type> m_landmarks;
+    std::vector<Weight> m_from;   ///< m_from[v * m_count + i] = dist(landmark i, v)
+    std::vector<Weight> m_to;     ///< m_to[v * m_count + i] = dist(v, landmark i); directed only
+
+    /**
+     * @brief Unchosen id with the largest distance (infinity() counts as largest)
+     */
+    static id_type farthest(const std::vector<Weight>& dist, const std::vector<bool>& chosen) {
+        id_type best = 0;
+        bool found = false;
+        for (size_type v = 0; v < dist.size(); ++v) {
+            if (!chosen[v] && (!found || dist[best] < dist[v])) {
+                best = static_cast<id_type>(v);
+                found = true;
+            }
+        }
+        return best;
+    }
+};
+
+/**
+ * @brief Single-source distances with Dial's bucket queue
+ * @param graph Graph with non-negative integer weights
+ * @param source Id in [0, vertex_count())
+ * @return Distance per id, CsrGraph::infinity() if unreachable
+ * @throws std::out_of_range if source is out of range
+ * @throws std::invalid_argument if a weight is negative
+ *
+ * Tentative distances all lie in [d, d + C] where d is the distance being
+ * settled and C the largest weight, so C + 1 buckets used as a ring keep
+ * them in order. Each bucket is a doubly linked list threaded through
+ * per-vertex arrays, so lowering a distance unlinks the vertex instead of
+ * leaving a stale entry. Time O(V * C + E), memory O(V + C): the right
+ * choice when C is small (hop costs, rounded travel times), a heap when it
+ * is not.
+ */
+template <typename Vertex, typename Weight>
+std::vector<Weight> dial_dijkstra(const graph::CsrGraph<Vertex, Weight>& graph,
+                                  typename graph::CsrGraph<Vertex, Weight>::id_type source) {
+    static_assert(std::is_integral<Weight>::value, "dial_dijkstra needs integer weights");
+    using graph_type = graph::CsrGraph<Vertex, Weight>;
+    using id_type = typename graph_type::id_type;
+    constexpr id_type NONE = std::numeric_limits<id_type>::max();
+
+    const std::size_t n = graph.vertex_count();
+    if (source >= n) {
+        throw std::out_of_range("dial_dijkstra: source out of range");
+    }
+    Weight max_weight = 0;
+    for (Weight w : graph.weights()) {
+        if constexpr (std::is_signed<Weight>::value) {
+            if (w < 0) {
+                throw std::invalid_argument("dial_dijkstra: negative edge weight");
+            }
+        }
+        max_weight = std::max(max_weight, w);
+    }
+
+    const std::size_t ring = static_cast<std::size_t>(max_weight) + 1;
+    std::vector<Weight> dist(n, graph_type::infinity());
+    std::vector<id_type> head(ring, NONE);
+    std::vector<id_type> next(n, NONE);
+    std::vector<id_type> prev(n, NONE);
+    std::vector<bool> queued(n, false);
+    std::size_t queued_count = 0;
+
+    auto link = [&](id_type v) {
+        std::size_t bucket = static_cast<std::size_t>(dist[v]) % ring;
+        next[v] = head[bucket];
+        prev[v] = NONE;
+        if (head[bucket] != NONE) {
+            prev[head[bucket]] = v;
+        }
+        head[bucket] = v;
+        queued[v] = true;
+        ++queued_count;
+    };
+    auto unlink = [&](id_type v) {
+        if (prev[v] != NONE) {
+            next[prev[v]] = next[v];
+        } else {
+            head[static_cast<std::size_t>(dist[v]) % ring] = next[v];
+        }
+        if (next[v] != NONE) {
+            prev[next[v]] = prev[v];
+        }
+        queued[v] = false;
+        --queued_count;
+    };
+
+    dist[source] = 0;
+    link(source);
+    for (std::size_t current = 0; queued_count > 0; ++current) {
+        std::size_t bucket = current % ring;
+        // Zero-weight arcs refill this bucket; drain it before moving on
+        while (head[bucket] != NONE) {
+            id_type u = head[bucket];
+            unlink(u);
+            for (std::size_t e = graph.offsets()[u]; e < graph.offsets()[u + 1]; ++e) {
+                id_type v = graph.targets()[e];
+                Weight new_dist = dist[u] + graph.weights()[e];
+                if (new_dist < dist[v]) {
+                    if (queued[v]) {
+                        unlink(v);
+                    }
+                    dist[v] = new_dist;
+                    link(v);
+                }
+            }
+        }
+    }
+
+    return dist;
+}
+
+} // namespace algorithm
+} // namespace mylib
+
+#endif // MYLIB_ALGORITHM_SHORTEST_PATHS_HPP
@@ -9,7 +9,7 @@
  * - Iterator-based interface (works with any container)
  * - Custom comparator support
  * - Stability options
- * - Parallel execution hints
+ * - Parallel QuickSort on a work-stealing ThreadPool
  * - Sorting statistics and analysis
  * - Partial sorting capabilities
  * - Key-based sorting (like Python's key parameter)
@@ -30,6 +30,9 @@
 #include <random>
 #include <chrono>
 #include <type_traits>
+#include <mutex>
+
+#include "algorithm/thread_pool.hpp"
 
 namespace mylib {
 namespace algorithm {
@@ -75,7 +78,7 @@ struct SortConfig {
     bool collect_stats = false;         ///< Whether to collect statistics
     bool stable = false;                ///< Whether to use stable sorting
     std::size_t insertion_threshold = 16; ///< Threshold for switching to insertion sort
-    std::size_t parallel_threshold = 10000; ///< Threshold for parallel execution (hint)
+    std::size_t parallel_threshold = 10000; ///< Ranges at or below this size are sorted sequentially
 };
 
 // ============================================
@@ -197,6 +200,11 @@ public:
         return *this;
     }
 
+    Sorter& set_parallel_threshold(std::size_t threshold) {
+        m_config.parallel_threshold = threshold;
+        return *this;
+    }
+
     // ============================================
     // Container-based sorting (convenience)
     // ============================================
@@ -236,6 +244,13 @@ public:
         return insertion_sort_range(container.begin(), container.end());
     }
 
+    /**
+     * @brief Sort using QuickSort, sorting partitions in parallel on pool
+     */
+    SortStats parallel_quick_sort(std::vector<T>& container, ThreadPool& pool) {
+        return parallel_quick_sort_range(container.begin(), container.end(), pool);
+    }
+
     // ============================================
     // Iterator-based sorting
     // ============================================
@@ -260,6 +275,33 @@ public:
         return stats;
     }
 
+    /**
+     * @brief Sort range using QuickSort with fork-join parallelism
+     *
+     * Each partition step hands the smaller side to the pool as a task and
+     * keeps partitioning the larger side; ranges of at most
+     * parallel_threshold elements are sorted sequentially. The comparator
+     * is called concurrently from several threads.
+     */
+    template <typename RandomIt>
+    SortStats parallel_quick_sort_range(RandomIt first, RandomIt last, ThreadPool& pool) {
+        SortStats stats;
+        auto start_time = std::chrono::high_resolution_clock::now();
+
+        auto comp = get_effective_compare();
+        // Declared before group: if this frame unwinds, ~TaskGroup waits for
+        // tasks that still lock the mutex and update stats
+        std::mutex stats_mutex;
+        TaskGroup group(pool);
+        parallel_quick_sort_impl(first, last, comp, group,
+                                 m_config.collect_stats ? &stats : nullptr, stats_mutex);
+        group.wait();
+
+        auto end_time = std::chrono::high_resolution_clock::now();
+        stats.elapsed_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+        return stats;
+    }
+
     /**
      * @brief Sort range using MergeSort
      */
@@ -498,6 +540,48 @@ private:
         insertion_sort_impl(first, last, comp, stats);
     }
 
+    /**
+     * @brief Partition large ranges, spawning the smaller side as a task
+     * @param shared_stats Statistics to merge into (nullptr when not collecting)
+     */
+    template <typename RandomIt, typename Compare>
+    void parallel_quick_sort_impl(RandomIt first, RandomIt last, Compare comp, TaskGroup& group,
+                                  SortStats* shared_stats, std::mutex& stats_mutex) {
+        SortStats local;
+        while (last - first > static_cast<std::ptrdiff_t>(m_config.parallel_threshold) &&
+               last - first > static_cast<std::ptrdiff_t>(m_config.insertion_threshold)) {
+            RandomIt pivot;
+            if (shared_stats) {
+                pivot = median_of_three(first, first + (last - first) / 2, last - 1, comp, local);
+                pivot = partition_impl(first, last, pivot, comp, local);
+            } else {
+                pivot = median_of_three(first, first + (last - first) / 2, last - 1, comp);
+                pivot = partition_impl(first, last, pivot, comp);
+            }
+
+            RandomIt left_first = first, left_last = pivot;
+            RandomIt right_first = pivot + 1, right_last = last;
+            if (left_last - left_first > right_last - right_first) {
+                std::swap(left_first, right_first);
+                std::swap(left_last, right_last);
+            }
+            // Spawn the smaller side, keep partitioning the larger one
+            group.run([this, left_first, left_last, comp, &group, shared_stats, &stats_mutex] {
+                parallel_quick_sort_impl(left_first, left_last, comp, group, shared_stats, stats_mutex);
+            });
+            first = right_first;
+            last = right_last;
+        }
+
+        if (shared_stats) {
+            quick_sort_impl(first, last, comp, local);
+            std::lock_guard<std::mutex> lock(stats_mutex);
+            *shared_stats += local;
+        } else {
+            quick_sort_impl(first, last, comp);
+        }
+    }
+
     template <typename RandomIt, typename Compare>
     RandomIt median_of_three(RandomIt a, RandomIt b, RandomIt c, Compare comp) {
         if (comp(*a, *b)) {
@@ -519,8 +603,10 @@ private:
 
     template <typename RandomIt, typename Compare>
     RandomIt partition_impl(RandomIt first, RandomIt last, RandomIt pivot, Compare comp) {
-        auto pivot_value = std::move(*pivot);
+        // Park the pivot at the end and compare against it in place (moving
+        // it out would leave a moved-from element in the range)
         std::iter_swap(pivot, last - 1);
+        const auto& pivot_value = *(last - 1);
         
         RandomIt store = first;
         for (RandomIt it = first; it != last - 1; ++it) {
@@ -535,8 +621,8 @@ private:
 
     template <typename RandomIt, typename Compare>
     RandomIt partition_impl(RandomIt first, RandomIt last, RandomIt pivot, Compare comp, SortStats& stats) {
-        auto pivot_value = std::move(*pivot);
         std::iter_swap(pivot, last - 1);
+        const auto& pivot_value = *(last - 1);
         ++stats.swaps;
         
         RandomIt store = first;
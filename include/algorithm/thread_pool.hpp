@@ -0,0 +1,370 @@
+/**
+ * @file thread_pool.hpp
+ * @brief Work-stealing thread pool and fork-join task groups
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ *
+ * Execution layer for the library's parallel algorithms.
+ *
+ * Each worker owns a linear::WorkStealingDeque of tasks:
+ * - A task spawned on a worker goes to the bottom of that worker's deque
+ *   and is normally run by the same worker next (depth-first, cache-hot).
+ * - An idle worker steals from the top of another worker's deque, taking
+ *   the oldest and usually largest piece of work.
+ * - Tasks submitted from outside the pool go to a shared injection queue.
+ *
+ * TaskGroup provides fork-join: run() spawns tasks, wait() blocks until all
+ * of them (and anything they spawned into the same group) have finished.
+ * A thread waiting in wait() runs pending tasks instead of sleeping, so
+ * nested fork-join (parallel recursion) cannot starve the pool.
+ *
+ * @code
+ * ThreadPool pool;
+ * TaskGroup group(pool);
+ * group.run([&] { left = solve(a); });
+ * group.run([&] { right = solve(b); });
+ * group.wait();
+ *
+ * auto answer = pool.submit([] { return 42; });   // std::future<int>
+ * @endcode
+ *
+ * Copyright (c) 2026 Jinhyeok
+ * MIT License
+ */
+
+#ifndef MYLIB_ALGORITHM_THREAD_POOL_HPP
+#define MYLIB_ALGORITHM_THREAD_POOL_HPP
+
+#include "linear/work_stealing_deque.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mylib {
+namespace algorithm {
+
+class TaskGroup;
+
+/**
+ * @class ThreadPool
+ * @brief Fixed set of worker threads scheduling tasks by work stealing
+ *
+ * The destructor runs every task still queued, then joins the workers.
+ */
+class ThreadPool {
+public:
+    using size_type = std::size_t;
+
+    /**
+     * @brief Start a pool
+     * @param threads Number of workers (0 selects default_thread_count())
+     */
+    explicit ThreadPool(size_type threads = 0) {
+        if (threads == 0) {
+            threads = default_thread_count();
+        }
+        m_queues.reserve(threads);
+        for (size_type i = 0; i < threads; ++i) {
+            m_queues.push_back(std::make_unique<linear::WorkStealingDeque<Task*>>());
+        }
+        m_workers.reserve(threads);
+        for (size_type i = 0; i < threads; ++i) {
+            m_workers.emplace_back([this, i] { worker_loop(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_sleep_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+        for (std::thread& worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    /** @brief Number of worker threads */
+    size_type thread_count() const noexcept { return m_workers.size(); }
+
+    /** @brief Hardware concurrency, at least 1 */
+    static size_type default_thread_count() noexcept {
+        unsigned n = std::thread::hardware_concurrency();
+        return n == 0 ? 1 : n;
+    }
+
+    /**
+     * @brief Run a callable on the pool
+     * @return Future for its result (exceptions are delivered through it)
+     *
+     * Blocking on the future from inside a pool task can deadlock a small
+     * pool; use TaskGroup for nested parallelism.
+     */
+    template <typename F>
+    auto submit(F&& func) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(func));
+        std::future<Result> future = task->get_future();
+        schedule(new Task{[task] { (*task)(); }, nullptr});
+        return future;
+    }
+
+private:
+    friend class TaskGroup;
+
+    struct Task {
+        std::function<void()> body;
+        TaskGroup* group;   ///< Group to notify, or nullptr for submit()
+    };
+
+    /**
+     * @brief Identity of the calling thread if it is a worker
+     */
+    struct WorkerSlot {
+        ThreadPool* pool = nullptr;
+        size_type index = 0;
+    };
+
+    static WorkerSlot& current_worker() noexcept {
+        thread_local WorkerSlot slot;
+        return slot;
+    }
+
+    /**
+     * @brief Index of the calling worker in this pool, or thread_count() if none
+     */
+    size_type own_index() const noexcept {
+        const WorkerSlot& slot = current_worker();
+        return slot.pool == this ? slot.index : m_workers.size();
+    }
+
+    /**
+     * @brief Queue a task: the worker's own deque, else the injection queue
+     *
+     * Takes ownership of task; if queueing throws, the task is deleted and
+     * the pending count restored before the exception propagates.
+     */
+    void schedule(Task* task) {
+        m_pending.fetch_add(1, std::memory_order_seq_cst);
+        try {
+            size_type self = own_index();
+            if (self < m_queues.size()) {
+                m_queues[self]->push(task);
+            } else {
+                std::lock_guard<std::mutex> lock(m_inject_mutex);
+                m_injected.push_back(task);
+            }
+        } catch (...) {
+            m_pending.fetch_sub(1, std::memory_order_relaxed);
+            delete task;
+            throw;
+        }
+        if (m_sleepers.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(m_sleep_mutex);
+            m_wake.notify_one();
+        }
+    }
+
+    /**
+     * @brief Take one task: own deque, then injection queue, then steal
+     * @param self Index of the calling worker, or thread_count() for outsiders
+     */
+    Task* find_task(size_type self) {
+        size_type count = m_queues.size();
+        if (self < count) {
+            if (std::optional<Task*> task = m_queues[self]->pop()) {
+                return take(*task);
+            }
+        }
+        {
+            std::unique_lock<std::mutex> lock(m_inject_mutex, std::try_to_lock);
+            if (lock.owns_lock() && !m_injected.empty()) {
+                Task* task = m_injected.front();
+                m_injected.pop_front();
+                return take(task);
+            }
+        }
+        size_type start = self < count ? self + 1 : 0;
+        for (size_type k = 0; k < count; ++k) {
+            size_type victim = (start + k) % count;
+            if (victim == self) {
+                continue;
+            }
+            if (std::optional<Task*> task = m_queues[victim]->steal()) {
+                return take(*task);
+            }
+        }
+        return nullptr;
+    }
+
+    Task* take(Task* task) noexcept {
+        m_pending.fetch_sub(1, std::memory_order_relaxed);
+        return task;
+    }
+
+    /**
+     * @brief Run one queued task on the calling thread
+     * @return false if no task could be found
+     */
+    bool run_one() {
+        Task* task = find_task(own_index());
+        if (task == nullptr) {
+            return false;
+        }
+        execute(task);
+        return true;
+    }
+
+    inline void execute(Task* task);
+
+    void worker_loop(size_type index) {
+        current_worker() = WorkerSlot{this, index};
+        for (;;) {
+            if (Task* task = find_task(index)) {
+                execute(task);
+                continue;
+            }
+            if (m_pending.load(std::memory_order_seq_cst) > 0) {
+                // A task is being queued or another thief won the race
+                std::this_thread::yield();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(m_sleep_mutex);
+            m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+            m_wake.wait(lock, [this] {
+                return m_stopping || m_pending.load(std::memory_order_seq_cst) > 0;
+            });
+            m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+            if (m_stopping && m_pending.load(std::memory_order_seq_cst) == 0) {
+                return;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<linear::WorkStealingDeque<Task*>>> m_queues;  ///< One per worker
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_inject_mutex;
+    std::deque<Task*> m_injected;                 ///< Tasks from non-worker threads
+
+    std::atomic<size_type> m_pending{0};          ///< Queued tasks not yet taken
+    std::atomic<size_type> m_sleepers{0};         ///< Workers blocked on m_wake
+    std::mutex m_sleep_mutex;
+    std::condition_variable m_wake;
+    bool m_stopping = false;                      ///< Guarded by m_sleep_mutex
+};
+
+/**
+ * @class TaskGroup
+ * @brief Set of tasks that can be waited on together (fork-join)
+ *
+ * run() may be called from any thread, including from tasks of the same
+ * group. The first exception thrown by a task is rethrown from wait().
+ * The destructor waits for outstanding tasks but swallows their exceptions.
+ */
+class TaskGroup {
+public:
+    explicit TaskGroup(ThreadPool& pool) noexcept : m_pool(pool) {}
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    ~TaskGroup() {
+        try {
+            wait();
+        } catch (...) {
+        }
+    }
+
+    /**
+     * @brief Spawn a task in this group
+     *
+     * If allocating, copying func or queueing throws, the task is not
+     * counted and wait() is unaffected.
+     */
+    template <typename F>
+    void run(F&& func) {
+        auto* task = new ThreadPool::Task{std::forward<F>(func), this};
+        // Counted before it is queued: a worker may finish it at once
+        m_outstanding.fetch_add(1, std::memory_order_relaxed);
+        try {
+            m_pool.schedule(task);
+        } catch (...) {
+            m_outstanding.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+    }
+
+    /**
+     * @brief Run pending tasks until every task of the group has finished
+     * @throws The first exception thrown by a task of the group
+     */
+    void wait() {
+        while (m_outstanding.load(std::memory_order_acquire) != 0) {
+            if (!m_pool.run_one()) {
+                std::this_thread::yield();
+            }
+        }
+        if (m_error) {
+            std::exception_ptr error = m_error;
+            m_error = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    friend class ThreadPool;
+
+    void record_error(std::exception_ptr error) {
+        std::lock_guard<std::mutex> lock(m_error_mutex);
+        if (!m_error) {
+            m_error = std::move(error);
+        }
+    }
+
+    ThreadPool& m_pool;
+    std::atomic<std::size_t> m_outstanding{0};
+    std::mutex m_error_mutex;
+    std::exception_ptr m_error;
+};
+
+// ============================================
+// ThreadPool members that need the complete TaskGroup
+// ============================================
+
+inline void ThreadPool::execute(Task* task) {
+    TaskGroup* group = task->group;
+    try {
+        task->body();
+    } catch (...) {
+        if (group != nullptr) {
+            group->record_error(std::current_exception());
+        }
+    }
+    delete task;
+    if (group != nullptr) {
+        // Last access to the group: a waiter may destroy it right after
+        group->m_outstanding.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+} // namespace algorithm
+} // namespace mylib
+
+#endif // MYLIB_ALGORITHM_THREAD_POOL_HPP
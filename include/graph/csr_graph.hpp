@@ -0,0 +1,595 @@
+/**
+ * @file csr_graph.hpp
+ * @brief Immutable graph in compressed sparse row (CSR) form
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ *
+ * CsrGraph is a read-only snapshot of a Graph (or of an edge list) laid out
+ * for traversal speed:
+ * - Vertices are renumbered to dense ids 0..n-1
+ * - The out-arcs of vertex u are targets[offsets[u] .. offsets[u + 1]) with
+ *   their weights at the same positions of weights
+ * - Per-vertex algorithm state lives in flat vectors indexed by id instead
+ *   of hash maps keyed by Vertex
+ *
+ * The id <-> Vertex mapping is kept so the traversals accept and report
+ * vertices just like Graph does.
+ *
+ * Copyright (c) 2026 Jinhyeok
+ * MIT License
+ */
+
+#ifndef MYLIB_GRAPH_CSR_GRAPH_HPP
+#define MYLIB_GRAPH_CSR_GRAPH_HPP
+
+#include "graph/graph.hpp"
+#include "tree/indexed_heap.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <unordered_map>
+#include <limits>
+#include <algorithm>
+#include <functional>
+
+namespace mylib {
+namespace graph {
+
+/**
+ * @class CsrGraph
+ * @brief Immutable compressed sparse row graph with dense vertex ids
+ *
+ * Building is O(V + E): ids are assigned in order of first appearance, arcs
+ * are bucketed by source with a counting pass, and each vertex keeps its
+ * neighbours in the order the source listed them. A CsrGraph built from a
+ * Graph therefore visits vertices in the same order as that Graph's bfs()
+ * and dfs().
+ *
+ * Undirected graphs store every edge as two arcs (a self-loop as one), as
+ * Graph does.
+ *
+ * @tparam Vertex The type of vertex identifiers
+ * @tparam Weight The type of edge weights (default: double)
+ */
+template <typename Vertex, typename Weight = double>
+class CsrGraph {
+public:
+    // Type aliases
+    using vertex_type = Vertex;
+    using weight_type = Weight;
+    using size_type = std::size_t;
+    using id_type = std::uint32_t;
+    using Edge = typename Graph<Vertex, Weight>::Edge;
+
+    /**
+     * @brief Default constructor
+     * Creates an empty directed graph
+     */
+    CsrGraph() : m_edge_count(0), m_directed(true) {
+        m_offsets.push_back(0);
+    }
+
+    /**
+     * @brief Snapshot a Graph
+     * @param graph Graph to convert; later changes to it are not reflected
+     * @throws std::length_error if the graph has more vertices than id_type holds
+     */
+    explicit CsrGraph(const Graph<Vertex, Weight>& graph)
+        : m_edge_count(graph.m_edge_count), m_directed(graph.m_directed) {
+        check_vertex_count(graph.m_adj.size());
+        m_vertices.reserve(graph.m_adj.size());
+        m_ids.reserve(graph.m_adj.size());
+        for (const auto& pair : graph.m_adj) {
+            m_ids.emplace(pair.first, static_cast<id_type>(m_vertices.size()));
+            m_vertices.push_back(pair.first);
+        }
+
+        m_offsets.reserve(m_vertices.size() + 1);
+        m_offsets.push_back(0);
+        for (const auto& pair : graph.m_adj) {
+            m_offsets.push_back(m_offsets.back() + pair.second.size());
+        }
+
+        m_targets.reserve(m_offsets.back());
+        m_weights.reserve(m_offsets.back());
+        for (const auto& pair : graph.m_adj) {
+            for (const auto& neighbor : pair.second) {
+                m_targets.push_back(m_ids.find(neighbor.vertex)->second);
+                m_weights.push_back(neighbor.weight);
+            }
+        }
+    }
+
+    /**
+     * @brief Build from an edge list
+     * @param edges Edges to store; vertices are the edge endpoints
+     * @param directed true for directed graph, false for undirected
+     * @throws std::length_error if there are more vertices than id_type holds
+     *
+     * Unlike Graph::add_edge, repeated edges are not merged: each one becomes
+     * its own arc.
+     */
+    explicit CsrGraph(const std::vector<Edge>& edges, bool directed = true)
+        : m_edge_count(edges.size()), m_directed(directed) {
+        std::vector<id_type> from(edges.size());
+        std::vector<id_type> to(edges.size());
+        for (size_type i = 0; i < edges.size(); ++i) {
+            from[i] = intern(edges[i].from);
+            to[i] = intern(edges[i].to);
+        }
+
+        // Counting pass: offsets[u + 1] is the out-degree of u, then prefix sums
+        m_offsets.assign(m_vertices.size() + 1, 0);
+        for (size_type i = 0; i < edges.size(); ++i) {
+            ++m_offsets[from[i] + 1];
+            if (!directed && from[i] != to[i]) {
+                ++m_offsets[to[i] + 1];
+            }
+        }
+        for (size_type u = 0; u < m_vertices.size(); ++u) {
+            m_offsets[u + 1] += m_offsets[u];
+        }
+
+        m_targets.resize(m_offsets.back());
+        m_weights.resize(m_offsets.back());
+        std::vector<size_type> cursor(m_offsets.begin(), m_offsets.end() - 1);
+        for (size_type i = 0; i < edges.size(); ++i) {
+            size_type slot = cursor[from[i]]++;
+            m_targets[slot] = to[i];
+            m_weights[slot] = edges[i].weight;
+            if (!directed && from[i] != to[i]) {
+                slot = cursor[to[i]]++;
+                m_targets[slot] = from[i];
+                m_weights[slot] = edges[i].weight;
+            }
+        }
+    }
+
+    // Properties
+    /**
+     * @brief Check if graph is directed
+     * @return true if directed, false if undirected
+     */
+    bool is_directed() const noexcept { return m_directed; }
+
+    /**
+     * @brief Check if graph is empty (no vertices)
+     * @return true if empty
+     */
+    bool empty() const noexcept { return m_vertices.empty(); }
+
+    /**
+     * @brief Get number of vertices
+     * @return Number of vertices
+     */
+    size_type vertex_count() const noexcept { return m_vertices.size(); }
+
+    /**
+     * @brief Get number of edges (an undirected edge counts once)
+     * @return Number of edges
+     */
+    size_type edge_count() const noexcept { return m_edge_count; }
+
+    // Id mapping
+    /**
+     * @brief Check if vertex exists
+     * @param vertex Vertex to check
+     * @return true if exists
+     */
+    bool has_vertex(const Vertex& vertex) const {
+        return m_ids.find(vertex) != m_ids.end();
+    }
+
+    /**
+     * @brief Get the dense id of a vertex
+     * @param vertex Vertex to look up
+     * @return Id in [0, vertex_count())
+     * @throws std::out_of_range if vertex not found
+     */
+    id_type id_of(const Vertex& vertex) const {
+        auto it = m_ids.find(vertex);
+        if (it == m_ids.end()) {
+            throw std::out_of_range("CsrGraph::id_of: vertex not found");
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Get the vertex with a dense id
+     * @param id Id in [0, vertex_count())
+     * @return Vertex
+     * @throws std::out_of_range if id is out of range
+     */
+    const Vertex& vertex_of(id_type id) const {
+        if (id >= m_vertices.size()) {
+            throw std::out_of_range("CsrGraph::vertex_of: id out of range");
+        }
+        return m_vertices[id];
+    }
+
+    // Raw arrays
+    /**
+     * @brief Row offsets: the arcs of id u are [offsets()[u], offsets()[u + 1])
+     * @return vertex_count() + 1 offsets into targets() and weights()
+     */
+    const std::vector<size_type>& offsets() const noexcept { return m_offsets; }
+
+    /**
+     * @brief Arc targets, grouped by source id
+     */
+    const std::vector<id_type>& targets() const noexcept { return m_targets; }
+
+    /**
+     * @brief Arc weights, parallel to targets()
+     */
+    const std::vector<Weight>& weights() const noexcept { return m_weights; }
+
+    /**
+     * @brief Get out-degree of an id
+     * @param id Id in [0, vertex_count())
+     * @return Number of out-arcs
+     */
+    size_type degree(id_type id) const {
+        return m_offsets[id + 1] - m_offsets[id];
+    }
+
+    // Traversals
+    /**
+     * @brief Breadth-first search traversal
+     * @param start Starting vertex; nothing is visited if it does not exist
+     * @param visitor Callable invoked with each visited vertex
+     */
+    template <typename Visitor>
+    void bfs(const Vertex& start, Visitor visitor) const {
+        auto it = m_ids.find(start);
+        if (it == m_ids.end()) {
+            return;
+        }
+
+        // The queue is a vector: every id is enqueued at most once
+        std::vector<bool> visited(m_vertices.size(), false);
+        std::vector<id_type> queue;
+        queue.reserve(m_vertices.size());
+        queue.push_back(it->second);
+        visited[it->second] = true;
+
+        for (size_type head = 0; head < queue.size(); ++head) {
+            id_type u = queue[head];
+            visitor(m_vertices[u]);
+            for (size_type e = m_offsets[u]; e < m_offsets[u + 1]; ++e) {
+                id_type v = m_targets[e];
+                if (!visited[v]) {
+                    visited[v] = true;
+                    queue.push_back(v);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Depth-first search traversal
+     * @param start Starting vertex; nothing is visited if it does not exist
+     * @param visitor Callable invoked with each visited vertex
+     */
+    template <typename Visitor>
+    void dfs(const Vertex& start, Visitor visitor) const {
+        auto it = m_ids.find(start);
+        if (it == m_ids.end()) {
+            return;
+        }
+
+        std::vector<bool> visited(m_vertices.size(), false);
+        std::vector<id_type> stack;
+        stack.push_back(it->second);
+
+        while (!stack.empty()) {
+            id_type u = stack.back();
+            stack.pop_back();
+            if (visited[u]) {
+                continue;
+            }
+
+            visited[u] = true;
+            visitor(m_vertices[u]);
+            for (size_type e = m_offsets[u]; e < m_offsets[u + 1]; ++e) {
+                if (!visited[m_targets[e]]) {
+                    stack.push_back(m_targets[e]);
+                }
+            }
+        }
+    }
+
+    // Path finding
+    /**
+     * @brief Find shortest path using Dijkstra (weighted, non-negative)
+     * @param from Source vertex
+     * @param to Destination vertex
+     * @return Pair of (path, total distance), empty path if no path
+     */
+    std::pair<std::vector<Vertex>, Weight> dijkstra(const Vertex& from, const Vertex& to) const {
+        auto source = m_ids.find(from);
+        auto target = m_ids.find(to);
+        if (source == m_ids.end() || target == m_ids.end()) {
+            return {{}, Weight{}};
+        }
+        if (source->second == target->second) {
+            return {{from}, Weight{0}};
+        }
+
+        std::vector<id_type> parent(m_vertices.size());
+        std::vector<Weight> dist = shortest_distances(source->second, target->second, &parent);
+        if (dist[target->second] == infinity()) {
+            return {{}, Weight{}};
+        }
+
+        std::vector<Vertex> path;
+        for (id_type v = target->second; v != source->second; v = parent[v]) {
+            path.push_back(m_vertices[v]);
+        }
+        path.push_back(from);
+        std::reverse(path.begin(), path.end());
+        return {path, dist[target->second]};
+    }
+
+    /**
+     * @brief Find all shortest distances from a vertex (Dijkstra)
+     * @param from Source vertex
+     * @return Distance to each id, std::numeric_limits<Weight>::max() if
+     *         unreachable; empty if from does not exist
+     */
+    std::vector<Weight> dijkstra_all(const Vertex& from) const {
+        auto source = m_ids.find(from);
+        if (source == m_ids.end()) {
+            return {};
+        }
+        return shortest_distances(source->second, NO_ID, nullptr);
+    }
+
+    // Graph properties
+    /**
+     * @brief Topological sort (Kahn's algorithm)
+     * @return Vector of vertices in topological order
+     * @throws std::runtime_error if the graph is undirected or has a cycle
+     */
+    std::vector<Vertex> topological_sort() const {
+        if (!m_directed) {
+            throw std::runtime_error("CsrGraph::topological_sort: only valid for directed graphs");
+        }
+
+        std::vector<size_type> in_degree(m_vertices.size(), 0);
+        for (id_type v : m_targets) {
+            ++in_degree[v];
+        }
+
+        std::vector<id_type> order;
+        order.reserve(m_vertices.size());
+        for (size_type u = 0; u < m_vertices.size(); ++u) {
+            if (in_degree[u] == 0) {
+                order.push_back(static_cast<id_type>(u));
+            }
+        }
+        for (size_type head = 0; head < order.size(); ++head) {
+            id_type u = order[head];
+            for (size_type e = m_offsets[u]; e < m_offsets[u + 1]; ++e) {
+                if (--in_degree[m_targets[e]] == 0) {
+                    order.push_back(m_targets[e]);
+                }
+            }
+        }
+
+        // Vertices on or behind a cycle never reach in-degree 0
+        if (order.size() != m_vertices.size()) {
+            throw std::runtime_error("CsrGraph::topological_sort: graph contains a cycle");
+        }
+
+        std::vector<Vertex> result;
+        result.reserve(order.size());
+        for (id_type u : order) {
+            result.push_back(m_vertices[u]);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Get connected components
+     * @return Vector of vectors, each containing vertices in a component
+     *
+     * For directed graphs, returns weakly connected components: arcs are
+     * followed in both directions through a temporary reverse index.
+     */
+    std::vector<std::vector<Vertex>> connected_components() const {
+        std::vector<size_type> in_offsets;
+        std::vector<id_type> sources;
+        if (m_directed) {
+            reverse_arcs(in_offsets, sources);
+        }
+
+        std::vector<std::vector<Vertex>> components;
+        std::vector<bool> visited(m_vertices.size(), false);
+        std::vector<id_type> queue;
+        queue.reserve(m_vertices.size());
+
+        for (size_type root = 0; root < m_vertices.size(); ++root) {
+            if (visited[root]) {
+                continue;
+            }
+            queue.clear();
+            queue.push_back(static_cast<id_type>(root));
+            visited[root] = true;
+
+            std::vector<Vertex> component;
+            for (size_type head = 0; head < queue.size(); ++head) {
+                id_type u = queue[head];
+                component.push_back(m_vertices[u]);
+                for (size_type e = m_offsets[u]; e < m_offsets[u + 1]; ++e) {
+                    if (!visited[m_targets[e]]) {
+                        visited[m_targets[e]] = true;
+                        queue.push_back(m_targets[e]);
+                    }
+                }
+                if (m_directed) {
+                    for (size_type e = in_offsets[u]; e < in_offsets[u + 1]; ++e) {
+                        if (!visited[sources[e]]) {
+                            visited[sources[e]] = true;
+                            queue.push_back(sources[e]);
+                        }
+                    }
+                }
+            }
+            components.push_back(std::move(component));
+        }
+
+        return components;
+    }
+
+    /**
+     * @brief Build the incoming-arc index
+     * @param in_offsets Receives vertex_count() + 1 offsets into sources
+     * @param sources Receives arc sources: the arcs into id v come from
+     *        sources[in_offsets[v] .. in_offsets[v + 1])
+     *
+     * For undirected graphs this reproduces offsets() and targets().
+     */
+    void reverse_arcs(std::vector<size_type>& in_offsets, std::vector<id_type>& sources) const {
+        reverse_into(in_offsets, sources, nullptr);
+    }
+
+    /**
+     * @brief Create a transposed (reversed) graph
+     * @return Graph with every arc reversed and the same vertex ids
+     *
+     * Searches that run backwards from a target (bidirectional Dijkstra,
+     * distances to a landmark) run forwards on the transpose.
+     */
+    CsrGraph transpose() const {
+        CsrGraph reversed;
+        reversed.m_vertices = m_vertices;
+        reversed.m_ids = m_ids;
+        reversed.m_edge_count = m_edge_count;
+        reversed.m_directed = m_directed;
+        if (m_directed) {
+            reverse_into(reversed.m_offsets, reversed.m_targets, &reversed.m_weights);
+        } else {
+            reversed.m_offsets = m_offsets;
+            reversed.m_targets = m_targets;
+            reversed.m_weights = m_weights;
+        }
+        return reversed;
+    }
+
+    /**
+     * @brief Distance value reported for unreachable ids
+     */
+    static Weight infinity() noexcept { return std::numeric_limits<Weight>::max(); }
+
+private:
+    static constexpr id_type NO_ID = std::numeric_limits<id_type>::max();
+
+    std::vector<size_type> m_offsets;       ///< vertex_count() + 1 row offsets
+    std::vector<id_type> m_targets;         ///< Arc targets grouped by source
+    std::vector<Weight> m_weights;          ///< Arc weights, parallel to m_targets
+    std::vector<Vertex> m_vertices;         ///< Id -> vertex
+    std::unordered_map<Vertex, id_type> m_ids;  ///< Vertex -> id
+    size_type m_edge_count;                 ///< Number of edges
+    bool m_directed;                        ///< Whether graph is directed
+
+    static void check_vertex_count(size_type count) {
+        // NO_ID itself is reserved as the "no vertex" marker
+        if (count >= NO_ID) {
+            throw std::length_error("CsrGraph: too many vertices for id_type");
+        }
+    }
+
+    /**
+     * @brief Id of a vertex, assigning the next one if it is new
+     */
+    id_type intern(const Vertex& vertex) {
+        auto found = m_ids.find(vertex);
+        if (found != m_ids.end()) {
+            return found->second;
+        }
+        check_vertex_count(m_vertices.size() + 1);
+        id_type id = static_cast<id_type>(m_vertices.size());
+        m_ids.emplace(vertex, id);
+        m_vertices.push_back(vertex);
+        return id;
+    }
+
+    /**
+     * @brief Dijkstra over ids with an indexed 4-ary heap (one entry per id)
+     * @param source Source id
+     * @param target Stop once this id is settled (NO_ID: settle everything)
+     * @param parent If not null, receives the shortest-path tree
+     * @return Distance per id, infinity() if not reached
+     */
+    std::vector<Weight> shortest_distances(id_type source, id_type target,
+                                           std::vector<id_type>* parent) const {
+        std::vector<Weight> dist(m_vertices.size(), infinity());
+        dist[source] = Weight{0};
+
+        tree::MinIndexedHeap<Weight> heap(m_vertices.size());
+        heap.push(source, Weight{0});
+
+        while (!heap.empty()) {
+            auto [u, d] = heap.extract();
+            if (u == target) {
+                break;
+            }
+            for (size_type e = m_offsets[u]; e < m_offsets[u + 1]; ++e) {
+                id_type v = m_targets[e];
+                Weight new_dist = d + m_weights[e];
+                if (new_dist < dist[v]) {
+                    if (heap.contains(v)) {
+                        heap.decrease_key(v, new_dist);
+                    } else {
+                        heap.push(v, new_dist);
+                    }
+                    dist[v] = new_dist;
+                    if (parent != nullptr) {
+                        (*parent)[v] = static_cast<id_type>(u);
+                    }
+                }
+            }
+        }
+
+        return dist;
+    }
+
+    /**
+     * @brief Counting-sort the arcs by target
+     * @param weights If not null, receives the weight of each reversed arc
+     */
+    void reverse_into(std::vector<size_type>& in_offsets, std::vector<id_type>& sources,
+                      std::vector<Weight>* weights) const {
+        in_offsets.assign(m_vertices.size() + 1, 0);
+        for (id_type v : m_targets) {
+            ++in_offsets[v + 1];
+        }
+        for (size_type v = 0; v < m_vertices.size(); ++v) {
+            in_offsets[v + 1] += in_offsets[v];
+        }
+        sources.resize(m_targets.size());
+        if (weights != nullptr) {
+            weights->resize(m_targets.size());
+        }
+        std::vector<size_type> cursor(in_offsets.begin(), in_offsets.end() - 1);
+        for (size_type u = 0; u < m_vertices.size(); ++u) {
+            for (size_type e = m_offsets[u]; e < m_offsets[u + 1]; ++e) {
+                size_type slot = cursor[m_targets[e]]++;
+                sources[slot] = static_cast<id_type>(u);
+                if (weights != nullptr) {
+                    (*weights)[slot] = m_weights[e];
+                }
+            }
+        }
+    }
+};
+
+} // namespace graph
+} // namespace mylib
+
+#endif // MYLIB_GRAPH_CSR_GRAPH_HPP
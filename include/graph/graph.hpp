@@ -30,7 +30,9 @@
 #define MYLIB_GRAPH_GRAPH_HPP
 
 #include <cstddef>
+#include <cstdint>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include <list>
@@ -45,6 +47,109 @@
 namespace mylib {
 namespace graph {
 
+template <typename Vertex, typename Weight>
+class CsrGraph;
+
+/**
+ * @struct DenseVertexTraits
+ * @brief Opt-in hook for vertex types that map to integers
+ *
+ * When enabled, Graph tracks the smallest and largest key among its
+ * vertices. While the keys are compact (their range is at most
+ * detail::DenseVertexRange::SPAN_FACTOR times the vertex count), bfs, dfs,
+ * shortest_path_bfs, has_path, dijkstra and dijkstra_all keep their
+ * visited/distance/parent state in bitsets and flat vectors indexed by
+ * key - min instead of hash containers.
+ *
+ * Integral vertex types are enabled out of the box. Other id types can opt
+ * in with a specialization, e.g. for a wrapper around std::uint32_t:
+ * @code
+ * template <>
+ * struct DenseVertexTraits<NodeId> {
+ *     static constexpr bool enabled = true;
+ *     using key_type = std::uint32_t;
+ *     static key_type key(const NodeId& v) noexcept { return v.value; }
+ * };
+ * @endcode
+ *
+ * @tparam Vertex The type of vertex identifiers
+ */
+template <typename Vertex, typename Enable = void>
+struct DenseVertexTraits {
+    static constexpr bool enabled = false;
+};
+
+template <typename Vertex>
+struct DenseVertexTraits<Vertex, std::enable_if_t<std::is_integral<Vertex>::value &&
+                                                  !std::is_same<Vertex, bool>::value>> {
+    static constexpr bool enabled = true;
+    using key_type = Vertex;
+    static key_type key(const Vertex& vertex) noexcept { return vertex; }
+};
+
+namespace detail {
+
+/**
+ * @class DenseVertexRange
+ * @brief Key range of the vertices a Graph has held; empty unless enabled
+ */
+template <typename Vertex, bool Enabled = DenseVertexTraits<Vertex>::enabled>
+class DenseVertexRange {
+public:
+    void include(const Vertex&) noexcept {}
+    void reset() noexcept {}
+    bool compact(std::size_t) const noexcept { return false; }
+};
+
+template <typename Vertex>
+class DenseVertexRange<Vertex, true> {
+public:
+    using Traits = DenseVertexTraits<Vertex>;
+    using key_type = typename Traits::key_type;
+
+    /// Dense state is used while (max - min) / SPAN_FACTOR < vertex count
+    static constexpr std::size_t SPAN_FACTOR = 4;
+
+    void include(const Vertex& vertex) noexcept {
+        key_type key = Traits::key(vertex);
+        if (m_empty) {
+            m_low = m_high = key;
+            m_empty = false;
+        } else if (key < m_low) {
+            m_low = key;
+        } else if (m_high < key) {
+            m_high = key;
+        }
+    }
+
+    void reset() noexcept { m_empty = true; }
+
+    bool compact(std::size_t vertex_count) const noexcept {
+        return !m_empty && distance(m_high) / SPAN_FACTOR < vertex_count;
+    }
+
+    /// Number of slots a dense state needs; only meaningful if compact()
+    std::size_t span() const noexcept {
+        return m_empty ? 0 : static_cast<std::size_t>(distance(m_high)) + 1;
+    }
+
+    std::size_t index(const Vertex& vertex) const noexcept {
+        return static_cast<std::size_t>(distance(Traits::key(vertex)));
+    }
+
+private:
+    key_type m_low{};
+    key_type m_high{};
+    bool m_empty = true;
+
+    // Unsigned wrap-around gives the exact difference for signed keys too
+    std::uint64_t distance(key_type key) const noexcept {
+        return static_cast<std::uint64_t>(key) - static_cast<std::uint64_t>(m_low);
+    }
+};
+
+} // namespace detail
+
 /**
  * @class Graph
  * @brief A graph implementation using adjacency list representation
@@ -334,6 +439,10 @@ public:
      * @param from Source vertex
      * @param to Destination vertex
      * @return Pair of (path, total distance), empty path if no path
+     *
+     * The queue is a tree::MinIndexedHeap: a vertex whose distance drops
+     * has its entry moved with decrease_key, so the heap holds at most one
+     * entry per vertex.
      */
     std::pair<std::vector<Vertex>, Weight> dijkstra(const Vertex& from, const Vertex& to) const;
 
@@ -341,6 +450,8 @@ public:
      * @brief Find all shortest distances from a vertex (Dijkstra)
      * @param from Source vertex
      * @return Map of vertex to shortest distance
+     *
+     * Uses the same indexed heap as dijkstra().
      */
     std::unordered_map<Vertex, Weight> dijkstra_all(const Vertex& from) const;
 
@@ -399,9 +510,12 @@ public:
     Graph transpose() const;
 
 private:
+    friend class CsrGraph<Vertex, Weight>;    // Reads m_adj directly when converting
+
     AdjacencyMap m_adj;         ///< Adjacency list representation
     size_type m_edge_count;     ///< Number of edges
     bool m_directed;            ///< Whether graph is directed
+    detail::DenseVertexRange<Vertex> m_range;  ///< Key range, only widened until clear()
 
     /**
      * @brief Find neighbor in adjacency list
@@ -0,0 +1,222 @@
+/**
+ * @file bucket_policy.hpp
+ * @brief Bucket sizing and hash-to-bucket reduction policies for HashTable
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ *
+ * A bucket policy decides how many buckets a table may have and how a hash
+ * value is reduced to a bucket index:
+ *
+ * - PrimeBucketPolicy: prime bucket counts, index = hash % count
+ *   (the original HashTable behaviour; tolerant of weak hashes, but pays
+ *   an integer division on every lookup)
+ * - PowerOfTwoBucketPolicy: power-of-two counts, Fibonacci multiply-shift
+ *   (one multiply and one shift; the multiply doubles as the mixing step)
+ * - FastRangeBucketPolicy: any count, Lemire's fastrange
+ *   ((hash * count) >> 64; one widening multiply, uses the high hash bits)
+ *
+ * Hash-quality guard: a policy that only looks at some of the hash bits sets
+ * needs_avalanche. HashTable then runs the hash through mix_hash() first,
+ * unless the hasher declares `using is_avalanching = void;` to promise that
+ * every output bit already depends on every input bit. This keeps the
+ * identity std::hash<int> from piling sequential keys into a few buckets.
+ *
+ * Policy interface:
+ * @code
+ * struct Policy {
+ *     static constexpr bool needs_avalanche;
+ *     static std::size_t round_bucket_count(std::size_t n); // smallest valid count >= n
+ *     static std::size_t index(std::size_t hash, std::size_t bucket_count);
+ * };
+ * @endcode
+ *
+ * Copyright (c) 2026 Jinhyeok
+ * MIT License
+ */
+
+#ifndef MYLIB_HASH_BUCKET_POLICY_HPP
+#define MYLIB_HASH_BUCKET_POLICY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <type_traits>
+
+namespace mylib {
+namespace hash {
+
+namespace detail {
+
+/**
+ * @brief Scramble a hash value so that weak hashes use all bits
+ *
+ * std::hash<int> is the identity on common standard libraries, which would
+ * put sequential keys into neighbouring slots and leave the high bits zero.
+ * The multiply-xorshift finalizer spreads entropy into every output bit.
+ */
+inline std::size_t mix_hash(std::size_t h) noexcept {
+    if constexpr (sizeof(std::size_t) >= 8) {
+        std::uint64_t x = static_cast<std::uint64_t>(h);
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return static_cast<std::size_t>(x);
+    } else {
+        std::uint32_t x = static_cast<std::uint32_t>(h);
+        x ^= x >> 16;
+        x *= 0x85ebca6bU;
+        x ^= x >> 13;
+        x *= 0xc2b2ae35U;
+        x ^= x >> 16;
+        return static_cast<std::size_t>(x);
+    }
+}
+
+/**
+ * @brief True if Hash declares a nested is_avalanching type
+ */
+template <typename Hash, typename = void>
+struct is_avalanching : std::false_type {};
+
+template <typename Hash>
+struct is_avalanching<Hash, std::void_t<typename Hash::is_avalanching>> : std::true_type {};
+
+/**
+ * @brief High half of the full-width product a * b
+ */
+inline std::size_t mul_high(std::size_t a, std::size_t b) noexcept {
+    if constexpr (sizeof(std::size_t) >= 8) {
+#if defined(__SIZEOF_INT128__)
+        __extension__ using uint128 = unsigned __int128;
+        return static_cast<std::size_t>((static_cast<uint128>(a) * b) >> 64);
+#else
+        std::uint64_t a_lo = static_cast<std::uint32_t>(a), a_hi = a >> 32;
+        std::uint64_t b_lo = static_cast<std::uint32_t>(b), b_hi = b >> 32;
+        std::uint64_t lo_lo = a_lo * b_lo;
+        std::uint64_t hi_lo = a_hi * b_lo;
+        std::uint64_t lo_hi = a_lo * b_hi;
+        std::uint64_t cross = (lo_lo >> 32) + static_cast<std::uint32_t>(hi_lo) + lo_hi;
+        return static_cast<std::size_t>(a_hi * b_hi + (hi_lo >> 32) + (cross >> 32));
+#endif
+    } else {
+        return static_cast<std::size_t>(
+            (static_cast<std::uint64_t>(a) * b) >> (sizeof(std::size_t) * 8));
+    }
+}
+
+} // namespace detail
+
+// ============================================
+// Prime Policy
+// ============================================
+
+/**
+ * @struct PrimeBucketPolicy
+ * @brief Prime bucket counts with modulo reduction
+ */
+struct PrimeBucketPolicy {
+    static constexpr bool needs_avalanche = false;
+
+    static std::size_t round_bucket_count(std::size_t n) noexcept {
+        if (n <= 2) return 2;
+        if (n % 2 == 0) ++n;
+
+        while (!is_prime(n)) {
+            n += 2;
+        }
+        return n;
+    }
+
+    static std::size_t index(std::size_t hash, std::size_t bucket_count) noexcept {
+        return hash % bucket_count;
+    }
+
+private:
+    static bool is_prime(std::size_t n) noexcept {
+        if (n < 2) return false;
+        if (n == 2) return true;
+        if (n % 2 == 0) return false;
+
+        std::size_t sqrt_n = static_cast<std::size_t>(std::sqrt(n));
+        for (std::size_t i = 3; i <= sqrt_n; i += 2) {
+            if (n % i == 0) return false;
+        }
+        return true;
+    }
+};
+
+// ============================================
+// Power-of-two Policy
+// ============================================
+
+/**
+ * @struct PowerOfTwoBucketPolicy
+ * @brief Power-of-two bucket counts with Fibonacci (multiply-shift) hashing
+ *
+ * The index is the top log2(bucket_count) bits of hash * 2^64/phi. Every
+ * input bit influences those top bits, so no extra mixing is needed even
+ * for the identity hash.
+ */
+struct PowerOfTwoBucketPolicy {
+    static constexpr bool needs_avalanche = false;
+
+    static std::size_t round_bucket_count(std::size_t n) noexcept {
+        std::size_t count = 2;
+        while (count < n) {
+            count <<= 1;
+        }
+        return count;
+    }
+
+    static std::size_t index(std::size_t hash, std::size_t bucket_count) noexcept {
+        constexpr int bits = static_cast<int>(sizeof(std::size_t) * 8);
+        constexpr std::size_t golden = sizeof(std::size_t) >= 8
+            ? static_cast<std::size_t>(0x9E3779B97F4A7C15ULL)
+            : static_cast<std::size_t>(0x9E3779B9U);
+        return (hash * golden) >> (bits - log2(bucket_count));
+    }
+
+private:
+    static int log2(std::size_t pow2) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(static_cast<unsigned long long>(pow2));
+#else
+        int n = 0;
+        while ((pow2 >>= 1) != 0) {
+            ++n;
+        }
+        return n;
+#endif
+    }
+};
+
+// ============================================
+// Fastrange Policy
+// ============================================
+
+/**
+ * @struct FastRangeBucketPolicy
+ * @brief Arbitrary bucket counts with Lemire's multiply-high reduction
+ *
+ * Maps hash uniformly onto [0, bucket_count) using only its high bits, so
+ * the hash must be avalanching (see needs_avalanche).
+ */
+struct FastRangeBucketPolicy {
+    static constexpr bool needs_avalanche = true;
+
+    static std::size_t round_bucket_count(std::size_t n) noexcept {
+        return n > 0 ? n : 1;
+    }
+
+    static std::size_t index(std::size_t hash, std::size_t bucket_count) noexcept {
+        return detail::mul_high(hash, bucket_count);
+    }
+};
+
+} // namespace hash
+} // namespace mylib
+
+#endif // MYLIB_HASH_BUCKET_POLICY_HPP
@@ -0,0 +1,542 @@
+/**
+ * @file frozen_hash_index.hpp
+ * @brief Immutable, memory-mappable hash index built from a hash table
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ *
+ * FrozenHashIndex turns a finished HashTable (or OpenHashTable) of
+ * trivially copyable keys and values into one flat byte image that can be
+ * written to disk and queried in place. Loading maps the file read-only
+ * with mmap(), so start-up cost no longer grows with the number of
+ * entries, and processes that load the same file share its page-cache
+ * pages.
+ *
+ * File layout (all positions are byte offsets from the start of the image,
+ * so the image is position-independent):
+ *
+ * @code
+ * +----------------------+  0
+ * | FrozenHeader         |  magic, version, type sizes, counts, offsets
+ * +----------------------+  offsets_offset (64-byte aligned)
+ * | uint64 offsets[B+1]  |  bucket b holds entries [offsets[b], offsets[b+1])
+ * +----------------------+  entries_offset (64-byte aligned)
+ * | Entry entries[N]     |  { Key key; Value value; } grouped by bucket
+ * +----------------------+  file_size
+ * @endcode
+ *
+ * There is one bucket per entry (B = max(N, 1)) and the bucket of a key is
+ * fastrange(mix_hash(Hash(key)), B), so a lookup touches the offset table
+ * once and then scans about one entry on average.
+ *
+ * The image stores raw object bytes. It must be read by a build with the
+ * same Key/Value layout, byte order and Hash results; type sizes, byte
+ * order and the format version are checked on load. The offset table is
+ * checked to be non-decreasing and within the entries, so a corrupt image
+ * throws instead of reading out of bounds; the keys and values themselves
+ * are trusted, so only load files you produced.
+ *
+ * Key Features:
+ * - Zero deserialization: load() is mmap + validation of the header and
+ *   offset table
+ * - Read-only API matching HashTable lookups (find, contains, count, at)
+ * - Works from a file (load) or any aligned memory buffer (view)
+ *
+ * Time Complexity:
+ * - serialize/save: O(n + buckets)
+ * - load/view: O(buckets) for the offset check; entries are not touched
+ * - find: O(1) average
+ *
+ * Space Complexity: O(n * sizeof(Entry) + 8 * buckets)
+ *
+ * Copyright (c) 2026 Jinhyeok
+ * MIT License
+ */
+
+#ifndef MYLIB_HASH_FROZEN_HASH_INDEX_HPP
+#define MYLIB_HASH_FROZEN_HASH_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "hash/bucket_policy.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MYLIB_HASH_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mylib {
+namespace hash {
+
+namespace detail {
+
+/**
+ * @struct FrozenHeader
+ * @brief Fixed-size header at the start of a frozen index image
+ */
+struct FrozenHeader {
+    char magic[8];                ///< "MYLFHIX" + NUL
+    std::uint32_t version;        ///< Format version
+    std::uint32_t byte_order;     ///< FROZEN_BYTE_ORDER as written by the producer
+    std::uint32_t key_size;       ///< sizeof(Key)
+    std::uint32_t value_size;     ///< sizeof(Value)
+    std::uint32_t entry_size;     ///< sizeof(Entry)
+    std::uint32_t entry_align;    ///< alignof(Entry)
+    std::uint64_t size;           ///< Number of entries
+    std::uint64_t bucket_count;   ///< Number of buckets
+    std::uint64_t offsets_offset; ///< Byte offset of the bucket offset table
+    std::uint64_t entries_offset; ///< Byte offset of the entry array
+    std::uint64_t file_size;      ///< Total image size in bytes
+};
+
+constexpr char FROZEN_MAGIC[8] = {'M', 'Y', 'L', 'F', 'H', 'I', 'X', '\0'};
+constexpr std::uint32_t FROZEN_VERSION = 1;
+constexpr std::uint32_t FROZEN_BYTE_ORDER = 0x01020304;
+constexpr std::size_t FROZEN_SECTION_ALIGN = 64;
+
+inline std::size_t frozen_align_up(std::size_t n, std::size_t align) noexcept {
+    return (n + align - 1) / align * align;
+}
+
+} // namespace detail
+
+/**
+ * @class FrozenHashIndex
+ * @brief Read-only hash index over a flat, mmap-able image
+ *
+ * @code
+ * HashTable<std::uint64_t, Record> table = build_table();
+ * FrozenHashIndex<std::uint64_t, Record>::save(table, "records.idx");
+ *
+ * // Later, in any process:
+ * auto index = FrozenHashIndex<std::uint64_t, Record>::load("records.idx");
+ * const Record* r = index.find(42);
+ * @endcode
+ *
+ * @tparam Key Trivially copyable key type
+ * @tparam Value Trivially copyable value type
+ * @tparam Hash Hash function object type (default: std::hash<Key>)
+ * @tparam KeyEqual Key equality comparison function (default: std::equal_to<Key>)
+ */
+template <typename Key,
+          typename Value,
+          typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class FrozenHashIndex {
+    static_assert(std::is_trivially_copyable<Key>::value,
+                  "FrozenHashIndex requires a trivially copyable Key");
+    static_assert(std::is_trivially_copyable<Value>::value,
+                  "FrozenHashIndex requires a trivially copyable Value");
+
+public:
+    // Type aliases
+    using key_type = Key;
+    using mapped_type = Value;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+private:
+    /**
+     * @struct Entry
+     * @brief One key-value pair as laid out in the image
+     */
+    struct Entry {
+        Key key;
+        Value value;
+    };
+
+public:
+    // ============================================
+    // Construction
+    // ============================================
+
+    /**
+     * @brief Create an empty index that holds no image
+     */
+    FrozenHashIndex() noexcept
+        : m_data(nullptr)
+        , m_bytes(0)
+        , m_mapped(false)
+        , m_offsets(nullptr)
+        , m_entries(nullptr)
+        , m_size(0)
+        , m_bucket_count(0)
+        , m_hasher()
+        , m_key_equal() {}
+
+    FrozenHashIndex(const FrozenHashIndex&) = delete;
+    FrozenHashIndex& operator=(const FrozenHashIndex&) = delete;
+
+    FrozenHashIndex(FrozenHashIndex&& other) noexcept
+        : FrozenHashIndex() {
+        swap(other);
+    }
+
+    FrozenHashIndex& operator=(FrozenHashIndex&& other) noexcept {
+        if (this != &other) {
+            FrozenHashIndex tmp(std::move(other));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    ~FrozenHashIndex() {
+        release();
+    }
+
+    /**
+     * @brief Build the image of a table in memory
+     * @param table Any table with size() and for_each(func(const Key&, const Value&))
+     * @param hash Hash function used for bucketing (must match the reader's)
+     * @return Image bytes, ready for view() or to be written to disk
+     */
+    template <typename Table>
+    static std::vector<char> serialize(const Table& table, const Hash& hash = Hash()) {
+        const size_type n = table.size();
+        const size_type buckets = n > 0 ? n : 1;
+
+        const size_type offsets_offset =
+            detail::frozen_align_up(sizeof(detail::FrozenHeader), detail::FROZEN_SECTION_ALIGN);
+        const size_type entries_offset = detail::frozen_align_up(
+            offsets_offset + (buckets + 1) * sizeof(std::uint64_t),
+            alignof(Entry) > detail::FROZEN_SECTION_ALIGN ? alignof(Entry)
+                                                          : detail::FROZEN_SECTION_ALIGN);
+        const size_type file_size = entries_offset + n * sizeof(Entry);
+
+        // Zero-filled so padding bytes are deterministic
+        std::vector<char> image(file_size, 0);
+
+        detail::FrozenHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, detail::FROZEN_MAGIC, sizeof(header.magic));
+        header.version = detail::FROZEN_VERSION;
+        header.byte_order = detail::FROZEN_BYTE_ORDER;
+        header.key_size = static_cast<std::uint32_t>(sizeof(Key));
+        header.value_size = static_cast<std::uint32_t>(sizeof(Value));
+        header.entry_size = static_cast<std::uint32_t>(sizeof(Entry));
+        header.entry_align = static_cast<std::uint32_t>(alignof(Entry));
+        header.size = n;
+        header.bucket_count = buckets;
+        header.offsets_offset = offsets_offset;
+        header.entries_offset = entries_offset;
+        header.file_size = file_size;
+        std::memcpy(image.data(), &header, sizeof(header));
+
+        // Counting sort by bucket: count, prefix-sum, then place
+        std::vector<std::uint64_t> offsets(buckets + 1, 0);
+        table.for_each([&](const Key& key, const Value&) {
+            ++offsets[bucket_of(hash, key, buckets) + 1];
+        });
+        for (size_type b = 0; b < buckets; ++b) {
+            offsets[b + 1] += offsets[b];
+        }
+        std::memcpy(image.data() + offsets_offset, offsets.data(),
+                    offsets.size() * sizeof(std::uint64_t));
+
+        Entry* entries = reinterpret_cast<Entry*>(image.data() + entries_offset);
+        table.for_each([&](const Key& key, const Value& value) {
+            Entry* dst = entries + offsets[bucket_of(hash, key, buckets)]++;
+            std::memcpy(static_cast<void*>(&dst->key), &key, sizeof(Key));
+            std::memcpy(static_cast<void*>(&dst->value), &value, sizeof(Value));
+        });
+        return image;
+    }
+
+    /**
+     * @brief Write the image of a table to a file
+     * @param table Table to freeze (see serialize())
+     * @param path Destination file (overwritten)
+     * @param hash Hash function used for bucketing
+     * @throws std::runtime_error if the file cannot be written
+     */
+    template <typename Table>
+    static void save(const Table& table, const std::string& path, const Hash& hash = Hash()) {
+        std::vector<char> image = serialize(table, hash);
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw std::runtime_error("FrozenHashIndex::save: cannot open " + path);
+        }
+        out.write(image.data(), static_cast<std::streamsize>(image.size()));
+        if (!out) {
+            throw std::runtime_error("FrozenHashIndex::save: write failed for " + path);
+        }
+    }
+
+    /**
+     * @brief Map an image file read-only
+     * @param path File written by save()
+     * @param hash Hash function (must produce the writer's values)
+     * @param equal Key equality function
+     * @return Index backed by the mapping (unmapped on destruction)
+     * @throws std::runtime_error if the file cannot be mapped or is not a
+     *         valid image for these Key/Value types
+     *
+     * Without mmap support the file is read into memory instead.
+     */
+    static FrozenHashIndex load(const std::string& path,
+                                const Hash& hash = Hash(),
+                                const KeyEqual& equal = KeyEqual()) {
+        FrozenHashIndex index;
+        index.m_hasher = hash;
+        index.m_key_equal = equal;
+#ifdef MYLIB_HASH_HAS_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("FrozenHashIndex::load: cannot open " + path);
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+            ::close(fd);
+            throw std::runtime_error("FrozenHashIndex::load: cannot read " + path);
+        }
+        size_type bytes = static_cast<size_type>(st.st_size);
+        void* addr = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED) {
+            throw std::runtime_error("FrozenHashIndex::load: mmap failed for " + path);
+        }
+        index.m_data = static_cast<const char*>(addr);
+        index.m_bytes = bytes;
+        index.m_mapped = true;
+#else
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) {
+            throw std::runtime_error("FrozenHashIndex::load: cannot open " + path);
+        }
+        index.m_storage.resize(static_cast<size_type>(in.tellg()));
+        in.seekg(0);
+        in.read(index.m_storage.data(), static_cast<std::streamsize>(index.m_storage.size()));
+        if (!in) {
+            throw std::runtime_error("FrozenHashIndex::load: cannot read " + path);
+        }
+        index.m_data = index.m_storage.data();
+        index.m_bytes = index.m_storage.size();
+#endif
+        index.attach("FrozenHashIndex::load");
+        return index;
+    }
+
+    /**
+     * @brief Query an image that already lives in memory
+     * @param data Start of the image, aligned to at least alignof(Entry) and 8
+     * @param bytes Size of the buffer
+     * @param hash Hash function (must produce the writer's values)
+     * @param equal Key equality function
+     * @return Index borrowing the buffer, which must outlive it
+     * @throws std::runtime_error if the buffer is not a valid image
+     */
+    static FrozenHashIndex view(const void* data, size_type bytes,
+                                const Hash& hash = Hash(),
+                                const KeyEqual& equal = KeyEqual()) {
+        FrozenHashIndex index;
+        index.m_hasher = hash;
+        index.m_key_equal = equal;
+        index.m_data = static_cast<const char*>(data);
+        index.m_bytes = bytes;
+        index.attach("FrozenHashIndex::view");
+        return index;
+    }
+
+    // ============================================
+    // Capacity
+    // ============================================
+
+    bool empty() const noexcept { return m_size == 0; }
+    size_type size() const noexcept { return m_size; }
+    size_type bucket_count() const noexcept { return m_bucket_count; }
+
+    /**
+     * @brief Size of the underlying image in bytes
+     */
+    size_type image_size() const noexcept { return m_bytes; }
+
+    /**
+     * @brief Check if the image is a memory-mapped file
+     */
+    bool mapped() const noexcept { return m_mapped; }
+
+    // ============================================
+    // Lookup
+    // ============================================
+
+    /**
+     * @brief Find value for key
+     * @param key Key to search for
+     * @return Pointer into the image, or nullptr if not found
+     */
+    const Value* find(const Key& key) const {
+        if (m_size == 0) {
+            return nullptr;
+        }
+        size_type b = bucket_of(m_hasher, key, m_bucket_count);
+        const Entry* it = m_entries + m_offsets[b];
+        const Entry* last = m_entries + m_offsets[b + 1];
+        for (; it != last; ++it) {
+            if (m_key_equal(it->key, key)) {
+                return &it->value;
+            }
+        }
+        return nullptr;
+    }
+
+    bool contains(const Key& key) const {
+        return find(key) != nullptr;
+    }
+
+    size_type count(const Key& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    /**
+     * @brief Access value for key
+     * @throws std::out_of_range if key not found
+     */
+    const Value& at(const Key& key) const {
+        const Value* value = find(key);
+        if (value == nullptr) {
+            throw std::out_of_range("FrozenHashIndex::at: key not found");
+        }
+        return *value;
+    }
+
+    // ============================================
+    // Iteration
+    // ============================================
+
+    /**
+     * @brief Apply func(const Key&, const Value&) to every entry
+     */
+    template <typename Func>
+    void for_each(Func&& func) const {
+        for (size_type i = 0; i < m_size; ++i) {
+            func(m_entries[i].key, m_entries[i].value);
+        }
+    }
+
+    void swap(FrozenHashIndex& other) noexcept {
+        using std::swap;
+        swap(m_data, other.m_data);
+        swap(m_bytes, other.m_bytes);
+        swap(m_mapped, other.m_mapped);
+        m_storage.swap(other.m_storage);
+        swap(m_offsets, other.m_offsets);
+        swap(m_entries, other.m_entries);
+        swap(m_size, other.m_size);
+        swap(m_bucket_count, other.m_bucket_count);
+        swap(m_hasher, other.m_hasher);
+        swap(m_key_equal, other.m_key_equal);
+    }
+
+private:
+    const char* m_data;             ///< Start of the image
+    size_type m_bytes;              ///< Image size
+    bool m_mapped;                  ///< m_data is an mmap() we must unmap
+    std::vector<char> m_storage;    ///< Owned copy when mmap is unavailable
+    const std::uint64_t* m_offsets; ///< Bucket offset table inside the image
+    const Entry* m_entries;         ///< Entry array inside the image
+    size_type m_size;               ///< Number of entries
+    size_type m_bucket_count;       ///< Number of buckets
+    Hash m_hasher;                  ///< Hash function
+    KeyEqual m_key_equal;           ///< Key equality function
+
+    static size_type bucket_of(const Hash& hash, const Key& key, size_type buckets) {
+        return FastRangeBucketPolicy::index(detail::mix_hash(hash(key)), buckets);
+    }
+
+    /**
+     * @brief Validate the header at m_data and point into the image
+     * @param where Prefix for error messages
+     */
+    void attach(const char* where) {
+        auto fail = [this, where](const char* what) {
+            release();
+            throw std::runtime_error(std::string(where) + ": " + what);
+        };
+
+        if (m_data == nullptr || m_bytes < sizeof(detail::FrozenHeader)) {
+            fail("image too small");
+        }
+        if (reinterpret_cast<std::uintptr_t>(m_data) % alignof(std::uint64_t) != 0 ||
+            reinterpret_cast<std::uintptr_t>(m_data) % alignof(Entry) != 0) {
+            fail("image is misaligned");
+        }
+
+        detail::FrozenHeader header;
+        std::memcpy(&header, m_data, sizeof(header));
+        if (std::memcmp(header.magic, detail::FROZEN_MAGIC, sizeof(header.magic)) != 0) {
+            fail("bad magic");
+        }
+        if (header.version != detail::FROZEN_VERSION) {
+            fail("unsupported version");
+        }
+        if (header.byte_order != detail::FROZEN_BYTE_ORDER) {
+            fail("byte order mismatch");
+        }
+        if (header.key_size != sizeof(Key) || header.value_size != sizeof(Value) ||
+            header.entry_size != sizeof(Entry) || header.entry_align != alignof(Entry)) {
+            fail("key/value layout mismatch");
+        }
+        if (header.file_size > m_bytes || header.bucket_count == 0 ||
+            header.bucket_count > m_bytes / sizeof(std::uint64_t) ||
+            header.size > m_bytes / sizeof(Entry) ||
+            header.offsets_offset > m_bytes || header.entries_offset > m_bytes ||
+            header.offsets_offset % alignof(std::uint64_t) != 0 ||
+            header.entries_offset % alignof(Entry) != 0 ||
+            header.offsets_offset + (header.bucket_count + 1) * sizeof(std::uint64_t) >
+                header.entries_offset ||
+            header.entries_offset + header.size * sizeof(Entry) > header.file_size) {
+            fail("truncated or inconsistent image");
+        }
+
+        m_offsets = reinterpret_cast<const std::uint64_t*>(m_data + header.offsets_offset);
+        m_entries = reinterpret_cast<const Entry*>(m_data + header.entries_offset);
+        m_size = static_cast<size_type>(header.size);
+        m_bucket_count = static_cast<size_type>(header.bucket_count);
+        if (m_offsets[0] != 0 || m_offsets[m_bucket_count] != header.size) {
+            fail("corrupt bucket offsets");
+        }
+        // find() indexes m_entries with these directly
+        for (size_type b = 0; b < m_bucket_count; ++b) {
+            if (m_offsets[b] > m_offsets[b + 1]) {
+                fail("corrupt bucket offsets");
+            }
+        }
+    }
+
+    /**
+     * @brief Drop the image (unmapping it if owned)
+     */
+    void release() noexcept {
+#ifdef MYLIB_HASH_HAS_MMAP
+        if (m_mapped && m_data != nullptr) {
+            ::munmap(const_cast<char*>(m_data), m_bytes);
+        }
+#endif
+        std::vector<char>().swap(m_storage);
+        m_data = nullptr;
+        m_bytes = 0;
+        m_mapped = false;
+        m_offsets = nullptr;
+        m_entries = nullptr;
+        m_size = 0;
+        m_bucket_count = 0;
+    }
+};
+
+} // namespace hash
+} // namespace mylib
+
+#endif // MYLIB_HASH_FROZEN_HASH_INDEX_HPP
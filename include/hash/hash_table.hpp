@@ -36,10 +36,65 @@
 #include <functional>
 #include <vector>
 #include <list>
+#include <memory>
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "hash/bucket_policy.hpp"
+#include "memory/node_pool.hpp"
 
 namespace mylib {
 namespace hash {
 
+namespace detail {
+
+/**
+ * @brief True if F declares a nested is_transparent type
+ */
+template <typename F, typename = void>
+struct is_transparent : std::false_type {};
+
+template <typename F>
+struct is_transparent<F, std::void_t<typename F::is_transparent>> : std::true_type {};
+
+/**
+ * @brief Hint that the cache line at addr will be read soon
+ */
+inline void prefetch(const void* addr) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(addr, 0, 3);
+#else
+    (void)addr;
+#endif
+}
+
+} // namespace detail
+
+/**
+ * @struct StringHash
+ * @brief Transparent hash for std::string keys
+ *
+ * Hashes anything convertible to std::string_view, so std::string,
+ * std::string_view and const char* keys produce the same value. Pair with
+ * std::equal_to<> to enable heterogeneous lookup:
+ *
+ * @code
+ * HashTable<std::string, int, StringHash, std::equal_to<>> routes;
+ * routes.find(std::string_view(path));   // no temporary std::string
+ * @endcode
+ */
+struct StringHash {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view str) const noexcept {
+        return std::hash<std::string_view>()(str);
+    }
+};
+
 /**
  * @class HashTable
  * @brief A hash table implementation using separate chaining for collision resolution
@@ -56,15 +111,44 @@ namespace hash {
  * 
  * Worst case (all keys hash to same bucket): O(n)
  * 
+ * Rehashing is synchronous by default: the insert that crosses
+ * max_load_factor moves every entry. With incremental_rehash(true) the old
+ * and new bucket arrays stay live instead, and each mutating call migrates
+ * a bounded number of old buckets, spreading the cost over later inserts.
+ * Entries are spliced between buckets, so references to values stay valid
+ * across both kinds of rehash.
+ * 
+ * If both Hash and KeyEqual declare is_transparent, find(), contains(),
+ * count(), at() and erase() also accept any type they can compare with
+ * Key (e.g. std::string_view for std::string keys) without converting it.
+ *
+ * Entries are std::pair<const Key, Value> and can be scanned with forward
+ * iterators or the templated for_each() visitor. extract(), insert(node)
+ * and merge() move whole list nodes, so draining one table into another
+ * never copies or reallocates an entry.
+ *
+ * The BucketPolicy chooses bucket counts and the hash-to-bucket reduction
+ * (see bucket_policy.hpp). The default keeps prime sizing with modulo;
+ * PowerOfTwoBucketPolicy and FastRangeBucketPolicy avoid the division.
+ *
+ * Entry nodes come from Allocator; memory::PoolAllocator carves them from
+ * slabs instead of calling malloc per insert. Every bucket list shares the
+ * table's allocator, and nodes are only spliced between tables whose
+ * allocators compare equal (otherwise the entry is moved).
+ * 
  * @tparam Key The type of keys
  * @tparam Value The type of values
  * @tparam Hash Hash function object type (default: std::hash<Key>)
  * @tparam KeyEqual Key equality comparison function (default: std::equal_to<Key>)
+ * @tparam BucketPolicy Bucket sizing/reduction policy (default: PrimeBucketPolicy)
+ * @tparam Allocator Allocator for entries (default: std::allocator<value_type>)
  */
 template <typename Key, 
           typename Value, 
           typename Hash = std::hash<Key>,
-          typename KeyEqual = std::equal_to<Key>>
+          typename KeyEqual = std::equal_to<Key>,
+          typename BucketPolicy = PrimeBucketPolicy,
+          typename Allocator = std::allocator<std::pair<const Key, Value>>>
 class HashTable {
 public:
     // Type aliases
@@ -74,27 +158,172 @@ public:
     using size_type = std::size_t;
     using hasher = Hash;
     using key_equal = KeyEqual;
+    using bucket_policy = BucketPolicy;
+    using allocator_type = Allocator;
     using reference = value_type&;
     using const_reference = const value_type&;
 
 private:
+    // Each entry is a list node holding value_type, so iterators can hand
+    // out value_type& and nodes can be spliced without copying
+    using ValueAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<value_type>;
+    using Bucket = std::list<value_type, ValueAllocator>;
+
+public:
     /**
-     * @struct Entry
-     * @brief Internal entry structure for key-value pairs
+     * @class basic_iterator
+     * @brief Forward iterator over all entries (old buckets first, then new)
+     *
+     * Any call that may migrate or rehash (insert, operator[], emplace,
+     * erase(key), reserve, ...) invalidates iterators. erase(pos) and
+     * extract(pos) only invalidate pos itself.
      */
-    struct Entry {
-        Key key;
-        Value value;
-        
-        Entry(const Key& k, const Value& v) : key(k), value(v) {}
-        Entry(Key&& k, Value&& v) : key(std::move(k)), value(std::move(v)) {}
-        Entry(const Key& k, Value&& v) : key(k), value(std::move(v)) {}
-        Entry(Key&& k, const Value& v) : key(std::move(k)), value(v) {}
+    template <bool IsConst>
+    class basic_iterator {
+        using table_type = std::conditional_t<IsConst, const HashTable, HashTable>;
+        using bucket_type = std::conditional_t<IsConst, const Bucket, Bucket>;
+        using bucket_iterator = std::conditional_t<IsConst,
+            typename Bucket::const_iterator, typename Bucket::iterator>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename HashTable::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+        using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+        basic_iterator() = default;
+
+        /**
+         * @brief Convert iterator to const_iterator
+         */
+        template <bool C = IsConst, typename = std::enable_if_t<C>>
+        basic_iterator(const basic_iterator<false>& other)
+            : m_table(other.m_table)
+            , m_array(other.m_array)
+            , m_current(other.m_current)
+            , m_last(other.m_last)
+            , m_it(other.m_it) {}
+
+        reference operator*() const { return *m_it; }
+        pointer operator->() const { return &*m_it; }
+
+        basic_iterator& operator++() {
+            if (++m_it == m_current->end()) {
+                next_bucket();
+            }
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {
+            return a.m_array == b.m_array && (a.m_array == END_ARRAY || a.m_it == b.m_it);
+        }
+
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {
+            return !(a == b);
+        }
+
+    private:
+        friend class HashTable;
+        friend class basic_iterator<!IsConst>;
+
+        static constexpr int OLD_ARRAY = 0;
+        static constexpr int NEW_ARRAY = 1;
+        static constexpr int END_ARRAY = 2;
+
+        basic_iterator(table_type* table, int array, bucket_type* current,
+                       bucket_type* last, bucket_iterator it)
+            : m_table(table)
+            , m_array(array)
+            , m_current(current)
+            , m_last(last)
+            , m_it(it) {}
+
+        /**
+         * @brief Move to the first entry at or after bucket first of array,
+         *        continuing into later arrays, or to end
+         */
+        void seek(int array, size_type first) {
+            for (m_array = array; m_array != END_ARRAY; ++m_array, first = 0) {
+                auto& buckets = m_array == OLD_ARRAY ? m_table->m_old_buckets : m_table->m_buckets;
+                m_current = buckets.data() + first;
+                m_last = buckets.data() + buckets.size();
+                for (; m_current != m_last; ++m_current) {
+                    if (!m_current->empty()) {
+                        m_it = m_current->begin();
+                        return;
+                    }
+                }
+            }
+            m_current = m_last = nullptr;
+            m_it = bucket_iterator();
+        }
+
+        /**
+         * @brief Move to the first entry of the next non-empty bucket
+         */
+        void next_bucket() {
+            while (++m_current != m_last) {
+                if (!m_current->empty()) {
+                    m_it = m_current->begin();
+                    return;
+                }
+            }
+            seek(m_array + 1, 0);
+        }
+
+        table_type* m_table = nullptr;
+        int m_array = END_ARRAY;          ///< OLD_ARRAY, NEW_ARRAY or END_ARRAY
+        bucket_type* m_current = nullptr; ///< Bucket holding m_it
+        bucket_type* m_last = nullptr;    ///< One past the last bucket of the array
+        bucket_iterator m_it{};           ///< Entry within the bucket
     };
 
-    using Bucket = std::list<Entry>;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    /**
+     * @class node_type
+     * @brief Owning handle to an entry removed with extract()
+     *
+     * The entry stays in its original list node, so extract() followed by
+     * insert(node_type&&) or merge() moves it between tables without
+     * allocating or copying the key or value.
+     */
+    class node_type {
+    public:
+        node_type() = default;
+        node_type(node_type&&) noexcept = default;
+        node_type& operator=(node_type&&) noexcept = default;
+
+        bool empty() const noexcept { return m_node.empty(); }
+        explicit operator bool() const noexcept { return !empty(); }
+
+        /**
+         * @brief Key of the held entry (undefined if empty)
+         */
+        const Key& key() const { return m_node.front().first; }
+
+        /**
+         * @brief Value of the held entry (undefined if empty)
+         */
+        Value& mapped() { return m_node.front().second; }
+        const Value& mapped() const { return m_node.front().second; }
+
+    private:
+        friend class HashTable;
+
+        explicit node_type(const ValueAllocator& alloc) : m_node(alloc) {}
+
+        Bucket m_node;  ///< Holds at most one entry
+    };
 
-public:
     /**
      * @brief Default constructor
      * Creates an empty hash table with default bucket count
@@ -122,6 +351,22 @@ public:
      */
     HashTable(size_type bucket_count, const Hash& hash, const KeyEqual& equal);
 
+    /**
+     * @brief Constructor with bucket count, hasher, equality and allocator
+     * @param bucket_count Initial number of buckets
+     * @param hash Hash function to use
+     * @param equal Key equality function to use
+     * @param alloc Allocator for entries
+     */
+    HashTable(size_type bucket_count, const Hash& hash, const KeyEqual& equal,
+              const Allocator& alloc);
+
+    /**
+     * @brief Construct an empty table using the given allocator
+     * @param alloc Allocator for entries
+     */
+    explicit HashTable(const Allocator& alloc);
+
     /**
      * @brief Initializer list constructor
      * @param init Initializer list of key-value pairs
@@ -159,6 +404,12 @@ public:
      */
     HashTable& operator=(HashTable&& other) noexcept;
 
+    /**
+     * @brief Get a copy of the allocator
+     * @return Allocator used for entries
+     */
+    allocator_type get_allocator() const;
+
     // Capacity
     /**
      * @brief Check if hash table is empty
@@ -196,6 +447,33 @@ public:
      */
     void max_load_factor(float ml);
 
+    /**
+     * @brief Check if incremental rehashing is enabled
+     * @return true if growth migrates buckets gradually
+     */
+    bool incremental_rehash() const noexcept;
+
+    /**
+     * @brief Enable or disable incremental rehashing
+     * @param enable true to migrate buckets gradually on growth
+     * @param buckets_per_step Old buckets migrated per mutating operation
+     * @throws std::invalid_argument if buckets_per_step is 0
+     * 
+     * Disabling while a migration is in progress finishes it immediately.
+     */
+    void incremental_rehash(bool enable, size_type buckets_per_step = DEFAULT_REHASH_STEP);
+
+    /**
+     * @brief Check if an incremental migration is in progress
+     * @return true if the old bucket array still holds entries
+     */
+    bool rehashing() const noexcept;
+
+    /**
+     * @brief Complete an in-progress incremental migration
+     */
+    void finish_rehash();
+
     // Element access
     /**
      * @brief Access or insert element with key
@@ -271,6 +549,53 @@ public:
      */
     bool erase(const Key& key);
 
+    /**
+     * @brief Remove the element at pos
+     * @param pos Valid dereferenceable iterator
+     * @return Iterator to the element after pos
+     *
+     * Does not advance an incremental rehash, so other iterators stay valid
+     * and a table can be filtered in a single pass.
+     */
+    iterator erase(const_iterator pos);
+    iterator erase(iterator pos);
+
+    /**
+     * @brief Unlink the element at pos and hand it over as a node
+     * @param pos Valid dereferenceable iterator
+     * @return Node owning the element
+     *
+     * Like erase(pos), leaves all other iterators valid.
+     */
+    node_type extract(const_iterator pos);
+
+    /**
+     * @brief Unlink the element with key and hand it over as a node
+     * @param key Key to extract
+     * @return Node owning the element, or an empty node if not found
+     */
+    node_type extract(const Key& key);
+
+    /**
+     * @brief Insert an extracted node without copying its entry
+     * @param node Node from extract()
+     * @return pair of (node was non-empty, was_inserted)
+     *
+     * If the key already exists the node is left untouched, so the caller
+     * still owns the entry.
+     */
+    std::pair<bool, bool> insert(node_type&& node);
+
+    /**
+     * @brief Move every entry whose key is absent here out of source
+     * @param source Table to take entries from
+     *
+     * Entries are spliced across, never copied. Keys already present here
+     * stay in source.
+     */
+    void merge(HashTable& source);
+    void merge(HashTable&& source);
+
     /**
      * @brief Clear all elements
      */
@@ -305,11 +630,83 @@ public:
      */
     size_type count(const Key& key) const;
 
+    /**
+     * @brief Look up many keys at once
+     * @param keys Array of count keys
+     * @param count Number of keys
+     * @param results Array of count slots; results[i] receives find(keys[i])
+     * 
+     * Keys are processed FIND_BATCH_CHUNK at a time: every key in a chunk
+     * is hashed and its bucket prefetched, then the first node of each
+     * bucket is prefetched, then the lookups are resolved. The cache misses
+     * of independent keys overlap instead of being paid one after another,
+     * which pays off once the table is larger than the cache.
+     */
+    void find_batch(const Key* keys, size_type count, Value** results);
+    void find_batch(const Key* keys, size_type count, const Value** results) const;
+
+    /**
+     * @brief Look up many keys at once
+     * @param keys Keys to look up
+     * @param results Resized to keys.size(); results[i] receives find(keys[i])
+     */
+    void find_batch(const std::vector<Key>& keys, std::vector<Value*>& results);
+    void find_batch(const std::vector<Key>& keys, std::vector<const Value*>& results) const;
+
+    // Heterogeneous lookup (only when Hash and KeyEqual are transparent).
+    // Iterators are excluded so erase(it) picks the positional overload.
+    template <typename K>
+    using transparent_key_t = std::enable_if_t<
+        detail::is_transparent<Hash>::value && detail::is_transparent<KeyEqual>::value &&
+        !std::is_convertible<K, iterator>::value && !std::is_convertible<K, const_iterator>::value,
+        K>;
+
+    /**
+     * @brief Find element comparing equal to key of another type
+     * @param key Value comparable with Key through Hash and KeyEqual
+     * @return Pointer to value if found, nullptr otherwise
+     */
+    template <typename K, typename = transparent_key_t<K>>
+    Value* find(const K& key);
+    template <typename K, typename = transparent_key_t<K>>
+    const Value* find(const K& key) const;
+
+    /**
+     * @brief Check if a key comparing equal to key exists
+     */
+    template <typename K, typename = transparent_key_t<K>>
+    bool contains(const K& key) const;
+
+    /**
+     * @brief Count elements comparing equal to key (0 or 1)
+     */
+    template <typename K, typename = transparent_key_t<K>>
+    size_type count(const K& key) const;
+
+    /**
+     * @brief Access element comparing equal to key
+     * @throws std::out_of_range if key not found
+     */
+    template <typename K, typename = transparent_key_t<K>>
+    Value& at(const K& key);
+    template <typename K, typename = transparent_key_t<K>>
+    const Value& at(const K& key) const;
+
+    /**
+     * @brief Remove element comparing equal to key
+     * @return true if removed, false if not found
+     */
+    template <typename K, typename = transparent_key_t<K>>
+    bool erase(const K& key);
+
     // Bucket interface
     /**
      * @brief Get number of elements in bucket
      * @param n Bucket index
      * @return Number of elements in bucket n
+     * 
+     * During an incremental rehash this (and bucket()) refers to the new
+     * bucket array only.
      */
     size_type bucket_size(size_type n) const;
 
@@ -347,6 +744,22 @@ public:
     key_equal key_eq() const;
 
     // Iteration support
+    /**
+     * @brief Get iterator to the first element
+     * @return Iterator to the first element, or end() if empty
+     */
+    iterator begin();
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+
+    /**
+     * @brief Get past-the-end iterator
+     * @return Iterator past the last element
+     */
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
     /**
      * @brief Apply function to all key-value pairs
      * @param func Function to apply
@@ -354,6 +767,18 @@ public:
     void for_each(std::function<void(const Key&, Value&)> func);
     void for_each(std::function<void(const Key&, const Value&)> func) const;
 
+    /**
+     * @brief Apply a visitor to all key-value pairs
+     * @param func Callable as func(const Key&, Value&)
+     *
+     * Chosen over the std::function overloads for lambdas and function
+     * objects, so the call is inlined instead of going through type erasure.
+     */
+    template <typename Func>
+    void for_each(Func&& func);
+    template <typename Func>
+    void for_each(Func&& func) const;
+
     /**
      * @brief Get all keys
      * @return Vector of all keys
@@ -366,8 +791,16 @@ public:
      */
     std::vector<Value> values() const;
 
+    static constexpr size_type DEFAULT_REHASH_STEP = 4;
+    static constexpr size_type FIND_BATCH_CHUNK = 16;
+
 private:
+    ValueAllocator m_alloc;            ///< Entry allocator shared by every bucket
     std::vector<Bucket> m_buckets;    ///< Array of buckets
+    std::vector<Bucket> m_old_buckets; ///< Buckets still being migrated (incremental rehash)
+    size_type m_rehash_pos;            ///< Old buckets below this index are migrated
+    size_type m_rehash_step;           ///< Old buckets migrated per mutating operation
+    bool m_incremental;                ///< Incremental rehash enabled
     size_type m_size;                  ///< Number of elements
     float m_max_load_factor;           ///< Maximum load factor
     Hash m_hasher;                     ///< Hash function
@@ -383,58 +816,317 @@ private:
      */
     size_type get_bucket_index(const Key& key) const;
 
+    /**
+     * @brief Hash a key, mixing it first if the policy needs an avalanching
+     *        hash and Hash does not declare is_avalanching
+     * @param key Key (or transparent key) to hash
+     * @return Hash value to pass to bucket_index()
+     */
+    template <typename K>
+    size_type hash_key(const K& key) const;
+
+    /**
+     * @brief Reduce a hash to a bucket index
+     * @param hash Value from hash_key()
+     * @param count Number of buckets
+     * @return Bucket index in [0, count)
+     */
+    static size_type bucket_index(size_type hash, size_type count) noexcept;
+
+    /**
+     * @brief Get the bucket that holds (or would receive) key
+     * @param key Key to locate
+     * @return Unmigrated old bucket if the key maps to one, else new bucket
+     */
+    template <typename K>
+    Bucket& bucket_for(const K& key);
+    template <typename K>
+    const Bucket& bucket_for(const K& key) const;
+
+    /**
+     * @brief Get the bucket for a hash_key() value (see bucket_for())
+     */
+    Bucket& bucket_for_hash(size_type hash);
+    const Bucket& bucket_for_hash(size_type hash) const;
+
+    /**
+     * @brief Shared body of the find_batch() overloads
+     * @tparam Result Value* or const Value*
+     */
+    template <typename Result>
+    void find_batch_impl(const Key* keys, size_type count, Result* results) const;
+
     /**
      * @brief Find entry in bucket
-     * @param bucket_index Bucket to search
+     * @param bucket Bucket to search
      * @param key Key to find
      * @return Iterator to entry, or end() if not found
      */
-    typename Bucket::iterator find_in_bucket(size_type bucket_index, const Key& key);
-    typename Bucket::const_iterator find_in_bucket(size_type bucket_index, const Key& key) const;
+    template <typename K>
+    typename Bucket::iterator find_in_bucket(Bucket& bucket, const K& key);
+    template <typename K>
+    typename Bucket::const_iterator find_in_bucket(const Bucket& bucket, const K& key) const;
 
     /**
-     * @brief Check if rehash is needed and perform if necessary
+     * @brief Check if rehash is needed and perform (or start) it if necessary
      */
     void check_rehash();
 
     /**
-     * @brief Get next prime number >= n (for bucket count)
-     * @param n Minimum value
-     * @return Next prime >= n
+     * @brief Migrate the next batch of old buckets if a migration is running
+     */
+    void rehash_step();
+
+    /**
+     * @brief Splice all entries of an old bucket into m_buckets
+     * @param bucket Bucket to empty
+     */
+    void migrate_bucket(Bucket& bucket);
+
+    /**
+     * @brief Create empty buckets that use this table's allocator
+     * @param count Number of buckets
      */
-    static size_type next_prime(size_type n);
+    std::vector<Bucket> make_buckets(size_type count) const;
 
     /**
-     * @brief Check if n is prime
-     * @param n Number to check
-     * @return true if prime
+     * @brief Deep-copy a bucket array into buckets using this table's allocator
+     * @param source Buckets to copy
      */
-    static bool is_prime(size_type n);
+    std::vector<Bucket> copy_buckets(const std::vector<Bucket>& source) const;
 };
 
 // ============================================
 // Template member function implementations
 // ============================================
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
 template <typename... Args>
-std::pair<bool, bool> HashTable<Key, Value, Hash, KeyEqual>::emplace(
+std::pair<bool, bool> HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::emplace(
     const Key& key, Args&&... args) {
     
-    size_type index = get_bucket_index(key);
-    auto it = find_in_bucket(index, key);
-    
-    if (it != m_buckets[index].end()) {
+    rehash_step();
+    Bucket& bucket = bucket_for(key);
+    if (find_in_bucket(bucket, key) != bucket.end()) {
         return {true, false};
     }
     
     check_rehash();
-    index = get_bucket_index(key);
-    m_buckets[index].emplace_back(key, Value(std::forward<Args>(args)...));
+    bucket_for(key).emplace_back(std::piecewise_construct,
+                                 std::forward_as_tuple(key),
+                                 std::forward_as_tuple(std::forward<Args>(args)...));
     ++m_size;
     return {true, true};
 }
 
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+template <typename Func>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::for_each(Func&& func) {
+    for (auto* buckets : {&m_old_buckets, &m_buckets}) {
+        for (auto& bucket : *buckets) {
+            for (auto& entry : bucket) {
+                func(entry.first, entry.second);
+            }
+        }
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+template <typename Func>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::for_each(Func&& func) const {
+    for (const auto* buckets : {&m_old_buckets, &m_buckets}) {
+        for (const auto& bucket : *buckets) {
+            for (const auto& entry : bucket) {
+                func(entry.first, entry.second);
+            }
+        }
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+template <typename K, typename>
+Value* HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::find(const K& key) {
+    auto& bucket = bucket_for(key);
+    auto it = find_in_bucket(bucket, key);
+    return it != bucket.end() ? &(it->second) : nullptr;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+template <typename K, typename>
+const Value* HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::find(const K& key) const {
+    const auto& bucket = bucket_for(key);
+    auto it = find_in_bucket(bucket, key);
+    return it != bucket.end() ? &(it->second) : nullptr;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+template <typename K, typename>
+bool HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::contains(const K& key) const {
+    return find<K>(key) != nullptr;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+template <typename K, typename>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::size_type 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::count(const K& key) const {
+    return contains<K>(key) ? 1 : 0;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+template <typename K, typename>
+Value& HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::at(const K& key) {
+    Value* value = find<K>(key);
+    if (value == nullptr) {
+        throw std::out_of_range("HashTable::at: key not found");
+    }
+    return *value;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+template <typename K, typename>
+const Value& HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::at(const K& key) const {
+    const Value* value = find<K>(key);
+    if (value == nullptr) {
+        throw std::out_of_range("HashTable::at: key not found");
+    }
+    return *value;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+template <typename K, typename>
+bool HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::erase(const K& key) {
+    rehash_step();
+    Bucket& bucket = bucket_for(key);
+    auto it = find_in_bucket(bucket, key);
+    if (it == bucket.end()) {
+        return false;
+    }
+    bucket.erase(it);
+    --m_size;
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+template <typename K>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::size_type 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::hash_key(const K& key) const {
+    size_type hash = m_hasher(key);
+    if constexpr (BucketPolicy::needs_avalanche && !detail::is_avalanching<Hash>::value) {
+        hash = detail::mix_hash(hash);
+    }
+    return hash;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+template <typename K>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::Bucket& 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::bucket_for(const K& key) {
+    return bucket_for_hash(hash_key(key));
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+template <typename K>
+const typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::Bucket& 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::bucket_for(const K& key) const {
+    return bucket_for_hash(hash_key(key));
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::Bucket& 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::bucket_for_hash(size_type hash) {
+    if (!m_old_buckets.empty()) {
+        size_type old_index = bucket_index(hash, m_old_buckets.size());
+        if (old_index >= m_rehash_pos) {
+            return m_old_buckets[old_index];
+        }
+    }
+    return m_buckets[bucket_index(hash, m_buckets.size())];
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+const typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::Bucket& 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::bucket_for_hash(size_type hash) const {
+    if (!m_old_buckets.empty()) {
+        size_type old_index = bucket_index(hash, m_old_buckets.size());
+        if (old_index >= m_rehash_pos) {
+            return m_old_buckets[old_index];
+        }
+    }
+    return m_buckets[bucket_index(hash, m_buckets.size())];
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+template <typename Result>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::find_batch_impl(
+    const Key* keys, size_type count, Result* results) const {
+    
+    const Bucket* buckets[FIND_BATCH_CHUNK];
+    for (size_type base = 0; base < count; base += FIND_BATCH_CHUNK) {
+        size_type n = std::min(FIND_BATCH_CHUNK, count - base);
+        
+        // Hash every key and start loading its bucket head
+        for (size_type i = 0; i < n; ++i) {
+            buckets[i] = &bucket_for_hash(hash_key(keys[base + i]));
+            detail::prefetch(buckets[i]);
+        }
+        
+        // Start loading the first node of each bucket
+        for (size_type i = 0; i < n; ++i) {
+            if (!buckets[i]->empty()) {
+                detail::prefetch(&buckets[i]->front());
+            }
+        }
+        
+        for (size_type i = 0; i < n; ++i) {
+            auto it = find_in_bucket(*buckets[i], keys[base + i]);
+            // Result is Value* only when called from a non-const table
+            results[base + i] = it != buckets[i]->end() ? const_cast<Result>(&it->second) : nullptr;
+        }
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+template <typename K>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::Bucket::iterator 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::find_in_bucket(Bucket& bucket, const K& key) {
+    for (auto it = bucket.begin(); it != bucket.end(); ++it) {
+        if (m_key_equal(it->first, key)) {
+            return it;
+        }
+    }
+    return bucket.end();
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+template <typename K>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::Bucket::const_iterator 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::find_in_bucket(const Bucket& bucket, const K& key) const {
+    for (auto it = bucket.begin(); it != bucket.end(); ++it) {
+        if (m_key_equal(it->first, key)) {
+            return it;
+        }
+    }
+    return bucket.end();
+}
+
 } // namespace hash
 } // namespace mylib
 
@@ -1,6 +1,6 @@
 /**
  * @file deque.hpp
- * @brief Double-ended queue implementation using LinkedList as underlying container
+ * @brief Double-ended queue implementation on a segmented block map
  * @author Jinhyeok
  * @date 2025-11-29
  * @version 1.0.0
@@ -29,8 +29,8 @@
 #ifndef MYLIB_LINEAR_DEQUE_HPP
 #define MYLIB_LINEAR_DEQUE_HPP
 
-#include "linear/linked_list.hpp"
 #include <cstddef>
+#include <memory>
 #include <stdexcept>
 #include <utility>
 #include <initializer_list>
@@ -38,13 +38,51 @@
 namespace mylib {
 namespace linear {
 
+namespace detail {
+
+/**
+ * @brief Elements per Deque block: about 4 KB, at least 16, rounded down to
+ * a power of two so positions split into block/offset with a shift and mask
+ */
+constexpr std::size_t deque_block_elements(std::size_t element_size) {
+    std::size_t n = element_size < 4096 / 16 ? 4096 / element_size : 16;
+    std::size_t pow2 = 1;
+    while (pow2 * 2 <= n) {
+        pow2 *= 2;
+    }
+    return pow2;
+}
+
+/**
+ * @brief log2 of a power of two
+ */
+constexpr std::size_t deque_log2(std::size_t pow2) {
+    std::size_t shift = 0;
+    while ((std::size_t(1) << shift) < pow2) {
+        ++shift;
+    }
+    return shift;
+}
+
+} // namespace detail
+
 /**
  * @class Deque
  * @brief A double-ended queue container
  * 
- * This class implements a deque (double-ended queue) data structure using
- * LinkedList as the underlying container. It provides O(1) insertion and
- * deletion at both ends.
+ * This class implements a deque (double-ended queue) data structure on a
+ * segmented block map, like std::deque: elements live in fixed-size blocks
+ * (BLOCK_SIZE elements, about 4 KB) and a map array points at the blocks.
+ * 
+ * - at() / operator[]: O(1), one map lookup plus one block access
+ * - push/pop at either end: amortized O(1); blocks emptied by pops are kept
+ *   and reused, so a deque cycling at a steady size stops allocating
+ * - insert/erase in the middle: O(n), shifting the shorter side
+ * - References stay valid across pushes and pops at the ends (the map may
+ *   move, the blocks never do)
+ * 
+ * Memory held by spare blocks is returned by shrink_to_fit() or on
+ * destruction.
  * 
  * @tparam T The type of elements stored in the deque
  */
@@ -57,6 +95,8 @@ public:
     using reference = T&;
     using const_reference = const T&;
 
+    static constexpr size_type BLOCK_SIZE = detail::deque_block_elements(sizeof(T));  ///< Elements per block
+
     /**
      * @brief Default constructor
      * Creates an empty deque
@@ -91,7 +131,7 @@ public:
     /**
      * @brief Destructor
      */
-    ~Deque() = default;
+    ~Deque();
 
     /**
      * @brief Copy assignment operator
@@ -154,9 +194,20 @@ public:
      */
     size_type size() const noexcept;
 
+    /**
+     * @brief Number of elements the allocated blocks can hold
+     * @return Allocated block count times BLOCK_SIZE
+     */
+    size_type capacity() const noexcept;
+
+    /**
+     * @brief Free blocks that hold no elements
+     */
+    void shrink_to_fit();
+
     // Modifiers
     /**
-     * @brief Clear all elements
+     * @brief Clear all elements (allocated blocks are kept for reuse)
      */
     void clear() noexcept;
 
@@ -265,9 +316,180 @@ public:
     bool contains(const T& value) const;
 
 private:
-    LinkedList<T> m_container;  ///< Underlying container
+    using BlockAllocator = std::allocator<T>;
+    using BlockTraits = std::allocator_traits<BlockAllocator>;
+
+    static constexpr size_type BLOCK_SHIFT = detail::deque_log2(BLOCK_SIZE);
+    static constexpr size_type BLOCK_MASK = BLOCK_SIZE - 1;
+    static constexpr size_type MIN_MAP_SIZE = 8;
+
+    T** m_map;              ///< Block pointers; unused slots may hold spare blocks
+    size_type m_map_size;   ///< Number of slots in m_map
+    size_type m_start;      ///< Position of the first element (slot * BLOCK_SIZE + offset)
+    size_type m_size;       ///< Number of elements
+
+    /**
+     * @brief Address of the element at a map position
+     */
+    T* slot_at(size_type pos) const noexcept {
+        return m_map[pos >> BLOCK_SHIFT] + (pos & BLOCK_MASK);
+    }
+
+    /**
+     * @brief Make sure the slot holding position pos has a block
+     */
+    void ensure_block(size_type pos) {
+        if (!m_map[pos >> BLOCK_SHIFT]) {
+            allocate_block(pos >> BLOCK_SHIFT);
+        }
+    }
+
+    /**
+     * @brief Allocate the block for an empty map slot
+     */
+    void allocate_block(size_type slot);
+
+    /**
+     * @brief Make room for one more element at the front or back
+     * @param at_front true to grow at the front
+     *
+     * Re-centres the used blocks in the map, growing the map if it is more
+     * than half full. Spare blocks are carried over.
+     */
+    void reserve_map(bool at_front);
+
+    /**
+     * @brief Free every block and the map
+     */
+    void release() noexcept;
+
+    template <typename U>
+    void emplace_front_impl(U&& value);
+
+    template <typename U>
+    void emplace_back_impl(U&& value);
+
+    template <typename U>
+    void insert_impl(size_type index, U&& value);
 };
 
+// ============================================
+// Template member function implementations
+// ============================================
+
+// Element access and end operations are defined here so they inline into
+// callers; everything else lives in deque.cpp
+
+template <typename T>
+inline typename Deque<T>::reference Deque<T>::operator[](size_type index) {
+    return *slot_at(m_start + index);
+}
+
+template <typename T>
+inline typename Deque<T>::const_reference Deque<T>::operator[](size_type index) const {
+    return *slot_at(m_start + index);
+}
+
+template <typename T>
+inline void Deque<T>::push_front(const T& value) {
+    emplace_front_impl(value);
+}
+
+template <typename T>
+inline void Deque<T>::push_front(T&& value) {
+    emplace_front_impl(std::move(value));
+}
+
+template <typename T>
+inline void Deque<T>::push_back(const T& value) {
+    emplace_back_impl(value);
+}
+
+template <typename T>
+inline void Deque<T>::push_back(T&& value) {
+    emplace_back_impl(std::move(value));
+}
+
+template <typename T>
+inline void Deque<T>::pop_front() {
+    if (m_size == 0) {
+        throw std::out_of_range("Deque::pop_front: deque is empty");
+    }
+    BlockAllocator alloc;
+    BlockTraits::destroy(alloc, slot_at(m_start));
+    ++m_start;
+    --m_size;
+}
+
+template <typename T>
+inline void Deque<T>::pop_back() {
+    if (m_size == 0) {
+        throw std::out_of_range("Deque::pop_back: deque is empty");
+    }
+    BlockAllocator alloc;
+    BlockTraits::destroy(alloc, slot_at(m_start + m_size - 1));
+    --m_size;
+}
+
+template <typename T>
+template <typename U>
+void Deque<T>::emplace_front_impl(U&& value) {
+    if (m_start == 0) {
+        reserve_map(true);
+    }
+    ensure_block(m_start - 1);
+    BlockAllocator alloc;
+    BlockTraits::construct(alloc, slot_at(m_start - 1), std::forward<U>(value));
+    --m_start;
+    ++m_size;
+}
+
+template <typename T>
+template <typename U>
+void Deque<T>::emplace_back_impl(U&& value) {
+    size_type pos = m_start + m_size;
+    if (pos == (m_map_size << BLOCK_SHIFT)) {
+        reserve_map(false);
+        pos = m_start + m_size;
+    }
+    ensure_block(pos);
+    BlockAllocator alloc;
+    BlockTraits::construct(alloc, slot_at(pos), std::forward<U>(value));
+    ++m_size;
+}
+
+template <typename T>
+template <typename U>
+void Deque<T>::insert_impl(size_type index, U&& value) {
+    if (index > m_size) {
+        throw std::out_of_range("Deque::insert: index out of range");
+    }
+    if (index == 0) {
+        emplace_front_impl(std::forward<U>(value));
+        return;
+    }
+    if (index == m_size) {
+        emplace_back_impl(std::forward<U>(value));
+        return;
+    }
+    // Take a copy first: value may refer to an element about to shift
+    T tmp(std::forward<U>(value));
+    if (index < m_size / 2) {
+        // Shift the front part one slot towards the front
+        emplace_front_impl(std::move((*this)[0]));
+        for (size_type i = 1; i < index; ++i) {
+            (*this)[i] = std::move((*this)[i + 1]);
+        }
+    } else {
+        // Shift the back part one slot towards the back
+        emplace_back_impl(std::move((*this)[m_size - 1]));
+        for (size_type i = m_size - 2; i > index; --i) {
+            (*this)[i] = std::move((*this)[i - 1]);
+        }
+    }
+    (*this)[index] = std::move(tmp);
+}
+
 } // namespace linear
 } // namespace mylib
 
@@ -0,0 +1,221 @@
+/**
+ * @file allocation_policy.hpp
+ * @brief Storage allocation policies for DynamicArray
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 2.1.0
+ *
+ * DynamicArray<T, Policy> obtains its element buffer from Policy. A policy
+ * is a class with static members:
+ *
+ * @code
+ * static constexpr std::size_t alignment;   // Minimum buffer alignment
+ * static void* allocate(std::size_t bytes, std::size_t align);
+ * static void deallocate(void* p, std::size_t bytes, std::size_t align) noexcept;
+ * static void* reallocate(void* p, std::size_t old_bytes, std::size_t new_bytes,
+ *                         std::size_t align) noexcept;
+ * @endcode
+ *
+ * align is max(alignment, alignof(T)). allocate() throws std::bad_alloc
+ * on failure. reallocate() is only called for trivially relocatable T: it
+ * may resize the block in place or move its bytes, and returns nullptr
+ * (leaving p untouched) when it cannot, in which case DynamicArray
+ * allocates a new block and relocates the elements itself.
+ *
+ * Provided policies:
+ * - MallocAllocation (default): malloc/realloc, aligned new for
+ *   over-aligned types
+ * - AlignedAllocation<A>: every buffer aligned to A bytes (e.g. 64 for
+ *   aligned SIMD loads and cache-line-aligned scans)
+ * - HugePageAllocation<A, Threshold>: like AlignedAllocation below
+ *   Threshold bytes; above it, anonymous mmap with MADV_HUGEPAGE (fewer
+ *   TLB misses on large scans), grown with mremap so the kernel moves
+ *   page mappings instead of copying. Falls back to AlignedAllocation
+ *   where mmap/mremap are unavailable.
+ *
+ * Copyright (c) 2026 Jinhyeok
+ * MIT License
+ */
+
+#ifndef MYLIB_LINEAR_ALLOCATION_POLICY_HPP
+#define MYLIB_LINEAR_ALLOCATION_POLICY_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define MYLIB_HAS_MREMAP 1
+#else
+#define MYLIB_HAS_MREMAP 0
+#endif
+
+namespace mylib {
+namespace linear {
+
+/**
+ * @struct MallocAllocation
+ * @brief Default policy: malloc/realloc, aligned new for over-aligned types
+ */
+struct MallocAllocation {
+    static constexpr std::size_t alignment = 1;
+
+    static void* allocate(std::size_t bytes, std::size_t align) {
+        if (align <= alignof(std::max_align_t)) {
+            void* p = std::malloc(bytes);
+            if (p == nullptr) {
+                throw std::bad_alloc();
+            }
+            return p;
+        }
+        return ::operator new(bytes, std::align_val_t(align));
+    }
+
+    static void deallocate(void* p, std::size_t, std::size_t align) noexcept {
+        if (align <= alignof(std::max_align_t)) {
+            std::free(p);
+        } else {
+            ::operator delete(p, std::align_val_t(align));
+        }
+    }
+
+    static void* reallocate(void* p, std::size_t, std::size_t new_bytes, std::size_t align) noexcept {
+        if (align <= alignof(std::max_align_t)) {
+            return std::realloc(p, new_bytes);
+        }
+        return nullptr;
+    }
+};
+
+/**
+ * @struct AlignedAllocation
+ * @brief Every buffer starts on an Alignment-byte boundary
+ * @tparam Alignment Power of two (64 = one cache line / AVX-512 vector)
+ */
+template <std::size_t Alignment = 64>
+struct AlignedAllocation {
+    static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0,
+                  "AlignedAllocation: alignment must be a power of two");
+
+    static constexpr std::size_t alignment = Alignment;
+
+    static void* allocate(std::size_t bytes, std::size_t align) {
+        return ::operator new(bytes, std::align_val_t(align));
+    }
+
+    static void deallocate(void* p, std::size_t, std::size_t align) noexcept {
+        ::operator delete(p, std::align_val_t(align));
+    }
+
+    static void* reallocate(void*, std::size_t, std::size_t, std::size_t) noexcept {
+        // No aligned realloc in the standard library
+        return nullptr;
+    }
+};
+
+/**
+ * @struct HugePageAllocation
+ * @brief Aligned heap blocks for small arrays, huge-page mappings for large ones
+ * @tparam Alignment Power of two, at most the page size
+ * @tparam Threshold Size in bytes from which buffers are mapped (default 2 MiB,
+ *         one x86-64 huge page)
+ *
+ * Whether a block is mapped depends only on its size, so a block is never
+ * resized across the threshold in place; DynamicArray relocates it instead.
+ */
+template <std::size_t Alignment = 64, std::size_t Threshold = (std::size_t(2) << 20)>
+struct HugePageAllocation {
+    using Small = AlignedAllocation<Alignment>;
+
+    static constexpr std::size_t alignment = Alignment;
+    static constexpr std::size_t threshold = Threshold;
+
+    static void* allocate(std::size_t bytes, std::size_t align) {
+#if MYLIB_HAS_MREMAP
+        if (is_mapped(bytes, align)) {
+            void* p = ::mmap(nullptr, round_to_pages(bytes), PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+            advise(p, round_to_pages(bytes));
+            return p;
+        }
+#endif
+        return Small::allocate(bytes, align);
+    }
+
+    static void deallocate(void* p, std::size_t bytes, std::size_t align) noexcept {
+#if MYLIB_HAS_MREMAP
+        if (is_mapped(bytes, align)) {
+            ::munmap(p, round_to_pages(bytes));
+            return;
+        }
+#endif
+        Small::deallocate(p, bytes, align);
+    }
+
+    static void* reallocate(void* p, std::size_t old_bytes, std::size_t new_bytes,
+                            std::size_t align) noexcept {
+#if MYLIB_HAS_MREMAP
+        if (is_mapped(old_bytes, align) && is_mapped(new_bytes, align)) {
+            std::size_t old_length = round_to_pages(old_bytes);
+            std::size_t new_length = round_to_pages(new_bytes);
+            if (old_length == new_length) {
+                return p;
+            }
+            void* q = ::mremap(p, old_length, new_length, MREMAP_MAYMOVE);
+            if (q == MAP_FAILED) {
+                return nullptr;
+            }
+            if (new_length > old_length) {
+                advise(q, new_length);
+            }
+            return q;
+        }
+#else
+        (void)p;
+        (void)old_bytes;
+        (void)new_bytes;
+        (void)align;
+#endif
+        return nullptr;
+    }
+
+private:
+#if MYLIB_HAS_MREMAP
+    static std::size_t page_size() noexcept {
+        static const std::size_t size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        return size;
+    }
+
+    /**
+     * @brief Mapped blocks are page-aligned, so they serve any align up to a page
+     */
+    static bool is_mapped(std::size_t bytes, std::size_t align) noexcept {
+        return bytes >= Threshold && align <= page_size();
+    }
+
+    static std::size_t round_to_pages(std::size_t bytes) noexcept {
+        std::size_t page = page_size();
+        return (bytes + page - 1) / page * page;
+    }
+
+    static void advise(void* p, std::size_t length) noexcept {
+#ifdef MADV_HUGEPAGE
+        // Only a hint: without transparent huge pages this is a no-op
+        ::madvise(p, length, MADV_HUGEPAGE);
+#else
+        (void)p;
+        (void)length;
+#endif
+    }
+#endif
+};
+
+} // namespace linear
+} // namespace mylib
+
+#endif // MYLIB_LINEAR_ALLOCATION_POLICY_HPP
@@ -3,7 +3,7 @@
  * @brief Dynamic array container with automatic memory management
  * @author Jinhyeok
  * @date 2025-12-06
- * @version 2.0.0
+ * @version 2.1.0
  * 
  * Phase 1 Optimizations Applied:
  * - ✅ Move semantics (already present)
@@ -12,6 +12,16 @@
  * - ✅ noexcept specifications (ENHANCED)
  * - ✅ Growth factor optimization (2.0 → 1.5)
  * 
+ * Relocation (2.1):
+ * - Elements live in raw storage; capacity beyond size() is unconstructed
+ * - Types with is_trivially_relocatable<T> are moved by memcpy/memmove
+ *   when growing, inserting and erasing, and grown in place with realloc
+ *   when the allocator can extend the block
+ * - Bulk append/insert reserve once; resize_default_init and
+ *   resize_uninitialized skip zeroing for trivial types
+ * - Storage comes from an allocation policy: malloc (default), aligned,
+ *   or huge-page mappings grown with mremap
+ * 
  * Copyright (c) 2025 Jinhyeok
  * Licensed under MIT License
  */
@@ -27,6 +37,7 @@
 #include <iterator>
 #include <algorithm>
 #include <memory>
+#include <cstdlib>
 
 namespace mylib {
 namespace linear {
@@ -43,6 +54,9 @@ namespace linear {
  * - Optimized growth strategy (φ ≈ 1.5)
  * 
  * @tparam T Element type (must be move-constructible)
+ * @tparam Policy Storage allocation policy (see allocation_policy.hpp),
+ *         e.g. AlignedAllocation<64> or HugePageAllocation<> for large
+ *         numeric buffers
  * 
  * Performance characteristics:
  * - Access: O(1)
@@ -50,7 +64,7 @@ namespace linear {
  * - Insertion at arbitrary position: O(n)
  * - Space complexity: O(n)
  */
-template <typename T>
+template <typename T, typename Policy>
 class DynamicArray {
 public:
     // ============================================
@@ -71,6 +85,12 @@ public:
     using reverse_iterator = std::reverse_iterator<iterator>;
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
     
+    using allocation_policy = Policy;
+    
+    /// Guaranteed alignment of data() (when non-null)
+    static constexpr size_type ALIGNMENT =
+        Policy::alignment > alignof(T) ? Policy::alignment : alignof(T);
+    
     // ============================================
     // Constructors & Destructor
     // ============================================
@@ -334,6 +354,85 @@ public:
      */
     void pop_back() noexcept;
     
+    /**
+     * @brief Insert a copy of value before pos
+     * @param pos Insertion point (begin() to end())
+     * @param value Element to copy (may be an element of this array)
+     * @return Iterator to the inserted element
+     * @complexity O(n)
+     * @exception Strong guarantee for trivially relocatable or nothrow-movable T
+     */
+    iterator insert(const_iterator pos, const T& value);
+    
+    /**
+     * @brief Insert value before pos by move
+     */
+    iterator insert(const_iterator pos, T&& value);
+    
+    /**
+     * @brief Construct an element in place before pos
+     * @return Iterator to the new element
+     * @complexity O(n)
+     */
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args);
+    
+    /**
+     * @brief Insert copies of [first, last) before pos
+     * @param pos Insertion point (begin() to end())
+     * @param first, last Source range (may lie inside this array)
+     * @return Iterator to the first inserted element (pos if the range is empty)
+     * @complexity O(n + m) where m = distance(first, last)
+     * @exception Strong guarantee when the range is forward and the
+     *            array has to grow; basic guarantee otherwise
+     * 
+     * Forward ranges reserve once. Pointer ranges of trivially copyable T
+     * are copied with memcpy and the tail is shifted with memmove.
+     */
+    template <typename InputIt,
+              typename = std::enable_if_t<detail::is_input_iterator_v<InputIt>>>
+    iterator insert(const_iterator pos, InputIt first, InputIt last);
+    
+    /**
+     * @brief Append copies of [first, last) at the end
+     * @param first, last Source range (may lie inside this array)
+     * @complexity O(m) where m = distance(first, last)
+     * @exception Strong guarantee for forward ranges
+     * 
+     * Grows at most once for forward ranges, then copies without
+     * per-element capacity checks (memcpy for pointer ranges of
+     * trivially copyable T).
+     * 
+     * Example:
+     *   arr.append(packet.begin(), packet.end());
+     */
+    template <typename InputIt,
+              typename = std::enable_if_t<detail::is_input_iterator_v<InputIt>>>
+    void append(InputIt first, InputIt last);
+    
+    /**
+     * @brief Append count elements copied from a contiguous buffer
+     * @param data First element of the buffer (pointer + size span)
+     * @param count Number of elements
+     * @complexity O(count)
+     * @exception Strong guarantee
+     */
+    void append(const_pointer data, size_type count);
+    
+    /**
+     * @brief Remove the element at pos
+     * @return Iterator to the element that followed it
+     * @complexity O(n)
+     */
+    iterator erase(const_iterator pos);
+    
+    /**
+     * @brief Remove the elements in [first, last)
+     * @return Iterator to the element that followed the range
+     * @complexity O(n)
+     */
+    iterator erase(const_iterator first, const_iterator last);
+    
     /**
      * @brief Resize to contain count elements
      * @param count New size
@@ -352,6 +451,27 @@ public:
      */
     void resize(size_type count, const T& value);
     
+    /**
+     * @brief Resize, default-initializing new elements
+     * @param count New size
+     * @complexity O(n), but O(1) amortized for growing trivial T
+     * @exception Strong guarantee
+     * 
+     * Unlike resize(count), new elements of trivial type are left
+     * indeterminate instead of zeroed. Use it when the caller overwrites
+     * them right away (e.g. reading from a socket into data() + old size).
+     */
+    void resize_default_init(size_type count);
+    
+    /**
+     * @brief Resize without initializing new elements (trivial T only)
+     * @param count New size
+     * @complexity O(1) amortized (capacity grows geometrically)
+     * @exception Strong guarantee
+     * @warning New elements are indeterminate until written
+     */
+    void resize_uninitialized(size_type count);
+    
     /**
      * @brief Swap contents with another array
      * @param other Array to swap with
@@ -387,6 +507,9 @@ private:
     static constexpr size_type DEFAULT_CAPACITY = 16;
     static constexpr double GROWTH_FACTOR = 1.5;  // Optimized from 2.0
     
+    /// Relocate by copying bytes instead of move + destroy
+    static constexpr bool TRIVIAL_RELOCATION = is_trivially_relocatable_v<T>;
+    
     // ============================================
     // Helper Methods
     // ============================================
@@ -406,10 +529,80 @@ private:
     
     /**
      * @brief Reallocate with new capacity
-     * @param new_capacity New capacity
+     * @param new_capacity New capacity (elements beyond it are destroyed)
+     * 
+     * Trivially relocatable elements are carried over by
+     * Policy::reallocate (realloc, mremap) or memcpy; others are moved
+     * (or copied if the move may throw) one by one.
      */
     void reallocate(size_type new_capacity);
     
+    /**
+     * @brief Allocate uninitialized storage for count elements
+     * @throws std::bad_alloc, std::length_error
+     */
+    static pointer allocate(size_type count);
+    
+    /**
+     * @brief Free storage obtained from allocate(count)
+     */
+    static void deallocate(pointer p, size_type count) noexcept;
+    
+    /**
+     * @brief Move [first, last) to uninitialized dest and end the source objects
+     * @pre The ranges do not overlap
+     */
+    static void relocate(pointer first, pointer last, pointer dest);
+    
+    /**
+     * @brief Move-construct (or copy if the move may throw) [first, last) into dest
+     * @return End of the constructed range
+     */
+    static pointer uninitialized_transfer(pointer first, pointer last, pointer dest);
+    
+    /**
+     * @brief Open a gap of one element at index (capacity must allow it)
+     * @return Pointer to the uninitialized gap
+     */
+    pointer open_gap(size_type index);
+    
+    /**
+     * @brief Grow, constructing the new element at index before the old
+     *        ones are relocated (args may refer to an element of this array)
+     */
+    template <typename... Args>
+    pointer grow_and_emplace(size_type index, Args&&... args);
+    
+    /**
+     * @brief Copy [first, last) (count elements) to uninitialized dest
+     * @return End of the constructed range
+     */
+    template <typename ForwardIt>
+    static pointer copy_range(ForwardIt first, ForwardIt last, size_type count, pointer dest);
+    
+    /**
+     * @brief Move into a buffer of at least required capacity, copying
+     *        [first, last) (count elements) to its slot at index first
+     * @return Pointer to the first copied element
+     */
+    template <typename ForwardIt>
+    pointer grow_and_insert(size_type index, ForwardIt first, ForwardIt last,
+                            size_type count, size_type required);
+    
+    /**
+     * @brief Move the elements into new_data, leaving gap unconstructed
+     *        slots at index, then free the old storage
+     * 
+     * On exception the old elements are intact and nothing in new_data
+     * outside the gap is left constructed.
+     */
+    void move_around_gap(pointer new_data, size_type index, size_type gap);
+    
+    /**
+     * @brief Check whether p points at one of the current elements
+     */
+    bool contains_address(const_pointer p) const noexcept;
+    
     /**
      * @brief Destroy range of elements
      * @param first First element to destroy
@@ -429,8 +622,8 @@ private:
  * @complexity O(1)
  * @exception noexcept
  */
-template <typename T>
-void swap(DynamicArray<T>& lhs, DynamicArray<T>& rhs) noexcept;
+template <typename T, typename Policy>
+void swap(DynamicArray<T, Policy>& lhs, DynamicArray<T, Policy>& rhs) noexcept;
 
 } // namespace linear
 } // namespace mylib
@@ -3,22 +3,56 @@
  * @brief Forward declarations and type traits for DynamicArray
  * @author Jinhyeok
  * @date 2025-12-06
- * @version 2.0.0
+ * @version 2.1.0
  */
 
 #ifndef MYLIB_LINEAR_DYNAMIC_ARRAY_FWD_HPP
 #define MYLIB_LINEAR_DYNAMIC_ARRAY_FWD_HPP
 
+#include "allocation_policy.hpp"
 #include <cstddef>
+#include <iterator>
+#include <memory>
 #include <type_traits>
 
 namespace mylib {
 namespace linear {
 
 // Forward declaration
-template <typename T>
+template <typename T, typename Policy = MallocAllocation>
 class DynamicArray;
 
+/**
+ * @brief Whether moving a T to a new address and ending the old object's
+ *        lifetime is equivalent to copying its bytes
+ *
+ * True for trivially copyable types. Specialize it (as true_type) for
+ * types that own resources but hold no pointers into themselves, so
+ * containers can relocate them with memcpy/memmove/realloc instead of
+ * move-constructing and destroying each element.
+ *
+ * Types that point into themselves must stay false. This includes
+ * libstdc++'s std::string, whose short-string buffer is referenced by its
+ * own data pointer, and SmallDynamicArray.
+ */
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T>
+struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type {};
+
+template <typename T>
+struct is_trivially_relocatable<std::shared_ptr<T>> : std::true_type {};
+
+template <typename T>
+struct is_trivially_relocatable<std::weak_ptr<T>> : std::true_type {};
+
+template <typename T, typename Policy>
+struct is_trivially_relocatable<DynamicArray<T, Policy>> : std::true_type {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
 // Type traits helpers
 namespace detail {
 
@@ -37,9 +71,45 @@ template <typename T>
 inline constexpr bool is_trivially_copyable_v = 
     std::is_trivially_copyable_v<T>;
 
+/**
+ * @brief Iterator category of It, or void if It is not an iterator
+ */
+template <typename It, typename = void>
+struct iterator_category {
+    using type = void;
+};
+
+template <typename It>
+struct iterator_category<It, std::void_t<typename std::iterator_traits<It>::iterator_category>> {
+    using type = typename std::iterator_traits<It>::iterator_category;
+};
+
+/**
+ * @brief Check if It is at least an input iterator
+ */
+template <typename It>
+inline constexpr bool is_input_iterator_v =
+    std::is_convertible_v<typename iterator_category<It>::type, std::input_iterator_tag>;
+
+/**
+ * @brief Check if It is at least a forward iterator (multi-pass, countable)
+ */
+template <typename It>
+inline constexpr bool is_forward_iterator_v =
+    std::is_convertible_v<typename iterator_category<It>::type, std::forward_iterator_tag>;
+
+/**
+ * @brief Check if [first, last) of It can be copied into T storage with memcpy
+ */
+template <typename It, typename T>
+inline constexpr bool is_memcpy_source_v =
+    std::is_pointer_v<It> &&
+    std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>, T> &&
+    std::is_trivially_copyable_v<T>;
+
 } // namespace detail
 
 } // namespace linear
 } // namespace mylib
 
-#endif // MYLIB_LINEAR_DYNAMIC_ARRAY_FWD_HPP
\ No newline at end of file
+#endif // MYLIB_LINEAR_DYNAMIC_ARRAY_FWD_HPP
@@ -3,7 +3,7 @@
  * @brief Implementation of DynamicArray member functions
  * @author Jinhyeok
  * @date 2025-12-06
- * @version 2.0.0
+ * @version 2.1.0
  */
 
 #ifndef MYLIB_LINEAR_DYNAMIC_ARRAY_IMPL_HPP
@@ -11,6 +11,10 @@
 
 #include "dynamic_array.hpp"
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iterator>
 #include <memory>
 #include <new>
 
@@ -21,88 +25,80 @@ namespace linear {
 // Constructors & Destructor
 // ============================================
 
-template <typename T>
-DynamicArray<T>::DynamicArray() noexcept
+template <typename T, typename Policy>
+DynamicArray<T, Policy>::DynamicArray() noexcept
     : m_data(nullptr), m_size(0), m_capacity(0) {
 }
 
-template <typename T>
-DynamicArray<T>::DynamicArray(size_type initial_capacity)
+template <typename T, typename Policy>
+DynamicArray<T, Policy>::DynamicArray(size_type initial_capacity)
     : m_data(nullptr), m_size(0), m_capacity(0) {
     if (initial_capacity > 0) {
-        m_data = new T[initial_capacity];
+        m_data = allocate(initial_capacity);
         m_capacity = initial_capacity;
     }
 }
 
-template <typename T>
-DynamicArray<T>::DynamicArray(size_type count, const T& value)
+template <typename T, typename Policy>
+DynamicArray<T, Policy>::DynamicArray(size_type count, const T& value)
     : m_data(nullptr), m_size(0), m_capacity(0) {
     if (count > 0) {
-        m_data = new T[count];
+        m_data = allocate(count);
         m_capacity = count;
         
         try {
-            for (size_type i = 0; i < count; ++i) {
-                m_data[i] = value;
-                ++m_size;
-            }
+            std::uninitialized_fill_n(m_data, count, value);
+            m_size = count;
         } catch (...) {
             // Exception safety: clean up and rethrow
-            delete[] m_data;
+            deallocate(m_data, m_capacity);
             m_data = nullptr;
-            m_size = 0;
             m_capacity = 0;
             throw;
         }
     }
 }
 
-template <typename T>
-DynamicArray<T>::DynamicArray(std::initializer_list<T> init)
+template <typename T, typename Policy>
+DynamicArray<T, Policy>::DynamicArray(std::initializer_list<T> init)
     : m_data(nullptr), m_size(0), m_capacity(0) {
     if (init.size() > 0) {
-        m_data = new T[init.size()];
+        m_data = allocate(init.size());
         m_capacity = init.size();
         
         try {
-            for (const auto& item : init) {
-                m_data[m_size++] = item;
-            }
+            std::uninitialized_copy(init.begin(), init.end(), m_data);
+            m_size = init.size();
         } catch (...) {
-            delete[] m_data;
+            deallocate(m_data, m_capacity);
             m_data = nullptr;
-            m_size = 0;
             m_capacity = 0;
             throw;
         }
     }
 }
 
-template <typename T>
-DynamicArray<T>::DynamicArray(const DynamicArray& other)
+template <typename T, typename Policy>
+DynamicArray<T, Policy>::DynamicArray(const DynamicArray& other)
     : m_data(nullptr), m_size(0), m_capacity(0) {
     if (other.m_capacity > 0) {
-        m_data = new T[other.m_capacity];
+        m_data = allocate(other.m_capacity);
         m_capacity = other.m_capacity;
         
         try {
-            for (size_type i = 0; i < other.m_size; ++i) {
-                m_data[i] = other.m_data[i];
-                ++m_size;
-            }
+            std::uninitialized_copy(other.m_data, other.m_data + other.m_size, m_data);
+            m_size = other.m_size;
         } catch (...) {
-            delete[] m_data;
+            deallocate(m_data, m_capacity);
             m_data = nullptr;
-            m_size = 0;
             m_capacity = 0;
             throw;
         }
     }
 }
 
-template <typename T>
-DynamicArray<T>::DynamicArray(DynamicArray&& other) noexcept
+template <typename T, typename Policy>
+DynamicArray<T, Policy>::DynamicArray(DynamicArray&& other) noexcept
     : m_data(other.m_data)
     , m_size(other.m_size)
     , m_capacity(other.m_capacity) {
@@ -112,17 +108,18 @@ DynamicArray<T>::DynamicArray(DynamicArray&& other) noexcept
     other.m_capacity = 0;
 }
 
-template <typename T>
-DynamicArray<T>::~DynamicArray() noexcept {
-    delete[] m_data;
+template <typename T, typename Policy>
+DynamicArray<T, Policy>::~DynamicArray() noexcept {
+    destroy_range(m_data, m_data + m_size);
+    deallocate(m_data, m_capacity);
 }
 
 // ============================================
 // Assignment Operators
 // ============================================
 
-template <typename T>
-DynamicArray<T>& DynamicArray<T>::operator=(const DynamicArray& other) {
+template <typename T, typename Policy>
+DynamicArray<T, Policy>& DynamicArray<T, Policy>::operator=(const DynamicArray& other) {
     if (this != &other) {
         // Create temporary and swap (strong exception guarantee)
         DynamicArray temp(other);
@@ -131,11 +128,12 @@ DynamicArray<T>& DynamicArray<T>::operator=(const DynamicArray& other) {
     return *this;
 }
 
-template <typename T>
-DynamicArray<T>& DynamicArray<T>::operator=(DynamicArray&& other) noexcept {
+template <typename T, typename Policy>
+DynamicArray<T, Policy>& DynamicArray<T, Policy>::operator=(DynamicArray&& other) noexcept {
     if (this != &other) {
         // Clean up our resources
-        delete[] m_data;
+        destroy_range(m_data, m_data + m_size);
+        deallocate(m_data, m_capacity);
         
         // Take ownership of other's resources
         m_data = other.m_data;
@@ -150,8 +148,8 @@ DynamicArray<T>& DynamicArray<T>::operator=(DynamicArray&& other) noexcept {
     return *this;
 }
 
-template <typename T>
-DynamicArray<T>& DynamicArray<T>::operator=(std::initializer_list<T> init) {
+template <typename T, typename Policy>
+DynamicArray<T, Policy>& DynamicArray<T, Policy>::operator=(std::initializer_list<T> init) {
     // Create temporary and swap
     DynamicArray temp(init);
     swap(temp);
@@ -162,59 +160,59 @@ DynamicArray<T>& DynamicArray<T>::operator=(std::initializer_list<T> init) {
 // Element Access
 // ============================================
 
-template <typename T>
-typename DynamicArray<T>::reference DynamicArray<T>::at(size_type index) {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::reference DynamicArray<T, Policy>::at(size_type index) {
     if (index >= m_size) {
         throw std::out_of_range("DynamicArray::at: index out of range");
     }
     return m_data[index];
 }
 
-template <typename T>
-typename DynamicArray<T>::const_reference DynamicArray<T>::at(size_type index) const {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::const_reference DynamicArray<T, Policy>::at(size_type index) const {
     if (index >= m_size) {
         throw std::out_of_range("DynamicArray::at: index out of range");
     }
     return m_data[index];
 }
 
-template <typename T>
-typename DynamicArray<T>::reference DynamicArray<T>::operator[](size_type index) noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::reference DynamicArray<T, Policy>::operator[](size_type index) noexcept {
     return m_data[index];
 }
 
-template <typename T>
-typename DynamicArray<T>::const_reference DynamicArray<T>::operator[](size_type index) const noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::const_reference DynamicArray<T, Policy>::operator[](size_type index) const noexcept {
     return m_data[index];
 }
 
-template <typename T>
-typename DynamicArray<T>::reference DynamicArray<T>::front() noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::reference DynamicArray<T, Policy>::front() noexcept {
     return m_data[0];
 }
 
-template <typename T>
-typename DynamicArray<T>::const_reference DynamicArray<T>::front() const noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::const_reference DynamicArray<T, Policy>::front() const noexcept {
     return m_data[0];
 }
 
-template <typename T>
-typename DynamicArray<T>::reference DynamicArray<T>::back() noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::reference DynamicArray<T, Policy>::back() noexcept {
     return m_data[m_size - 1];
 }
 
-template <typename T>
-typename DynamicArray<T>::const_reference DynamicArray<T>::back() const noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::const_reference DynamicArray<T, Policy>::back() const noexcept {
     return m_data[m_size - 1];
 }
 
-template <typename T>
-typename DynamicArray<T>::pointer DynamicArray<T>::data() noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::pointer DynamicArray<T, Policy>::data() noexcept {
     return m_data;
 }
 
-template <typename T>
-typename DynamicArray<T>::const_pointer DynamicArray<T>::data() const noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::const_pointer DynamicArray<T, Policy>::data() const noexcept {
     return m_data;
 }
 
@@ -222,63 +220,63 @@ typename DynamicArray<T>::const_pointer DynamicArray<T>::data() const noexcept {
 // Iterators
 // ============================================
 
-template <typename T>
-typename DynamicArray<T>::iterator DynamicArray<T>::begin() noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::iterator DynamicArray<T, Policy>::begin() noexcept {
     return m_data;
 }
 
-template <typename T>
-typename DynamicArray<T>::const_iterator DynamicArray<T>::begin() const noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::const_iterator DynamicArray<T, Policy>::begin() const noexcept {
     return m_data;
 }
 
-template <typename T>
-typename DynamicArray<T>::const_iterator DynamicArray<T>::cbegin() const noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::const_iterator DynamicArray<T, Policy>::cbegin() const noexcept {
     return m_data;
 }
 
-template <typename T>
-typename DynamicArray<T>::iterator DynamicArray<T>::end() noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::iterator DynamicArray<T, Policy>::end() noexcept {
     return m_data + m_size;
 }
 
-template <typename T>
-typename DynamicArray<T>::const_iterator DynamicArray<T>::end() const noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::const_iterator DynamicArray<T, Policy>::end() const noexcept {
     return m_data + m_size;
 }
 
-template <typename T>
-typename DynamicArray<T>::const_iterator DynamicArray<T>::cend() const noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::const_iterator DynamicArray<T, Policy>::cend() const noexcept {
     return m_data + m_size;
 }
 
-template <typename T>
-typename DynamicArray<T>::reverse_iterator DynamicArray<T>::rbegin() noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::reverse_iterator DynamicArray<T, Policy>::rbegin() noexcept {
     return reverse_iterator(end());
 }
 
-template <typename T>
-typename DynamicArray<T>::const_reverse_iterator DynamicArray<T>::rbegin() const noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::const_reverse_iterator DynamicArray<T, Policy>::rbegin() const noexcept {
     return const_reverse_iterator(end());
 }
 
-template <typename T>
-typename DynamicArray<T>::const_reverse_iterator DynamicArray<T>::crbegin() const noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::const_reverse_iterator DynamicArray<T, Policy>::crbegin() const noexcept {
     return const_reverse_iterator(cend());
 }
 
-template <typename T>
-typename DynamicArray<T>::reverse_iterator DynamicArray<T>::rend() noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::reverse_iterator DynamicArray<T, Policy>::rend() noexcept {
     return reverse_iterator(begin());
 }
 
-template <typename T>
-typename DynamicArray<T>::const_reverse_iterator DynamicArray<T>::rend() const noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::const_reverse_iterator DynamicArray<T, Policy>::rend() const noexcept {
     return const_reverse_iterator(begin());
 }
 
-template <typename T>
-typename DynamicArray<T>::const_reverse_iterator DynamicArray<T>::crend() const noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::const_reverse_iterator DynamicArray<T, Policy>::crend() const noexcept {
     return const_reverse_iterator(cbegin());
 }
 
@@ -286,38 +284,32 @@ typename DynamicArray<T>::const_reverse_iterator DynamicArray<T>::crend() const
 // Capacity
 // ============================================
 
-template <typename T>
-bool DynamicArray<T>::empty() const noexcept {
+template <typename T, typename Policy>
+bool DynamicArray<T, Policy>::empty() const noexcept {
     return m_size == 0;
 }
 
-template <typename T>
-typename DynamicArray<T>::size_type DynamicArray<T>::size() const noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::size_type DynamicArray<T, Policy>::size() const noexcept {
     return m_size;
 }
 
-template <typename T>
-typename DynamicArray<T>::size_type DynamicArray<T>::capacity() const noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::size_type DynamicArray<T, Policy>::capacity() const noexcept {
     return m_capacity;
 }
 
-template <typename T>
-void DynamicArray<T>::reserve(size_type new_capacity) {
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::reserve(size_type new_capacity) {
     if (new_capacity > m_capacity) {
         reallocate(new_capacity);
     }
 }
 
-template <typename T>
-void DynamicArray<T>::shrink_to_fit() {
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::shrink_to_fit() {
     if (m_size < m_capacity) {
-        if (m_size == 0) {
-            delete[] m_data;
-            m_data = nullptr;
-            m_capacity = 0;
-        } else {
-            reallocate(m_size);
-        }
+        reallocate(m_size);
     }
 }
 
@@ -325,44 +317,39 @@ void DynamicArray<T>::shrink_to_fit() {
 // Modifiers
 // ============================================
 
-template <typename T>
-void DynamicArray<T>::clear() noexcept {
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::clear() noexcept {
+    destroy_range(m_data, m_data + m_size);
     m_size = 0;
     // Note: Capacity is unchanged (like std::vector)
 }
 
-template <typename T>
-void DynamicArray<T>::push_back(const T& value) {
-    if (m_size >= m_capacity) {
-        grow();
-    }
-    m_data[m_size++] = value;
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::push_back(const T& value) {
+    emplace_back(value);
 }
 
-template <typename T>
-void DynamicArray<T>::push_back(T&& value) {
-    if (m_size >= m_capacity) {
-        grow();
-    }
-    m_data[m_size++] = std::move(value);
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::push_back(T&& value) {
+    emplace_back(std::move(value));
 }
 
-template <typename T>
+template <typename T, typename Policy>
 template <typename... Args>
-typename DynamicArray<T>::reference DynamicArray<T>::emplace_back(Args&&... args) {
-    if (m_size >= m_capacity) {
-        grow();
+typename DynamicArray<T, Policy>::reference DynamicArray<T, Policy>::emplace_back(Args&&... args) {
+    if (m_size < m_capacity) {
+        // Placement new for in-place construction
+        ::new (static_cast<void*>(m_data + m_size)) T(std::forward<Args>(args)...);
+        return m_data[m_size++];
     }
     
-    // Placement new for in-place construction
-    new (&m_data[m_size]) T(std::forward<Args>(args)...);
+    pointer slot = grow_and_emplace(m_size, std::forward<Args>(args)...);
     ++m_size;
-    
-    return m_data[m_size - 1];
+    return *slot;
 }
 
-template <typename T>
-void DynamicArray<T>::pop_back() noexcept {
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::pop_back() noexcept {
     if (m_size > 0) {
         --m_size;
         // Explicitly destroy element (important for non-trivial types)
@@ -370,46 +357,214 @@ void DynamicArray<T>::pop_back() noexcept {
     }
 }
 
-template <typename T>
-void DynamicArray<T>::resize(size_type count) {
-    if (count > m_capacity) {
-        reallocate(count);
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::iterator DynamicArray<T, Policy>::insert(const_iterator pos, const T& value) {
+    return emplace(pos, value);
+}
+
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::iterator DynamicArray<T, Policy>::insert(const_iterator pos, T&& value) {
+    return emplace(pos, std::move(value));
+}
+
+template <typename T, typename Policy>
+template <typename... Args>
+typename DynamicArray<T, Policy>::iterator DynamicArray<T, Policy>::emplace(const_iterator pos, Args&&... args) {
+    size_type index = static_cast<size_type>(pos - m_data);
+    
+    if (m_size == m_capacity) {
+        pointer slot = grow_and_emplace(index, std::forward<Args>(args)...);
+        ++m_size;
+        return slot;
     }
     
-    // Default-initialize new elements if growing
-    for (size_type i = m_size; i < count; ++i) {
-        new (&m_data[i]) T();
+    if (index == m_size) {
+        ::new (static_cast<void*>(m_data + m_size)) T(std::forward<Args>(args)...);
+        ++m_size;
+        return m_data + index;
     }
     
-    // Destroy excess elements if shrinking
-    for (size_type i = count; i < m_size; ++i) {
-        m_data[i].~T();
+    // Build the element first: args may refer to an element we are about to shift
+    T value(std::forward<Args>(args)...);
+    pointer gap = open_gap(index);
+    if constexpr (TRIVIAL_RELOCATION) {
+        // The gap holds no object after a byte shift
+        ::new (static_cast<void*>(gap)) T(std::move(value));
+    } else {
+        *gap = std::move(value);
+    }
+    return gap;
+}
+
+template <typename T, typename Policy>
+template <typename InputIt, typename>
+typename DynamicArray<T, Policy>::iterator DynamicArray<T, Policy>::insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type index = static_cast<size_type>(pos - m_data);
+    
+    if constexpr (!detail::is_forward_iterator_v<InputIt>) {
+        // Single pass: append, then rotate into place
+        size_type old_size = m_size;
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+        std::rotate(m_data + index, m_data + old_size, m_data + m_size);
+        return m_data + index;
+    } else {
+        size_type count = static_cast<size_type>(std::distance(first, last));
+        if (count == 0) {
+            return m_data + index;
+        }
+        
+        if (count > m_capacity - m_size) {
+            pointer slot = grow_and_insert(index, first, last, count, m_size + count);
+            m_size += count;
+            return slot;
+        }
+        
+        if constexpr (detail::is_memcpy_source_v<InputIt, T>) {
+            if (!contains_address(first)) {
+                pointer gap = m_data + index;
+                std::memmove(static_cast<void*>(gap + count), static_cast<const void*>(gap),
+                             (m_size - index) * sizeof(T));
+                std::memcpy(static_cast<void*>(gap), static_cast<const void*>(first), count * sizeof(T));
+                m_size += count;
+                return gap;
+            }
+        }
+        
+        // Copy behind the end (the source stays untouched), then rotate into place
+        pointer old_end = m_data + m_size;
+        copy_range(first, last, count, old_end);
+        m_size += count;
+        std::rotate(m_data + index, old_end, m_data + m_size);
+        return m_data + index;
+    }
+}
+
+template <typename T, typename Policy>
+template <typename InputIt, typename>
+void DynamicArray<T, Policy>::append(InputIt first, InputIt last) {
+    if constexpr (!detail::is_forward_iterator_v<InputIt>) {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    } else {
+        size_type count = static_cast<size_type>(std::distance(first, last));
+        if (count == 0) {
+            return;
+        }
+        
+        if (count > m_capacity - m_size) {
+            if constexpr (detail::is_memcpy_source_v<InputIt, T>) {
+                if (!contains_address(first)) {
+                    // realloc can extend the block in place
+                    reallocate(calculate_growth(m_capacity, m_size + count));
+                    copy_range(first, last, count, m_data + m_size);
+                    m_size += count;
+                    return;
+                }
+            }
+            grow_and_insert(m_size, first, last, count, m_size + count);
+        } else {
+            copy_range(first, last, count, m_data + m_size);
+        }
+        m_size += count;
+    }
+}
+
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::append(const_pointer data, size_type count) {
+    append(data, data + count);
+}
+
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::iterator DynamicArray<T, Policy>::erase(const_iterator pos) {
+    return erase(pos, pos + 1);
+}
+
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::iterator DynamicArray<T, Policy>::erase(const_iterator first, const_iterator last) {
+    pointer from = m_data + (first - m_data);
+    pointer to = m_data + (last - m_data);
+    if (from == to) {
+        return from;
+    }
+    
+    pointer old_end = m_data + m_size;
+    if constexpr (TRIVIAL_RELOCATION) {
+        destroy_range(from, to);
+        std::memmove(static_cast<void*>(from), static_cast<const void*>(to),
+                     static_cast<size_type>(old_end - to) * sizeof(T));
+    } else {
+        pointer new_end = std::move(to, old_end, from);
+        destroy_range(new_end, old_end);
+    }
+    m_size -= static_cast<size_type>(to - from);
+    return from;
+}
+
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::resize(size_type count) {
+    if (count > m_capacity) {
+        reallocate(count);
+    }
+    
+    if (count > m_size) {
+        // Value-initialize new elements if growing
+        std::uninitialized_value_construct(m_data + m_size, m_data + count);
+    } else {
+        // Destroy excess elements if shrinking
+        destroy_range(m_data + count, m_data + m_size);
     }
     
     m_size = count;
 }
 
-template <typename T>
-void DynamicArray<T>::resize(size_type count, const T& value) {
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::resize(size_type count, const T& value) {
     if (count > m_capacity) {
+        // value may be one of our elements: copy it before reallocating
+        T copy(value);
         reallocate(count);
+        std::uninitialized_fill(m_data + m_size, m_data + count, copy);
+    } else if (count > m_size) {
+        // Fill new elements if growing
+        std::uninitialized_fill(m_data + m_size, m_data + count, value);
+    } else {
+        // Destroy excess elements if shrinking
+        destroy_range(m_data + count, m_data + m_size);
     }
     
-    // Fill new elements if growing
-    for (size_type i = m_size; i < count; ++i) {
-        m_data[i] = value;
+    m_size = count;
+}
+
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::resize_default_init(size_type count) {
+    if (count > m_capacity) {
+        // Geometric: callers typically grow by one chunk at a time
+        reallocate(calculate_growth(m_capacity, count));
     }
     
-    // Destroy excess elements if shrinking
-    for (size_type i = count; i < m_size; ++i) {
-        m_data[i].~T();
+    if (count > m_size) {
+        // No-op for trivial T: the new elements keep whatever bytes are there
+        std::uninitialized_default_construct(m_data + m_size, m_data + count);
+    } else {
+        destroy_range(m_data + count, m_data + m_size);
     }
     
     m_size = count;
 }
 
-template <typename T>
-void DynamicArray<T>::swap(DynamicArray& other) noexcept {
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::resize_uninitialized(size_type count) {
+    static_assert(std::is_trivial_v<T>,
+                  "DynamicArray::resize_uninitialized: T must be a trivial type");
+    resize_default_init(count);
+}
+
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::swap(DynamicArray& other) noexcept {
+    // Buffers are exchanged, so no element is relocated at all
     std::swap(m_data, other.m_data);
     std::swap(m_size, other.m_size);
     std::swap(m_capacity, other.m_capacity);
@@ -419,36 +574,36 @@ void DynamicArray<T>::swap(DynamicArray& other) noexcept {
 // Comparison Operators
 // ============================================
 
-template <typename T>
-bool DynamicArray<T>::operator==(const DynamicArray& other) const {
+template <typename T, typename Policy>
+bool DynamicArray<T, Policy>::operator==(const DynamicArray& other) const {
     if (m_size != other.m_size) {
         return false;
     }
     return std::equal(begin(), end(), other.begin());
 }
 
-template <typename T>
-bool DynamicArray<T>::operator!=(const DynamicArray& other) const {
+template <typename T, typename Policy>
+bool DynamicArray<T, Policy>::operator!=(const DynamicArray& other) const {
     return !(*this == other);
 }
 
-template <typename T>
-bool DynamicArray<T>::operator<(const DynamicArray& other) const {
+template <typename T, typename Policy>
+bool DynamicArray<T, Policy>::operator<(const DynamicArray& other) const {
     return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
 }
 
-template <typename T>
-bool DynamicArray<T>::operator<=(const DynamicArray& other) const {
+template <typename T, typename Policy>
+bool DynamicArray<T, Policy>::operator<=(const DynamicArray& other) const {
     return !(other < *this);
 }
 
-template <typename T>
-bool DynamicArray<T>::operator>(const DynamicArray& other) const {
+template <typename T, typename Policy>
+bool DynamicArray<T, Policy>::operator>(const DynamicArray& other) const {
     return other < *this;
 }
 
-template <typename T>
-bool DynamicArray<T>::operator>=(const DynamicArray& other) const {
+template <typename T, typename Policy>
+bool DynamicArray<T, Policy>::operator>=(const DynamicArray& other) const {
     return !(*this < other);
 }
 
@@ -456,67 +611,229 @@ bool DynamicArray<T>::operator>=(const DynamicArray& other) const {
 // Private Helper Methods
 // ============================================
 
-template <typename T>
-typename DynamicArray<T>::size_type 
-DynamicArray<T>::calculate_growth(size_type current, size_type required) const noexcept {
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::size_type 
+DynamicArray<T, Policy>::calculate_growth(size_type current, size_type required) const noexcept {
     // Use growth factor (1.5) or meet requirement, whichever is larger
     size_type geometric = static_cast<size_type>(current * GROWTH_FACTOR);
     return std::max(geometric, required);
 }
 
-template <typename T>
-void DynamicArray<T>::grow() {
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::grow() {
     size_type new_capacity = (m_capacity == 0) 
         ? DEFAULT_CAPACITY 
         : calculate_growth(m_capacity, m_capacity + 1);
     reallocate(new_capacity);
 }
 
-template <typename T>
-void DynamicArray<T>::reallocate(size_type new_capacity) {
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::reallocate(size_type new_capacity) {
+    if (new_capacity < m_size) {
+        destroy_range(m_data + new_capacity, m_data + m_size);
+        m_size = new_capacity;
+    }
+    
     if (new_capacity == 0) {
-        delete[] m_data;
+        deallocate(m_data, m_capacity);
         m_data = nullptr;
         m_capacity = 0;
-        m_size = 0;
         return;
     }
     
+    if constexpr (TRIVIAL_RELOCATION) {
+        if (m_data != nullptr && new_capacity <= static_cast<size_type>(-1) / sizeof(T)) {
+            // The policy may resize the block in place (realloc, mremap);
+            // if it moves it, copying the bytes is a valid relocation
+            void* resized = Policy::reallocate(static_cast<void*>(m_data), m_capacity * sizeof(T),
+                                               new_capacity * sizeof(T), ALIGNMENT);
+            if (resized != nullptr) {
+                m_data = static_cast<pointer>(resized);
+                m_capacity = new_capacity;
+                return;
+            }
+        }
+    }
+    
     // Allocate new storage
-    T* new_data = new T[new_capacity];
+    pointer new_data = allocate(new_capacity);
     
     try {
-        // Move or copy existing elements
-        if constexpr (detail::is_nothrow_movable_v<T>) {
-            // Move elements if noexcept
-            for (size_type i = 0; i < m_size; ++i) {
-                new_data[i] = std::move(m_data[i]);
-            }
-        } else {
-            // Copy if move can throw
-            for (size_type i = 0; i < m_size; ++i) {
-                new_data[i] = m_data[i];
-            }
-        }
+        relocate(m_data, m_data + m_size, new_data);
     } catch (...) {
-        // Exception during copy/move - clean up and rethrow
-        delete[] new_data;
+        // Exception during copy/move - old elements are untouched
+        deallocate(new_data, new_capacity);
         throw;
     }
     
-    // Success - clean up old storage
-    delete[] m_data;
+    // Success - release old storage
+    deallocate(m_data, m_capacity);
     m_data = new_data;
     m_capacity = new_capacity;
+}
+
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::pointer DynamicArray<T, Policy>::allocate(size_type count) {
+    if (count > static_cast<size_type>(-1) / sizeof(T)) {
+        throw std::length_error("DynamicArray: requested capacity is too large");
+    }
+    return static_cast<pointer>(Policy::allocate(count * sizeof(T), ALIGNMENT));
+}
+
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::deallocate(pointer p, size_type count) noexcept {
+    if (p != nullptr) {
+        Policy::deallocate(static_cast<void*>(p), count * sizeof(T), ALIGNMENT);
+    }
+}
+
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::relocate(pointer first, pointer last, pointer dest) {
+    if (first == last) {
+        return;
+    }
+    if constexpr (TRIVIAL_RELOCATION) {
+        std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first),
+                    static_cast<size_type>(last - first) * sizeof(T));
+    } else {
+        uninitialized_transfer(first, last, dest);
+        std::destroy(first, last);
+    }
+}
+
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::pointer
+DynamicArray<T, Policy>::uninitialized_transfer(pointer first, pointer last, pointer dest) {
+    // Move if noexcept, copy if move can throw (sources stay intact on failure)
+    if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+        return std::uninitialized_move(first, last, dest);
+    } else {
+        return std::uninitialized_copy(first, last, dest);
+    }
+}
+
+template <typename T, typename Policy>
+typename DynamicArray<T, Policy>::pointer DynamicArray<T, Policy>::open_gap(size_type index) {
+    pointer gap = m_data + index;
+    pointer old_end = m_data + m_size;
+    if constexpr (TRIVIAL_RELOCATION) {
+        std::memmove(static_cast<void*>(gap + 1), static_cast<const void*>(gap),
+                     (m_size - index) * sizeof(T));
+        ++m_size;
+    } else {
+        // Move the last element into raw storage, then shift the rest up
+        ::new (static_cast<void*>(old_end)) T(std::move(*(old_end - 1)));
+        ++m_size;
+        std::move_backward(gap, old_end - 1, old_end);
+    }
+    return gap;
+}
+
+template <typename T, typename Policy>
+template <typename... Args>
+typename DynamicArray<T, Policy>::pointer DynamicArray<T, Policy>::grow_and_emplace(size_type index, Args&&... args) {
+    size_type new_capacity = (m_capacity == 0)
+        ? DEFAULT_CAPACITY
+        : calculate_growth(m_capacity, m_capacity + 1);
+    pointer new_data = allocate(new_capacity);
+    pointer slot = new_data + index;
     
-    // Adjust size if shrinking
-    if (m_size > new_capacity) {
-        m_size = new_capacity;
+    try {
+        ::new (static_cast<void*>(slot)) T(std::forward<Args>(args)...);
+    } catch (...) {
+        deallocate(new_data, new_capacity);
+        throw;
+    }
+    
+    try {
+        move_around_gap(new_data, index, 1);
+    } catch (...) {
+        slot->~T();
+        deallocate(new_data, new_capacity);
+        throw;
     }
+    
+    m_data = new_data;
+    m_capacity = new_capacity;
+    return slot;
+}
+
+template <typename T, typename Policy>
+template <typename ForwardIt>
+typename DynamicArray<T, Policy>::pointer
+DynamicArray<T, Policy>::copy_range(ForwardIt first, ForwardIt last, size_type count, pointer dest) {
+    if constexpr (detail::is_memcpy_source_v<ForwardIt, T>) {
+        (void)last;
+        if (count > 0) {
+            std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), count * sizeof(T));
+        }
+        return dest + count;
+    } else {
+        (void)count;
+        return std::uninitialized_copy(first, last, dest);
+    }
+}
+
+template <typename T, typename Policy>
+template <typename ForwardIt>
+typename DynamicArray<T, Policy>::pointer
+DynamicArray<T, Policy>::grow_and_insert(size_type index, ForwardIt first, ForwardIt last,
+                                 size_type count, size_type required) {
+    size_type new_capacity = calculate_growth(m_capacity, required);
+    pointer new_data = allocate(new_capacity);
+    pointer slot = new_data + index;
+    
+    // Copy the new elements first: the source may be inside the old buffer
+    try {
+        copy_range(first, last, count, slot);
+    } catch (...) {
+        deallocate(new_data, new_capacity);
+        throw;
+    }
+    
+    try {
+        move_around_gap(new_data, index, count);
+    } catch (...) {
+        destroy_range(slot, slot + count);
+        deallocate(new_data, new_capacity);
+        throw;
+    }
+    
+    m_data = new_data;
+    m_capacity = new_capacity;
+    return slot;
+}
+
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::move_around_gap(pointer new_data, size_type index, size_type gap) {
+    pointer slot = new_data + index;
+    if constexpr (TRIVIAL_RELOCATION) {
+        relocate(m_data, m_data + index, new_data);
+        relocate(m_data + index, m_data + m_size, slot + gap);
+    } else {
+        // Build both halves before destroying anything, so a throwing copy
+        // leaves the old buffer intact
+        pointer prefix_end = new_data;
+        try {
+            prefix_end = uninitialized_transfer(m_data, m_data + index, new_data);
+            uninitialized_transfer(m_data + index, m_data + m_size, slot + gap);
+        } catch (...) {
+            destroy_range(new_data, prefix_end);
+            throw;
+        }
+        destroy_range(m_data, m_data + m_size);
+    }
+    deallocate(m_data, m_capacity);
+}
+
+template <typename T, typename Policy>
+bool DynamicArray<T, Policy>::contains_address(const_pointer p) const noexcept {
+    return std::less_equal<const_pointer>()(m_data, p) &&
+           std::less<const_pointer>()(p, m_data + m_size);
 }
 
-template <typename T>
-void DynamicArray<T>::destroy_range(pointer first, pointer last) noexcept {
+template <typename T, typename Policy>
+void DynamicArray<T, Policy>::destroy_range(pointer first, pointer last) noexcept {
     for (pointer p = first; p != last; ++p) {
         p->~T();
     }
@@ -526,8 +843,8 @@ void DynamicArray<T>::destroy_range(pointer first, pointer last) noexcept {
 // Non-member Functions
 // ============================================
 
-template <typename T>
-void swap(DynamicArray<T>& lhs, DynamicArray<T>& rhs) noexcept {
+template <typename T, typename Policy>
+void swap(DynamicArray<T, Policy>& lhs, DynamicArray<T, Policy>& rhs) noexcept {
     lhs.swap(rhs);
 }
 
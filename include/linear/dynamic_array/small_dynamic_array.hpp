@@ -0,0 +1,336 @@
+/**
+ * @file small_dynamic_array.hpp
+ * @brief Dynamic array with inline storage for the first N elements
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 2.1.0
+ *
+ * DynamicArray allocates on the first push_back. Most arrays in practice
+ * stay tiny, so SmallDynamicArray<T, N> keeps up to N elements inside the
+ * object itself and only moves them to the heap when the N+1-th element
+ * arrives:
+ * - Creating, filling and destroying an array of at most N elements never
+ *   calls the allocator
+ * - The elements are always contiguous: data(), operator[] and the pointer
+ *   iterators behave exactly like DynamicArray's
+ * - Moving an inline array moves its elements (O(n), n <= N); moving a
+ *   spilled array steals the heap buffer (O(1))
+ *
+ * Iterators and pointers are invalidated by any operation that changes
+ * capacity, including the spill to the heap and shrink_to_fit() back into
+ * the inline buffer.
+ *
+ * Copyright (c) 2026 Jinhyeok
+ * MIT License
+ */
+
+#ifndef MYLIB_LINEAR_SMALL_DYNAMIC_ARRAY_HPP
+#define MYLIB_LINEAR_SMALL_DYNAMIC_ARRAY_HPP
+
+// Independent of dynamic_array_fwd.hpp, so it can be used next to the v1
+// DynamicArray (whose single-parameter declaration would clash)
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <initializer_list>
+#include <iterator>
+#include <algorithm>
+#include <memory>
+
+namespace mylib {
+namespace linear {
+
+/**
+ * @class SmallDynamicArray
+ * @brief Contiguous dynamic array storing up to N elements inline
+ *
+ * @tparam T Element type (must be move-constructible)
+ * @tparam N Inline capacity (elements held without a heap allocation)
+ *
+ * Performance characteristics:
+ * - Access: O(1)
+ * - Insertion at end: O(1) amortized, no allocation while size() <= N
+ * - Space: sizeof(T) * N inside the object, plus the heap buffer once spilled
+ */
+template <typename T, std::size_t N>
+class SmallDynamicArray {
+    static_assert(N > 0, "SmallDynamicArray: inline capacity must be positive");
+
+public:
+    // ============================================
+    // Type Aliases (STL Compatibility)
+    // ============================================
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type INLINE_CAPACITY = N;   ///< Elements stored without allocation
+
+    // ============================================
+    // Constructors & Destructor
+    // ============================================
+
+    /**
+     * @brief Default constructor - empty, using the inline buffer
+     * @complexity O(1)
+     * @exception noexcept
+     */
+    SmallDynamicArray() noexcept;
+
+    /**
+     * @brief Fill constructor - count copies of value
+     * @complexity O(n)
+     * @exception Strong guarantee
+     */
+    SmallDynamicArray(size_type count, const T& value);
+
+    /**
+     * @brief Initializer list constructor
+     * @complexity O(n)
+     * @exception Strong guarantee
+     */
+    SmallDynamicArray(std::initializer_list<T> init);
+
+    /**
+     * @brief Copy constructor (the copy is inline if it fits)
+     * @complexity O(n)
+     * @exception Strong guarantee
+     */
+    SmallDynamicArray(const SmallDynamicArray& other);
+
+    /**
+     * @brief Move constructor
+     * @param other Array to move from (left empty)
+     * @complexity O(1) if other has spilled, O(n) otherwise
+     */
+    SmallDynamicArray(SmallDynamicArray&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /**
+     * @brief Destructor
+     * @complexity O(n)
+     */
+    ~SmallDynamicArray() noexcept;
+
+    // ============================================
+    // Assignment Operators
+    // ============================================
+
+    SmallDynamicArray& operator=(const SmallDynamicArray& other);
+    SmallDynamicArray& operator=(SmallDynamicArray&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+    SmallDynamicArray& operator=(std::initializer_list<T> init);
+
+    // ============================================
+    // Element Access
+    // ============================================
+
+    /**
+     * @brief Bounds-checked element access
+     * @throws std::out_of_range if index >= size()
+     */
+    reference at(size_type index);
+    const_reference at(size_type index) const;
+
+    reference operator[](size_type index) noexcept { return m_data[index]; }
+    const_reference operator[](size_type index) const noexcept { return m_data[index]; }
+
+    reference front() noexcept { return m_data[0]; }
+    const_reference front() const noexcept { return m_data[0]; }
+
+    reference back() noexcept { return m_data[m_size - 1]; }
+    const_reference back() const noexcept { return m_data[m_size - 1]; }
+
+    /**
+     * @brief Pointer to the contiguous elements (inline buffer or heap)
+     */
+    pointer data() noexcept { return m_data; }
+    const_pointer data() const noexcept { return m_data; }
+
+    // ============================================
+    // Iterators
+    // ============================================
+
+    iterator begin() noexcept { return m_data; }
+    const_iterator begin() const noexcept { return m_data; }
+    const_iterator cbegin() const noexcept { return m_data; }
+
+    iterator end() noexcept { return m_data + m_size; }
+    const_iterator end() const noexcept { return m_data + m_size; }
+    const_iterator cend() const noexcept { return m_data + m_size; }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(cend()); }
+
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return const_reverse_iterator(cbegin()); }
+
+    // ============================================
+    // Capacity
+    // ============================================
+
+    bool empty() const noexcept { return m_size == 0; }
+    size_type size() const noexcept { return m_size; }
+    size_type capacity() const noexcept { return m_capacity; }
+
+    /**
+     * @brief Check whether the elements live in the inline buffer
+     */
+    bool is_inline() const noexcept { return m_data == inline_data(); }
+
+    /**
+     * @brief Reserve capacity for at least new_capacity elements
+     * @exception Strong guarantee
+     * @note Does nothing if new_capacity <= capacity()
+     */
+    void reserve(size_type new_capacity);
+
+    /**
+     * @brief Reduce capacity to fit size, returning to the inline buffer if possible
+     * @exception Strong guarantee
+     */
+    void shrink_to_fit();
+
+    // ============================================
+    // Modifiers
+    // ============================================
+
+    /**
+     * @brief Destroy all elements (capacity unchanged)
+     */
+    void clear() noexcept;
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    /**
+     * @brief Construct element in place at end
+     * @return Reference to the new element
+     * @complexity O(1) amortized
+     * @exception Strong guarantee
+     */
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        if (m_size < m_capacity) {
+            ::new (static_cast<void*>(m_data + m_size)) T(std::forward<Args>(args)...);
+            return m_data[m_size++];
+        }
+        return emplace_back_grow(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Remove last element
+     * @pre !empty()
+     */
+    void pop_back() noexcept {
+        --m_size;
+        m_data[m_size].~T();
+    }
+
+    /**
+     * @brief Resize to count elements (new elements value-initialized)
+     * @exception Strong guarantee
+     */
+    void resize(size_type count);
+
+    /**
+     * @brief Resize to count elements (new elements copied from value)
+     * @exception Strong guarantee
+     */
+    void resize(size_type count, const T& value);
+
+    /**
+     * @brief Swap contents with another array
+     * @complexity O(1) if both have spilled, O(N) otherwise
+     */
+    void swap(SmallDynamicArray& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    // ============================================
+    // Comparison Operators
+    // ============================================
+
+    bool operator==(const SmallDynamicArray& other) const;
+    bool operator!=(const SmallDynamicArray& other) const;
+    bool operator<(const SmallDynamicArray& other) const;
+    bool operator<=(const SmallDynamicArray& other) const;
+    bool operator>(const SmallDynamicArray& other) const;
+    bool operator>=(const SmallDynamicArray& other) const;
+
+private:
+    // ============================================
+    // Member Variables
+    // ============================================
+
+    pointer m_data;           ///< inline_data() or a heap buffer
+    size_type m_size;         ///< Number of elements
+    size_type m_capacity;     ///< N while inline, else heap capacity
+    alignas(T) unsigned char m_inline[sizeof(T) * N];   ///< Inline element storage
+
+    static constexpr double GROWTH_FACTOR = 1.5;
+
+    // ============================================
+    // Helper Methods
+    // ============================================
+
+    pointer inline_data() noexcept { return reinterpret_cast<pointer>(m_inline); }
+    const_pointer inline_data() const noexcept { return reinterpret_cast<const_pointer>(m_inline); }
+
+    static pointer allocate(size_type count);
+    void deallocate() noexcept;
+
+    /**
+     * @brief Capacity after growth: 1.5x, or required if larger
+     */
+    size_type calculate_growth(size_type required) const noexcept;
+
+    /**
+     * @brief Move elements to a new buffer of new_capacity (>= size())
+     */
+    void reallocate(size_type new_capacity);
+
+    /**
+     * @brief Grow and construct the new element before relocating the old
+     *        ones, so args may refer to an element of this array
+     */
+    template <typename... Args>
+    reference emplace_back_grow(Args&&... args);
+
+    /**
+     * @brief Move-construct (or copy if the move may throw) [first, last) into dest
+     */
+    static void relocate(pointer first, pointer last, pointer dest);
+
+    /**
+     * @brief Take other's elements; *this must be empty and inline
+     */
+    void steal(SmallDynamicArray& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+};
+
+// ============================================
+// Non-member Functions
+// ============================================
+
+template <typename T, std::size_t N>
+void swap(SmallDynamicArray<T, N>& lhs, SmallDynamicArray<T, N>& rhs)
+    noexcept(std::is_nothrow_move_constructible_v<T>) {
+    lhs.swap(rhs);
+}
+
+} // namespace linear
+} // namespace mylib
+
+// Include implementation
+#include "small_dynamic_array_impl.hpp"
+
+#endif // MYLIB_LINEAR_SMALL_DYNAMIC_ARRAY_HPP
@@ -0,0 +1,338 @@
+/**
+ * @file small_dynamic_array_impl.hpp
+ * @brief Implementation of SmallDynamicArray member functions
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 2.1.0
+ */
+
+#ifndef MYLIB_LINEAR_SMALL_DYNAMIC_ARRAY_IMPL_HPP
+#define MYLIB_LINEAR_SMALL_DYNAMIC_ARRAY_IMPL_HPP
+
+#include "small_dynamic_array.hpp"
+#include <algorithm>
+#include <memory>
+#include <new>
+
+namespace mylib {
+namespace linear {
+
+// ============================================
+// Constructors & Destructor
+// ============================================
+
+template <typename T, std::size_t N>
+SmallDynamicArray<T, N>::SmallDynamicArray() noexcept
+    : m_data(inline_data()), m_size(0), m_capacity(N) {
+}
+
+template <typename T, std::size_t N>
+SmallDynamicArray<T, N>::SmallDynamicArray(size_type count, const T& value)
+    : SmallDynamicArray() {
+    reserve(count);
+    std::uninitialized_fill_n(m_data, count, value);
+    m_size = count;
+}
+
+template <typename T, std::size_t N>
+SmallDynamicArray<T, N>::SmallDynamicArray(std::initializer_list<T> init)
+    : SmallDynamicArray() {
+    reserve(init.size());
+    std::uninitialized_copy(init.begin(), init.end(), m_data);
+    m_size = init.size();
+}
+
+template <typename T, std::size_t N>
+SmallDynamicArray<T, N>::SmallDynamicArray(const SmallDynamicArray& other)
+    : SmallDynamicArray() {
+    reserve(other.m_size);
+    std::uninitialized_copy(other.begin(), other.end(), m_data);
+    m_size = other.m_size;
+}
+
+template <typename T, std::size_t N>
+SmallDynamicArray<T, N>::SmallDynamicArray(SmallDynamicArray&& other)
+    noexcept(std::is_nothrow_move_constructible_v<T>)
+    : SmallDynamicArray() {
+    steal(other);
+}
+
+template <typename T, std::size_t N>
+SmallDynamicArray<T, N>::~SmallDynamicArray() noexcept {
+    clear();
+    deallocate();
+}
+
+// ============================================
+// Assignment Operators
+// ============================================
+
+template <typename T, std::size_t N>
+SmallDynamicArray<T, N>& SmallDynamicArray<T, N>::operator=(const SmallDynamicArray& other) {
+    if (this != &other) {
+        // Copy first so *this is untouched if a copy throws
+        SmallDynamicArray temp(other);
+        clear();
+        deallocate();
+        steal(temp);
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N>
+SmallDynamicArray<T, N>& SmallDynamicArray<T, N>::operator=(SmallDynamicArray&& other)
+    noexcept(std::is_nothrow_move_constructible_v<T>) {
+    if (this != &other) {
+        clear();
+        deallocate();
+        steal(other);
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N>
+SmallDynamicArray<T, N>& SmallDynamicArray<T, N>::operator=(std::initializer_list<T> init) {
+    SmallDynamicArray temp(init);
+    clear();
+    deallocate();
+    steal(temp);
+    return *this;
+}
+
+// ============================================
+// Element Access
+// ============================================
+
+template <typename T, std::size_t N>
+typename SmallDynamicArray<T, N>::reference SmallDynamicArray<T, N>::at(size_type index) {
+    if (index >= m_size) {
+        throw std::out_of_range("SmallDynamicArray::at: index out of range");
+    }
+    return m_data[index];
+}
+
+template <typename T, std::size_t N>
+typename SmallDynamicArray<T, N>::const_reference SmallDynamicArray<T, N>::at(size_type index) const {
+    if (index >= m_size) {
+        throw std::out_of_range("SmallDynamicArray::at: index out of range");
+    }
+    return m_data[index];
+}
+
+// ============================================
+// Capacity
+// ============================================
+
+template <typename T, std::size_t N>
+void SmallDynamicArray<T, N>::reserve(size_type new_capacity) {
+    if (new_capacity > m_capacity) {
+        reallocate(new_capacity);
+    }
+}
+
+template <typename T, std::size_t N>
+void SmallDynamicArray<T, N>::shrink_to_fit() {
+    if (is_inline() || m_size == m_capacity) {
+        return;
+    }
+    if (m_size <= N) {
+        // Back into the inline buffer
+        pointer heap = m_data;
+        relocate(heap, heap + m_size, inline_data());
+        std::destroy(heap, heap + m_size);
+        ::operator delete(heap);
+        m_data = inline_data();
+        m_capacity = N;
+    } else {
+        reallocate(m_size);
+    }
+}
+
+// ============================================
+// Modifiers
+// ============================================
+
+template <typename T, std::size_t N>
+void SmallDynamicArray<T, N>::clear() noexcept {
+    std::destroy(m_data, m_data + m_size);
+    m_size = 0;
+}
+
+template <typename T, std::size_t N>
+void SmallDynamicArray<T, N>::resize(size_type count) {
+    if (count > m_size) {
+        reserve(count);
+        std::uninitialized_value_construct(m_data + m_size, m_data + count);
+    } else {
+        std::destroy(m_data + count, m_data + m_size);
+    }
+    m_size = count;
+}
+
+template <typename T, std::size_t N>
+void SmallDynamicArray<T, N>::resize(size_type count, const T& value) {
+    if (count > m_size) {
+        if (count > m_capacity) {
+            // value may be one of our elements: fill a copy after growing
+            T copy(value);
+            reallocate(calculate_growth(count));
+            std::uninitialized_fill(m_data + m_size, m_data + count, copy);
+        } else {
+            std::uninitialized_fill(m_data + m_size, m_data + count, value);
+        }
+    } else {
+        std::destroy(m_data + count, m_data + m_size);
+    }
+    m_size = count;
+}
+
+template <typename T, std::size_t N>
+void SmallDynamicArray<T, N>::swap(SmallDynamicArray& other)
+    noexcept(std::is_nothrow_move_constructible_v<T>) {
+    if (this == &other) {
+        return;
+    }
+    if (!is_inline() && !other.is_inline()) {
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+        std::swap(m_capacity, other.m_capacity);
+        return;
+    }
+    SmallDynamicArray temp(std::move(other));
+    other.steal(*this);
+    steal(temp);
+}
+
+// ============================================
+// Comparison Operators
+// ============================================
+
+template <typename T, std::size_t N>
+bool SmallDynamicArray<T, N>::operator==(const SmallDynamicArray& other) const {
+    return m_size == other.m_size && std::equal(begin(), end(), other.begin());
+}
+
+template <typename T, std::size_t N>
+bool SmallDynamicArray<T, N>::operator!=(const SmallDynamicArray& other) const {
+    return !(*this == other);
+}
+
+template <typename T, std::size_t N>
+bool SmallDynamicArray<T, N>::operator<(const SmallDynamicArray& other) const {
+    return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
+}
+
+template <typename T, std::size_t N>
+bool SmallDynamicArray<T, N>::operator<=(const SmallDynamicArray& other) const {
+    return !(other < *this);
+}
+
+template <typename T, std::size_t N>
+bool SmallDynamicArray<T, N>::operator>(const SmallDynamicArray& other) const {
+    return other < *this;
+}
+
+template <typename T, std::size_t N>
+bool SmallDynamicArray<T, N>::operator>=(const SmallDynamicArray& other) const {
+    return !(*this < other);
+}
+
+// ============================================
+// Private Helper Methods
+// ============================================
+
+template <typename T, std::size_t N>
+typename SmallDynamicArray<T, N>::pointer SmallDynamicArray<T, N>::allocate(size_type count) {
+    if (count > static_cast<size_type>(-1) / sizeof(T)) {
+        throw std::length_error("SmallDynamicArray: requested capacity is too large");
+    }
+    return static_cast<pointer>(::operator new(count * sizeof(T)));
+}
+
+template <typename T, std::size_t N>
+void SmallDynamicArray<T, N>::deallocate() noexcept {
+    if (!is_inline()) {
+        ::operator delete(m_data);
+        m_data = inline_data();
+        m_capacity = N;
+    }
+}
+
+template <typename T, std::size_t N>
+typename SmallDynamicArray<T, N>::size_type
+SmallDynamicArray<T, N>::calculate_growth(size_type required) const noexcept {
+    size_type geometric = static_cast<size_type>(m_capacity * GROWTH_FACTOR);
+    return std::max(geometric, required);
+}
+
+template <typename T, std::size_t N>
+void SmallDynamicArray<T, N>::relocate(pointer first, pointer last, pointer dest) {
+    if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+        std::uninitialized_move(first, last, dest);
+    } else {
+        std::uninitialized_copy(first, last, dest);
+    }
+}
+
+template <typename T, std::size_t N>
+void SmallDynamicArray<T, N>::reallocate(size_type new_capacity) {
+    pointer new_data = allocate(new_capacity);
+    try {
+        relocate(m_data, m_data + m_size, new_data);
+    } catch (...) {
+        ::operator delete(new_data);
+        throw;
+    }
+    std::destroy(m_data, m_data + m_size);
+    deallocate();
+    m_data = new_data;
+    m_capacity = new_capacity;
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+typename SmallDynamicArray<T, N>::reference
+SmallDynamicArray<T, N>::emplace_back_grow(Args&&... args) {
+    size_type new_capacity = calculate_growth(m_size + 1);
+    pointer new_data = allocate(new_capacity);
+    try {
+        ::new (static_cast<void*>(new_data + m_size)) T(std::forward<Args>(args)...);
+    } catch (...) {
+        ::operator delete(new_data);
+        throw;
+    }
+    try {
+        relocate(m_data, m_data + m_size, new_data);
+    } catch (...) {
+        new_data[m_size].~T();
+        ::operator delete(new_data);
+        throw;
+    }
+    std::destroy(m_data, m_data + m_size);
+    deallocate();
+    m_data = new_data;
+    m_capacity = new_capacity;
+    return m_data[m_size++];
+}
+
+template <typename T, std::size_t N>
+void SmallDynamicArray<T, N>::steal(SmallDynamicArray& other)
+    noexcept(std::is_nothrow_move_constructible_v<T>) {
+    if (!other.is_inline()) {
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+        other.m_data = other.inline_data();
+        other.m_size = 0;
+        other.m_capacity = N;
+        return;
+    }
+    std::uninitialized_move(other.begin(), other.end(), m_data);
+    m_size = other.m_size;
+    other.clear();
+}
+
+} // namespace linear
+} // namespace mylib
+
+#endif // MYLIB_LINEAR_SMALL_DYNAMIC_ARRAY_IMPL_HPP
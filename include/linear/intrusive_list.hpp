@@ -0,0 +1,444 @@
+/**
+ * @file intrusive_list.hpp
+ * @brief Doubly linked list over hooks embedded in the user's objects
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ *
+ * LinkedList owns its elements and allocates a node per element.
+ * IntrusiveList owns nothing: an object joins a list through an
+ * IntrusiveListHook base class, so linking, unlinking and moving objects
+ * between lists never allocates and never copies or moves the object.
+ * This suits LRU lists, free lists and run queues of large objects whose
+ * lifetime is managed elsewhere (arrays, pools, hash tables).
+ *
+ * @code
+ * struct Entry : IntrusiveListHook<> {
+ *     Key key;
+ *     Payload payload;
+ * };
+ *
+ * IntrusiveList<Entry> lru;
+ * lru.push_front(entry);                      // No allocation
+ * lru.splice(lru.begin(), lru, lru.iterator_to(entry));   // Touch: O(1)
+ * Entry& victim = lru.back();
+ * lru.pop_back();                             // Unlinks only
+ * @endcode
+ *
+ * An object can be on several lists at once by deriving from one hook per
+ * list, told apart by a tag type: IntrusiveListHook<ByAge> and
+ * IntrusiveListHook<BySize> with IntrusiveList<Entry, ByAge> and
+ * IntrusiveList<Entry, BySize>.
+ *
+ * An object must be unlinked (erase/remove/pop/clear, or the list
+ * destroyed) before it is destroyed or moved in memory. Copying an object
+ * copies no links: the copy starts unlinked.
+ *
+ * Copyright (c) 2026 Jinhyeok
+ * MIT License
+ */
+
+#ifndef MYLIB_LINEAR_INTRUSIVE_LIST_HPP
+#define MYLIB_LINEAR_INTRUSIVE_LIST_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace mylib {
+namespace linear {
+
+template <typename T, typename Tag>
+class IntrusiveList;
+
+/**
+ * @class IntrusiveListHook
+ * @brief Links embedded in an object (derive from it) to put it on an IntrusiveList
+ * @tparam Tag Distinguishes hooks when an object is on several lists
+ */
+template <typename Tag = void>
+class IntrusiveListHook {
+public:
+    IntrusiveListHook() noexcept : m_prev(nullptr), m_next(nullptr) {}
+
+    /**
+     * @brief Copies start unlinked
+     */
+    IntrusiveListHook(const IntrusiveListHook&) noexcept : m_prev(nullptr), m_next(nullptr) {}
+
+    /**
+     * @brief Assignment keeps this object's own links
+     */
+    IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept { return *this; }
+
+    /**
+     * @brief Whether the object is currently on a list
+     */
+    bool is_linked() const noexcept { return m_next != nullptr; }
+
+private:
+    template <typename, typename>
+    friend class IntrusiveList;
+
+    IntrusiveListHook* m_prev;   ///< Previous hook (the list's root before the first)
+    IntrusiveListHook* m_next;   ///< Next hook (the list's root after the last)
+};
+
+/**
+ * @class IntrusiveList
+ * @brief Circular doubly linked list of objects deriving from IntrusiveListHook<Tag>
+ *
+ * @tparam T Element type, derived from IntrusiveListHook<Tag>
+ * @tparam Tag Which of T's hooks this list uses
+ *
+ * Performance characteristics:
+ * - push/pop at either end, insert, erase, remove, splice: O(1), no allocation
+ * - size(): O(1)
+ * - clear(): O(n) (every hook is reset to unlinked)
+ */
+template <typename T, typename Tag = void>
+class IntrusiveList {
+    using Hook = IntrusiveListHook<Tag>;
+
+    static_assert(std::is_base_of_v<Hook, T>,
+                  "IntrusiveList: T must derive from IntrusiveListHook<Tag>");
+
+    template <bool Const>
+    class Iterator {
+        using HookPtr = std::conditional_t<Const, const Hook*, Hook*>;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        Iterator() noexcept : m_hook(nullptr) {}
+
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        Iterator(const Iterator<false>& other) noexcept : m_hook(other.m_hook) {}
+
+        reference operator*() const noexcept { return static_cast<reference>(*m_hook); }
+        pointer operator->() const noexcept { return static_cast<pointer>(m_hook); }
+
+        Iterator& operator++() noexcept {
+            m_hook = m_hook->m_next;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator previous = *this;
+            m_hook = m_hook->m_next;
+            return previous;
+        }
+
+        Iterator& operator--() noexcept {
+            m_hook = m_hook->m_prev;
+            return *this;
+        }
+
+        Iterator operator--(int) noexcept {
+            Iterator previous = *this;
+            m_hook = m_hook->m_prev;
+            return previous;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept {
+            return lhs.m_hook == rhs.m_hook;
+        }
+
+        friend bool operator!=(const Iterator& lhs, const Iterator& rhs) noexcept {
+            return lhs.m_hook != rhs.m_hook;
+        }
+
+    private:
+        friend class IntrusiveList;
+        friend class Iterator<!Const>;
+
+        explicit Iterator(HookPtr hook) noexcept : m_hook(hook) {}
+
+        HookPtr m_hook;
+    };
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     * @brief Default constructor - creates an empty list
+     */
+    IntrusiveList() noexcept : m_size(0) {
+        m_root.m_prev = &m_root;
+        m_root.m_next = &m_root;
+    }
+
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    /**
+     * @brief Move constructor - takes other's elements, leaving it empty
+     */
+    IntrusiveList(IntrusiveList&& other) noexcept : IntrusiveList() {
+        splice(end(), other);
+    }
+
+    /**
+     * @brief Move assignment - unlinks the current elements, then takes other's
+     */
+    IntrusiveList& operator=(IntrusiveList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            splice(end(), other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Destructor - unlinks every element (the elements are not destroyed)
+     */
+    ~IntrusiveList() {
+        clear();
+    }
+
+    // Element access
+
+    /**
+     * @brief Access the first element
+     * @throws std::out_of_range if the list is empty
+     */
+    reference front() {
+        if (empty()) {
+            throw std::out_of_range("IntrusiveList::front: list is empty");
+        }
+        return static_cast<T&>(*m_root.m_next);
+    }
+
+    const_reference front() const {
+        if (empty()) {
+            throw std::out_of_range("IntrusiveList::front: list is empty");
+        }
+        return static_cast<const T&>(*m_root.m_next);
+    }
+
+    /**
+     * @brief Access the last element
+     * @throws std::out_of_range if the list is empty
+     */
+    reference back() {
+        if (empty()) {
+            throw std::out_of_range("IntrusiveList::back: list is empty");
+        }
+        return static_cast<T&>(*m_root.m_prev);
+    }
+
+    const_reference back() const {
+        if (empty()) {
+            throw std::out_of_range("IntrusiveList::back: list is empty");
+        }
+        return static_cast<const T&>(*m_root.m_prev);
+    }
+
+    // Iterators
+
+    iterator begin() noexcept { return iterator(m_root.m_next); }
+    const_iterator begin() const noexcept { return const_iterator(m_root.m_next); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator end() noexcept { return iterator(&m_root); }
+    const_iterator end() const noexcept { return const_iterator(&m_root); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    /**
+     * @brief Iterator to an element of this list, in O(1)
+     */
+    iterator iterator_to(T& value) noexcept { return iterator(static_cast<Hook*>(&value)); }
+    const_iterator iterator_to(const T& value) const noexcept {
+        return const_iterator(static_cast<const Hook*>(&value));
+    }
+
+    // Capacity
+
+    bool empty() const noexcept { return m_size == 0; }
+    size_type size() const noexcept { return m_size; }
+
+    // Modifiers
+
+    /**
+     * @brief Unlink every element
+     */
+    void clear() noexcept {
+        Hook* current = m_root.m_next;
+        while (current != &m_root) {
+            Hook* next = current->m_next;
+            current->m_prev = nullptr;
+            current->m_next = nullptr;
+            current = next;
+        }
+        m_root.m_prev = &m_root;
+        m_root.m_next = &m_root;
+        m_size = 0;
+    }
+
+    /**
+     * @brief Link value at the front
+     * @throws std::invalid_argument if value is already on a list
+     */
+    void push_front(T& value) { insert(begin(), value); }
+
+    /**
+     * @brief Link value at the back
+     * @throws std::invalid_argument if value is already on a list
+     */
+    void push_back(T& value) { insert(end(), value); }
+
+    /**
+     * @brief Unlink the first element
+     * @throws std::out_of_range if the list is empty
+     */
+    void pop_front() {
+        if (empty()) {
+            throw std::out_of_range("IntrusiveList::pop_front: list is empty");
+        }
+        erase(begin());
+    }
+
+    /**
+     * @brief Unlink the last element
+     * @throws std::out_of_range if the list is empty
+     */
+    void pop_back() {
+        if (empty()) {
+            throw std::out_of_range("IntrusiveList::pop_back: list is empty");
+        }
+        erase(iterator(m_root.m_prev));
+    }
+
+    /**
+     * @brief Link value before pos
+     * @return Iterator to value
+     * @throws std::invalid_argument if value is already on a list
+     */
+    iterator insert(const_iterator pos, T& value) {
+        Hook* hook = static_cast<Hook*>(&value);
+        if (hook->is_linked()) {
+            throw std::invalid_argument("IntrusiveList::insert: element is already linked");
+        }
+        link_before(mutable_hook(pos), hook, hook);
+        ++m_size;
+        return iterator(hook);
+    }
+
+    /**
+     * @brief Unlink the element at pos
+     * @return Iterator to the next element
+     */
+    iterator erase(const_iterator pos) noexcept {
+        Hook* hook = mutable_hook(pos);
+        Hook* next = hook->m_next;
+        unlink_range(hook, hook);
+        hook->m_prev = nullptr;
+        hook->m_next = nullptr;
+        --m_size;
+        return iterator(next);
+    }
+
+    /**
+     * @brief Unlink value, which must be on this list
+     */
+    void remove(T& value) noexcept { erase(iterator_to(value)); }
+
+    /**
+     * @brief Move all elements of other before pos, leaving other empty
+     * @complexity O(1)
+     */
+    void splice(const_iterator pos, IntrusiveList& other) noexcept {
+        if (&other == this || other.empty()) {
+            return;
+        }
+        Hook* first = other.m_root.m_next;
+        Hook* last = other.m_root.m_prev;
+        other.unlink_range(first, last);
+        link_before(mutable_hook(pos), first, last);
+        m_size += other.m_size;
+        other.m_size = 0;
+    }
+
+    /**
+     * @brief Move the element at it from other (which may be *this) before pos
+     * @complexity O(1)
+     */
+    void splice(const_iterator pos, IntrusiveList& other, const_iterator it) noexcept {
+        Hook* hook = mutable_hook(it);
+        Hook* target = mutable_hook(pos);
+        if (hook == target || hook->m_next == target) {
+            return;   // Already in place
+        }
+        other.unlink_range(hook, hook);
+        link_before(target, hook, hook);
+        if (&other != this) {
+            --other.m_size;
+            ++m_size;
+        }
+    }
+
+    /**
+     * @brief Swap contents with another list
+     */
+    void swap(IntrusiveList& other) noexcept {
+        IntrusiveList temp(std::move(other));
+        other.splice(other.end(), *this);
+        splice(end(), temp);
+    }
+
+private:
+    Hook m_root;        ///< Sentinel: m_next is the first element, m_prev the last
+    size_type m_size;   ///< Number of linked elements
+
+    static Hook* mutable_hook(const_iterator pos) noexcept {
+        return const_cast<Hook*>(pos.m_hook);
+    }
+
+    /**
+     * @brief Link the chain first..last (already linked internally) before pos
+     */
+    static void link_before(Hook* pos, Hook* first, Hook* last) noexcept {
+        Hook* prev = pos->m_prev;
+        first->m_prev = prev;
+        last->m_next = pos;
+        prev->m_next = first;
+        pos->m_prev = last;
+    }
+
+    /**
+     * @brief Detach the chain first..last, closing the gap (sizes untouched)
+     */
+    static void unlink_range(Hook* first, Hook* last) noexcept {
+        first->m_prev->m_next = last->m_next;
+        last->m_next->m_prev = first->m_prev;
+    }
+};
+
+/**
+ * @brief Swap two intrusive lists
+ */
+template <typename T, typename Tag>
+void swap(IntrusiveList<T, Tag>& lhs, IntrusiveList<T, Tag>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace linear
+} // namespace mylib
+
+#endif // MYLIB_LINEAR_INTRUSIVE_LIST_HPP
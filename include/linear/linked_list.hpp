@@ -30,9 +30,14 @@
 #define MYLIB_LINEAR_LINKED_LIST_HPP
 
 #include <cstddef>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
+#include <iterator>
+#include <functional>
 #include <initializer_list>
+#include "memory/node_pool.hpp"
 
 namespace mylib {
 namespace linear {
@@ -45,9 +50,20 @@ namespace linear {
  * memory allocation. It provides O(1) insertion/deletion at both ends
  * and O(n) access by index.
  * 
+ * Nodes are obtained from Allocator (rebound to the node type). With
+ * memory::PoolAllocator nodes come from slabs, and clear() releases them
+ * in bulk when the list is the pool's only user and T is trivially
+ * destructible.
+ * 
+ * Bidirectional iterators give O(1) insert/erase at a known position.
+ * splice(), merge() and sort() only relink nodes: elements are never
+ * copied or moved, and iterators to them stay valid (when the allocators
+ * of the two lists differ, splice/merge fall back to moving elements).
+ * 
  * @tparam T The type of elements stored in the list
+ * @tparam Allocator Allocator for elements (default: std::allocator<T>)
  */
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class LinkedList {
 private:
     /**
@@ -74,12 +90,81 @@ private:
             : data(std::move(value)), next(nullptr), prev(nullptr) {}
     };
 
+    /**
+     * @class Iterator
+     * @brief Bidirectional iterator; end() is a null node, decremented to the tail
+     */
+    template <bool Const>
+    class Iterator {
+        using NodePtr = std::conditional_t<Const, const Node*, Node*>;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        Iterator() noexcept : m_node(nullptr), m_list(nullptr) {}
+
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        Iterator(const Iterator<false>& other) noexcept
+            : m_node(other.m_node), m_list(other.m_list) {}
+
+        reference operator*() const noexcept { return m_node->data; }
+        pointer operator->() const noexcept { return &m_node->data; }
+
+        Iterator& operator++() noexcept {
+            m_node = m_node->next;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator previous = *this;
+            m_node = m_node->next;
+            return previous;
+        }
+
+        Iterator& operator--() noexcept {
+            m_node = m_node ? m_node->prev : m_list->m_tail;
+            return *this;
+        }
+
+        Iterator operator--(int) noexcept {
+            Iterator previous = *this;
+            --*this;
+            return previous;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept {
+            return lhs.m_node == rhs.m_node;
+        }
+
+        friend bool operator!=(const Iterator& lhs, const Iterator& rhs) noexcept {
+            return lhs.m_node != rhs.m_node;
+        }
+
+    private:
+        friend class LinkedList;
+        friend class Iterator<!Const>;
+
+        Iterator(NodePtr node, const LinkedList* list) noexcept : m_node(node), m_list(list) {}
+
+        NodePtr m_node;              ///< Current node (nullptr at end())
+        const LinkedList* m_list;    ///< Owning list, to step back from end()
+    };
+
 public:
     // Type aliases
     using value_type = T;
     using size_type = std::size_t;
     using reference = T&;
     using const_reference = const T&;
+    using allocator_type = Allocator;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
     /**
      * @brief Default constructor
@@ -87,6 +172,12 @@ public:
      */
     LinkedList();
 
+    /**
+     * @brief Construct an empty list using the given allocator
+     * @param alloc Allocator to draw nodes from
+     */
+    explicit LinkedList(const Allocator& alloc);
+
     /**
      * @brief Constructor with count and default value
      * @param count Number of elements
@@ -131,6 +222,12 @@ public:
      */
     LinkedList& operator=(LinkedList&& other) noexcept;
 
+    /**
+     * @brief Get a copy of the allocator
+     * @return Allocator used for nodes, rebound to T
+     */
+    allocator_type get_allocator() const;
+
     // Element access
     /**
      * @brief Access element at index
@@ -165,6 +262,18 @@ public:
     reference back();
     const_reference back() const;
 
+    // Iterators
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+    reverse_iterator rbegin() noexcept;
+    const_reverse_iterator rbegin() const noexcept;
+    reverse_iterator rend() noexcept;
+    const_reverse_iterator rend() const noexcept;
+
     // Capacity
     /**
      * @brief Check if list is empty
@@ -243,6 +352,82 @@ public:
      */
     void erase(size_type index);
 
+    /**
+     * @brief Insert element before pos in O(1)
+     * @param pos Position to insert before (end() appends)
+     * @param value Value to insert
+     * @return Iterator to the inserted element
+     */
+    iterator insert(const_iterator pos, const T& value);
+
+    /**
+     * @brief Insert element before pos in O(1) (move version)
+     * @param pos Position to insert before (end() appends)
+     * @param value Value to move
+     * @return Iterator to the inserted element
+     */
+    iterator insert(const_iterator pos, T&& value);
+
+    /**
+     * @brief Erase the element at pos in O(1)
+     * @param pos Dereferenceable iterator into this list
+     * @return Iterator to the element after the erased one
+     */
+    iterator erase(const_iterator pos);
+
+    /**
+     * @brief Erase the elements in [first, last)
+     * @return last, as a mutable iterator
+     */
+    iterator erase(const_iterator first, const_iterator last);
+
+    /**
+     * @brief Move all elements of other before pos, leaving other empty
+     * @param pos Position in this list
+     * @param other List to take the nodes of (must not be *this)
+     * @throws std::invalid_argument if other is *this
+     * @complexity O(1) (O(n) moves if the allocators differ)
+     */
+    void splice(const_iterator pos, LinkedList& other);
+
+    /**
+     * @brief Move the element at it from other (which may be *this) before pos
+     * @complexity O(1)
+     */
+    void splice(const_iterator pos, LinkedList& other, const_iterator it);
+
+    /**
+     * @brief Move the elements in [first, last) from other (which may be
+     *        *this, with pos outside the range) before pos
+     * @complexity O(1) if other is *this, otherwise O(distance(first, last))
+     *             to update the sizes
+     */
+    void splice(const_iterator pos, LinkedList& other, const_iterator first, const_iterator last);
+
+    /**
+     * @brief Merge sorted other into this sorted list by relinking nodes
+     * 
+     * Stable: of equal elements, those of *this come first. If comp throws,
+     * both lists stay valid and every element is in one of them.
+     * @param other Sorted list, left empty (must not be *this)
+     */
+    void merge(LinkedList& other);
+
+    template <typename Compare>
+    void merge(LinkedList& other, Compare comp);
+
+    /**
+     * @brief Stable in-place merge sort that relinks nodes
+     * 
+     * Bottom-up, O(n log n) comparisons, O(1) extra space; no element is
+     * copied or moved. If comp throws, the list keeps all its elements in
+     * an unspecified order.
+     */
+    void sort();
+
+    template <typename Compare>
+    void sort(Compare comp);
+
     /**
      * @brief Resize list to contain count elements
      * @param count New size
@@ -289,9 +474,28 @@ public:
     bool contains(const T& value) const;
 
 private:
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+    using BulkRelease = memory::bulk_release_traits<NodeAllocator>;
+
     Node* m_head;         ///< Pointer to first node
     Node* m_tail;         ///< Pointer to last node
     size_type m_size;     ///< Current number of elements
+    NodeAllocator m_alloc; ///< Node allocator
+
+    /**
+     * @brief Allocate and construct a node
+     * @param value Value to store (forwarded)
+     * @return Pointer to the new, unlinked node
+     */
+    template <typename U>
+    Node* create_node(U&& value);
+
+    /**
+     * @brief Destroy and deallocate a node
+     * @param node Node to free
+     */
+    void destroy_node(Node* node) noexcept;
 
     /**
      * @brief Get node at specific index
@@ -305,8 +509,173 @@ private:
      * @param other List to copy from
      */
     void copy_from(const LinkedList& other);
+
+    /**
+     * @brief Link the chain first..last (already linked internally) before pos
+     * @param pos Node to insert before (nullptr appends)
+     */
+    void link_before(Node* pos, Node* first, Node* last) noexcept;
+
+    /**
+     * @brief Detach the chain first..last from this list (sizes untouched)
+     */
+    void unlink_range(Node* first, Node* last) noexcept;
+
+    /**
+     * @brief Rebuild prev links, head and tail from a null-terminated next chain
+     */
+    void relink_prev(Node* first) noexcept;
+
+    /**
+     * @brief Stable merge of two sorted null-terminated next chains into out
+     * 
+     * If comp throws, out still receives every node of both chains.
+     */
+    template <typename Compare>
+    static void merge_runs(Node* earlier, Node* later, Node*& out, Compare& comp);
+
+    /**
+     * @brief Concatenate two null-terminated next chains (either may be empty)
+     */
+    static Node* append_run(Node* first, Node* second) noexcept;
 };
 
+// ============================================
+// Template member function implementations
+// ============================================
+
+template <typename T, typename Allocator>
+template <typename U>
+typename LinkedList<T, Allocator>::Node* LinkedList<T, Allocator>::create_node(U&& value) {
+    Node* node = NodeTraits::allocate(m_alloc, 1);
+    try {
+        NodeTraits::construct(m_alloc, node, std::forward<U>(value));
+    } catch (...) {
+        NodeTraits::deallocate(m_alloc, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template <typename T, typename Allocator>
+template <typename Compare>
+void LinkedList<T, Allocator>::merge(LinkedList& other, Compare comp) {
+    if (&other == this) {
+        throw std::invalid_argument("LinkedList::merge: cannot merge a list into itself");
+    }
+    if (!(m_alloc == other.m_alloc)) {
+        // Nodes cannot change allocators: rebuild other's elements with ours
+        LinkedList adopted(get_allocator());
+        for (Node* current = other.m_head; current; current = current->next) {
+            adopted.push_back(std::move(current->data));
+        }
+        other.clear();
+        merge(adopted, comp);
+        return;
+    }
+
+    // Each step moves one node, so both lists are valid if comp throws
+    Node* current = m_head;
+    while (current && other.m_head) {
+        Node* taken = other.m_head;
+        if (comp(taken->data, current->data)) {
+            other.unlink_range(taken, taken);
+            --other.m_size;
+            link_before(current, taken, taken);
+            ++m_size;
+        } else {
+            current = current->next;
+        }
+    }
+    if (other.m_head) {
+        link_before(nullptr, other.m_head, other.m_tail);
+        m_size += other.m_size;
+        other.m_head = nullptr;
+        other.m_tail = nullptr;
+        other.m_size = 0;
+    }
+}
+
+template <typename T, typename Allocator>
+template <typename Compare>
+void LinkedList<T, Allocator>::sort(Compare comp) {
+    if (m_size < 2) {
+        return;
+    }
+
+    // Merge sort over the next links with binary-counter bins: bins[i] holds
+    // a sorted run of 2^i nodes, so runs are merged while still in cache.
+    // prev links are rebuilt once at the end.
+    Node* bins[64] = {};
+    size_type fill = 0;
+    Node* rest = m_head;
+    Node* carry = nullptr;
+    try {
+        while (rest) {
+            carry = rest;
+            rest = rest->next;
+            carry->next = nullptr;
+            size_type i = 0;
+            for (; i < fill && bins[i]; ++i) {
+                Node* earlier = bins[i];
+                bins[i] = nullptr;
+                merge_runs(earlier, carry, carry, comp);
+            }
+            bins[i] = carry;
+            carry = nullptr;
+            if (i == fill) {
+                ++fill;
+            }
+        }
+        for (size_type i = 0; i < fill; ++i) {
+            if (bins[i]) {
+                Node* earlier = bins[i];
+                bins[i] = nullptr;
+                if (carry) {
+                    merge_runs(earlier, carry, carry, comp);
+                } else {
+                    carry = earlier;
+                }
+            }
+        }
+    } catch (...) {
+        // Chain every run back together so no node is lost
+        Node* all = rest;
+        for (size_type i = 0; i < fill; ++i) {
+            all = append_run(bins[i], all);
+        }
+        relink_prev(append_run(carry, all));
+        throw;
+    }
+    relink_prev(carry);
+}
+
+template <typename T, typename Allocator>
+template <typename Compare>
+void LinkedList<T, Allocator>::merge_runs(Node* earlier, Node* later, Node*& out, Compare& comp) {
+    Node* head = nullptr;
+    Node** link = &head;
+    try {
+        while (earlier && later) {
+            if (comp(later->data, earlier->data)) {
+                *link = later;
+                link = &later->next;
+                later = later->next;
+            } else {
+                *link = earlier;
+                link = &earlier->next;
+                earlier = earlier->next;
+            }
+        }
+    } catch (...) {
+        *link = append_run(earlier, later);
+        out = head;
+        throw;
+    }
+    *link = earlier ? earlier : later;
+    out = head;
+}
+
 } // namespace linear
 } // namespace mylib
 
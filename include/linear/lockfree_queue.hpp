@@ -0,0 +1,514 @@
+/**
+ * @file lockfree_queue.hpp
+ * @brief Bounded lock-free queues for handing work between threads
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ *
+ * Two fixed-capacity ring buffers that never take a lock or allocate after
+ * construction:
+ *
+ * - SpscQueue: exactly one producer thread and one consumer thread. Each
+ *   side owns one index and keeps a cached copy of the other side's index,
+ *   so a push or pop normally touches no shared cache line except the slot
+ *   itself. Batch operations publish many elements with one index store.
+ * - MpmcQueue: any number of producers and consumers (Dmitry Vyukov's
+ *   bounded MPMC queue). Every cell carries a sequence number that tells a
+ *   producer or consumer whether the cell is free for its lap; a single CAS
+ *   on the shared position claims one cell, or a run of cells for the
+ *   batch operations.
+ *
+ * Indices of the two sides live on separate cache lines (CACHE_LINE_SIZE)
+ * so producers and consumers do not false-share.
+ *
+ * Both queues report failure instead of blocking: try_push() returns false
+ * when full, try_pop() returns false when empty. Callers choose how to
+ * wait (spin, yield, back off).
+ *
+ * Time Complexity:
+ * - try_push/try_pop: O(1) (MpmcQueue: lock-free, retries under contention)
+ * - try_push_batch/try_pop_batch: O(k) for k elements
+ *
+ * Copyright (c) 2026 Jinhyeok
+ * MIT License
+ */
+
+#ifndef MYLIB_LINEAR_LOCKFREE_QUEUE_HPP
+#define MYLIB_LINEAR_LOCKFREE_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace mylib {
+namespace linear {
+
+/**
+ * @brief Assumed cache line size used to pad shared indices
+ */
+constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+namespace detail {
+
+/**
+ * @brief Round up to a power of two (at least 2)
+ */
+inline std::size_t lockfree_capacity(std::size_t requested) {
+    if (requested == 0) {
+        throw std::invalid_argument("lock-free queue: capacity must be positive");
+    }
+    std::size_t capacity = 2;
+    while (capacity < requested) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+/**
+ * @brief Uninitialized storage for one element
+ */
+template <typename T>
+struct Slot {
+    alignas(T) unsigned char bytes[sizeof(T)];
+
+    T* get() noexcept { return std::launder(reinterpret_cast<T*>(bytes)); }
+};
+
+} // namespace detail
+
+// ============================================
+// SpscQueue
+// ============================================
+
+/**
+ * @class SpscQueue
+ * @brief Bounded single-producer / single-consumer lock-free queue
+ *
+ * Push operations may only be called from one thread at a time, and pop
+ * operations from one (other) thread at a time. size_approx() and empty()
+ * may be called from anywhere but are only a snapshot.
+ *
+ * @tparam T Element type (should be nothrow move constructible)
+ */
+template <typename T>
+class SpscQueue {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /**
+     * @brief Construct an empty queue
+     * @param capacity Minimum number of elements (rounded up to a power of two)
+     * @throws std::invalid_argument if capacity is 0
+     */
+    explicit SpscQueue(size_type capacity)
+        : m_capacity(detail::lockfree_capacity(capacity))
+        , m_mask(m_capacity - 1)
+        , m_slots(new detail::Slot<T>[m_capacity]) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * @brief Destroy remaining elements (no thread may be using the queue)
+     */
+    ~SpscQueue() {
+        size_type head = m_consumer.head.load(std::memory_order_relaxed);
+        size_type tail = m_producer.tail.load(std::memory_order_relaxed);
+        for (; head != tail; ++head) {
+            m_slots[head & m_mask].get()->~T();
+        }
+    }
+
+    // ============================================
+    // Producer side
+    // ============================================
+
+    /**
+     * @brief Construct an element in place at the tail
+     * @return false if the queue is full
+     */
+    template <typename... Args>
+    bool try_emplace(Args&&... args) {
+        size_type tail = m_producer.tail.load(std::memory_order_relaxed);
+        if (tail - m_producer.head_cache == m_capacity) {
+            m_producer.head_cache = m_consumer.head.load(std::memory_order_acquire);
+            if (tail - m_producer.head_cache == m_capacity) {
+                return false;
+            }
+        }
+        ::new (m_slots[tail & m_mask].bytes) T(std::forward<Args>(args)...);
+        m_producer.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Push a copy of value
+     * @return false if the queue is full
+     */
+    bool try_push(const T& value) { return try_emplace(value); }
+
+    /**
+     * @brief Push value by move
+     * @return false if the queue is full (value is left untouched)
+     */
+    bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+    /**
+     * @brief Push up to count elements, publishing them with one store
+     * @param items Elements to copy in
+     * @param count Number of elements offered
+     * @return Number pushed (a prefix of items); less than count if the queue filled up
+     */
+    size_type try_push_batch(const T* items, size_type count) {
+        size_type tail = m_producer.tail.load(std::memory_order_relaxed);
+        size_type free = m_capacity - (tail - m_producer.head_cache);
+        if (free < count) {
+            m_producer.head_cache = m_consumer.head.load(std::memory_order_acquire);
+            free = m_capacity - (tail - m_producer.head_cache);
+        }
+        size_type n = count < free ? count : free;
+        for (size_type i = 0; i < n; ++i) {
+            ::new (m_slots[(tail + i) & m_mask].bytes) T(items[i]);
+        }
+        if (n > 0) {
+            m_producer.tail.store(tail + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+    // ============================================
+    // Consumer side
+    // ============================================
+
+    /**
+     * @brief Move the front element out
+     * @param out Receives the element
+     * @return false if the queue is empty (out is left untouched)
+     */
+    bool try_pop(T& out) {
+        size_type head = m_consumer.head.load(std::memory_order_relaxed);
+        if (head == m_consumer.tail_cache) {
+            m_consumer.tail_cache = m_producer.tail.load(std::memory_order_acquire);
+            if (head == m_consumer.tail_cache) {
+                return false;
+            }
+        }
+        T* slot = m_slots[head & m_mask].get();
+        out = std::move(*slot);
+        slot->~T();
+        m_consumer.head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Move up to max_count elements out, releasing them with one store
+     * @param out Destination array (at least max_count elements)
+     * @param max_count Maximum number to pop
+     * @return Number popped
+     */
+    size_type try_pop_batch(T* out, size_type max_count) {
+        size_type head = m_consumer.head.load(std::memory_order_relaxed);
+        size_type available = m_consumer.tail_cache - head;
+        if (available < max_count) {
+            m_consumer.tail_cache = m_producer.tail.load(std::memory_order_acquire);
+            available = m_consumer.tail_cache - head;
+        }
+        size_type n = max_count < available ? max_count : available;
+        for (size_type i = 0; i < n; ++i) {
+            T* slot = m_slots[(head + i) & m_mask].get();
+            out[i] = std::move(*slot);
+            slot->~T();
+        }
+        if (n > 0) {
+            m_consumer.head.store(head + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+    // ============================================
+    // Observers
+    // ============================================
+
+    /** @brief Maximum number of elements */
+    size_type capacity() const noexcept { return m_capacity; }
+
+    /** @brief Snapshot of the number of elements */
+    size_type size_approx() const noexcept {
+        size_type head = m_consumer.head.load(std::memory_order_acquire);
+        size_type tail = m_producer.tail.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    /** @brief Snapshot of emptiness */
+    bool empty() const noexcept { return size_approx() == 0; }
+
+private:
+    /**
+     * @brief Producer-owned line: the tail it publishes and its view of head
+     */
+    struct alignas(CACHE_LINE_SIZE) ProducerSide {
+        std::atomic<size_type> tail{0};
+        size_type head_cache = 0;
+    };
+
+    /**
+     * @brief Consumer-owned line: the head it publishes and its view of tail
+     */
+    struct alignas(CACHE_LINE_SIZE) ConsumerSide {
+        std::atomic<size_type> head{0};
+        size_type tail_cache = 0;
+    };
+
+    const size_type m_capacity;
+    const size_type m_mask;
+    std::unique_ptr<detail::Slot<T>[]> m_slots;
+    ProducerSide m_producer;
+    ConsumerSide m_consumer;
+};
+
+// ============================================
+// MpmcQueue
+// ============================================
+
+/**
+ * @class MpmcQueue
+ * @brief Bounded multi-producer / multi-consumer lock-free queue
+ *
+ * Cell i starts with sequence i. A producer at position pos may write the
+ * cell when its sequence equals pos and publishes it by storing pos + 1; a
+ * consumer at pos may read it when the sequence equals pos + 1 and frees it
+ * for the next lap by storing pos + capacity.
+ *
+ * A claimed cell must always be published, or consumers would wait on it
+ * forever, so nothing that can throw runs between claiming and publishing.
+ * When constructing T from the arguments may throw (e.g. copying a
+ * std::string), try_emplace() builds the element first and moves it into
+ * the cell, and try_push_batch() pushes the elements one at a time.
+ *
+ * @tparam T Element type (must be nothrow move constructible unless every
+ *           push constructs it without throwing)
+ */
+template <typename T>
+class MpmcQueue {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /**
+     * @brief Construct an empty queue
+     * @param capacity Minimum number of elements (rounded up to a power of two)
+     * @throws std::invalid_argument if capacity is 0
+     */
+    explicit MpmcQueue(size_type capacity)
+        : m_capacity(detail::lockfree_capacity(capacity))
+        , m_mask(m_capacity - 1)
+        , m_cells(new Cell[m_capacity]) {
+        for (size_type i = 0; i < m_capacity; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    /**
+     * @brief Destroy remaining elements (no thread may be using the queue)
+     */
+    ~MpmcQueue() {
+        size_type head = m_dequeue_pos.value.load(std::memory_order_relaxed);
+        size_type tail = m_enqueue_pos.value.load(std::memory_order_relaxed);
+        for (; head != tail; ++head) {
+            m_cells[head & m_mask].slot.get()->~T();
+        }
+    }
+
+    /**
+     * @brief Construct an element in place
+     * @return false if the queue is full
+     */
+    template <typename... Args>
+    bool try_emplace(Args&&... args) {
+        if constexpr (std::is_nothrow_constructible<T, Args&&...>::value) {
+            size_type pos;
+            if (claim(m_enqueue_pos.value, 0, 1, pos) == 0) {
+                return false;
+            }
+            Cell& cell = m_cells[pos & m_mask];
+            ::new (cell.slot.bytes) T(std::forward<Args>(args)...);
+            cell.sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        } else {
+            static_assert(std::is_nothrow_move_constructible<T>::value,
+                          "MpmcQueue: T must be nothrow move constructible when "
+                          "constructing it may throw");
+            // Build it before claiming: a throw must not leave a claimed cell unpublished
+            T value(std::forward<Args>(args)...);
+            return try_emplace(std::move(value));
+        }
+    }
+
+    /**
+     * @brief Push a copy of value
+     * @return false if the queue is full
+     */
+    bool try_push(const T& value) { return try_emplace(value); }
+
+    /**
+     * @brief Push value by move
+     * @return false if the queue is full (value is left untouched)
+     */
+    bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+    /**
+     * @brief Push up to count elements into consecutive cells claimed with one CAS
+     * @param items Elements to copy in
+     * @param count Number of elements offered
+     * @return Number pushed (a prefix of items); 0 if the queue is full
+     *
+     * Claims all cells with one CAS when copying T cannot throw; otherwise
+     * pushes one element at a time.
+     */
+    size_type try_push_batch(const T* items, size_type count) {
+        if constexpr (!std::is_nothrow_copy_constructible<T>::value) {
+            // Copies may throw: one claim per element, each copy made first.
+            // If a copy throws, the elements before it stay pushed.
+            size_type n = 0;
+            while (n < count && try_push(items[n])) {
+                ++n;
+            }
+            return n;
+        } else {
+            size_type pos;
+            size_type n = claim(m_enqueue_pos.value, 0, count, pos);
+            for (size_type i = 0; i < n; ++i) {
+                Cell& cell = m_cells[(pos + i) & m_mask];
+                ::new (cell.slot.bytes) T(items[i]);
+                cell.sequence.store(pos + i + 1, std::memory_order_release);
+            }
+            return n;
+        }
+    }
+
+    /**
+     * @brief Move the front element out
+     * @param out Receives the element
+     * @return false if the queue is empty (out is left untouched)
+     */
+    bool try_pop(T& out) {
+        size_type pos;
+        if (claim(m_dequeue_pos.value, 1, 1, pos) == 0) {
+            return false;
+        }
+        release(pos, out);
+        return true;
+    }
+
+    /**
+     * @brief Move up to max_count consecutive elements out, claimed with one CAS
+     * @param out Destination array (at least max_count elements)
+     * @param max_count Maximum number to pop
+     * @return Number popped
+     */
+    size_type try_pop_batch(T* out, size_type max_count) {
+        size_type pos;
+        size_type n = claim(m_dequeue_pos.value, 1, max_count, pos);
+        for (size_type i = 0; i < n; ++i) {
+            release(pos + i, out[i]);
+        }
+        return n;
+    }
+
+    /** @brief Maximum number of elements */
+    size_type capacity() const noexcept { return m_capacity; }
+
+    /** @brief Snapshot of the number of elements (claimed but unfinished pushes count) */
+    size_type size_approx() const noexcept {
+        size_type head = m_dequeue_pos.value.load(std::memory_order_acquire);
+        size_type tail = m_enqueue_pos.value.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    /** @brief Snapshot of emptiness */
+    bool empty() const noexcept { return size_approx() == 0; }
+
+private:
+    struct alignas(CACHE_LINE_SIZE) Cell {
+        std::atomic<size_type> sequence;
+        detail::Slot<T> slot;
+    };
+
+    struct alignas(CACHE_LINE_SIZE) Position {
+        std::atomic<size_type> value{0};
+    };
+
+    /**
+     * @brief Claim up to max_count consecutive cells starting at the shared position
+     * @param position m_enqueue_pos (lag 0) or m_dequeue_pos (lag 1)
+     * @param lag How far a ready cell's sequence is ahead of its position
+     * @param max_count Maximum number of cells
+     * @param pos Receives the first claimed position
+     * @return Number of cells claimed; 0 if max_count is 0 or the first cell is
+     *         not ready (full/empty)
+     *
+     * A cell whose sequence equals pos + lag stays ready until the position
+     * moves past it, so checking a run of cells and then moving the position
+     * with one CAS claims all of them.
+     */
+    size_type claim(std::atomic<size_type>& position, size_type lag, size_type max_count,
+                    size_type& pos) {
+        pos = position.load(std::memory_order_relaxed);
+        if (max_count == 0) {
+            return 0;  // Nothing asked for; the retry loop below would never claim
+        }
+        for (;;) {
+            size_type n = 0;
+            while (n < max_count && n < m_capacity) {
+                size_type seq = m_cells[(pos + n) & m_mask].sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + n + lag);
+                if (diff != 0) {
+                    if (n == 0 && diff < 0) {
+                        return 0;  // full (producers) or empty (consumers)
+                    }
+                    break;
+                }
+                ++n;
+            }
+            if (n == 0) {
+                // Another thread already took this cell; catch up
+                pos = position.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (position.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed)) {
+                return n;
+            }
+        }
+    }
+
+    /**
+     * @brief Move a claimed element out and free its cell for the next lap
+     */
+    void release(size_type pos, T& out) {
+        Cell& cell = m_cells[pos & m_mask];
+        T* value = cell.slot.get();
+        out = std::move(*value);
+        value->~T();
+        cell.sequence.store(pos + m_capacity, std::memory_order_release);
+    }
+
+    const size_type m_capacity;
+    const size_type m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+    Position m_enqueue_pos;
+    Position m_dequeue_pos;
+};
+
+} // namespace linear
+} // namespace mylib
+
+#endif // MYLIB_LINEAR_LOCKFREE_QUEUE_HPP
@@ -1,6 +1,6 @@
 /**
  * @file queue.hpp
- * @brief Queue implementation using LinkedList as underlying container
+ * @brief Queue implementation on a contiguous circular buffer
  * @author Jinhyeok
  * @date 2025-11-29
  * @version 1.0.0
@@ -29,8 +29,8 @@
 #ifndef MYLIB_LINEAR_QUEUE_HPP
 #define MYLIB_LINEAR_QUEUE_HPP
 
-#include "linear/linked_list.hpp"
 #include <cstddef>
+#include <memory>
 #include <stdexcept>
 #include <utility>
 
@@ -41,8 +41,14 @@ namespace linear {
  * @class Queue
  * @brief A FIFO (First-In-First-Out) queue container
  * 
- * This class implements a queue data structure using LinkedList as the
- * underlying container. It provides O(1) enqueue and dequeue operations.
+ * This class implements a queue data structure on a contiguous circular
+ * buffer. push() writes at the tail and pop() advances the head, both O(1)
+ * with no allocation; when the buffer is full an unbounded queue doubles
+ * its capacity (amortized O(1) push).
+ * 
+ * Bounded mode (Queue::bounded(n)) fixes the capacity at construction: the
+ * queue never allocates again, full() reports when it is at capacity,
+ * try_push() returns false instead of growing and push() throws.
  * 
  * @tparam T The type of elements stored in the queue
  */
@@ -55,28 +61,38 @@ public:
     using reference = T&;
     using const_reference = const T&;
 
+    static constexpr size_type MIN_CAPACITY = 16;  ///< First allocation of an unbounded queue
+
     /**
      * @brief Default constructor
-     * Creates an empty queue
+     * Creates an empty, unbounded queue (no allocation until the first push)
      */
     Queue();
 
+    /**
+     * @brief Create a fixed-capacity queue
+     * @param capacity Maximum number of elements, allocated up front
+     * @return Empty bounded queue
+     * @throws std::invalid_argument if capacity is 0
+     */
+    static Queue bounded(size_type capacity);
+
     /**
      * @brief Copy constructor
-     * @param other Queue to copy from
+     * @param other Queue to copy from (bounded mode and capacity are copied)
      */
     Queue(const Queue& other);
 
     /**
      * @brief Move constructor
-     * @param other Queue to move from
+     * @param other Queue to move from (left empty and unbounded)
      */
     Queue(Queue&& other) noexcept;
 
     /**
      * @brief Destructor
      */
-    ~Queue() = default;
+    ~Queue();
 
     /**
      * @brief Copy assignment operator
@@ -116,25 +132,66 @@ public:
      */
     bool empty() const noexcept;
 
+    /**
+     * @brief Check if a bounded queue is at capacity
+     * @return true if bounded and size() == capacity(); always false when unbounded
+     */
+    bool full() const noexcept;
+
     /**
      * @brief Get the number of elements in the queue
      * @return Number of elements
      */
     size_type size() const noexcept;
 
+    /**
+     * @brief Get the number of elements the buffer can hold without growing
+     * @return Current capacity
+     */
+    size_type capacity() const noexcept;
+
+    /**
+     * @brief Check whether the queue has a fixed capacity
+     * @return true if created by bounded()
+     */
+    bool is_bounded() const noexcept;
+
+    /**
+     * @brief Make room for at least new_capacity elements
+     * @param new_capacity Requested capacity
+     * @throws std::length_error if the queue is bounded and new_capacity exceeds its capacity
+     */
+    void reserve(size_type new_capacity);
+
     // Modifiers
     /**
      * @brief Add an element to the back of the queue
      * @param value Value to add
+     * @throws std::length_error if the queue is bounded and full
      */
     void push(const T& value);
 
     /**
      * @brief Add an element to the back of the queue (move version)
      * @param value Value to move into the queue
+     * @throws std::length_error if the queue is bounded and full
      */
     void push(T&& value);
 
+    /**
+     * @brief Add an element unless a bounded queue is full
+     * @param value Value to add
+     * @return false if the queue was full (value is not consumed)
+     */
+    bool try_push(const T& value);
+
+    /**
+     * @brief Add an element unless a bounded queue is full (move version)
+     * @param value Value to move into the queue
+     * @return false if the queue was full (value is left untouched)
+     */
+    bool try_push(T&& value);
+
     /**
      * @brief Remove the front element from the queue
      * @throws std::out_of_range if queue is empty
@@ -142,7 +199,14 @@ public:
     void pop();
 
     /**
-     * @brief Remove all elements from the queue
+     * @brief Move the front element out and remove it
+     * @param out Receives the front element
+     * @return false if the queue was empty (out is left untouched)
+     */
+    bool try_pop(T& out);
+
+    /**
+     * @brief Remove all elements from the queue (capacity is kept)
      */
     void clear() noexcept;
 
@@ -153,9 +217,191 @@ public:
     void swap(Queue& other) noexcept;
 
 private:
-    LinkedList<T> m_container;  ///< Underlying container
+    using Alloc = std::allocator<T>;
+    using AllocTraits = std::allocator_traits<Alloc>;
+
+    T* m_data;              ///< Circular buffer
+    size_type m_capacity;   ///< Slots in m_data
+    size_type m_head;       ///< Index of the front element
+    size_type m_size;       ///< Number of elements
+    bool m_bounded;         ///< Capacity is fixed
+
+    /**
+     * @brief Slot index of the element at position pos from the front
+     */
+    size_type wrap(size_type pos) const noexcept {
+        return pos >= m_capacity ? pos - m_capacity : pos;
+    }
+
+    /**
+     * @brief Capacity to grow to for one more element, or throw if bounded
+     */
+    size_type grow_capacity() const;
+
+    /**
+     * @brief Move the elements into a buffer of new_capacity slots
+     */
+    void reallocate(size_type new_capacity);
+
+    /**
+     * @brief Move the elements to the front of new_data and adopt it
+     *
+     * On exception the queue is unchanged and new_data holds no elements
+     * moved from it; the caller still owns new_data.
+     */
+    void adopt(T* new_data, size_type new_capacity);
+
+    template <typename U>
+    void push_impl(U&& value);
+
+    template <typename U>
+    void grow_and_push(U&& value);
 };
 
+// ============================================
+// Template member function implementations
+// ============================================
+
+// Element access and the push/pop paths are defined here so they inline
+// into callers; everything else lives in queue.cpp
+
+template <typename T>
+inline typename Queue<T>::reference Queue<T>::front() {
+    if (m_size == 0) {
+        throw std::out_of_range("Queue::front: queue is empty");
+    }
+    return m_data[m_head];
+}
+
+template <typename T>
+inline typename Queue<T>::const_reference Queue<T>::front() const {
+    if (m_size == 0) {
+        throw std::out_of_range("Queue::front: queue is empty");
+    }
+    return m_data[m_head];
+}
+
+template <typename T>
+inline typename Queue<T>::reference Queue<T>::back() {
+    if (m_size == 0) {
+        throw std::out_of_range("Queue::back: queue is empty");
+    }
+    return m_data[wrap(m_head + m_size - 1)];
+}
+
+template <typename T>
+inline typename Queue<T>::const_reference Queue<T>::back() const {
+    if (m_size == 0) {
+        throw std::out_of_range("Queue::back: queue is empty");
+    }
+    return m_data[wrap(m_head + m_size - 1)];
+}
+
+template <typename T>
+inline bool Queue<T>::empty() const noexcept {
+    return m_size == 0;
+}
+
+template <typename T>
+inline bool Queue<T>::full() const noexcept {
+    return m_bounded && m_size == m_capacity;
+}
+
+template <typename T>
+inline typename Queue<T>::size_type Queue<T>::size() const noexcept {
+    return m_size;
+}
+
+template <typename T>
+template <typename U>
+inline void Queue<T>::push_impl(U&& value) {
+    if (m_size == m_capacity) {
+        grow_and_push(std::forward<U>(value));
+        return;
+    }
+    Alloc alloc;
+    AllocTraits::construct(alloc, m_data + wrap(m_head + m_size), std::forward<U>(value));
+    ++m_size;
+}
+
+template <typename T>
+template <typename U>
+inline void Queue<T>::grow_and_push(U&& value) {
+    size_type new_capacity = grow_capacity();
+    Alloc alloc;
+    T* new_data = AllocTraits::allocate(alloc, new_capacity);
+    T* slot = new_data + m_size;
+
+    // Construct the new element first: value may refer to an element of this queue
+    try {
+        AllocTraits::construct(alloc, slot, std::forward<U>(value));
+    } catch (...) {
+        AllocTraits::deallocate(alloc, new_data, new_capacity);
+        throw;
+    }
+
+    try {
+        adopt(new_data, new_capacity);
+    } catch (...) {
+        AllocTraits::destroy(alloc, slot);
+        AllocTraits::deallocate(alloc, new_data, new_capacity);
+        throw;
+    }
+    ++m_size;
+}
+
+template <typename T>
+inline void Queue<T>::push(const T& value) {
+    push_impl(value);
+}
+
+template <typename T>
+inline void Queue<T>::push(T&& value) {
+    push_impl(std::move(value));
+}
+
+template <typename T>
+inline bool Queue<T>::try_push(const T& value) {
+    if (full()) {
+        return false;
+    }
+    push_impl(value);
+    return true;
+}
+
+template <typename T>
+inline bool Queue<T>::try_push(T&& value) {
+    if (full()) {
+        return false;
+    }
+    push_impl(std::move(value));
+    return true;
+}
+
+template <typename T>
+inline void Queue<T>::pop() {
+    if (m_size == 0) {
+        throw std::out_of_range("Queue::pop: queue is empty");
+    }
+    Alloc alloc;
+    AllocTraits::destroy(alloc, m_data + m_head);
+    m_head = wrap(m_head + 1);
+    --m_size;
+}
+
+template <typename T>
+inline bool Queue<T>::try_pop(T& out) {
+    if (m_size == 0) {
+        return false;
+    }
+    out = std::move(m_data[m_head]);
+    Alloc alloc;
+    AllocTraits::destroy(alloc, m_data + m_head);
+    m_head = wrap(m_head + 1);
+    --m_size;
+    return true;
+}
+
 } // namespace linear
 } // namespace mylib
 
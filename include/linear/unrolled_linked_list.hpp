@@ -0,0 +1,945 @@
+/**
+ * @file unrolled_linked_list.hpp
+ * @brief Doubly linked list storing up to NodeCapacity elements per node
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ *
+ * LinkedList pays two pointers (16 bytes on 64-bit) for every element and
+ * one cache miss per step of a traversal. UnrolledLinkedList keeps the
+ * list of nodes but packs a small array of elements into each node:
+ * - Per-element overhead drops to (2 pointers + count) / NodeCapacity
+ * - Iteration walks contiguous elements inside a node and only chases a
+ *   pointer once per NodeCapacity elements
+ * - Indexed access skips whole nodes by their element count, so at(),
+ *   insert(index) and erase(index) take O(n / B) node hops plus O(B)
+ *   element moves inside one node, instead of O(n) node steps
+ * - splice() links another list's nodes in O(1) once the position is
+ *   found; a position inside a node splits that node first (O(B))
+ *
+ * A full node is split in half on insertion. A node that falls below half
+ * capacity after erase() is merged into a neighbour when both fit in one
+ * node, so erasing does not leave long runs of nearly empty nodes.
+ *
+ * Inserting or erasing invalidates iterators and references to elements
+ * of the affected node (and of the node it splits into or merges with).
+ *
+ * Copyright (c) 2026 Jinhyeok
+ * MIT License
+ */
+
+#ifndef MYLIB_LINEAR_UNROLLED_LINKED_LIST_HPP
+#define MYLIB_LINEAR_UNROLLED_LINKED_LIST_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <initializer_list>
+
+namespace mylib {
+namespace linear {
+
+/**
+ * @class UnrolledLinkedList
+ * @brief Doubly linked list of fixed-capacity element arrays
+ *
+ * @tparam T Element type (must be move-constructible and move-assignable)
+ * @tparam NodeCapacity Elements per node (B); 32-64 keeps a node of small
+ *         elements within a few cache lines
+ * @tparam Allocator Allocator for elements, rebound to the node type
+ *
+ * Performance characteristics:
+ * - push_back / pop_back: O(1)
+ * - push_front / pop_front: O(B) (elements shift inside the head node)
+ * - at / insert / erase by index: O(n / B + B)
+ * - splice: O(n / B) to find the position, O(1) to link at a node boundary
+ * - Space: n * sizeof(T) / fill + (2 pointers + size_t) per node
+ */
+template <typename T, std::size_t NodeCapacity = 32, typename Allocator = std::allocator<T>>
+class UnrolledLinkedList {
+    static_assert(NodeCapacity >= 2, "UnrolledLinkedList: node capacity must be at least 2");
+
+private:
+    /**
+     * @struct Node
+     * @brief A run of up to NodeCapacity elements plus the list links
+     */
+    struct Node {
+        Node* next = nullptr;      ///< Pointer to next node
+        Node* prev = nullptr;      ///< Pointer to previous node
+        std::size_t count = 0;     ///< Constructed elements in storage
+        alignas(T) unsigned char storage[sizeof(T) * NodeCapacity];  ///< Raw element slots
+
+        T* elements() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+
+        const T* elements() const noexcept {
+            return std::launder(reinterpret_cast<const T*>(storage));
+        }
+    };
+
+    template <bool Const>
+    class Iterator {
+        using NodePtr = std::conditional_t<Const, const Node*, Node*>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        Iterator() noexcept : m_node(nullptr), m_offset(0) {}
+        Iterator(NodePtr node, std::size_t offset) noexcept : m_node(node), m_offset(offset) {}
+
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        Iterator(const Iterator<false>& other) noexcept
+            : m_node(other.m_node), m_offset(other.m_offset) {}
+
+        reference operator*() const noexcept { return m_node->elements()[m_offset]; }
+        pointer operator->() const noexcept { return m_node->elements() + m_offset; }
+
+        Iterator& operator++() noexcept {
+            if (++m_offset == m_node->count) {
+                m_node = m_node->next;
+                m_offset = 0;
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept {
+            return lhs.m_node == rhs.m_node && lhs.m_offset == rhs.m_offset;
+        }
+
+        friend bool operator!=(const Iterator& lhs, const Iterator& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+    private:
+        friend class Iterator<!Const>;
+
+        NodePtr m_node;
+        std::size_t m_offset;
+    };
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    static constexpr size_type NODE_CAPACITY = NodeCapacity;   ///< Elements per node (B)
+
+    /**
+     * @brief Default constructor - creates an empty list
+     */
+    UnrolledLinkedList() : UnrolledLinkedList(Allocator()) {}
+
+    /**
+     * @brief Constructor with allocator - creates an empty list
+     * @param alloc Allocator to draw nodes from
+     */
+    explicit UnrolledLinkedList(const Allocator& alloc)
+        : m_head(nullptr), m_tail(nullptr), m_size(0), m_nodes(0), m_alloc(alloc) {}
+
+    /**
+     * @brief Initializer list constructor
+     * @param init Initializer list with elements
+     */
+    UnrolledLinkedList(std::initializer_list<T> init) : UnrolledLinkedList() {
+        for (const T& value : init) {
+            push_back(value);
+        }
+    }
+
+    /**
+     * @brief Copy constructor (nodes of the copy are packed full)
+     * @param other List to copy from
+     */
+    UnrolledLinkedList(const UnrolledLinkedList& other)
+        : UnrolledLinkedList(NodeTraits::select_on_container_copy_construction(other.m_alloc)) {
+        for (const T& value : other) {
+            push_back(value);
+        }
+    }
+
+    /**
+     * @brief Move constructor
+     * @param other List to move from (left empty)
+     */
+    UnrolledLinkedList(UnrolledLinkedList&& other) noexcept
+        : m_head(other.m_head), m_tail(other.m_tail), m_size(other.m_size),
+          m_nodes(other.m_nodes), m_alloc(std::move(other.m_alloc)) {
+        other.reset();
+    }
+
+    /**
+     * @brief Destructor
+     */
+    ~UnrolledLinkedList() {
+        clear();
+    }
+
+    UnrolledLinkedList& operator=(const UnrolledLinkedList& other);
+    UnrolledLinkedList& operator=(UnrolledLinkedList&& other) noexcept(
+        std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value);
+
+    /**
+     * @brief Get the allocator
+     * @return Allocator used for nodes, rebound to T
+     */
+    allocator_type get_allocator() const { return allocator_type(m_alloc); }
+
+    // Element access
+
+    /**
+     * @brief Access element at index with bounds checking
+     * @param index Position of the element
+     * @return Reference to the element
+     * @throws std::out_of_range if index >= size()
+     * @complexity O(n / B) node hops
+     */
+    reference at(size_type index);
+    const_reference at(size_type index) const;
+
+    /**
+     * @brief Access element at index without bounds checking
+     */
+    reference operator[](size_type index) {
+        Position position = locate(index);
+        return position.node->elements()[position.offset];
+    }
+
+    const_reference operator[](size_type index) const {
+        Position position = locate(index);
+        return position.node->elements()[position.offset];
+    }
+
+    /**
+     * @brief Access the first element
+     * @throws std::out_of_range if the list is empty
+     */
+    reference front();
+    const_reference front() const;
+
+    /**
+     * @brief Access the last element
+     * @throws std::out_of_range if the list is empty
+     */
+    reference back();
+    const_reference back() const;
+
+    // Iterators
+
+    iterator begin() noexcept { return iterator(m_head, 0); }
+    const_iterator begin() const noexcept { return const_iterator(m_head, 0); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator end() noexcept { return iterator(); }
+    const_iterator end() const noexcept { return const_iterator(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    // Capacity
+
+    bool empty() const noexcept { return m_size == 0; }
+    size_type size() const noexcept { return m_size; }
+
+    /**
+     * @brief Number of allocated nodes (each holds 1..B elements)
+     */
+    size_type node_count() const noexcept { return m_nodes; }
+
+    // Modifiers
+
+    /**
+     * @brief Remove all elements and free every node
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Add element at the front
+     * @complexity O(B): elements of the head node shift right
+     */
+    void push_front(const T& value) { emplace_front_impl(value); }
+    void push_front(T&& value) { emplace_front_impl(std::move(value)); }
+
+    /**
+     * @brief Add element at the end
+     * @complexity O(1)
+     */
+    void push_back(const T& value) { emplace_back_impl(value); }
+    void push_back(T&& value) { emplace_back_impl(std::move(value)); }
+
+    /**
+     * @brief Remove the first element
+     * @throws std::out_of_range if the list is empty
+     */
+    void pop_front();
+
+    /**
+     * @brief Remove the last element
+     * @throws std::out_of_range if the list is empty
+     */
+    void pop_back();
+
+    /**
+     * @brief Insert element before index
+     * @param index Position to insert at (0..size())
+     * @param value Value to insert
+     * @throws std::out_of_range if index > size()
+     * @complexity O(n / B + B)
+     */
+    void insert(size_type index, const T& value) { insert_impl(index, value); }
+    void insert(size_type index, T&& value) { insert_impl(index, std::move(value)); }
+
+    /**
+     * @brief Remove element at index
+     * @throws std::out_of_range if index >= size()
+     * @complexity O(n / B + B)
+     */
+    void erase(size_type index);
+
+    /**
+     * @brief Move all elements of other before index, leaving other empty
+     * @param index Position to splice at (0..size())
+     * @param other List to take the nodes of
+     * @throws std::out_of_range if index > size()
+     * @throws std::invalid_argument if other is *this
+     * @complexity O(n / B) to find index; O(1) relinking at a node boundary
+     *             (index 0, size(), or the first element of a node), plus
+     *             an O(B) split otherwise. Elements are moved one by one
+     *             only when the allocators differ.
+     */
+    void splice(size_type index, UnrolledLinkedList& other);
+
+    /**
+     * @brief Resize the list, default-inserting or popping at the back
+     */
+    void resize(size_type count);
+    void resize(size_type count, const T& value);
+
+    /**
+     * @brief Swap contents with another list
+     */
+    void swap(UnrolledLinkedList& other) noexcept;
+
+    /**
+     * @brief Remove all elements equal to value
+     * @return Number of elements removed
+     * @complexity O(n)
+     */
+    size_type remove(const T& value);
+
+    /**
+     * @brief Find the first occurrence of value
+     * @return Index of the element, or size() if not found
+     */
+    size_type find(const T& value) const;
+
+    /**
+     * @brief Check if the list contains value
+     */
+    bool contains(const T& value) const { return find(value) != m_size; }
+
+private:
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    static constexpr size_type MERGE_THRESHOLD = NodeCapacity / 2;
+
+    /**
+     * @struct Position
+     * @brief Node holding an element and the element's offset in it
+     */
+    struct Position {
+        Node* node;
+        size_type offset;
+    };
+
+    Node* m_head;          ///< Pointer to first node
+    Node* m_tail;          ///< Pointer to last node
+    size_type m_size;      ///< Current number of elements
+    size_type m_nodes;     ///< Current number of nodes
+    NodeAllocator m_alloc; ///< Node allocator
+
+    /**
+     * @brief Find the node and offset of element index (index < size())
+     *
+     * Walks from the nearer end and skips whole nodes by their count.
+     */
+    Position locate(size_type index) const noexcept;
+
+    Node* create_node();
+    void destroy_node(Node* node) noexcept;
+
+    /**
+     * @brief Link node after pos (pos == nullptr links it as the new head)
+     */
+    void link_after(Node* pos, Node* node) noexcept;
+
+    /**
+     * @brief Unlink and free an empty node
+     */
+    void unlink(Node* node) noexcept;
+
+    /**
+     * @brief Move elements [offset, count) of node into a new node linked after it
+     * @return The new node
+     */
+    Node* split(Node* node, size_type offset);
+
+    /**
+     * @brief Merge node with a neighbour if it is under half full and both fit
+     */
+    void rebalance(Node* node) noexcept;
+
+    /**
+     * @brief Construct value at offset of a non-full node, shifting the tail right
+     */
+    void insert_in_node(Node* node, size_type offset, T&& value);
+
+    /**
+     * @brief Destroy the element at offset, shifting the tail left
+     */
+    void erase_in_node(Node* node, size_type offset) noexcept;
+
+    template <typename U>
+    void emplace_back_impl(U&& value);
+
+    template <typename U>
+    void emplace_front_impl(U&& value);
+
+    template <typename U>
+    void insert_impl(size_type index, U&& value);
+
+    void reset() noexcept {
+        m_head = nullptr;
+        m_tail = nullptr;
+        m_size = 0;
+        m_nodes = 0;
+    }
+};
+
+/**
+ * @brief Swap two unrolled lists
+ */
+template <typename T, std::size_t B, typename Allocator>
+void swap(UnrolledLinkedList<T, B, Allocator>& lhs, UnrolledLinkedList<T, B, Allocator>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+// ============================================
+// Implementation
+// ============================================
+
+template <typename T, std::size_t B, typename Allocator>
+UnrolledLinkedList<T, B, Allocator>&
+UnrolledLinkedList<T, B, Allocator>::operator=(const UnrolledLinkedList& other) {
+    if (this != &other) {
+        UnrolledLinkedList temp(other);
+        clear();
+        if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+            m_alloc = other.m_alloc;
+        }
+        splice(0, temp);
+    }
+    return *this;
+}
+
+template <typename T, std::size_t B, typename Allocator>
+UnrolledLinkedList<T, B, Allocator>&
+UnrolledLinkedList<T, B, Allocator>::operator=(UnrolledLinkedList&& other) noexcept(
+    std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value) {
+    if (this != &other) {
+        clear();
+        if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+            m_alloc = std::move(other.m_alloc);
+        } else if (!(m_alloc == other.m_alloc)) {
+            // Nodes cannot change allocators: move element by element
+            for (T& value : other) {
+                push_back(std::move(value));
+            }
+            other.clear();
+            return *this;
+        }
+        m_head = other.m_head;
+        m_tail = other.m_tail;
+        m_size = other.m_size;
+        m_nodes = other.m_nodes;
+        other.reset();
+    }
+    return *this;
+}
+
+template <typename T, std::size_t B, typename Allocator>
+typename UnrolledLinkedList<T, B, Allocator>::reference
+UnrolledLinkedList<T, B, Allocator>::at(size_type index) {
+    if (index >= m_size) {
+        throw std::out_of_range("UnrolledLinkedList::at: index out of range");
+    }
+    return (*this)[index];
+}
+
+template <typename T, std::size_t B, typename Allocator>
+typename UnrolledLinkedList<T, B, Allocator>::const_reference
+UnrolledLinkedList<T, B, Allocator>::at(size_type index) const {
+    if (index >= m_size) {
+        throw std::out_of_range("UnrolledLinkedList::at: index out of range");
+    }
+    return (*this)[index];
+}
+
+template <typename T, std::size_t B, typename Allocator>
+typename UnrolledLinkedList<T, B, Allocator>::reference
+UnrolledLinkedList<T, B, Allocator>::front() {
+    if (empty()) {
+        throw std::out_of_range("UnrolledLinkedList::front: list is empty");
+    }
+    return m_head->elements()[0];
+}
+
+template <typename T, std::size_t B, typename Allocator>
+typename UnrolledLinkedList<T, B, Allocator>::const_reference
+UnrolledLinkedList<T, B, Allocator>::front() const {
+    if (empty()) {
+        throw std::out_of_range("UnrolledLinkedList::front: list is empty");
+    }
+    return m_head->elements()[0];
+}
+
+template <typename T, std::size_t B, typename Allocator>
+typename UnrolledLinkedList<T, B, Allocator>::reference
+UnrolledLinkedList<T, B, Allocator>::back() {
+    if (empty()) {
+        throw std::out_of_range("UnrolledLinkedList::back: list is empty");
+    }
+    return m_tail->elements()[m_tail->count - 1];
+}
+
+template <typename T, std::size_t B, typename Allocator>
+typename UnrolledLinkedList<T, B, Allocator>::const_reference
+UnrolledLinkedList<T, B, Allocator>::back() const {
+    if (empty()) {
+        throw std::out_of_range("UnrolledLinkedList::back: list is empty");
+    }
+    return m_tail->elements()[m_tail->count - 1];
+}
+
+template <typename T, std::size_t B, typename Allocator>
+void UnrolledLinkedList<T, B, Allocator>::clear() noexcept {
+    Node* current = m_head;
+    while (current) {
+        Node* next = current->next;
+        std::destroy_n(current->elements(), current->count);
+        destroy_node(current);
+        current = next;
+    }
+    reset();
+}
+
+template <typename T, std::size_t B, typename Allocator>
+void UnrolledLinkedList<T, B, Allocator>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("UnrolledLinkedList::pop_front: list is empty");
+    }
+    Node* node = m_head;
+    erase_in_node(node, 0);
+    --m_size;
+    if (node->count == 0) {
+        unlink(node);
+    }
+}
+
+template <typename T, std::size_t B, typename Allocator>
+void UnrolledLinkedList<T, B, Allocator>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("UnrolledLinkedList::pop_back: list is empty");
+    }
+    Node* node = m_tail;
+    std::destroy_at(node->elements() + node->count - 1);
+    --node->count;
+    --m_size;
+    if (node->count == 0) {
+        unlink(node);
+    }
+}
+
+template <typename T, std::size_t B, typename Allocator>
+void UnrolledLinkedList<T, B, Allocator>::erase(size_type index) {
+    if (index >= m_size) {
+        throw std::out_of_range("UnrolledLinkedList::erase: index out of range");
+    }
+    Position position = locate(index);
+    erase_in_node(position.node, position.offset);
+    --m_size;
+    if (position.node->count == 0) {
+        unlink(position.node);
+    } else {
+        rebalance(position.node);
+    }
+}
+
+template <typename T, std::size_t B, typename Allocator>
+void UnrolledLinkedList<T, B, Allocator>::splice(size_type index, UnrolledLinkedList& other) {
+    if (&other == this) {
+        throw std::invalid_argument("UnrolledLinkedList::splice: cannot splice a list into itself");
+    }
+    if (index > m_size) {
+        throw std::out_of_range("UnrolledLinkedList::splice: index out of range");
+    }
+    if (other.empty()) {
+        return;
+    }
+    if (!(m_alloc == other.m_alloc)) {
+        // Nodes cannot change allocators: move element by element
+        for (T& value : other) {
+            insert(index++, std::move(value));
+        }
+        other.clear();
+        return;
+    }
+
+    // Find the node the spliced run goes after (nullptr = before the head)
+    Node* before;
+    if (index == m_size) {
+        before = m_tail;
+    } else if (index == 0) {
+        before = nullptr;
+    } else {
+        Position position = locate(index);
+        if (position.offset == 0) {
+            before = position.node->prev;
+        } else {
+            split(position.node, position.offset);
+            before = position.node;
+        }
+    }
+
+    Node* after = before ? before->next : m_head;
+    other.m_head->prev = before;
+    other.m_tail->next = after;
+    if (before) {
+        before->next = other.m_head;
+    } else {
+        m_head = other.m_head;
+    }
+    if (after) {
+        after->prev = other.m_tail;
+    } else {
+        m_tail = other.m_tail;
+    }
+    m_size += other.m_size;
+    m_nodes += other.m_nodes;
+    other.reset();
+}
+
+template <typename T, std::size_t B, typename Allocator>
+void UnrolledLinkedList<T, B, Allocator>::resize(size_type count) {
+    while (m_size > count) {
+        pop_back();
+    }
+    while (m_size < count) {
+        emplace_back_impl(T());
+    }
+}
+
+template <typename T, std::size_t B, typename Allocator>
+void UnrolledLinkedList<T, B, Allocator>::resize(size_type count, const T& value) {
+    while (m_size > count) {
+        pop_back();
+    }
+    while (m_size < count) {
+        push_back(value);
+    }
+}
+
+template <typename T, std::size_t B, typename Allocator>
+void UnrolledLinkedList<T, B, Allocator>::swap(UnrolledLinkedList& other) noexcept {
+    std::swap(m_head, other.m_head);
+    std::swap(m_tail, other.m_tail);
+    std::swap(m_size, other.m_size);
+    std::swap(m_nodes, other.m_nodes);
+    if constexpr (NodeTraits::propagate_on_container_swap::value) {
+        std::swap(m_alloc, other.m_alloc);
+    }
+}
+
+template <typename T, std::size_t B, typename Allocator>
+typename UnrolledLinkedList<T, B, Allocator>::size_type
+UnrolledLinkedList<T, B, Allocator>::remove(const T& value) {
+    // value may be an element of this list, which the compaction overwrites
+    const T target(value);
+    size_type removed_count = 0;
+    Node* current = m_head;
+    while (current) {
+        Node* next = current->next;
+        T* first = current->elements();
+        T* last = first + current->count;
+        T* kept = std::remove(first, last, target);
+        size_type removed = static_cast<size_type>(last - kept);
+        if (removed > 0) {
+            std::destroy(kept, last);
+            current->count -= removed;
+            m_size -= removed;
+            removed_count += removed;
+            if (current->count == 0) {
+                unlink(current);
+            }
+        }
+        current = next;
+    }
+    return removed_count;
+}
+
+template <typename T, std::size_t B, typename Allocator>
+typename UnrolledLinkedList<T, B, Allocator>::size_type
+UnrolledLinkedList<T, B, Allocator>::find(const T& value) const {
+    size_type index = 0;
+    for (const Node* current = m_head; current; current = current->next) {
+        const T* elements = current->elements();
+        for (size_type i = 0; i < current->count; ++i) {
+            if (elements[i] == value) {
+                return index + i;
+            }
+        }
+        index += current->count;
+    }
+    return m_size;
+}
+
+// Private helper methods
+
+template <typename T, std::size_t B, typename Allocator>
+typename UnrolledLinkedList<T, B, Allocator>::Position
+UnrolledLinkedList<T, B, Allocator>::locate(size_type index) const noexcept {
+    Node* current;
+    if (index < m_size / 2) {
+        current = m_head;
+        while (index >= current->count) {
+            index -= current->count;
+            current = current->next;
+        }
+        return {current, index};
+    }
+    // Count from the back: the element is remaining-th from the end
+    size_type remaining = m_size - index;
+    current = m_tail;
+    while (remaining > current->count) {
+        remaining -= current->count;
+        current = current->prev;
+    }
+    return {current, current->count - remaining};
+}
+
+template <typename T, std::size_t B, typename Allocator>
+typename UnrolledLinkedList<T, B, Allocator>::Node*
+UnrolledLinkedList<T, B, Allocator>::create_node() {
+    Node* node = NodeTraits::allocate(m_alloc, 1);
+    NodeTraits::construct(m_alloc, node);
+    return node;
+}
+
+template <typename T, std::size_t B, typename Allocator>
+void UnrolledLinkedList<T, B, Allocator>::destroy_node(Node* node) noexcept {
+    NodeTraits::destroy(m_alloc, node);
+    NodeTraits::deallocate(m_alloc, node, 1);
+}
+
+template <typename T, std::size_t B, typename Allocator>
+void UnrolledLinkedList<T, B, Allocator>::link_after(Node* pos, Node* node) noexcept {
+    Node* next = pos ? pos->next : m_head;
+    node->prev = pos;
+    node->next = next;
+    if (pos) {
+        pos->next = node;
+    } else {
+        m_head = node;
+    }
+    if (next) {
+        next->prev = node;
+    } else {
+        m_tail = node;
+    }
+    ++m_nodes;
+}
+
+template <typename T, std::size_t B, typename Allocator>
+void UnrolledLinkedList<T, B, Allocator>::unlink(Node* node) noexcept {
+    if (node->prev) {
+        node->prev->next = node->next;
+    } else {
+        m_head = node->next;
+    }
+    if (node->next) {
+        node->next->prev = node->prev;
+    } else {
+        m_tail = node->prev;
+    }
+    destroy_node(node);
+    --m_nodes;
+}
+
+template <typename T, std::size_t B, typename Allocator>
+typename UnrolledLinkedList<T, B, Allocator>::Node*
+UnrolledLinkedList<T, B, Allocator>::split(Node* node, size_type offset) {
+    Node* fresh = create_node();
+    size_type moved = node->count - offset;
+    try {
+        std::uninitialized_move_n(node->elements() + offset, moved, fresh->elements());
+    } catch (...) {
+        destroy_node(fresh);
+        throw;
+    }
+    std::destroy_n(node->elements() + offset, moved);
+    node->count = offset;
+    fresh->count = moved;
+    link_after(node, fresh);
+    return fresh;
+}
+
+template <typename T, std::size_t B, typename Allocator>
+void UnrolledLinkedList<T, B, Allocator>::rebalance(Node* node) noexcept {
+    if (node->count >= MERGE_THRESHOLD) {
+        return;
+    }
+    // Merge the later node of a pair into the earlier one
+    Node* left = node;
+    Node* right = node->next;
+    if (!right || left->count + right->count > B) {
+        right = node;
+        left = node->prev;
+        if (!left || left->count + right->count > B) {
+            return;
+        }
+    }
+    if constexpr (!std::is_nothrow_move_constructible_v<T>) {
+        // A throwing move would leave the pair half-merged; keep them apart
+        return;
+    } else {
+        std::uninitialized_move_n(right->elements(), right->count, left->elements() + left->count);
+        std::destroy_n(right->elements(), right->count);
+        left->count += right->count;
+        right->count = 0;
+        unlink(right);
+    }
+}
+
+template <typename T, std::size_t B, typename Allocator>
+void UnrolledLinkedList<T, B, Allocator>::insert_in_node(Node* node, size_type offset, T&& value) {
+    T* elements = node->elements();
+    size_type count = node->count;
+    if (offset == count) {
+        ::new (static_cast<void*>(elements + offset)) T(std::move(value));
+        ++node->count;
+        return;
+    }
+    ::new (static_cast<void*>(elements + count)) T(std::move(elements[count - 1]));
+    ++node->count;
+    std::move_backward(elements + offset, elements + count - 1, elements + count);
+    elements[offset] = std::move(value);
+}
+
+template <typename T, std::size_t B, typename Allocator>
+void UnrolledLinkedList<T, B, Allocator>::erase_in_node(Node* node, size_type offset) noexcept {
+    T* elements = node->elements();
+    std::move(elements + offset + 1, elements + node->count, elements + offset);
+    std::destroy_at(elements + node->count - 1);
+    --node->count;
+}
+
+template <typename T, std::size_t B, typename Allocator>
+template <typename U>
+void UnrolledLinkedList<T, B, Allocator>::emplace_back_impl(U&& value) {
+    Node* node = m_tail;
+    bool fresh = !node || node->count == B;
+    if (fresh) {
+        node = create_node();
+    }
+    try {
+        ::new (static_cast<void*>(node->elements() + node->count)) T(std::forward<U>(value));
+    } catch (...) {
+        if (fresh) {
+            destroy_node(node);
+        }
+        throw;
+    }
+    if (fresh) {
+        link_after(m_tail, node);
+    }
+    ++node->count;
+    ++m_size;
+}
+
+template <typename T, std::size_t B, typename Allocator>
+template <typename U>
+void UnrolledLinkedList<T, B, Allocator>::emplace_front_impl(U&& value) {
+    if (!m_head || m_head->count == B) {
+        Node* node = create_node();
+        try {
+            ::new (static_cast<void*>(node->elements())) T(std::forward<U>(value));
+        } catch (...) {
+            destroy_node(node);
+            throw;
+        }
+        node->count = 1;
+        link_after(nullptr, node);
+    } else {
+        // value may refer to an element of the head node, which is about to shift
+        T item(std::forward<U>(value));
+        insert_in_node(m_head, 0, std::move(item));
+    }
+    ++m_size;
+}
+
+template <typename T, std::size_t B, typename Allocator>
+template <typename U>
+void UnrolledLinkedList<T, B, Allocator>::insert_impl(size_type index, U&& value) {
+    if (index > m_size) {
+        throw std::out_of_range("UnrolledLinkedList::insert: index out of range");
+    }
+    if (index == m_size) {
+        emplace_back_impl(std::forward<U>(value));
+        return;
+    }
+
+    // value may refer to an element that a shift or split is about to move
+    T item(std::forward<U>(value));
+    Position position = locate(index);
+    Node* node = position.node;
+    size_type offset = position.offset;
+    if (node->count == B) {
+        if (offset == 0 && node->prev && node->prev->count < B) {
+            // Append to the previous node instead of splitting this one
+            node = node->prev;
+            offset = node->count;
+        } else {
+            Node* upper = split(node, B / 2);
+            if (offset > B / 2) {
+                node = upper;
+                offset -= B / 2;
+            }
+        }
+    }
+    insert_in_node(node, offset, std::move(item));
+    ++m_size;
+}
+
+} // namespace linear
+} // namespace mylib
+
+#endif // MYLIB_LINEAR_UNROLLED_LINKED_LIST_HPP
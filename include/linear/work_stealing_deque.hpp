@@ -0,0 +1,206 @@
+/**
+ * @file work_stealing_deque.hpp
+ * @brief Chase-Lev work-stealing deque for task schedulers
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ *
+ * A deque with one owner thread and any number of thieves:
+ * - The owner pushes and pops at the bottom (LIFO) without locks or CAS,
+ *   except when racing a thief for the last element.
+ * - Thieves take from the top (FIFO) with a single CAS on the top index.
+ *
+ * This is the per-worker queue of a work-stealing scheduler: a worker runs
+ * its newest (cache-hot) tasks, idle workers steal the oldest (usually the
+ * largest) ones. The algorithm follows Chase & Lev, "Dynamic Circular
+ * Work-Stealing Deque" (SPAA 2005), with the C11 memory orderings of Lê et
+ * al. (PPoPP 2013).
+ *
+ * The ring grows when full. Old rings are kept until the deque is
+ * destroyed, because a thief may still be reading from one.
+ *
+ * Elements are stored in std::atomic<T>, so T must be trivially copyable;
+ * schedulers store task pointers.
+ *
+ * Time Complexity:
+ * - push: O(1) amortized
+ * - pop, steal: O(1)
+ *
+ * Copyright (c) 2026 Jinhyeok
+ * MIT License
+ */
+
+#ifndef MYLIB_LINEAR_WORK_STEALING_DEQUE_HPP
+#define MYLIB_LINEAR_WORK_STEALING_DEQUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace mylib {
+namespace linear {
+
+/**
+ * @class WorkStealingDeque
+ * @brief Unbounded single-owner, multi-thief deque
+ *
+ * push() and pop() may only be called by the owner thread. steal(),
+ * size_approx() and empty() may be called from any thread.
+ *
+ * @tparam T Element type (trivially copyable, e.g. a task pointer)
+ */
+template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "WorkStealingDeque: T must be trivially copyable");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    static constexpr size_type DEFAULT_CAPACITY = 256;
+
+    /**
+     * @brief Construct an empty deque
+     * @param capacity Initial ring size (rounded up to a power of two)
+     * @throws std::invalid_argument if capacity is 0
+     */
+    explicit WorkStealingDeque(size_type capacity = DEFAULT_CAPACITY) {
+        if (capacity == 0) {
+            throw std::invalid_argument("WorkStealingDeque: capacity must be positive");
+        }
+        size_type rounded = 2;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        m_rings.push_back(std::make_unique<Ring>(rounded));
+        m_ring.store(m_rings.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Push at the bottom (owner only)
+     */
+    void push(T value) {
+        std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        std::int64_t top = m_top.load(std::memory_order_acquire);
+        Ring* ring = m_ring.load(std::memory_order_relaxed);
+        if (bottom - top >= static_cast<std::int64_t>(ring->capacity)) {
+            ring = grow(ring, top, bottom);
+        }
+        ring->put(bottom, value);
+        m_bottom.store(bottom + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Pop the newest element from the bottom (owner only)
+     * @return The element, or nullopt if empty (or the last one was stolen)
+     */
+    std::optional<T> pop() {
+        std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        Ring* ring = m_ring.load(std::memory_order_relaxed);
+        m_bottom.store(bottom, std::memory_order_seq_cst);
+        std::int64_t top = m_top.load(std::memory_order_seq_cst);
+
+        if (top > bottom) {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+        T value = ring->get(bottom);
+        if (top == bottom) {
+            // Last element: race thieves for it
+            bool won = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                     std::memory_order_relaxed);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            if (!won) {
+                return std::nullopt;
+            }
+        }
+        return value;
+    }
+
+    /**
+     * @brief Take the oldest element from the top (any thread)
+     * @return The element, or nullopt if empty or another thread won the race
+     */
+    std::optional<T> steal() {
+        std::int64_t top = m_top.load(std::memory_order_seq_cst);
+        std::int64_t bottom = m_bottom.load(std::memory_order_seq_cst);
+        if (top >= bottom) {
+            return std::nullopt;
+        }
+        Ring* ring = m_ring.load(std::memory_order_acquire);
+        T value = ring->get(top);
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                           std::memory_order_relaxed)) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    /** @brief Snapshot of the number of elements */
+    size_type size_approx() const noexcept {
+        std::int64_t bottom = m_bottom.load(std::memory_order_acquire);
+        std::int64_t top = m_top.load(std::memory_order_acquire);
+        return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+    }
+
+    /** @brief Snapshot of emptiness */
+    bool empty() const noexcept { return size_approx() == 0; }
+
+    /** @brief Current ring size (owner only) */
+    size_type capacity() const noexcept {
+        return m_ring.load(std::memory_order_relaxed)->capacity;
+    }
+
+private:
+    /**
+     * @brief Power-of-two circular array indexed by the monotonic top/bottom
+     */
+    struct Ring {
+        explicit Ring(size_type cap)
+            : capacity(cap), mask(cap - 1), slots(new std::atomic<T>[cap]) {}
+
+        T get(std::int64_t index) const noexcept {
+            return slots[static_cast<size_type>(index) & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(std::int64_t index, T value) noexcept {
+            slots[static_cast<size_type>(index) & mask].store(value, std::memory_order_relaxed);
+        }
+
+        size_type capacity;
+        size_type mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+    };
+
+    /**
+     * @brief Double the ring, copying the live range [top, bottom)
+     */
+    Ring* grow(Ring* old, std::int64_t top, std::int64_t bottom) {
+        m_rings.push_back(std::make_unique<Ring>(old->capacity * 2));
+        Ring* ring = m_rings.back().get();
+        for (std::int64_t i = top; i < bottom; ++i) {
+            ring->put(i, old->get(i));
+        }
+        m_ring.store(ring, std::memory_order_release);
+        return ring;
+    }
+
+    alignas(64) std::atomic<std::int64_t> m_top{0};       ///< Next index to steal
+    alignas(64) std::atomic<std::int64_t> m_bottom{0};    ///< Next index to push
+    std::atomic<Ring*> m_ring{nullptr};                   ///< Current ring
+    std::vector<std::unique_ptr<Ring>> m_rings;           ///< Current and retired rings (owner only)
+};
+
+} // namespace linear
+} // namespace mylib
+
+#endif // MYLIB_LINEAR_WORK_STEALING_DEQUE_HPP
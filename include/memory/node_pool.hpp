@@ -0,0 +1,318 @@
+/**
+ * @file node_pool.hpp
+ * @brief Slab-backed node pool and a standard allocator on top of it
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ *
+ * Node-based containers (LinkedList, the trees, SkipList, Trie and the
+ * HashTable buckets) allocate one node per element. With the default
+ * std::allocator every insert is a malloc and every erase a free, and
+ * dropping a container frees its nodes one by one.
+ *
+ * NodePool carves small blocks out of large slabs:
+ * - allocate(): pop the free list of the block's size class, else bump a
+ *   pointer in the current slab
+ * - deallocate(): push onto that intrusive free list (no call into malloc)
+ * - release(): return every slab at once, O(slabs) instead of O(nodes)
+ *
+ * PoolAllocator<T> is a standard allocator that hands node allocations to a
+ * shared NodePool. Pass it as the Allocator template argument of a container:
+ * @code
+ * LinkedList<int, memory::PoolAllocator<int>> list;
+ * RedBlackTree<long, std::less<long>, memory::PoolAllocator<long>> tree;
+ * @endcode
+ *
+ * Bulk release: when a container's allocator is the only owner of its pool
+ * and its nodes are trivially destructible, clear() and the destructor skip
+ * the node walk and free all slabs through release(). Otherwise nodes are
+ * destroyed one by one and go back to the free list. bulk_release_traits
+ * lets containers ask for this without knowing the allocator type;
+ * std::allocator never supports it.
+ *
+ * Sharing: copies of a PoolAllocator share the pool and compare equal, so
+ * several containers built from the same allocator draw from one pool.
+ * Copying a container gives the copy a fresh pool. A pool is not
+ * thread-safe; containers sharing one must be used from one thread.
+ *
+ * Copyright (c) 2026 Jinhyeok
+ * MIT License
+ */
+
+#ifndef MYLIB_MEMORY_NODE_POOL_HPP
+#define MYLIB_MEMORY_NODE_POOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace mylib {
+namespace memory {
+
+// ============================================
+// NodePool
+// ============================================
+
+/**
+ * @class NodePool
+ * @brief Small-block pool carved from growing slabs
+ *
+ * Block sizes are rounded up to a multiple of GRANULE (one pointer), and
+ * each rounded size has its own free list, so nodes and small per-node
+ * arrays (e.g. SkipList towers) share the slabs. Requests larger than
+ * MAX_BLOCK_BYTES or aligned beyond GRANULE are refused (accepts() returns
+ * false) and left to the caller.
+ */
+class NodePool {
+public:
+    using size_type = std::size_t;
+
+    static constexpr size_type GRANULE = sizeof(void*);           ///< Block size/alignment unit
+    static constexpr size_type MAX_BLOCK_BYTES = 256;             ///< Largest pooled block
+    static constexpr size_type FIRST_SLAB_BYTES = 4096;           ///< Size of the first slab
+    static constexpr size_type MAX_SLAB_BYTES = 1024 * 1024;      ///< Slabs stop doubling here
+
+    NodePool() noexcept = default;
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    ~NodePool() { release(); }
+
+    /**
+     * @brief Check whether a block of this size/alignment comes from the pool
+     * @param bytes Block size in bytes
+     * @param align Required alignment
+     * @return true if allocate(bytes) may be used
+     */
+    static constexpr bool accepts(size_type bytes, size_type align) noexcept {
+        return bytes <= MAX_BLOCK_BYTES && align <= GRANULE && GRANULE % align == 0;
+    }
+
+    /**
+     * @brief Allocate one block
+     * @param bytes Block size (must satisfy accepts())
+     * @return Uninitialized, GRANULE-aligned storage
+     * @throws std::bad_alloc if a new slab cannot be allocated
+     */
+    void* allocate(size_type bytes) {
+        size_type cls = size_class(bytes);
+        if (FreeBlock* block = m_free[cls]) {
+            m_free[cls] = block->next;
+            ++m_in_use;
+            return block;
+        }
+        size_type block_bytes = cls * GRANULE;
+        if (static_cast<size_type>(m_end - m_cursor) < block_bytes) {
+            grow();
+        }
+        void* block = m_cursor;
+        m_cursor += block_bytes;
+        ++m_in_use;
+        return block;
+    }
+
+    /**
+     * @brief Return one block to its free list
+     * @param p Block obtained from allocate()
+     * @param bytes Size passed to allocate()
+     */
+    void deallocate(void* p, size_type bytes) noexcept {
+        size_type cls = size_class(bytes);
+        FreeBlock* block = static_cast<FreeBlock*>(p);
+        block->next = m_free[cls];
+        m_free[cls] = block;
+        --m_in_use;
+    }
+
+    /**
+     * @brief Free every slab at once
+     *
+     * All blocks handed out become invalid. Objects living in them are not
+     * destroyed; the caller must have done so if needed.
+     */
+    void release() noexcept {
+        for (char* slab : m_slabs) {
+            ::operator delete(slab);
+        }
+        m_slabs.clear();
+        for (FreeBlock*& head : m_free) {
+            head = nullptr;
+        }
+        m_cursor = m_end = nullptr;
+        m_next_slab_bytes = FIRST_SLAB_BYTES;
+        m_in_use = 0;
+    }
+
+    /** @brief Number of blocks currently handed out */
+    size_type in_use() const noexcept { return m_in_use; }
+
+    /** @brief Number of slabs owned */
+    size_type slab_count() const noexcept { return m_slabs.size(); }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    static constexpr size_type CLASS_COUNT = MAX_BLOCK_BYTES / GRANULE + 1;
+
+    static size_type size_class(size_type bytes) noexcept {
+        size_type cls = (bytes + GRANULE - 1) / GRANULE;
+        return cls == 0 ? 1 : cls;
+    }
+
+    static_assert(FIRST_SLAB_BYTES >= MAX_BLOCK_BYTES, "a slab must fit the largest block");
+
+    /**
+     * @brief Start a new slab (the unused tail of the current one is abandoned)
+     */
+    void grow() {
+        size_type bytes = m_next_slab_bytes;
+        m_slabs.reserve(m_slabs.size() + 1);
+        char* slab = static_cast<char*>(::operator new(bytes));
+        m_slabs.push_back(slab);
+        m_cursor = slab;
+        m_end = slab + bytes;
+        if (m_next_slab_bytes < MAX_SLAB_BYTES) {
+            m_next_slab_bytes *= 2;
+        }
+    }
+
+    std::vector<char*> m_slabs;                   ///< Owned slabs
+    FreeBlock* m_free[CLASS_COUNT] = {};          ///< Free list per size class
+    char* m_cursor = nullptr;                     ///< Next unused byte in the current slab
+    char* m_end = nullptr;                        ///< End of the current slab
+    size_type m_next_slab_bytes = FIRST_SLAB_BYTES;
+    size_type m_in_use = 0;                       ///< Blocks handed out
+};
+
+// ============================================
+// PoolAllocator
+// ============================================
+
+/**
+ * @class PoolAllocator
+ * @brief Standard allocator serving single-object allocations from a NodePool
+ *
+ * Allocations the pool does not accept (larger than
+ * NodePool::MAX_BLOCK_BYTES, or over-aligned) go to ::operator new, so the
+ * allocator also works inside containers that allocate more than nodes.
+ *
+ * @tparam T Value type
+ */
+template <typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    template <typename U>
+    struct rebind {
+        using other = PoolAllocator<U>;
+    };
+
+    /**
+     * @brief Create an allocator with its own, empty pool
+     */
+    PoolAllocator() : m_pool(std::make_shared<NodePool>()) {}
+
+    /**
+     * @brief Create an allocator drawing from an existing pool
+     * @param pool Pool to share
+     */
+    explicit PoolAllocator(std::shared_ptr<NodePool> pool) noexcept
+        : m_pool(std::move(pool)) {}
+
+    // Copies (and moves) share the pool; a moved-from allocator stays usable
+    PoolAllocator(const PoolAllocator& other) noexcept = default;
+    PoolAllocator& operator=(const PoolAllocator& other) noexcept = default;
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept
+        : m_pool(other.pool()) {}
+
+    T* allocate(size_type n) {
+        if (n <= NodePool::MAX_BLOCK_BYTES / sizeof(T) &&
+            NodePool::accepts(n * sizeof(T), alignof(T))) {
+            return static_cast<T*>(m_pool->allocate(n * sizeof(T)));
+        }
+        if (n > static_cast<size_type>(-1) / sizeof(T)) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_type n) noexcept {
+        if (n <= NodePool::MAX_BLOCK_BYTES / sizeof(T) &&
+            NodePool::accepts(n * sizeof(T), alignof(T))) {
+            m_pool->deallocate(p, n * sizeof(T));
+        } else {
+            ::operator delete(p);
+        }
+    }
+
+    /**
+     * @brief Copying a container gives the copy its own pool
+     */
+    PoolAllocator select_on_container_copy_construction() const {
+        return PoolAllocator();
+    }
+
+    /** @brief Shared pool */
+    const std::shared_ptr<NodePool>& pool() const noexcept { return m_pool; }
+
+    friend bool operator==(const PoolAllocator& a, const PoolAllocator& b) noexcept {
+        return a.m_pool == b.m_pool;
+    }
+
+    friend bool operator!=(const PoolAllocator& a, const PoolAllocator& b) noexcept {
+        return !(a == b);
+    }
+
+private:
+    std::shared_ptr<NodePool> m_pool;
+};
+
+// ============================================
+// Bulk release
+// ============================================
+
+/**
+ * @brief How a container may drop all of its nodes at once
+ *
+ * exclusive(alloc) is true when every block the allocator can reach belongs
+ * to the calling container and lives in its pool; release(alloc) then frees
+ * them in bulk. Blocks the pool refuses (see NodePool::accepts()) come from
+ * ::operator new and are not freed by release(), so an allocator whose T is
+ * such a block never qualifies. A container that also allocates other
+ * blocks through a rebound allocator (e.g. SkipList towers) must check
+ * those sizes itself. Allocators without a pool never qualify.
+ */
+template <typename Alloc>
+struct bulk_release_traits {
+    static bool exclusive(const Alloc&) noexcept { return false; }
+    static void release(Alloc&) noexcept {}
+};
+
+template <typename T>
+struct bulk_release_traits<PoolAllocator<T>> {
+    static bool exclusive(const PoolAllocator<T>& alloc) noexcept {
+        return NodePool::accepts(sizeof(T), alignof(T)) && alloc.pool().use_count() == 1;
+    }
+    static void release(PoolAllocator<T>& alloc) noexcept {
+        alloc.pool()->release();
+    }
+};
+
+} // namespace memory
+} // namespace mylib
+
+#endif // MYLIB_MEMORY_NODE_POOL_HPP
@@ -30,10 +30,13 @@
 #define MYLIB_TREE_BINARY_SEARCH_TREE_HPP
 
 #include <cstddef>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <initializer_list>
 #include <functional>
+#include "memory/node_pool.hpp"
 
 namespace mylib {
 namespace tree {
@@ -47,9 +50,13 @@ namespace tree {
  * larger values. Provides O(log n) average case for search, insert,
  * and delete operations.
  * 
+ * Nodes are obtained from Allocator (rebound to the node type); see
+ * memory::PoolAllocator for slab allocation with bulk release.
+ * 
  * @tparam T The type of elements stored in the tree (must be comparable)
+ * @tparam Allocator Allocator for elements (default: std::allocator<T>)
  */
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class BinarySearchTree {
 private:
     /**
@@ -82,6 +89,7 @@ public:
     using size_type = std::size_t;
     using reference = T&;
     using const_reference = const T&;
+    using allocator_type = Allocator;
 
     /**
      * @brief Default constructor
@@ -89,6 +97,12 @@ public:
      */
     BinarySearchTree();
 
+    /**
+     * @brief Construct an empty tree using the given allocator
+     * @param alloc Allocator to draw nodes from
+     */
+    explicit BinarySearchTree(const Allocator& alloc);
+
     /**
      * @brief Initializer list constructor
      * @param init Initializer list of elements to insert
@@ -126,6 +140,12 @@ public:
      */
     BinarySearchTree& operator=(BinarySearchTree&& other) noexcept;
 
+    /**
+     * @brief Get a copy of the allocator
+     * @return Allocator used for nodes, rebound to T
+     */
+    allocator_type get_allocator() const;
+
     // Capacity
     /**
      * @brief Check if tree is empty
@@ -256,8 +276,32 @@ public:
     bool is_valid() const;
 
 private:
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+    using BulkRelease = memory::bulk_release_traits<NodeAllocator>;
+
     Node* m_root;         ///< Pointer to root node
     size_type m_size;     ///< Current number of elements
+    NodeAllocator m_alloc; ///< Node allocator
+
+    /**
+     * @brief Allocate and construct a node
+     * @param value Value to store (forwarded)
+     * @return Pointer to the new leaf node
+     */
+    template <typename U>
+    Node* create_node(U&& value);
+
+    /**
+     * @brief Destroy and deallocate a node
+     * @param node Node to free
+     */
+    void destroy_node(Node* node) noexcept;
+
+    /**
+     * @brief Free the whole tree, in bulk when the allocator allows it
+     */
+    void destroy_all() noexcept;
 
     // Helper functions for recursive operations
     
@@ -319,7 +363,7 @@ private:
      * @param node Subtree root to copy
      * @return New subtree root
      */
-    Node* copy_tree(Node* node) const;
+    Node* copy_tree(Node* node);
 
     /**
      * @brief In-order traversal helper
@@ -352,6 +396,23 @@ private:
     bool is_valid_recursive(Node* node, const T* min_val, const T* max_val) const;
 };
 
+// ============================================
+// Template member function implementations
+// ============================================
+
+template <typename T, typename Allocator>
+template <typename U>
+typename BinarySearchTree<T, Allocator>::Node* BinarySearchTree<T, Allocator>::create_node(U&& value) {
+    Node* node = NodeTraits::allocate(m_alloc, 1);
+    try {
+        NodeTraits::construct(m_alloc, node, std::forward<U>(value));
+    } catch (...) {
+        NodeTraits::deallocate(m_alloc, node, 1);
+        throw;
+    }
+    return node;
+}
+
 } // namespace tree
 } // namespace mylib
 
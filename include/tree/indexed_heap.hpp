@@ -0,0 +1,321 @@
+/**
+ * @file indexed_heap.hpp
+ * @brief Indexed d-ary heap with decrease_key, for priority queues keyed by
+ *        small integer ids
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ *
+ * Each key 0..n-1 appears in the heap at most once, and a position table
+ * maps key -> slot. Updating a queued key moves its one entry instead of
+ * pushing a duplicate, so the heap never holds more than one entry per key.
+ * A lazy std::priority_queue can hold one entry per relaxed edge.
+ *
+ * A wider node (Arity 4 by default) gives a shallower tree. Sifting up costs
+ * fewer levels, and the Arity children checked when sifting down are
+ * adjacent in memory.
+ *
+ * Copyright (c) 2026 Jinhyeok
+ * MIT License
+ */
+
+#ifndef MYLIB_TREE_INDEXED_HEAP_HPP
+#define MYLIB_TREE_INDEXED_HEAP_HPP
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace mylib {
+namespace tree {
+
+/**
+ * @class IndexedHeap
+ * @brief d-ary heap of (key, priority) entries addressable by key
+ *
+ * Ordering follows Heap: with std::less the largest priority is on top,
+ * with std::greater the smallest (see MinIndexedHeap). decrease_key() means
+ * "move towards the top", which for a min heap is the classic operation.
+ *
+ * The position table grows to the largest key pushed, so keys should be
+ * dense (vertex ids, handles); it can be presized with the constructor.
+ *
+ * @tparam Priority Priority type
+ * @tparam Compare Comparison function object type (default: std::less for max heap)
+ * @tparam Arity Children per node, at least 2
+ */
+template <typename Priority, typename Compare = std::less<Priority>, std::size_t Arity = 4>
+class IndexedHeap {
+    static_assert(Arity >= 2, "IndexedHeap needs at least two children per node");
+
+public:
+    // Type aliases
+    using priority_type = Priority;
+    using size_type = std::size_t;
+    using key_type = std::size_t;
+    using comparator_type = Compare;
+
+    /**
+     * @brief Create an empty heap
+     * @param key_capacity Keys below this need no position table growth
+     * @param comp Comparator to use for ordering
+     */
+    explicit IndexedHeap(size_type key_capacity = 0, const Compare& comp = Compare())
+        : m_position(key_capacity, NOT_QUEUED), m_comp(comp) {}
+
+    // Capacity
+    bool empty() const noexcept { return m_entries.empty(); }
+    size_type size() const noexcept { return m_entries.size(); }
+
+    /**
+     * @brief Check whether key is queued
+     */
+    bool contains(key_type key) const noexcept {
+        return key < m_position.size() && m_position[key] != NOT_QUEUED;
+    }
+
+    // Element access
+    /**
+     * @brief Key of the top entry
+     * @throws std::out_of_range if heap is empty
+     */
+    key_type top_key() const {
+        if (empty()) {
+            throw std::out_of_range("IndexedHeap::top_key: heap is empty");
+        }
+        return m_entries.front().key;
+    }
+
+    /**
+     * @brief Priority of the top entry
+     * @throws std::out_of_range if heap is empty
+     */
+    const Priority& top_priority() const {
+        if (empty()) {
+            throw std::out_of_range("IndexedHeap::top_priority: heap is empty");
+        }
+        return m_entries.front().priority;
+    }
+
+    /**
+     * @brief Current priority of a queued key
+     * @throws std::out_of_range if key is not queued
+     */
+    const Priority& priority(key_type key) const {
+        if (!contains(key)) {
+            throw std::out_of_range("IndexedHeap::priority: key not in heap");
+        }
+        return m_entries[m_position[key]].priority;
+    }
+
+    // Modifiers
+    /**
+     * @brief Queue a key
+     * @throws std::invalid_argument if key is already queued
+     *
+     * Time complexity: O(log_d n)
+     */
+    void push(key_type key, const Priority& priority) {
+        if (contains(key)) {
+            throw std::invalid_argument("IndexedHeap::push: key already in heap");
+        }
+        if (key >= m_position.size()) {
+            m_position.resize(key + 1, NOT_QUEUED);
+        }
+        m_entries.push_back(Entry{priority, key});
+        m_position[key] = m_entries.size() - 1;
+        sift_up(m_entries.size() - 1);
+    }
+
+    /**
+     * @brief Move a queued key towards the top
+     * @param key Queued key
+     * @param priority New priority; must not order below the current one
+     * @throws std::out_of_range if key is not queued
+     * @throws std::invalid_argument if priority orders below the current one
+     *
+     * Time complexity: O(log_d n)
+     */
+    void decrease_key(key_type key, const Priority& priority) {
+        if (!contains(key)) {
+            throw std::out_of_range("IndexedHeap::decrease_key: key not in heap");
+        }
+        size_type index = m_position[key];
+        if (m_comp(priority, m_entries[index].priority)) {
+            throw std::invalid_argument("IndexedHeap::decrease_key: priority moves key down");
+        }
+        m_entries[index].priority = priority;
+        sift_up(index);
+    }
+
+    /**
+     * @brief Set the priority of a queued key in either direction
+     * @throws std::out_of_range if key is not queued
+     */
+    void update(key_type key, const Priority& priority) {
+        if (!contains(key)) {
+            throw std::out_of_range("IndexedHeap::update: key not in heap");
+        }
+        size_type index = m_position[key];
+        m_entries[index].priority = priority;
+        sift_down(sift_up(index));
+    }
+
+    /**
+     * @brief Remove the top entry
+     * @throws std::out_of_range if heap is empty
+     */
+    void pop() {
+        if (empty()) {
+            throw std::out_of_range("IndexedHeap::pop: heap is empty");
+        }
+        remove_at(0);
+    }
+
+    /**
+     * @brief Remove and return the top entry
+     * @return (key, priority) of the former top
+     * @throws std::out_of_range if heap is empty
+     */
+    std::pair<key_type, Priority> extract() {
+        if (empty()) {
+            throw std::out_of_range("IndexedHeap::extract: heap is empty");
+        }
+        std::pair<key_type, Priority> top(m_entries.front().key, m_entries.front().priority);
+        remove_at(0);
+        return top;
+    }
+
+    /**
+     * @brief Remove a key if it is queued
+     * @return true if the key was removed
+     */
+    bool erase(key_type key) {
+        if (!contains(key)) {
+            return false;
+        }
+        remove_at(m_position[key]);
+        return true;
+    }
+
+    /**
+     * @brief Remove all entries; the position table keeps its size
+     *
+     * Time complexity: O(size()), not O(key capacity)
+     */
+    void clear() noexcept {
+        for (const Entry& entry : m_entries) {
+            m_position[entry.key] = NOT_QUEUED;
+        }
+        m_entries.clear();
+    }
+
+    // Heap operations
+    /**
+     * @brief Check the heap property and the position table
+     * @return true if valid heap, false otherwise
+     */
+    bool is_valid() const {
+        for (size_type i = 0; i < m_entries.size(); ++i) {
+            if (m_position[m_entries[i].key] != i) {
+                return false;
+            }
+            if (i > 0 && m_comp(m_entries[parent(i)].priority, m_entries[i].priority)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    static constexpr size_type NOT_QUEUED = std::numeric_limits<size_type>::max();
+
+    struct Entry {
+        Priority priority;
+        key_type key;
+    };
+
+    std::vector<Entry> m_entries;       ///< Heap-ordered entries
+    std::vector<size_type> m_position;  ///< key -> index in m_entries, NOT_QUEUED if absent
+    Compare m_comp;                     ///< Comparator for ordering
+
+    static size_type parent(size_type index) noexcept { return (index - 1) / Arity; }
+    static size_type first_child(size_type index) noexcept { return index * Arity + 1; }
+
+    void place(size_type index, Entry&& entry) {
+        m_position[entry.key] = index;
+        m_entries[index] = std::move(entry);
+    }
+
+    /**
+     * @brief Move the entry at index up past lower-ordered parents
+     * @return Its final index
+     */
+    size_type sift_up(size_type index) {
+        Entry moving = std::move(m_entries[index]);
+        while (index > 0) {
+            size_type up = parent(index);
+            if (!m_comp(m_entries[up].priority, moving.priority)) {
+                break;
+            }
+            place(index, std::move(m_entries[up]));
+            index = up;
+        }
+        place(index, std::move(moving));
+        return index;
+    }
+
+    /**
+     * @brief Move the entry at index down below its best child while needed
+     */
+    void sift_down(size_type index) {
+        Entry moving = std::move(m_entries[index]);
+        const size_type count = m_entries.size();
+        for (;;) {
+            size_type child = first_child(index);
+            if (child >= count) {
+                break;
+            }
+            size_type last = child + Arity < count ? child + Arity : count;
+            size_type best = child;
+            for (++child; child < last; ++child) {
+                if (m_comp(m_entries[best].priority, m_entries[child].priority)) {
+                    best = child;
+                }
+            }
+            if (!m_comp(moving.priority, m_entries[best].priority)) {
+                break;
+            }
+            place(index, std::move(m_entries[best]));
+            index = best;
+        }
+        place(index, std::move(moving));
+    }
+
+    void remove_at(size_type index) {
+        m_position[m_entries[index].key] = NOT_QUEUED;
+        if (index + 1 == m_entries.size()) {
+            m_entries.pop_back();
+            return;
+        }
+        // Fill the hole with the last entry, which may belong above or below it
+        m_entries[index] = std::move(m_entries.back());
+        m_entries.pop_back();
+        m_position[m_entries[index].key] = index;
+        sift_down(sift_up(index));
+    }
+};
+
+/**
+ * @brief Type alias for indexed min heap (smallest priority on top)
+ */
+template <typename Priority, std::size_t Arity = 4>
+using MinIndexedHeap = IndexedHeap<Priority, std::greater<Priority>, Arity>;
+
+} // namespace tree
+} // namespace mylib
+
+#endif // MYLIB_TREE_INDEXED_HEAP_HPP
@@ -39,8 +39,10 @@
 #include <utility>
 #include <initializer_list>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 #include <queue>
+#include "memory/node_pool.hpp"
 
 namespace mylib {
 namespace tree {
@@ -51,6 +53,8 @@ namespace tree {
  * 
  * @tparam T Value type
  * @tparam Compare Comparison function (default: std::less<T>)
+ * @tparam Allocator Allocator for values, rebound to the node type
+ *         (default: std::allocator<T>; see memory::PoolAllocator)
  * 
  * Usage:
  * @code
@@ -68,7 +72,7 @@ namespace tree {
  * }
  * @endcode
  */
-template <typename T, typename Compare = std::less<T>>
+template <typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T>>
 class RedBlackTree {
 private:
     enum class Color { RED, BLACK };
@@ -187,12 +191,19 @@ public:
     /**
      * @brief Default constructor
      */
-    RedBlackTree() : m_root(nullptr), m_size(0), m_compare() {}
+    RedBlackTree() : m_root(nullptr), m_size(0), m_compare(), m_alloc() {}
     
     /**
      * @brief Constructor with custom comparator
      */
-    explicit RedBlackTree(const Compare& comp) : m_root(nullptr), m_size(0), m_compare(comp) {}
+    explicit RedBlackTree(const Compare& comp, const Allocator& alloc = Allocator())
+        : m_root(nullptr), m_size(0), m_compare(comp), m_alloc(alloc) {}
+    
+    /**
+     * @brief Constructor with allocator
+     */
+    explicit RedBlackTree(const Allocator& alloc)
+        : m_root(nullptr), m_size(0), m_compare(), m_alloc(alloc) {}
     
     /**
      * @brief Initializer list constructor
@@ -216,7 +227,9 @@ public:
     /**
      * @brief Copy constructor
      */
-    RedBlackTree(const RedBlackTree& other) : RedBlackTree() {
+    RedBlackTree(const RedBlackTree& other)
+        : m_root(nullptr), m_size(0), m_compare(other.m_compare),
+          m_alloc(NodeTraits::select_on_container_copy_construction(other.m_alloc)) {
         if (other.m_root != nullptr) {
             m_root = copy_tree(other.m_root, nullptr);
             m_size = other.m_size;
@@ -227,7 +240,8 @@ public:
      * @brief Move constructor
      */
     RedBlackTree(RedBlackTree&& other) noexcept
-        : m_root(other.m_root), m_size(other.m_size), m_compare(std::move(other.m_compare)) {
+        : m_root(other.m_root), m_size(other.m_size), m_compare(std::move(other.m_compare)),
+          m_alloc(other.m_alloc) {
         other.m_root = nullptr;
         other.m_size = 0;
     }
@@ -249,9 +263,20 @@ public:
     RedBlackTree& operator=(RedBlackTree&& other) noexcept {
         if (this != &other) {
             clear();
+            m_compare = std::move(other.m_compare);
+            if (!NodeTraits::propagate_on_container_move_assignment::value &&
+                !(m_alloc == other.m_alloc)) {
+                // Nodes cannot change allocators: copy the shape node by node
+                m_root = copy_tree(other.m_root, nullptr);
+                m_size = other.m_size;
+                other.clear();
+                return *this;
+            }
+            if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+                m_alloc = other.m_alloc;
+            }
             m_root = other.m_root;
             m_size = other.m_size;
-            m_compare = std::move(other.m_compare);
             other.m_root = nullptr;
             other.m_size = 0;
         }
@@ -346,7 +371,12 @@ public:
      * @brief Clear all elements
      */
     void clear() noexcept {
-        destroy_tree(m_root);
+        if (std::is_trivially_destructible<Node>::value && BulkRelease::exclusive(m_alloc)) {
+            // Sole owner of a pool: drop every slab without visiting the nodes
+            BulkRelease::release(m_alloc);
+        } else {
+            destroy_tree(m_root);
+        }
         m_root = nullptr;
         m_size = 0;
     }
@@ -358,6 +388,16 @@ public:
         std::swap(m_root, other.m_root);
         std::swap(m_size, other.m_size);
         std::swap(m_compare, other.m_compare);
+        if constexpr (NodeTraits::propagate_on_container_swap::value) {
+            std::swap(m_alloc, other.m_alloc);
+        }
+    }
+    
+    /**
+     * @brief Get a copy of the allocator
+     */
+    Allocator get_allocator() const {
+        return Allocator(m_alloc);
     }
     
     // ============================================
@@ -583,9 +623,14 @@ public:
     }
 
 private:
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+    using BulkRelease = memory::bulk_release_traits<NodeAllocator>;
+
     Node* m_root;
     std::size_t m_size;
     Compare m_compare;
+    NodeAllocator m_alloc;
     
     // ============================================
     // Helper Functions
@@ -733,7 +778,7 @@ private:
         }
         
         // Create new red node
-        Node* new_node = new Node(std::forward<ValueType>(value), Color::RED);
+        Node* new_node = create_node(std::forward<ValueType>(value), Color::RED);
         new_node->parent = parent;
         
         if (parent == nullptr) {
@@ -862,7 +907,7 @@ private:
             y->color = z->color;
         }
         
-        delete z;
+        destroy_node(z);
         --m_size;
         
         if (y_original_color == Color::BLACK) {
@@ -948,13 +993,36 @@ private:
     // Tree Operations
     // ============================================
     
+    /**
+     * @brief Allocate and construct a node
+     */
+    template <typename... Args>
+    Node* create_node(Args&&... args) {
+        Node* node = NodeTraits::allocate(m_alloc, 1);
+        try {
+            NodeTraits::construct(m_alloc, node, std::forward<Args>(args)...);
+        } catch (...) {
+            NodeTraits::deallocate(m_alloc, node, 1);
+            throw;
+        }
+        return node;
+    }
+    
+    /**
+     * @brief Destroy and deallocate a node
+     */
+    void destroy_node(Node* node) noexcept {
+        NodeTraits::destroy(m_alloc, node);
+        NodeTraits::deallocate(m_alloc, node, 1);
+    }
+    
     /**
      * @brief Deep copy a subtree
      */
     Node* copy_tree(Node* node, Node* parent) {
         if (node == nullptr) return nullptr;
         
-        Node* new_node = new Node(node->data, node->color);
+        Node* new_node = create_node(node->data, node->color);
         new_node->parent = parent;
         new_node->left = copy_tree(node->left, new_node);
         new_node->right = copy_tree(node->right, new_node);
@@ -970,7 +1038,7 @@ private:
         
         destroy_tree(node->left);
         destroy_tree(node->right);
-        delete node;
+        destroy_node(node);
     }
     
     /**
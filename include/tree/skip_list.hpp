@@ -39,6 +39,8 @@
 #include <stdexcept>
 #include <algorithm>
 #include <limits>
+#include <type_traits>
+#include "memory/node_pool.hpp"
 
 namespace mylib {
 namespace tree {
@@ -54,6 +56,9 @@ namespace tree {
  * 
  * @tparam T Value type
  * @tparam Compare Comparison function (default: std::less<T>)
+ * @tparam Allocator Allocator for values, rebound to nodes and their
+ *         forward-pointer towers (default: std::allocator<T>;
+ *         see memory::PoolAllocator)
  * 
  * Usage:
  * @code
@@ -74,7 +79,7 @@ namespace tree {
  * }
  * @endcode
  */
-template <typename T, typename Compare = std::less<T>>
+template <typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T>>
 class SkipList {
 private:
     /**
@@ -83,15 +88,22 @@ private:
      */
     struct Node {
         T value;
-        std::vector<Node*> forward;  // Forward pointers for each level
+        Node** forward;  // Forward pointers for each level (level + 1 entries)
+        int level;       // Highest level of this node
         
-        Node(const T& val, int level)
-            : value(val), forward(level + 1, nullptr) {}
+        Node(const T& val, int lvl)
+            : value(val), forward(nullptr), level(lvl) {}
         
-        Node(T&& val, int level)
-            : value(std::move(val)), forward(level + 1, nullptr) {}
+        Node(T&& val, int lvl)
+            : value(std::move(val)), forward(nullptr), level(lvl) {}
     };
     
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+    using TowerAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node*>;
+    using TowerTraits = std::allocator_traits<TowerAllocator>;
+    using BulkRelease = memory::bulk_release_traits<NodeAllocator>;
+    
     Node* m_head;                    // Sentinel head node
     int m_max_level;                 // Maximum level in the skip list
     int m_current_level;             // Current highest level with elements
@@ -103,6 +115,8 @@ private:
     std::mt19937 m_rng;
     std::uniform_real_distribution<double> m_dist;
     
+    NodeAllocator m_alloc;           // Node and tower allocator
+    
 public:
     // ============================================
     // Iterator
@@ -156,17 +170,20 @@ public:
      * @param max_level Maximum number of levels (default: 16)
      * @param probability Probability for level promotion (default: 0.5)
      * @param compare Comparison function
+     * @param alloc Allocator for nodes
      */
     explicit SkipList(int max_level = 16,
                       double probability = 0.5,
-                      const Compare& compare = Compare())
+                      const Compare& compare = Compare(),
+                      const Allocator& alloc = Allocator())
         : m_max_level(max_level),
           m_current_level(0),
           m_size(0),
           m_compare(compare),
           m_probability(probability),
           m_rng(std::random_device{}()),
-          m_dist(0.0, 1.0) {
+          m_dist(0.0, 1.0),
+          m_alloc(alloc) {
         
         if (max_level < 1) {
             throw std::invalid_argument("max_level must be at least 1");
@@ -176,7 +193,7 @@ public:
         }
         
         // Create sentinel head node with lowest possible value
-        m_head = new Node(T(), max_level);
+        m_head = create_node(T(), max_level);
     }
     
     /**
@@ -210,7 +227,8 @@ public:
      * @brief Copy constructor
      */
     SkipList(const SkipList& other)
-        : SkipList(other.m_max_level, other.m_probability, other.m_compare) {
+        : SkipList(other.m_max_level, other.m_probability, other.m_compare,
+                   Allocator(NodeTraits::select_on_container_copy_construction(other.m_alloc))) {
         for (const auto& val : other) {
             insert(val);
         }
@@ -227,7 +245,8 @@ public:
           m_compare(std::move(other.m_compare)),
           m_probability(other.m_probability),
           m_rng(std::move(other.m_rng)),
-          m_dist(std::move(other.m_dist)) {
+          m_dist(std::move(other.m_dist)),
+          m_alloc(other.m_alloc) {
         
         other.m_head = nullptr;
         other.m_size = 0;
@@ -238,10 +257,7 @@ public:
      * @brief Destructor
      */
     ~SkipList() {
-        if (m_head != nullptr) {
-            clear();
-            delete m_head;
-        }
+        destroy_all();
     }
     
     // ============================================
@@ -258,8 +274,26 @@ public:
     
     SkipList& operator=(SkipList&& other) noexcept {
         if (this != &other) {
-            clear();
-            delete m_head;
+            destroy_all();
+            if (!NodeTraits::propagate_on_container_move_assignment::value &&
+                !(m_alloc == other.m_alloc)) {
+                // Nodes cannot change allocators: move element by element
+                m_max_level = other.m_max_level;
+                m_compare = other.m_compare;
+                m_probability = other.m_probability;
+                m_rng = other.m_rng;
+                m_head = create_node(T(), m_max_level);
+                if (other.m_head != nullptr) {
+                    for (Node* node = other.m_head->forward[0]; node; node = node->forward[0]) {
+                        insert(std::move(node->value));
+                    }
+                    other.clear();
+                }
+                return *this;
+            }
+            if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+                m_alloc = other.m_alloc;
+            }
             
             m_head = other.m_head;
             m_max_level = other.m_max_level;
@@ -319,7 +353,7 @@ public:
         }
         
         // Create new node
-        Node* new_node = new Node(value, new_level);
+        Node* new_node = create_node(value, new_level);
         
         // Insert node by updating pointers
         for (int i = 0; i <= new_level; ++i) {
@@ -362,7 +396,7 @@ public:
             m_current_level = new_level;
         }
         
-        Node* new_node = new Node(std::move(value), new_level);
+        Node* new_node = create_node(std::move(value), new_level);
         
         for (int i = 0; i <= new_level; ++i) {
             new_node->forward[i] = update[i]->forward[i];
@@ -407,7 +441,7 @@ public:
             update[i]->forward[i] = current->forward[i];
         }
         
-        delete current;
+        destroy_node(current);
         
         // Update current level
         while (m_current_level > 0 && m_head->forward[m_current_level] == nullptr) {
@@ -424,10 +458,20 @@ public:
     void clear() {
         if (m_head == nullptr) return;
         
+        if (bulk_releasable()) {
+            // Sole owner of a pool: drop every slab, then rebuild the sentinel
+            BulkRelease::release(m_alloc);
+            m_head = nullptr;
+            m_head = create_node(T(), m_max_level);
+            m_current_level = 0;
+            m_size = 0;
+            return;
+        }
+        
         Node* current = m_head->forward[0];
         while (current != nullptr) {
             Node* next = current->forward[0];
-            delete current;
+            destroy_node(current);
             current = next;
         }
         
@@ -549,6 +593,16 @@ public:
         std::swap(m_probability, other.m_probability);
         std::swap(m_rng, other.m_rng);
         std::swap(m_dist, other.m_dist);
+        if constexpr (NodeTraits::propagate_on_container_swap::value) {
+            std::swap(m_alloc, other.m_alloc);
+        }
+    }
+    
+    /**
+     * @brief Get a copy of the allocator
+     */
+    Allocator get_allocator() const {
+        return Allocator(m_alloc);
     }
     
     /**
@@ -560,7 +614,7 @@ public:
         Node* current = m_head->forward[0];
         
         while (current != nullptr) {
-            for (int i = 0; i < static_cast<int>(current->forward.size()); ++i) {
+            for (int i = 0; i <= current->level; ++i) {
                 ++dist[i];
             }
             current = current->forward[0];
@@ -584,6 +638,74 @@ public:
     }
     
 private:
+    /**
+     * @brief Allocate a node and its tower of level + 1 null forward pointers
+     */
+    template <typename V>
+    Node* create_node(V&& value, int level) {
+        Node* node = NodeTraits::allocate(m_alloc, 1);
+        try {
+            NodeTraits::construct(m_alloc, node, std::forward<V>(value), level);
+        } catch (...) {
+            NodeTraits::deallocate(m_alloc, node, 1);
+            throw;
+        }
+        try {
+            TowerAllocator tower_alloc(m_alloc);
+            node->forward = TowerTraits::allocate(tower_alloc, level + 1);
+        } catch (...) {
+            NodeTraits::destroy(m_alloc, node);
+            NodeTraits::deallocate(m_alloc, node, 1);
+            throw;
+        }
+        std::fill(node->forward, node->forward + level + 1, nullptr);
+        return node;
+    }
+    
+    /**
+     * @brief Free a node and its tower
+     */
+    void destroy_node(Node* node) noexcept {
+        TowerAllocator tower_alloc(m_alloc);
+        TowerTraits::deallocate(tower_alloc, node->forward, node->level + 1);
+        NodeTraits::destroy(m_alloc, node);
+        NodeTraits::deallocate(m_alloc, node, 1);
+    }
+    
+    /**
+     * @brief Whether every node and tower can be freed by dropping the pool
+     *
+     * The tallest tower (the head's) must fit in the pool too; larger ones
+     * come from ::operator new and would leak.
+     */
+    bool bulk_releasable() const noexcept {
+        return std::is_trivially_destructible<Node>::value &&
+               memory::NodePool::accepts(sizeof(Node*) * (static_cast<std::size_t>(m_max_level) + 1),
+                                         alignof(Node*)) &&
+               BulkRelease::exclusive(m_alloc);
+    }
+    
+    /**
+     * @brief Free all nodes including the sentinel, in bulk when possible
+     */
+    void destroy_all() noexcept {
+        if (m_head == nullptr) return;
+        
+        if (bulk_releasable()) {
+            BulkRelease::release(m_alloc);
+        } else {
+            Node* current = m_head;
+            while (current != nullptr) {
+                Node* next = current->forward[0];
+                destroy_node(current);
+                current = next;
+            }
+        }
+        m_head = nullptr;
+        m_current_level = 0;
+        m_size = 0;
+    }
+    
     /**
      * @brief Generate random level for new node
      */
@@ -38,6 +38,7 @@
 #include <optional>
 #include <queue>
 #include <algorithm>
+#include "memory/node_pool.hpp"
 
 namespace mylib {
 namespace tree {
@@ -53,6 +54,8 @@ namespace tree {
  * - Word frequency counting
  * 
  * @tparam CharT Character type (default: char)
+ * @tparam Allocator Allocator rebound to trie nodes and their child maps
+ *         (default: std::allocator<CharT>; see memory::PoolAllocator)
  * 
  * Usage:
  * @code
@@ -75,30 +78,52 @@ namespace tree {
  * trie.remove("apple");
  * @endcode
  */
-template <typename CharT = char>
+template <typename CharT = char, typename Allocator = std::allocator<CharT>>
 class Trie {
 private:
+    struct TrieNode;
+    
+    using AllocTraits = std::allocator_traits<Allocator>;
+    using NodeAllocator = typename AllocTraits::template rebind_alloc<TrieNode>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+    using ChildAllocator = typename AllocTraits::template rebind_alloc<std::pair<const CharT, TrieNode*>>;
+    using ChildMap = std::unordered_map<CharT, TrieNode*, std::hash<CharT>,
+                                        std::equal_to<CharT>, ChildAllocator>;
+    
     /**
      * @struct TrieNode
      * @brief Internal node structure for the trie
+     * 
+     * Children are owned by their parent and freed through the trie's
+     * allocator (see destroy_subtree).
      */
     struct TrieNode {
-        std::unordered_map<CharT, std::unique_ptr<TrieNode>> children;
+        ChildMap children;
         bool is_end_of_word = false;
         std::size_t word_count = 0;      ///< Number of times this word was inserted
         std::size_t prefix_count = 0;    ///< Number of words with this prefix
         
-        TrieNode() = default;
+        explicit TrieNode(const ChildAllocator& alloc) : children(alloc) {}
     };
     
 public:
     using string_type = std::basic_string<CharT>;
     using string_view_type = std::basic_string_view<CharT>;
     
+    using allocator_type = Allocator;
+    
     /**
      * @brief Default constructor
      */
-    Trie() : m_root(std::make_unique<TrieNode>()), m_size(0) {}
+    Trie() : Trie(Allocator()) {}
+    
+    /**
+     * @brief Construct an empty trie using the given allocator
+     */
+    explicit Trie(const Allocator& alloc)
+        : m_root(nullptr), m_size(0), m_alloc(alloc) {
+        m_root = create_node();
+    }
     
     /**
      * @brief Construct with initializer list of words
@@ -122,7 +147,8 @@ public:
     /**
      * @brief Copy constructor
      */
-    Trie(const Trie& other) : Trie() {
+    Trie(const Trie& other)
+        : Trie(Allocator(NodeTraits::select_on_container_copy_construction(other.m_alloc))) {
         // Deep copy by inserting all words
         std::vector<string_type> words;
         other.get_all_words(words);
@@ -138,7 +164,11 @@ public:
     /**
      * @brief Move constructor
      */
-    Trie(Trie&& other) noexcept = default;
+    Trie(Trie&& other) noexcept
+        : m_root(other.m_root), m_size(other.m_size), m_alloc(other.m_alloc) {
+        other.m_root = nullptr;
+        other.m_size = 0;
+    }
     
     /**
      * @brief Copy assignment
@@ -146,8 +176,7 @@ public:
     Trie& operator=(const Trie& other) {
         if (this != &other) {
             Trie temp(other);
-            std::swap(m_root, temp.m_root);
-            std::swap(m_size, temp.m_size);
+            swap(temp);
         }
         return *this;
     }
@@ -155,12 +184,44 @@ public:
     /**
      * @brief Move assignment
      */
-    Trie& operator=(Trie&& other) noexcept = default;
+    Trie& operator=(Trie&& other) noexcept {
+        if (this != &other) {
+            destroy_subtree(m_root);
+            if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+                m_alloc = other.m_alloc;
+            }
+            m_root = other.m_root;
+            m_size = other.m_size;
+            other.m_root = nullptr;
+            other.m_size = 0;
+        }
+        return *this;
+    }
     
     /**
      * @brief Destructor
      */
-    ~Trie() = default;
+    ~Trie() {
+        destroy_subtree(m_root);
+    }
+    
+    /**
+     * @brief Swap contents with another trie
+     */
+    void swap(Trie& other) noexcept {
+        std::swap(m_root, other.m_root);
+        std::swap(m_size, other.m_size);
+        if constexpr (NodeTraits::propagate_on_container_swap::value) {
+            std::swap(m_alloc, other.m_alloc);
+        }
+    }
+    
+    /**
+     * @brief Get a copy of the allocator
+     */
+    Allocator get_allocator() const {
+        return Allocator(m_alloc);
+    }
     
     // ============================================
     // Basic Operations
@@ -173,15 +234,22 @@ public:
      * Time Complexity: O(m) where m = word length
      */
     void insert(string_view_type word) {
-        TrieNode* node = m_root.get();
+        TrieNode* node = m_root;
         
         for (CharT ch : word) {
             node->prefix_count++;
             
-            if (node->children.find(ch) == node->children.end()) {
-                node->children[ch] = std::make_unique<TrieNode>();
+            auto it = node->children.find(ch);
+            if (it == node->children.end()) {
+                TrieNode* child = create_node();
+                try {
+                    it = node->children.emplace(ch, child).first;
+                } catch (...) {
+                    destroy_subtree(child);
+                    throw;
+                }
             }
-            node = node->children[ch].get();
+            node = it->second;
         }
         
         node->prefix_count++;
@@ -228,7 +296,7 @@ public:
         }
         
         // Word exists, now remove it
-        remove_helper(m_root.get(), word, 0);
+        remove_helper(m_root, word, 0);
         return true;
     }
     
@@ -334,7 +402,7 @@ public:
     std::vector<std::pair<string_type, std::size_t>> most_frequent(std::size_t k) const {
         std::vector<std::pair<string_type, std::size_t>> all_words;
         string_type current;
-        collect_words_with_count(m_root.get(), current, all_words);
+        collect_words_with_count(m_root, current, all_words);
         
         // Sort by count (descending), then by word (ascending)
         std::sort(all_words.begin(), all_words.end(),
@@ -364,7 +432,7 @@ public:
     std::vector<string_type> search_pattern(string_view_type pattern) const {
         std::vector<string_type> result;
         string_type current;
-        search_pattern_helper(m_root.get(), pattern, 0, current, result);
+        search_pattern_helper(m_root, pattern, 0, current, result);
         return result;
     }
     
@@ -374,7 +442,7 @@ public:
      * @return true if any word matches
      */
     bool matches_pattern(string_view_type pattern) const {
-        return matches_pattern_helper(m_root.get(), pattern, 0);
+        return matches_pattern_helper(m_root, pattern, 0);
     }
     
     // ============================================
@@ -388,7 +456,7 @@ public:
     std::vector<string_type> get_all_words() const {
         std::vector<string_type> result;
         string_type current;
-        collect_words(m_root.get(), current, result);
+        collect_words(m_root, current, result);
         return result;
     }
     
@@ -397,7 +465,7 @@ public:
      */
     void get_all_words(std::vector<string_type>& words) const {
         string_type current;
-        collect_words(m_root.get(), current, words);
+        collect_words(m_root, current, words);
     }
     
     /**
@@ -418,8 +486,10 @@ public:
      * @brief Remove all words from the trie
      */
     void clear() {
-        m_root = std::make_unique<TrieNode>();
+        destroy_subtree(m_root);
+        m_root = nullptr;
         m_size = 0;
+        m_root = create_node();
     }
     
     /**
@@ -428,18 +498,18 @@ public:
      */
     string_type longest_common_prefix() const {
         string_type result;
-        const TrieNode* node = m_root.get();
+        const TrieNode* node = m_root;
         
         while (node != nullptr) {
             // If node has multiple children or is end of word, stop
             if (node->children.size() != 1 || 
-                (node->is_end_of_word && node != m_root.get())) {
+                (node->is_end_of_word && node != m_root)) {
                 break;
             }
             
             auto it = node->children.begin();
             result += it->first;
-            node = it->second.get();
+            node = it->second;
         }
         
         return result;
@@ -451,7 +521,7 @@ public:
     string_type longest_word() const {
         string_type result;
         string_type current;
-        find_longest(m_root.get(), current, result);
+        find_longest(m_root, current, result);
         return result;
     }
     
@@ -463,18 +533,18 @@ public:
         
         // BFS to find shortest word
         std::queue<std::pair<const TrieNode*, string_type>> q;
-        q.push({m_root.get(), string_type()});
+        q.push({m_root, string_type()});
         
         while (!q.empty()) {
             auto [node, word] = q.front();
             q.pop();
             
-            if (node->is_end_of_word && node != m_root.get()) {
+            if (node->is_end_of_word && node != m_root) {
                 return word;
             }
             
             for (const auto& [ch, child] : node->children) {
-                q.push({child.get(), word + ch});
+                q.push({child, word + ch});
             }
         }
         
@@ -488,7 +558,7 @@ public:
     template <typename Func>
     void for_each(Func func) const {
         string_type current;
-        for_each_helper(m_root.get(), current, func);
+        for_each_helper(m_root, current, func);
     }
     
     /**
@@ -508,7 +578,7 @@ public:
         }
         
         string_type current_word;
-        fuzzy_search_helper(m_root.get(), word, current_word, 
+        fuzzy_search_helper(m_root, word, current_word, 
                            current_row, max_distance, result);
         
         // Sort by distance
@@ -521,21 +591,48 @@ public:
     }
 
 private:
-    std::unique_ptr<TrieNode> m_root;
+    TrieNode* m_root;
     std::size_t m_size;
+    NodeAllocator m_alloc;
+    
+    /**
+     * @brief Allocate an empty node whose child map uses the trie's allocator
+     */
+    TrieNode* create_node() {
+        TrieNode* node = NodeTraits::allocate(m_alloc, 1);
+        try {
+            NodeTraits::construct(m_alloc, node, ChildAllocator(m_alloc));
+        } catch (...) {
+            NodeTraits::deallocate(m_alloc, node, 1);
+            throw;
+        }
+        return node;
+    }
+    
+    /**
+     * @brief Free a node and everything below it
+     */
+    void destroy_subtree(TrieNode* node) noexcept {
+        if (node == nullptr) return;
+        for (auto& [ch, child] : node->children) {
+            destroy_subtree(child);
+        }
+        NodeTraits::destroy(m_alloc, node);
+        NodeTraits::deallocate(m_alloc, node, 1);
+    }
     
     /**
      * @brief Find the node corresponding to a prefix
      */
     const TrieNode* find_node(string_view_type prefix) const {
-        const TrieNode* node = m_root.get();
+        const TrieNode* node = m_root;
         
         for (CharT ch : prefix) {
             auto it = node->children.find(ch);
             if (it == node->children.end()) {
                 return nullptr;
             }
-            node = it->second.get();
+            node = it->second;
         }
         
         return node;
@@ -545,14 +642,14 @@ private:
      * @brief Find node (non-const version)
      */
     TrieNode* find_node_mutable(string_view_type prefix) {
-        TrieNode* node = m_root.get();
+        TrieNode* node = m_root;
         
         for (CharT ch : prefix) {
             auto it = node->children.find(ch);
             if (it == node->children.end()) {
                 return nullptr;
             }
-            node = it->second.get();
+            node = it->second;
         }
         
         return node;
@@ -569,7 +666,7 @@ private:
         
         for (const auto& [ch, child] : node->children) {
             current.push_back(ch);
-            collect_words(child.get(), current, result);
+            collect_words(child, current, result);
             current.pop_back();
         }
     }
@@ -593,7 +690,7 @@ private:
         
         for (const auto& [ch, child] : node->children) {
             current.push_back(ch);
-            collect_words_limited(child.get(), current, result, max_count);
+            collect_words_limited(child, current, result, max_count);
             current.pop_back();
             
             if (max_count > 0 && result.size() >= max_count) {
@@ -613,7 +710,7 @@ private:
         
         for (const auto& [ch, child] : node->children) {
             current.push_back(ch);
-            collect_words_with_count(child.get(), current, result);
+            collect_words_with_count(child, current, result);
             current.pop_back();
         }
     }
@@ -627,7 +724,7 @@ private:
         }
         
         for (const auto& [ch, child] : node->children) {
-            count_words_in_subtree(child.get(), count);
+            count_words_in_subtree(child, count);
         }
     }
     
@@ -652,10 +749,11 @@ private:
         CharT ch = word[depth];
         auto it = node->children.find(ch);
         
-        bool should_delete_child = remove_helper(it->second.get(), word, depth + 1);
+        bool should_delete_child = remove_helper(it->second, word, depth + 1);
         
         if (should_delete_child) {
-            node->children.erase(ch);
+            destroy_subtree(it->second);
+            node->children.erase(it);
         }
         
         node->prefix_count--;
@@ -682,7 +780,7 @@ private:
             // Wildcard: try all children
             for (const auto& [child_ch, child] : node->children) {
                 current.push_back(child_ch);
-                search_pattern_helper(child.get(), pattern, index + 1, current, result);
+                search_pattern_helper(child, pattern, index + 1, current, result);
                 current.pop_back();
             }
         } else {
@@ -690,7 +788,7 @@ private:
             auto it = node->children.find(ch);
             if (it != node->children.end()) {
                 current.push_back(ch);
-                search_pattern_helper(it->second.get(), pattern, index + 1, current, result);
+                search_pattern_helper(it->second, pattern, index + 1, current, result);
                 current.pop_back();
             }
         }
@@ -709,7 +807,7 @@ private:
         
         if (ch == '.') {
             for (const auto& [child_ch, child] : node->children) {
-                if (matches_pattern_helper(child.get(), pattern, index + 1)) {
+                if (matches_pattern_helper(child, pattern, index + 1)) {
                     return true;
                 }
             }
@@ -719,7 +817,7 @@ private:
             if (it == node->children.end()) {
                 return false;
             }
-            return matches_pattern_helper(it->second.get(), pattern, index + 1);
+            return matches_pattern_helper(it->second, pattern, index + 1);
         }
     }
     
@@ -734,7 +832,7 @@ private:
         
         for (const auto& [ch, child] : node->children) {
             current.push_back(ch);
-            find_longest(child.get(), current, longest);
+            find_longest(child, current, longest);
             current.pop_back();
         }
     }
@@ -750,7 +848,7 @@ private:
         
         for (const auto& [ch, child] : node->children) {
             current.push_back(ch);
-            for_each_helper(child.get(), current, func);
+            for_each_helper(child, current, func);
             current.pop_back();
         }
     }
@@ -791,7 +889,7 @@ private:
             std::size_t min_in_row = *std::min_element(current_row.begin(), current_row.end());
             if (min_in_row <= max_distance) {
                 current_word.push_back(ch);
-                fuzzy_search_helper(child.get(), word, current_word,
+                fuzzy_search_helper(child, word, current_word,
                                    current_row, max_distance, result);
                 current_word.pop_back();
             }
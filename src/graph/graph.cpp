@@ -7,10 +7,161 @@
  */
 
 #include "graph/graph.hpp"
+#include "tree/indexed_heap.hpp"
 
 namespace mylib {
 namespace graph {
 
+namespace {
+
+/**
+ * @brief Traversal state in hash containers; works for any Vertex
+ */
+template <typename Vertex>
+struct HashVertexState {
+    class Visited {
+    public:
+        /// @return true if vertex was not visited before
+        bool insert(const Vertex& vertex) { return m_set.insert(vertex).second; }
+        bool contains(const Vertex& vertex) const { return m_set.find(vertex) != m_set.end(); }
+
+    private:
+        std::unordered_set<Vertex> m_set;
+    };
+
+    /// Vertex -> T map; vertices never written read as the fill value
+    template <typename T>
+    class Map {
+    public:
+        explicit Map(const T& fill) : m_fill(fill) {}
+        T& operator[](const Vertex& vertex) { return m_map.try_emplace(vertex, m_fill).first->second; }
+        const T& get(const Vertex& vertex) const {
+            auto it = m_map.find(vertex);
+            return it == m_map.end() ? m_fill : it->second;
+        }
+
+    private:
+        std::unordered_map<Vertex, T> m_map;
+        T m_fill;
+    };
+
+    Visited visited() const { return Visited(); }
+
+    template <typename T>
+    Map<T> map(const T& fill) const { return Map<T>(fill); }
+};
+
+/**
+ * @brief Traversal state in a bitset and flat vectors indexed by
+ *        DenseVertexRange::index(); used while the vertex keys are compact
+ */
+template <typename Vertex>
+struct DenseVertexState {
+    using Range = detail::DenseVertexRange<Vertex>;
+
+    class Visited {
+    public:
+        explicit Visited(const Range& range) : m_range(&range), m_bits(range.span(), false) {}
+        bool insert(const Vertex& vertex) {
+            std::size_t index = m_range->index(vertex);
+            if (m_bits[index]) {
+                return false;
+            }
+            m_bits[index] = true;
+            return true;
+        }
+        bool contains(const Vertex& vertex) const { return m_bits[m_range->index(vertex)]; }
+
+    private:
+        const Range* m_range;
+        std::vector<bool> m_bits;
+    };
+
+    template <typename T>
+    class Map {
+    public:
+        Map(const Range& range, const T& fill) : m_range(&range), m_values(range.span(), fill) {}
+        T& operator[](const Vertex& vertex) { return m_values[m_range->index(vertex)]; }
+        const T& get(const Vertex& vertex) const { return m_values[m_range->index(vertex)]; }
+
+    private:
+        const Range* m_range;
+        std::vector<T> m_values;
+    };
+
+    const Range* range;
+
+    Visited visited() const { return Visited(*range); }
+
+    template <typename T>
+    Map<T> map(const T& fill) const { return Map<T>(*range, fill); }
+};
+
+/**
+ * @brief Run body with dense state if the vertex keys allow it, hash state
+ *        otherwise
+ */
+template <typename Vertex, typename Body>
+auto with_vertex_state(const detail::DenseVertexRange<Vertex>& range,
+                       std::size_t vertex_count, Body&& body) {
+    if constexpr (DenseVertexTraits<Vertex>::enabled) {
+        if (range.compact(vertex_count)) {
+            return body(DenseVertexState<Vertex>{&range});
+        }
+    }
+    return body(HashVertexState<Vertex>());
+}
+
+/// Heap key of a vertex Dijkstra has not reached yet
+constexpr std::size_t NO_HANDLE = std::numeric_limits<std::size_t>::max();
+
+/**
+ * @brief Dijkstra state per reached vertex, indexed by heap key
+ *
+ * handles maps Vertex -> key (a flat vector or a hash map, whichever the
+ * vertex state provides); everything else is a flat vector.
+ */
+template <typename Vertex, typename Weight, typename HandleMap>
+struct ReachedVertices {
+    explicit ReachedVertices(HandleMap map) : handles(std::move(map)) {}
+
+    std::size_t add(const Vertex& vertex, Weight distance, std::size_t from) {
+        std::size_t handle = vertices.size();
+        handles[vertex] = handle;
+        vertices.push_back(vertex);
+        dist.push_back(distance);
+        parent.push_back(from);
+        return handle;
+    }
+
+    HandleMap handles;
+    std::vector<Vertex> vertices;
+    std::vector<Weight> dist;
+    std::vector<std::size_t> parent;
+};
+
+/**
+ * @brief Offer distance through heap key u to vertex; queues it or lowers
+ *        its key in place
+ */
+template <typename Reached, typename Heap, typename Vertex, typename Weight>
+void relax(Reached& reached, Heap& heap, std::size_t u, Weight distance, const Vertex& vertex) {
+    std::size_t v = reached.handles[vertex];
+    if (v == NO_HANDLE) {
+        heap.push(reached.add(vertex, distance, u), distance);
+    } else if (distance < reached.dist[v]) {
+        reached.dist[v] = distance;
+        reached.parent[v] = u;
+        if (heap.contains(v)) {
+            heap.decrease_key(v, distance);
+        } else {
+            heap.push(v, distance);  // Settled earlier; only a negative weight gets here
+        }
+    }
+}
+
+} // namespace
+
 // Constructors
 template <typename Vertex, typename Weight>
 Graph<Vertex, Weight>::Graph()
@@ -34,15 +185,18 @@ template <typename Vertex, typename Weight>
 Graph<Vertex, Weight>::Graph(const Graph& other)
     : m_adj(other.m_adj)
     , m_edge_count(other.m_edge_count)
-    , m_directed(other.m_directed) {
+    , m_directed(other.m_directed)
+    , m_range(other.m_range) {
 }
 
 template <typename Vertex, typename Weight>
 Graph<Vertex, Weight>::Graph(Graph&& other) noexcept
     : m_adj(std::move(other.m_adj))
     , m_edge_count(other.m_edge_count)
-    , m_directed(other.m_directed) {
+    , m_directed(other.m_directed)
+    , m_range(other.m_range) {
     other.m_edge_count = 0;
+    other.m_range.reset();
 }
 
 // Assignment operators
@@ -52,6 +206,7 @@ Graph<Vertex, Weight>& Graph<Vertex, Weight>::operator=(const Graph& other) {
         m_adj = other.m_adj;
         m_edge_count = other.m_edge_count;
         m_directed = other.m_directed;
+        m_range = other.m_range;
     }
     return *this;
 }
@@ -62,7 +217,9 @@ Graph<Vertex, Weight>& Graph<Vertex, Weight>::operator=(Graph&& other) noexcept
         m_adj = std::move(other.m_adj);
         m_edge_count = other.m_edge_count;
         m_directed = other.m_directed;
+        m_range = other.m_range;
         other.m_edge_count = 0;
+        other.m_range.reset();
     }
     return *this;
 }
@@ -97,6 +254,7 @@ bool Graph<Vertex, Weight>::add_vertex(const Vertex& vertex) {
         return false;
     }
     m_adj[vertex] = AdjacencyList();
+    m_range.include(vertex);
     return true;
 }
 
@@ -364,28 +522,29 @@ void Graph<Vertex, Weight>::bfs(const Vertex& start,
         return;
     }
     
-    std::unordered_set<Vertex> visited;
-    std::queue<Vertex> queue;
-    
-    visited.insert(start);
-    queue.push(start);
-    
-    while (!queue.empty()) {
-        Vertex current = queue.front();
-        queue.pop();
+    with_vertex_state(m_range, m_adj.size(), [&](auto state) {
+        auto visited = state.visited();
+        std::queue<Vertex> queue;
         
-        visitor(current);
+        visited.insert(start);
+        queue.push(start);
         
-        auto it = m_adj.find(current);
-        if (it != m_adj.end()) {
-            for (const auto& neighbor : it->second) {
-                if (visited.find(neighbor.vertex) == visited.end()) {
-                    visited.insert(neighbor.vertex);
-                    queue.push(neighbor.vertex);
+        while (!queue.empty()) {
+            Vertex current = queue.front();
+            queue.pop();
+            
+            visitor(current);
+            
+            auto it = m_adj.find(current);
+            if (it != m_adj.end()) {
+                for (const auto& neighbor : it->second) {
+                    if (visited.insert(neighbor.vertex)) {
+                        queue.push(neighbor.vertex);
+                    }
                 }
             }
         }
-    }
+    });
 }
 
 template <typename Vertex, typename Weight>
@@ -395,31 +554,32 @@ void Graph<Vertex, Weight>::dfs(const Vertex& start,
         return;
     }
     
-    std::unordered_set<Vertex> visited;
-    std::stack<Vertex> stack;
-    
-    stack.push(start);
-    
-    while (!stack.empty()) {
-        Vertex current = stack.top();
-        stack.pop();
+    with_vertex_state(m_range, m_adj.size(), [&](auto state) {
+        auto visited = state.visited();
+        std::stack<Vertex> stack;
         
-        if (visited.find(current) != visited.end()) {
-            continue;
-        }
-        
-        visited.insert(current);
-        visitor(current);
+        stack.push(start);
         
-        auto it = m_adj.find(current);
-        if (it != m_adj.end()) {
-            for (const auto& neighbor : it->second) {
-                if (visited.find(neighbor.vertex) == visited.end()) {
-                    stack.push(neighbor.vertex);
+        while (!stack.empty()) {
+            Vertex current = stack.top();
+            stack.pop();
+            
+            if (!visited.insert(current)) {
+                continue;
+            }
+            
+            visitor(current);
+            
+            auto it = m_adj.find(current);
+            if (it != m_adj.end()) {
+                for (const auto& neighbor : it->second) {
+                    if (!visited.contains(neighbor.vertex)) {
+                        stack.push(neighbor.vertex);
+                    }
                 }
             }
         }
-    }
+    });
 }
 
 template <typename Vertex, typename Weight>
@@ -446,51 +606,52 @@ std::vector<Vertex> Graph<Vertex, Weight>::shortest_path_bfs(
         return {from};
     }
     
-    std::unordered_map<Vertex, Vertex> parent;
-    std::unordered_set<Vertex> visited;
-    std::queue<Vertex> queue;
-    
-    visited.insert(from);
-    queue.push(from);
-    
-    bool found = false;
-    
-    while (!queue.empty() && !found) {
-        Vertex current = queue.front();
-        queue.pop();
+    return with_vertex_state(m_range, m_adj.size(), [&](auto state) -> std::vector<Vertex> {
+        auto parent = state.map(from);
+        auto visited = state.visited();
+        std::queue<Vertex> queue;
         
-        auto it = m_adj.find(current);
-        if (it != m_adj.end()) {
-            for (const auto& neighbor : it->second) {
-                if (visited.find(neighbor.vertex) == visited.end()) {
-                    visited.insert(neighbor.vertex);
-                    parent[neighbor.vertex] = current;
-                    queue.push(neighbor.vertex);
-                    
-                    if (neighbor.vertex == to) {
-                        found = true;
-                        break;
+        visited.insert(from);
+        queue.push(from);
+        
+        bool found = false;
+        
+        while (!queue.empty() && !found) {
+            Vertex current = queue.front();
+            queue.pop();
+            
+            auto it = m_adj.find(current);
+            if (it != m_adj.end()) {
+                for (const auto& neighbor : it->second) {
+                    if (visited.insert(neighbor.vertex)) {
+                        parent[neighbor.vertex] = current;
+                        queue.push(neighbor.vertex);
+                        
+                        if (neighbor.vertex == to) {
+                            found = true;
+                            break;
+                        }
                     }
                 }
             }
         }
-    }
-    
-    if (!found) {
-        return {};
-    }
-    
-    // Reconstruct path
-    std::vector<Vertex> path;
-    Vertex current = to;
-    while (current != from) {
-        path.push_back(current);
-        current = parent[current];
-    }
-    path.push_back(from);
-    
-    std::reverse(path.begin(), path.end());
-    return path;
+        
+        if (!found) {
+            return {};
+        }
+        
+        // Reconstruct path
+        std::vector<Vertex> path;
+        Vertex current = to;
+        while (current != from) {
+            path.push_back(current);
+            current = parent[current];
+        }
+        path.push_back(from);
+        
+        std::reverse(path.begin(), path.end());
+        return path;
+    });
 }
 
 template <typename Vertex, typename Weight>
@@ -505,62 +666,46 @@ std::pair<std::vector<Vertex>, Weight> Graph<Vertex, Weight>::dijkstra(
         return {{from}, Weight{0}};
     }
     
-    const Weight INF = std::numeric_limits<Weight>::max();
-    
-    std::unordered_map<Vertex, Weight> dist;
-    std::unordered_map<Vertex, Vertex> parent;
-    
-    // Initialize distances
-    for (const auto& pair : m_adj) {
-        dist[pair.first] = INF;
-    }
-    dist[from] = Weight{0};
-    
-    // Priority queue: (distance, vertex)
-    using PQElement = std::pair<Weight, Vertex>;
-    std::priority_queue<PQElement, std::vector<PQElement>, std::greater<PQElement>> pq;
-    pq.emplace(Weight{0}, from);
-    
-    while (!pq.empty()) {
-        auto [d, u] = pq.top();
-        pq.pop();
+    return with_vertex_state(m_range, m_adj.size(),
+                             [&](auto state) -> std::pair<std::vector<Vertex>, Weight> {
+        // Reached vertices get heap keys 0, 1, ... in the order they are found
+        ReachedVertices<Vertex, Weight, decltype(state.map(NO_HANDLE))> reached(state.map(NO_HANDLE));
+        reached.add(from, Weight{0}, 0);
+        
+        tree::MinIndexedHeap<Weight> heap;
+        heap.push(0, Weight{0});
         
-        if (d > dist[u]) {
-            continue;  // Outdated entry
+        while (!heap.empty()) {
+            auto [u, d] = heap.extract();
+            Vertex vertex = reached.vertices[u];
+            
+            if (vertex == to) {
+                break;  // Found shortest path to destination
+            }
+            
+            auto it = m_adj.find(vertex);
+            if (it != m_adj.end()) {
+                for (const auto& neighbor : it->second) {
+                    relax(reached, heap, u, d + neighbor.weight, neighbor.vertex);
+                }
+            }
         }
         
-        if (u == to) {
-            break;  // Found shortest path to destination
+        std::size_t target = reached.handles.get(to);
+        if (target == NO_HANDLE) {
+            return {{}, Weight{}};
         }
         
-        auto it = m_adj.find(u);
-        if (it != m_adj.end()) {
-            for (const auto& neighbor : it->second) {
-                Weight new_dist = dist[u] + neighbor.weight;
-                if (new_dist < dist[neighbor.vertex]) {
-                    dist[neighbor.vertex] = new_dist;
-                    parent[neighbor.vertex] = u;
-                    pq.emplace(new_dist, neighbor.vertex);
-                }
-            }
+        // Reconstruct path
+        std::vector<Vertex> path;
+        for (std::size_t current = target; current != 0; current = reached.parent[current]) {
+            path.push_back(reached.vertices[current]);
         }
-    }
-    
-    if (dist[to] == INF) {
-        return {{}, Weight{}};
-    }
-    
-    // Reconstruct path
-    std::vector<Vertex> path;
-    Vertex current = to;
-    while (current != from) {
-        path.push_back(current);
-        current = parent[current];
-    }
-    path.push_back(from);
-    
-    std::reverse(path.begin(), path.end());
-    return {path, dist[to]};
+        path.push_back(from);
+        
+        std::reverse(path.begin(), path.end());
+        return {path, reached.dist[target]};
+    });
 }
 
 template <typename Vertex, typename Weight>
@@ -569,43 +714,38 @@ std::unordered_map<Vertex, Weight> Graph<Vertex, Weight>::dijkstra_all(
     
     const Weight INF = std::numeric_limits<Weight>::max();
     
-    std::unordered_map<Vertex, Weight> dist;
+    std::unordered_map<Vertex, Weight> result;
     
     if (!has_vertex(from)) {
-        return dist;
+        return result;
     }
     
-    // Initialize distances
-    for (const auto& pair : m_adj) {
-        dist[pair.first] = INF;
-    }
-    dist[from] = Weight{0};
-    
-    using PQElement = std::pair<Weight, Vertex>;
-    std::priority_queue<PQElement, std::vector<PQElement>, std::greater<PQElement>> pq;
-    pq.emplace(Weight{0}, from);
-    
-    while (!pq.empty()) {
-        auto [d, u] = pq.top();
-        pq.pop();
+    with_vertex_state(m_range, m_adj.size(), [&](auto state) {
+        ReachedVertices<Vertex, Weight, decltype(state.map(NO_HANDLE))> reached(state.map(NO_HANDLE));
+        reached.add(from, Weight{0}, 0);
         
-        if (d > dist[u]) {
-            continue;
-        }
+        tree::MinIndexedHeap<Weight> heap;
+        heap.push(0, Weight{0});
         
-        auto it = m_adj.find(u);
-        if (it != m_adj.end()) {
-            for (const auto& neighbor : it->second) {
-                Weight new_dist = dist[u] + neighbor.weight;
-                if (new_dist < dist[neighbor.vertex]) {
-                    dist[neighbor.vertex] = new_dist;
-                    pq.emplace(new_dist, neighbor.vertex);
+        while (!heap.empty()) {
+            auto [u, d] = heap.extract();
+            auto it = m_adj.find(reached.vertices[u]);
+            if (it != m_adj.end()) {
+                for (const auto& neighbor : it->second) {
+                    relax(reached, heap, u, d + neighbor.weight, neighbor.vertex);
                 }
             }
         }
-    }
+        
+        // Every vertex gets an entry, INF if unreachable
+        result.reserve(m_adj.size());
+        for (const auto& pair : m_adj) {
+            std::size_t handle = reached.handles.get(pair.first);
+            result.emplace(pair.first, handle == NO_HANDLE ? INF : reached.dist[handle]);
+        }
+    });
     
-    return dist;
+    return result;
 }
 
 template <typename Vertex, typename Weight>
@@ -618,31 +758,32 @@ bool Graph<Vertex, Weight>::has_path(const Vertex& from, const Vertex& to) const
         return true;
     }
     
-    std::unordered_set<Vertex> visited;
-    std::queue<Vertex> queue;
-    
-    visited.insert(from);
-    queue.push(from);
-    
-    while (!queue.empty()) {
-        Vertex current = queue.front();
-        queue.pop();
+    return with_vertex_state(m_range, m_adj.size(), [&](auto state) {
+        auto visited = state.visited();
+        std::queue<Vertex> queue;
         
-        auto it = m_adj.find(current);
-        if (it != m_adj.end()) {
-            for (const auto& neighbor : it->second) {
-                if (neighbor.vertex == to) {
-                    return true;
-                }
-                if (visited.find(neighbor.vertex) == visited.end()) {
-                    visited.insert(neighbor.vertex);
-                    queue.push(neighbor.vertex);
+        visited.insert(from);
+        queue.push(from);
+        
+        while (!queue.empty()) {
+            Vertex current = queue.front();
+            queue.pop();
+            
+            auto it = m_adj.find(current);
+            if (it != m_adj.end()) {
+                for (const auto& neighbor : it->second) {
+                    if (neighbor.vertex == to) {
+                        return true;
+                    }
+                    if (visited.insert(neighbor.vertex)) {
+                        queue.push(neighbor.vertex);
+                    }
                 }
             }
         }
-    }
-    
-    return false;
+        
+        return false;
+    });
 }
 
 // Graph properties
@@ -829,6 +970,7 @@ template <typename Vertex, typename Weight>
 void Graph<Vertex, Weight>::clear() noexcept {
     m_adj.clear();
     m_edge_count = 0;
+    m_range.reset();
 }
 
 template <typename Vertex, typename Weight>
@@ -836,6 +978,7 @@ void Graph<Vertex, Weight>::swap(Graph& other) noexcept {
     m_adj.swap(other.m_adj);
     std::swap(m_edge_count, other.m_edge_count);
     std::swap(m_directed, other.m_directed);
+    std::swap(m_range, other.m_range);
 }
 
 template <typename Vertex, typename Weight>
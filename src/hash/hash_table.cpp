@@ -14,47 +14,112 @@ namespace mylib {
 namespace hash {
 
 // Constructors
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-HashTable<Key, Value, Hash, KeyEqual>::HashTable()
-    : m_buckets(DEFAULT_BUCKET_COUNT)
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::HashTable()
+    : m_alloc()
+    , m_buckets(make_buckets(BucketPolicy::round_bucket_count(DEFAULT_BUCKET_COUNT)))
+    , m_old_buckets()
+    , m_rehash_pos(0)
+    , m_rehash_step(DEFAULT_REHASH_STEP)
+    , m_incremental(false)
     , m_size(0)
     , m_max_load_factor(DEFAULT_MAX_LOAD_FACTOR)
     , m_hasher()
     , m_key_equal() {
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-HashTable<Key, Value, Hash, KeyEqual>::HashTable(size_type bucket_count)
-    : m_buckets(bucket_count > 0 ? bucket_count : DEFAULT_BUCKET_COUNT)
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::HashTable(size_type bucket_count)
+    : m_alloc()
+    , m_buckets(make_buckets(BucketPolicy::round_bucket_count(
+        bucket_count > 0 ? bucket_count : DEFAULT_BUCKET_COUNT)))
+    , m_old_buckets()
+    , m_rehash_pos(0)
+    , m_rehash_step(DEFAULT_REHASH_STEP)
+    , m_incremental(false)
     , m_size(0)
     , m_max_load_factor(DEFAULT_MAX_LOAD_FACTOR)
     , m_hasher()
     , m_key_equal() {
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-HashTable<Key, Value, Hash, KeyEqual>::HashTable(size_type bucket_count, const Hash& hash)
-    : m_buckets(bucket_count > 0 ? bucket_count : DEFAULT_BUCKET_COUNT)
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::HashTable(size_type bucket_count, const Hash& hash)
+    : m_alloc()
+    , m_buckets(make_buckets(BucketPolicy::round_bucket_count(
+        bucket_count > 0 ? bucket_count : DEFAULT_BUCKET_COUNT)))
+    , m_old_buckets()
+    , m_rehash_pos(0)
+    , m_rehash_step(DEFAULT_REHASH_STEP)
+    , m_incremental(false)
     , m_size(0)
     , m_max_load_factor(DEFAULT_MAX_LOAD_FACTOR)
     , m_hasher(hash)
     , m_key_equal() {
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-HashTable<Key, Value, Hash, KeyEqual>::HashTable(
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::HashTable(
     size_type bucket_count, const Hash& hash, const KeyEqual& equal)
-    : m_buckets(bucket_count > 0 ? bucket_count : DEFAULT_BUCKET_COUNT)
+    : m_alloc()
+    , m_buckets(make_buckets(BucketPolicy::round_bucket_count(
+        bucket_count > 0 ? bucket_count : DEFAULT_BUCKET_COUNT)))
+    , m_old_buckets()
+    , m_rehash_pos(0)
+    , m_rehash_step(DEFAULT_REHASH_STEP)
+    , m_incremental(false)
     , m_size(0)
     , m_max_load_factor(DEFAULT_MAX_LOAD_FACTOR)
     , m_hasher(hash)
     , m_key_equal(equal) {
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-HashTable<Key, Value, Hash, KeyEqual>::HashTable(
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::HashTable(
+    size_type bucket_count, const Hash& hash, const KeyEqual& equal, const Allocator& alloc)
+    : m_alloc(alloc)
+    , m_buckets(make_buckets(BucketPolicy::round_bucket_count(
+        bucket_count > 0 ? bucket_count : DEFAULT_BUCKET_COUNT)))
+    , m_old_buckets()
+    , m_rehash_pos(0)
+    , m_rehash_step(DEFAULT_REHASH_STEP)
+    , m_incremental(false)
+    , m_size(0)
+    , m_max_load_factor(DEFAULT_MAX_LOAD_FACTOR)
+    , m_hasher(hash)
+    , m_key_equal(equal) {
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::HashTable(const Allocator& alloc)
+    : m_alloc(alloc)
+    , m_buckets(make_buckets(BucketPolicy::round_bucket_count(DEFAULT_BUCKET_COUNT)))
+    , m_old_buckets()
+    , m_rehash_pos(0)
+    , m_rehash_step(DEFAULT_REHASH_STEP)
+    , m_incremental(false)
+    , m_size(0)
+    , m_max_load_factor(DEFAULT_MAX_LOAD_FACTOR)
+    , m_hasher()
+    , m_key_equal() {
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::HashTable(
     std::initializer_list<std::pair<Key, Value>> init)
-    : m_buckets(DEFAULT_BUCKET_COUNT)
+    : m_alloc()
+    , m_buckets(make_buckets(BucketPolicy::round_bucket_count(DEFAULT_BUCKET_COUNT)))
+    , m_old_buckets()
+    , m_rehash_pos(0)
+    , m_rehash_step(DEFAULT_REHASH_STEP)
+    , m_incremental(false)
     , m_size(0)
     , m_max_load_factor(DEFAULT_MAX_LOAD_FACTOR)
     , m_hasher()
@@ -64,229 +129,310 @@ HashTable<Key, Value, Hash, KeyEqual>::HashTable(
     }
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-HashTable<Key, Value, Hash, KeyEqual>::HashTable(const HashTable& other)
-    : m_buckets(other.m_buckets)
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::HashTable(const HashTable& other)
+    : m_alloc(std::allocator_traits<ValueAllocator>::select_on_container_copy_construction(other.m_alloc))
+    , m_buckets(copy_buckets(other.m_buckets))
+    , m_old_buckets(copy_buckets(other.m_old_buckets))
+    , m_rehash_pos(other.m_rehash_pos)
+    , m_rehash_step(other.m_rehash_step)
+    , m_incremental(other.m_incremental)
     , m_size(other.m_size)
     , m_max_load_factor(other.m_max_load_factor)
     , m_hasher(other.m_hasher)
     , m_key_equal(other.m_key_equal) {
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-HashTable<Key, Value, Hash, KeyEqual>::HashTable(HashTable&& other) noexcept
-    : m_buckets(std::move(other.m_buckets))
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::HashTable(HashTable&& other) noexcept
+    : m_alloc(other.m_alloc)
+    , m_buckets(std::move(other.m_buckets))
+    , m_old_buckets(std::move(other.m_old_buckets))
+    , m_rehash_pos(other.m_rehash_pos)
+    , m_rehash_step(other.m_rehash_step)
+    , m_incremental(other.m_incremental)
     , m_size(other.m_size)
     , m_max_load_factor(other.m_max_load_factor)
     , m_hasher(std::move(other.m_hasher))
     , m_key_equal(std::move(other.m_key_equal)) {
     other.m_size = 0;
-    other.m_buckets = std::vector<Bucket>(DEFAULT_BUCKET_COUNT);
+    other.m_buckets = other.make_buckets(BucketPolicy::round_bucket_count(DEFAULT_BUCKET_COUNT));
+    other.m_old_buckets.clear();
+    other.m_rehash_pos = 0;
 }
 
 // Assignment operators
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-HashTable<Key, Value, Hash, KeyEqual>& 
-HashTable<Key, Value, Hash, KeyEqual>::operator=(const HashTable& other) {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>& 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::operator=(const HashTable& other) {
     if (this != &other) {
-        m_buckets = other.m_buckets;
-        m_size = other.m_size;
-        m_max_load_factor = other.m_max_load_factor;
-        m_hasher = other.m_hasher;
-        m_key_equal = other.m_key_equal;
+        // Entries hold a const key, so buckets are rebuilt rather than assigned
+        HashTable copy(other);
+        swap(copy);
     }
     return *this;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-HashTable<Key, Value, Hash, KeyEqual>& 
-HashTable<Key, Value, Hash, KeyEqual>::operator=(HashTable&& other) noexcept {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>& 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::operator=(HashTable&& other) noexcept {
     if (this != &other) {
+        // The bucket lists carry their allocator with them, so the table's
+        // allocator follows them regardless of propagation traits
+        m_alloc = other.m_alloc;
         m_buckets = std::move(other.m_buckets);
+        m_old_buckets = std::move(other.m_old_buckets);
+        m_rehash_pos = other.m_rehash_pos;
+        m_rehash_step = other.m_rehash_step;
+        m_incremental = other.m_incremental;
         m_size = other.m_size;
         m_max_load_factor = other.m_max_load_factor;
         m_hasher = std::move(other.m_hasher);
         m_key_equal = std::move(other.m_key_equal);
         
         other.m_size = 0;
-        other.m_buckets = std::vector<Bucket>(DEFAULT_BUCKET_COUNT);
+        other.m_buckets = other.make_buckets(BucketPolicy::round_bucket_count(DEFAULT_BUCKET_COUNT));
+        other.m_old_buckets.clear();
+        other.m_rehash_pos = 0;
     }
     return *this;
 }
 
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::allocator_type 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::get_allocator() const {
+    return allocator_type(m_alloc);
+}
+
 // Capacity
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-bool HashTable<Key, Value, Hash, KeyEqual>::empty() const noexcept {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+bool HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::empty() const noexcept {
     return m_size == 0;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-typename HashTable<Key, Value, Hash, KeyEqual>::size_type 
-HashTable<Key, Value, Hash, KeyEqual>::size() const noexcept {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::size_type 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::size() const noexcept {
     return m_size;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-typename HashTable<Key, Value, Hash, KeyEqual>::size_type 
-HashTable<Key, Value, Hash, KeyEqual>::bucket_count() const noexcept {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::size_type 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::bucket_count() const noexcept {
     return m_buckets.size();
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-float HashTable<Key, Value, Hash, KeyEqual>::load_factor() const noexcept {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+float HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::load_factor() const noexcept {
     return m_buckets.empty() ? 0.0f : static_cast<float>(m_size) / m_buckets.size();
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-float HashTable<Key, Value, Hash, KeyEqual>::max_load_factor() const noexcept {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+float HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::max_load_factor() const noexcept {
     return m_max_load_factor;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-void HashTable<Key, Value, Hash, KeyEqual>::max_load_factor(float ml) {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::max_load_factor(float ml) {
     m_max_load_factor = ml;
     check_rehash();
 }
 
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+bool HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::incremental_rehash() const noexcept {
+    return m_incremental;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::incremental_rehash(
+    bool enable, size_type buckets_per_step) {
+    if (buckets_per_step == 0) {
+        throw std::invalid_argument("HashTable::incremental_rehash: step must be positive");
+    }
+    m_incremental = enable;
+    m_rehash_step = buckets_per_step;
+    if (!enable) {
+        finish_rehash();
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+bool HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::rehashing() const noexcept {
+    return !m_old_buckets.empty();
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::finish_rehash() {
+    for (; m_rehash_pos < m_old_buckets.size(); ++m_rehash_pos) {
+        migrate_bucket(m_old_buckets[m_rehash_pos]);
+    }
+    std::vector<Bucket>().swap(m_old_buckets);
+    m_rehash_pos = 0;
+}
+
 // Element access
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-Value& HashTable<Key, Value, Hash, KeyEqual>::operator[](const Key& key) {
-    size_type index = get_bucket_index(key);
-    auto it = find_in_bucket(index, key);
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+Value& HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::operator[](const Key& key) {
+    rehash_step();
+    Bucket& bucket = bucket_for(key);
+    auto it = find_in_bucket(bucket, key);
     
-    if (it != m_buckets[index].end()) {
-        return it->value;
+    if (it != bucket.end()) {
+        return it->second;
     }
     
     // Insert default value
     check_rehash();
-    index = get_bucket_index(key);  // Recalculate after potential rehash
-    m_buckets[index].emplace_back(key, Value{});
+    Bucket& target = bucket_for(key);  // Re-locate after potential rehash
+    target.emplace_back(key, Value{});
     ++m_size;
-    return m_buckets[index].back().value;
+    return target.back().second;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-Value& HashTable<Key, Value, Hash, KeyEqual>::operator[](Key&& key) {
-    size_type index = get_bucket_index(key);
-    auto it = find_in_bucket(index, key);
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+Value& HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::operator[](Key&& key) {
+    rehash_step();
+    Bucket& bucket = bucket_for(key);
+    auto it = find_in_bucket(bucket, key);
     
-    if (it != m_buckets[index].end()) {
-        return it->value;
+    if (it != bucket.end()) {
+        return it->second;
     }
     
     check_rehash();
-    index = get_bucket_index(key);
-    m_buckets[index].emplace_back(std::move(key), Value{});
+    Bucket& target = bucket_for(key);
+    target.emplace_back(std::move(key), Value{});
     ++m_size;
-    return m_buckets[index].back().value;
+    return target.back().second;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-Value& HashTable<Key, Value, Hash, KeyEqual>::at(const Key& key) {
-    size_type index = get_bucket_index(key);
-    auto it = find_in_bucket(index, key);
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+Value& HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::at(const Key& key) {
+    Bucket& bucket = bucket_for(key);
+    auto it = find_in_bucket(bucket, key);
     
-    if (it == m_buckets[index].end()) {
+    if (it == bucket.end()) {
         throw std::out_of_range("HashTable::at: key not found");
     }
-    return it->value;
+    return it->second;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-const Value& HashTable<Key, Value, Hash, KeyEqual>::at(const Key& key) const {
-    size_type index = get_bucket_index(key);
-    auto it = find_in_bucket(index, key);
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+const Value& HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::at(const Key& key) const {
+    const Bucket& bucket = bucket_for(key);
+    auto it = find_in_bucket(bucket, key);
     
-    if (it == m_buckets[index].end()) {
+    if (it == bucket.end()) {
         throw std::out_of_range("HashTable::at: key not found");
     }
-    return it->value;
+    return it->second;
 }
 
 // Modifiers
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-std::pair<bool, bool> HashTable<Key, Value, Hash, KeyEqual>::insert(
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+std::pair<bool, bool> HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::insert(
     const Key& key, const Value& value) {
     
-    size_type index = get_bucket_index(key);
-    auto it = find_in_bucket(index, key);
+    rehash_step();
+    Bucket& bucket = bucket_for(key);
     
-    if (it != m_buckets[index].end()) {
+    if (find_in_bucket(bucket, key) != bucket.end()) {
         // Key already exists
         return {true, false};
     }
     
     check_rehash();
-    index = get_bucket_index(key);
-    m_buckets[index].emplace_back(key, value);
+    bucket_for(key).emplace_back(key, value);
     ++m_size;
     return {true, true};
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-std::pair<bool, bool> HashTable<Key, Value, Hash, KeyEqual>::insert(
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+std::pair<bool, bool> HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::insert(
     Key&& key, Value&& value) {
     
-    size_type index = get_bucket_index(key);
-    auto it = find_in_bucket(index, key);
+    rehash_step();
+    Bucket& bucket = bucket_for(key);
     
-    if (it != m_buckets[index].end()) {
+    if (find_in_bucket(bucket, key) != bucket.end()) {
         return {true, false};
     }
     
     check_rehash();
-    index = get_bucket_index(key);
-    m_buckets[index].emplace_back(std::move(key), std::move(value));
+    bucket_for(key).emplace_back(std::move(key), std::move(value));
     ++m_size;
     return {true, true};
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-bool HashTable<Key, Value, Hash, KeyEqual>::insert_or_assign(
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+bool HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::insert_or_assign(
     const Key& key, const Value& value) {
     
-    size_type index = get_bucket_index(key);
-    auto it = find_in_bucket(index, key);
+    rehash_step();
+    Bucket& bucket = bucket_for(key);
+    auto it = find_in_bucket(bucket, key);
     
-    if (it != m_buckets[index].end()) {
-        it->value = value;
+    if (it != bucket.end()) {
+        it->second = value;
         return false;  // Assigned
     }
     
     check_rehash();
-    index = get_bucket_index(key);
-    m_buckets[index].emplace_back(key, value);
+    bucket_for(key).emplace_back(key, value);
     ++m_size;
     return true;  // Inserted
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-bool HashTable<Key, Value, Hash, KeyEqual>::insert_or_assign(
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+bool HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::insert_or_assign(
     Key&& key, Value&& value) {
     
-    size_type index = get_bucket_index(key);
-    auto it = find_in_bucket(index, key);
+    rehash_step();
+    Bucket& bucket = bucket_for(key);
+    auto it = find_in_bucket(bucket, key);
     
-    if (it != m_buckets[index].end()) {
-        it->value = std::move(value);
+    if (it != bucket.end()) {
+        it->second = std::move(value);
         return false;
     }
     
     check_rehash();
-    index = get_bucket_index(key);
-    m_buckets[index].emplace_back(std::move(key), std::move(value));
+    bucket_for(key).emplace_back(std::move(key), std::move(value));
     ++m_size;
     return true;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-bool HashTable<Key, Value, Hash, KeyEqual>::erase(const Key& key) {
-    size_type index = get_bucket_index(key);
-    auto& bucket = m_buckets[index];
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+bool HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::erase(const Key& key) {
+    rehash_step();
+    Bucket& bucket = bucket_for(key);
     
     for (auto it = bucket.begin(); it != bucket.end(); ++it) {
-        if (m_key_equal(it->key, key)) {
+        if (m_key_equal(it->first, key)) {
             bucket.erase(it);
             --m_size;
             return true;
@@ -295,17 +441,142 @@ bool HashTable<Key, Value, Hash, KeyEqual>::erase(const Key& key) {
     return false;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-void HashTable<Key, Value, Hash, KeyEqual>::clear() noexcept {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::iterator 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::erase(const_iterator pos) {
+    auto& buckets = pos.m_array == const_iterator::OLD_ARRAY ? m_old_buckets : m_buckets;
+    Bucket* bucket = buckets.data() + (pos.m_current - buckets.data());
+    iterator next(this, pos.m_array, bucket, buckets.data() + buckets.size(),
+                  bucket->erase(pos.m_it));
+    --m_size;
+    if (next.m_it == bucket->end()) {
+        next.next_bucket();
+    }
+    return next;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::iterator 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::erase(iterator pos) {
+    return erase(const_iterator(pos));
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::node_type 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::extract(const_iterator pos) {
+    auto& buckets = pos.m_array == const_iterator::OLD_ARRAY ? m_old_buckets : m_buckets;
+    Bucket& bucket = buckets[pos.m_current - buckets.data()];
+    node_type node(m_alloc);
+    node.m_node.splice(node.m_node.end(), bucket, pos.m_it);
+    --m_size;
+    return node;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::node_type 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::extract(const Key& key) {
+    rehash_step();
+    Bucket& bucket = bucket_for(key);
+    auto it = find_in_bucket(bucket, key);
+    
+    node_type node(m_alloc);
+    if (it != bucket.end()) {
+        node.m_node.splice(node.m_node.end(), bucket, it);
+        --m_size;
+    }
+    return node;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+std::pair<bool, bool> HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::insert(node_type&& node) {
+    if (node.empty()) {
+        return {false, false};
+    }
+    
+    rehash_step();
+    const Key& key = node.key();
+    Bucket& bucket = bucket_for(key);
+    if (find_in_bucket(bucket, key) != bucket.end()) {
+        return {true, false};
+    }
+    
+    check_rehash();
+    Bucket& target = bucket_for(key);
+    if (node.m_node.get_allocator() == m_alloc) {
+        target.splice(target.end(), node.m_node);
+    } else {
+        // Nodes cannot change allocators: rebuild the entry in a new node.
+        // The stored key is const, so it is copied; the value is moved.
+        target.emplace_back(node.m_node.front().first, std::move(node.m_node.front().second));
+        node.m_node.clear();
+    }
+    ++m_size;
+    return {true, true};
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::merge(HashTable& source) {
+    if (&source == this) {
+        return;
+    }
+    
+    // Size once up front so the splices below never trigger a rehash
+    reserve(m_size + source.m_size);
+    const bool splice = m_alloc == source.m_alloc;
+    for (auto* buckets : {&source.m_old_buckets, &source.m_buckets}) {
+        for (auto& bucket : *buckets) {
+            for (auto it = bucket.begin(); it != bucket.end();) {
+                auto next = std::next(it);
+                Bucket& target = bucket_for(it->first);
+                if (find_in_bucket(target, it->first) == target.end()) {
+                    if (splice) {
+                        target.splice(target.end(), bucket, it);
+                    } else {
+                        // The stored key is const: copy it, move the value
+                        target.emplace_back(it->first, std::move(it->second));
+                        bucket.erase(it);
+                    }
+                    ++m_size;
+                    --source.m_size;
+                }
+                it = next;
+            }
+        }
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::merge(HashTable&& source) {
+    merge(source);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::clear() noexcept {
     for (auto& bucket : m_buckets) {
         bucket.clear();
     }
+    std::vector<Bucket>().swap(m_old_buckets);
+    m_rehash_pos = 0;
     m_size = 0;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-void HashTable<Key, Value, Hash, KeyEqual>::swap(HashTable& other) noexcept {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::swap(HashTable& other) noexcept {
+    std::swap(m_alloc, other.m_alloc);
     m_buckets.swap(other.m_buckets);
+    m_old_buckets.swap(other.m_old_buckets);
+    std::swap(m_rehash_pos, other.m_rehash_pos);
+    std::swap(m_rehash_step, other.m_rehash_step);
+    std::swap(m_incremental, other.m_incremental);
     std::swap(m_size, other.m_size);
     std::swap(m_max_load_factor, other.m_max_load_factor);
     std::swap(m_hasher, other.m_hasher);
@@ -313,58 +584,95 @@ void HashTable<Key, Value, Hash, KeyEqual>::swap(HashTable& other) noexcept {
 }
 
 // Lookup
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-Value* HashTable<Key, Value, Hash, KeyEqual>::find(const Key& key) {
-    size_type index = get_bucket_index(key);
-    auto it = find_in_bucket(index, key);
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+Value* HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::find(const Key& key) {
+    auto& bucket = bucket_for(key);
+    auto it = find_in_bucket(bucket, key);
     
-    if (it != m_buckets[index].end()) {
-        return &(it->value);
+    if (it != bucket.end()) {
+        return &(it->second);
     }
     return nullptr;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-const Value* HashTable<Key, Value, Hash, KeyEqual>::find(const Key& key) const {
-    size_type index = get_bucket_index(key);
-    auto it = find_in_bucket(index, key);
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+const Value* HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::find(const Key& key) const {
+    auto& bucket = bucket_for(key);
+    auto it = find_in_bucket(bucket, key);
     
-    if (it != m_buckets[index].end()) {
-        return &(it->value);
+    if (it != bucket.end()) {
+        return &(it->second);
     }
     return nullptr;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-bool HashTable<Key, Value, Hash, KeyEqual>::contains(const Key& key) const {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::find_batch(
+    const Key* keys, size_type count, Value** results) {
+    find_batch_impl(keys, count, results);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::find_batch(
+    const Key* keys, size_type count, const Value** results) const {
+    find_batch_impl(keys, count, results);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::find_batch(
+    const std::vector<Key>& keys, std::vector<Value*>& results) {
+    results.resize(keys.size());
+    find_batch_impl(keys.data(), keys.size(), results.data());
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::find_batch(
+    const std::vector<Key>& keys, std::vector<const Value*>& results) const {
+    results.resize(keys.size());
+    find_batch_impl(keys.data(), keys.size(), results.data());
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+bool HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::contains(const Key& key) const {
     return find(key) != nullptr;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-typename HashTable<Key, Value, Hash, KeyEqual>::size_type 
-HashTable<Key, Value, Hash, KeyEqual>::count(const Key& key) const {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::size_type 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::count(const Key& key) const {
     return contains(key) ? 1 : 0;
 }
 
 // Bucket interface
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-typename HashTable<Key, Value, Hash, KeyEqual>::size_type 
-HashTable<Key, Value, Hash, KeyEqual>::bucket_size(size_type n) const {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::size_type 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::bucket_size(size_type n) const {
     if (n >= m_buckets.size()) {
         return 0;
     }
     return m_buckets[n].size();
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-typename HashTable<Key, Value, Hash, KeyEqual>::size_type 
-HashTable<Key, Value, Hash, KeyEqual>::bucket(const Key& key) const {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::size_type 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::bucket(const Key& key) const {
     return get_bucket_index(key);
 }
 
 // Hash policy
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-void HashTable<Key, Value, Hash, KeyEqual>::reserve(size_type count) {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::reserve(size_type count) {
     size_type needed_buckets = static_cast<size_type>(
         std::ceil(count / m_max_load_factor));
     if (needed_buckets > m_buckets.size()) {
@@ -372,151 +680,237 @@ void HashTable<Key, Value, Hash, KeyEqual>::reserve(size_type count) {
     }
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-void HashTable<Key, Value, Hash, KeyEqual>::rehash(size_type count) {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::rehash(size_type count) {
     size_type new_bucket_count = std::max(count, 
         static_cast<size_type>(std::ceil(m_size / m_max_load_factor)));
-    new_bucket_count = next_prime(new_bucket_count);
+    new_bucket_count = BucketPolicy::round_bucket_count(new_bucket_count);
     
+    finish_rehash();
     if (new_bucket_count == m_buckets.size()) {
         return;
     }
     
-    std::vector<Bucket> new_buckets(new_bucket_count);
-    
-    for (auto& bucket : m_buckets) {
-        for (auto& entry : bucket) {
-            size_type new_index = m_hasher(entry.key) % new_bucket_count;
-            new_buckets[new_index].emplace_back(std::move(entry.key), std::move(entry.value));
-        }
-    }
-    
-    m_buckets = std::move(new_buckets);
+    // Splice nodes across instead of reallocating them
+    m_old_buckets = std::move(m_buckets);
+    m_buckets = make_buckets(new_bucket_count);
+    finish_rehash();
 }
 
 // Observers
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-typename HashTable<Key, Value, Hash, KeyEqual>::hasher 
-HashTable<Key, Value, Hash, KeyEqual>::hash_function() const {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::hasher 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::hash_function() const {
     return m_hasher;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-typename HashTable<Key, Value, Hash, KeyEqual>::key_equal 
-HashTable<Key, Value, Hash, KeyEqual>::key_eq() const {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::key_equal 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::key_eq() const {
     return m_key_equal;
 }
 
 // Iteration support
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-void HashTable<Key, Value, Hash, KeyEqual>::for_each(
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::iterator 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::begin() {
+    iterator it;
+    it.m_table = this;
+    it.seek(iterator::OLD_ARRAY, m_rehash_pos);
+    return it;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::const_iterator 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::begin() const {
+    const_iterator it;
+    it.m_table = this;
+    it.seek(const_iterator::OLD_ARRAY, m_rehash_pos);
+    return it;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::const_iterator 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::cbegin() const {
+    return begin();
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::iterator 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::end() noexcept {
+    return iterator();
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::const_iterator 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::end() const noexcept {
+    return const_iterator();
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::const_iterator 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::cend() const noexcept {
+    return end();
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::for_each(
     std::function<void(const Key&, Value&)> func) {
     
-    for (auto& bucket : m_buckets) {
-        for (auto& entry : bucket) {
-            func(entry.key, entry.value);
+    for (auto* buckets : {&m_old_buckets, &m_buckets}) {
+        for (auto& bucket : *buckets) {
+            for (auto& entry : bucket) {
+                func(entry.first, entry.second);
+            }
         }
     }
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-void HashTable<Key, Value, Hash, KeyEqual>::for_each(
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::for_each(
     std::function<void(const Key&, const Value&)> func) const {
     
-    for (const auto& bucket : m_buckets) {
-        for (const auto& entry : bucket) {
-            func(entry.key, entry.value);
+    for (const auto* buckets : {&m_old_buckets, &m_buckets}) {
+        for (const auto& bucket : *buckets) {
+            for (const auto& entry : bucket) {
+                func(entry.first, entry.second);
+            }
         }
     }
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-std::vector<Key> HashTable<Key, Value, Hash, KeyEqual>::keys() const {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+std::vector<Key> HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::keys() const {
     std::vector<Key> result;
     result.reserve(m_size);
     
-    for (const auto& bucket : m_buckets) {
-        for (const auto& entry : bucket) {
-            result.push_back(entry.key);
+    for (const auto* buckets : {&m_old_buckets, &m_buckets}) {
+        for (const auto& bucket : *buckets) {
+            for (const auto& entry : bucket) {
+                result.push_back(entry.first);
+            }
         }
     }
     return result;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-std::vector<Value> HashTable<Key, Value, Hash, KeyEqual>::values() const {
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+std::vector<Value> HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::values() const {
     std::vector<Value> result;
     result.reserve(m_size);
     
-    for (const auto& bucket : m_buckets) {
-        for (const auto& entry : bucket) {
-            result.push_back(entry.value);
+    for (const auto* buckets : {&m_old_buckets, &m_buckets}) {
+        for (const auto& bucket : *buckets) {
+            for (const auto& entry : bucket) {
+                result.push_back(entry.second);
+            }
         }
     }
     return result;
 }
 
 // Private helpers
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-typename HashTable<Key, Value, Hash, KeyEqual>::size_type 
-HashTable<Key, Value, Hash, KeyEqual>::get_bucket_index(const Key& key) const {
-    return m_hasher(key) % m_buckets.size();
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::size_type 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::get_bucket_index(const Key& key) const {
+    return bucket_index(hash_key(key), m_buckets.size());
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-typename HashTable<Key, Value, Hash, KeyEqual>::Bucket::iterator 
-HashTable<Key, Value, Hash, KeyEqual>::find_in_bucket(size_type bucket_index, const Key& key) {
-    auto& bucket = m_buckets[bucket_index];
-    for (auto it = bucket.begin(); it != bucket.end(); ++it) {
-        if (m_key_equal(it->key, key)) {
-            return it;
-        }
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::size_type 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::bucket_index(
+    size_type hash, size_type count) noexcept {
+    return BucketPolicy::index(hash, count);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::check_rehash() {
+    if (load_factor() <= m_max_load_factor) {
+        return;
+    }
+    if (!m_incremental) {
+        rehash(m_buckets.size() * 2);
+        return;
     }
-    return bucket.end();
+    
+    // Start a migration; the old array is drained by rehash_step()
+    finish_rehash();
+    m_old_buckets = std::move(m_buckets);
+    m_buckets = make_buckets(BucketPolicy::round_bucket_count(m_old_buckets.size() * 2));
+    m_rehash_pos = 0;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-typename HashTable<Key, Value, Hash, KeyEqual>::Bucket::const_iterator 
-HashTable<Key, Value, Hash, KeyEqual>::find_in_bucket(size_type bucket_index, const Key& key) const {
-    const auto& bucket = m_buckets[bucket_index];
-    for (auto it = bucket.begin(); it != bucket.end(); ++it) {
-        if (m_key_equal(it->key, key)) {
-            return it;
-        }
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::rehash_step() {
+    if (m_old_buckets.empty()) {
+        return;
+    }
+    size_type end = std::min(m_rehash_pos + m_rehash_step, m_old_buckets.size());
+    for (; m_rehash_pos < end; ++m_rehash_pos) {
+        migrate_bucket(m_old_buckets[m_rehash_pos]);
+    }
+    if (m_rehash_pos == m_old_buckets.size()) {
+        std::vector<Bucket>().swap(m_old_buckets);
+        m_rehash_pos = 0;
     }
-    return bucket.end();
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-void HashTable<Key, Value, Hash, KeyEqual>::check_rehash() {
-    if (load_factor() > m_max_load_factor) {
-        rehash(m_buckets.size() * 2);
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+void HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::migrate_bucket(Bucket& bucket) {
+    while (!bucket.empty()) {
+        Bucket& target = m_buckets[bucket_index(hash_key(bucket.front().first), m_buckets.size())];
+        target.splice(target.end(), bucket, bucket.begin());
     }
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-typename HashTable<Key, Value, Hash, KeyEqual>::size_type 
-HashTable<Key, Value, Hash, KeyEqual>::next_prime(size_type n) {
-    if (n <= 2) return 2;
-    if (n % 2 == 0) ++n;
-    
-    while (!is_prime(n)) {
-        n += 2;
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+std::vector<typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::Bucket> 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::make_buckets(size_type count) const {
+    if constexpr (std::allocator_traits<ValueAllocator>::is_always_equal::value) {
+        return std::vector<Bucket>(count);
+    } else {
+        std::vector<Bucket> buckets;
+        buckets.reserve(count);
+        for (size_type i = 0; i < count; ++i) {
+            buckets.emplace_back(m_alloc);
+        }
+        return buckets;
     }
-    return n;
 }
 
-template <typename Key, typename Value, typename Hash, typename KeyEqual>
-bool HashTable<Key, Value, Hash, KeyEqual>::is_prime(size_type n) {
-    if (n < 2) return false;
-    if (n == 2) return true;
-    if (n % 2 == 0) return false;
-    
-    size_type sqrt_n = static_cast<size_type>(std::sqrt(n));
-    for (size_type i = 3; i <= sqrt_n; i += 2) {
-        if (n % i == 0) return false;
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename BucketPolicy,
+          typename Allocator>
+std::vector<typename HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::Bucket> 
+HashTable<Key, Value, Hash, KeyEqual, BucketPolicy, Allocator>::copy_buckets(const std::vector<Bucket>& source) const {
+    if constexpr (std::allocator_traits<ValueAllocator>::is_always_equal::value) {
+        return source;
+    } else {
+        // Copying a list would give every bucket its own allocator
+        std::vector<Bucket> buckets = make_buckets(source.size());
+        for (size_type i = 0; i < source.size(); ++i) {
+            buckets[i].insert(buckets[i].end(), source[i].begin(), source[i].end());
+        }
+        return buckets;
     }
-    return true;
 }
 
 // Explicit template instantiations for common types
@@ -528,5 +922,27 @@ template class HashTable<std::string, double>;
 template class HashTable<std::string, std::string>;
 template class HashTable<long, long>;
 template class HashTable<long long, long long>;
+
+// Division-free bucket policies
+template class HashTable<int, int, std::hash<int>, std::equal_to<int>, PowerOfTwoBucketPolicy>;
+template class HashTable<int, int, std::hash<int>, std::equal_to<int>, FastRangeBucketPolicy>;
+template class HashTable<long long, long long, std::hash<long long>, std::equal_to<long long>,
+                         PowerOfTwoBucketPolicy>;
+template class HashTable<long long, long long, std::hash<long long>, std::equal_to<long long>,
+                         FastRangeBucketPolicy>;
+template class HashTable<std::string, int, std::hash<std::string>, std::equal_to<std::string>,
+                         PowerOfTwoBucketPolicy>;
+template class HashTable<std::string, int, std::hash<std::string>, std::equal_to<std::string>,
+                         FastRangeBucketPolicy>;
+
+// Transparent string keys (heterogeneous lookup)
+template class HashTable<std::string, int, StringHash, std::equal_to<>>;
+template class HashTable<std::string, std::string, StringHash, std::equal_to<>>;
+
+// Pool-backed entry nodes
+template class HashTable<int, int, std::hash<int>, std::equal_to<int>, PrimeBucketPolicy,
+                         memory::PoolAllocator<std::pair<const int, int>>>;
+template class HashTable<long long, long long, std::hash<long long>, std::equal_to<long long>,
+                         PrimeBucketPolicy, memory::PoolAllocator<std::pair<const long long, long long>>>;
 } // namespace hash
 } // namespace mylib
\ No newline at end of file
@@ -7,40 +7,64 @@
  */
 
 #include "linear/deque.hpp"
+#include <algorithm>
+#include <string>
+#include <type_traits>
 
 namespace mylib {
 namespace linear {
 
 // Constructors
 template <typename T>
-Deque<T>::Deque() : m_container() {
+Deque<T>::Deque() : m_map(nullptr), m_map_size(0), m_start(0), m_size(0) {
 }
 
 template <typename T>
-Deque<T>::Deque(size_type count, const T& value)
-    : m_container(count, value) {
+Deque<T>::Deque(size_type count, const T& value) : Deque() {
+    for (size_type i = 0; i < count; ++i) {
+        emplace_back_impl(value);
+    }
 }
 
 template <typename T>
-Deque<T>::Deque(std::initializer_list<T> init)
-    : m_container(init) {
+Deque<T>::Deque(std::initializer_list<T> init) : Deque() {
+    for (const auto& value : init) {
+        emplace_back_impl(value);
+    }
 }
 
 template <typename T>
-Deque<T>::Deque(const Deque& other)
-    : m_container(other.m_container) {
+Deque<T>::Deque(const Deque& other) : Deque() {
+    for (size_type i = 0; i < other.m_size; ++i) {
+        emplace_back_impl(other[i]);
+    }
 }
 
 template <typename T>
 Deque<T>::Deque(Deque&& other) noexcept
-    : m_container(std::move(other.m_container)) {
+    : m_map(other.m_map)
+    , m_map_size(other.m_map_size)
+    , m_start(other.m_start)
+    , m_size(other.m_size) {
+    other.m_map = nullptr;
+    other.m_map_size = 0;
+    other.m_start = 0;
+    other.m_size = 0;
+}
+
+// Destructor
+template <typename T>
+Deque<T>::~Deque() {
+    clear();
+    release();
 }
 
 // Assignment operators
 template <typename T>
 Deque<T>& Deque<T>::operator=(const Deque& other) {
     if (this != &other) {
-        m_container = other.m_container;
+        Deque temp(other);
+        swap(temp);
     }
     return *this;
 }
@@ -48,7 +72,16 @@ Deque<T>& Deque<T>::operator=(const Deque& other) {
 template <typename T>
 Deque<T>& Deque<T>::operator=(Deque&& other) noexcept {
     if (this != &other) {
-        m_container = std::move(other.m_container);
+        clear();
+        release();
+        m_map = other.m_map;
+        m_map_size = other.m_map_size;
+        m_start = other.m_start;
+        m_size = other.m_size;
+        other.m_map = nullptr;
+        other.m_map_size = 0;
+        other.m_start = 0;
+        other.m_size = 0;
     }
     return *this;
 }
@@ -56,22 +89,18 @@ Deque<T>& Deque<T>::operator=(Deque&& other) noexcept {
 // Element access
 template <typename T>
 typename Deque<T>::reference Deque<T>::at(size_type index) {
-    return m_container.at(index);
+    if (index >= m_size) {
+        throw std::out_of_range("Deque::at: index out of range");
+    }
+    return *slot_at(m_start + index);
 }
 
 template <typename T>
 typename Deque<T>::const_reference Deque<T>::at(size_type index) const {
-    return m_container.at(index);
-}
-
-template <typename T>
-typename Deque<T>::reference Deque<T>::operator[](size_type index) {
-    return m_container[index];
-}
-
-template <typename T>
-typename Deque<T>::const_reference Deque<T>::operator[](size_type index) const {
-    return m_container[index];
+    if (index >= m_size) {
+        throw std::out_of_range("Deque::at: index out of range");
+    }
+    return *slot_at(m_start + index);
 }
 
 template <typename T>
@@ -79,7 +108,7 @@ typename Deque<T>::reference Deque<T>::front() {
     if (empty()) {
         throw std::out_of_range("Deque::front: deque is empty");
     }
-    return m_container.front();
+    return *slot_at(m_start);
 }
 
 template <typename T>
@@ -87,7 +116,7 @@ typename Deque<T>::const_reference Deque<T>::front() const {
     if (empty()) {
         throw std::out_of_range("Deque::front: deque is empty");
     }
-    return m_container.front();
+    return *slot_at(m_start);
 }
 
 template <typename T>
@@ -95,7 +124,7 @@ typename Deque<T>::reference Deque<T>::back() {
     if (empty()) {
         throw std::out_of_range("Deque::back: deque is empty");
     }
-    return m_container.back();
+    return *slot_at(m_start + m_size - 1);
 }
 
 template <typename T>
@@ -103,110 +132,226 @@ typename Deque<T>::const_reference Deque<T>::back() const {
     if (empty()) {
         throw std::out_of_range("Deque::back: deque is empty");
     }
-    return m_container.back();
+    return *slot_at(m_start + m_size - 1);
 }
 
 // Capacity
 template <typename T>
 bool Deque<T>::empty() const noexcept {
-    return m_container.empty();
+    return m_size == 0;
 }
 
 template <typename T>
 typename Deque<T>::size_type Deque<T>::size() const noexcept {
-    return m_container.size();
+    return m_size;
 }
 
-// Modifiers
 template <typename T>
-void Deque<T>::clear() noexcept {
-    m_container.clear();
-}
-
-template <typename T>
-void Deque<T>::push_front(const T& value) {
-    m_container.push_front(value);
-}
-
-template <typename T>
-void Deque<T>::push_front(T&& value) {
-    m_container.push_front(std::move(value));
-}
-
-template <typename T>
-void Deque<T>::push_back(const T& value) {
-    m_container.push_back(value);
-}
-
-template <typename T>
-void Deque<T>::push_back(T&& value) {
-    m_container.push_back(std::move(value));
+typename Deque<T>::size_type Deque<T>::capacity() const noexcept {
+    size_type blocks = 0;
+    for (size_type i = 0; i < m_map_size; ++i) {
+        if (m_map[i]) {
+            ++blocks;
+        }
+    }
+    return blocks * BLOCK_SIZE;
 }
 
 template <typename T>
-void Deque<T>::pop_front() {
-    if (empty()) {
-        throw std::out_of_range("Deque::pop_front: deque is empty");
+void Deque<T>::shrink_to_fit() {
+    if (m_size == 0) {
+        release();
+        m_start = 0;
+        return;
+    }
+    size_type first = m_start >> BLOCK_SHIFT;
+    size_type last = (m_start + m_size - 1) >> BLOCK_SHIFT;
+    BlockAllocator alloc;
+    for (size_type i = 0; i < m_map_size; ++i) {
+        if (m_map[i] && (i < first || i > last)) {
+            BlockTraits::deallocate(alloc, m_map[i], BLOCK_SIZE);
+            m_map[i] = nullptr;
+        }
     }
-    m_container.pop_front();
 }
 
+// Modifiers
 template <typename T>
-void Deque<T>::pop_back() {
-    if (empty()) {
-        throw std::out_of_range("Deque::pop_back: deque is empty");
+void Deque<T>::clear() noexcept {
+    if (!std::is_trivially_destructible<T>::value) {
+        BlockAllocator alloc;
+        for (size_type i = 0; i < m_size; ++i) {
+            BlockTraits::destroy(alloc, slot_at(m_start + i));
+        }
     }
-    m_container.pop_back();
+    m_size = 0;
+    // Restart in the middle so both ends can grow without re-centring
+    m_start = (m_map_size / 2) << BLOCK_SHIFT;
 }
 
 template <typename T>
 void Deque<T>::insert(size_type index, const T& value) {
-    m_container.insert(index, value);
+    insert_impl(index, value);
 }
 
 template <typename T>
 void Deque<T>::insert(size_type index, T&& value) {
-    m_container.insert(index, std::move(value));
+    insert_impl(index, std::move(value));
 }
 
 template <typename T>
 void Deque<T>::erase(size_type index) {
-    m_container.erase(index);
+    if (index >= m_size) {
+        throw std::out_of_range("Deque::erase: index out of range");
+    }
+    // Close the gap from whichever side is shorter
+    if (index < m_size / 2) {
+        for (size_type i = index; i > 0; --i) {
+            (*this)[i] = std::move((*this)[i - 1]);
+        }
+        pop_front();
+    } else {
+        for (size_type i = index; i + 1 < m_size; ++i) {
+            (*this)[i] = std::move((*this)[i + 1]);
+        }
+        pop_back();
+    }
 }
 
 template <typename T>
 void Deque<T>::resize(size_type count) {
-    m_container.resize(count);
+    while (m_size > count) {
+        pop_back();
+    }
+    while (m_size < count) {
+        emplace_back_impl(T());
+    }
 }
 
 template <typename T>
 void Deque<T>::resize(size_type count, const T& value) {
-    m_container.resize(count, value);
+    while (m_size > count) {
+        pop_back();
+    }
+    while (m_size < count) {
+        emplace_back_impl(value);
+    }
 }
 
 template <typename T>
 void Deque<T>::swap(Deque& other) noexcept {
-    m_container.swap(other.m_container);
+    std::swap(m_map, other.m_map);
+    std::swap(m_map_size, other.m_map_size);
+    std::swap(m_start, other.m_start);
+    std::swap(m_size, other.m_size);
 }
 
 template <typename T>
 void Deque<T>::reverse() noexcept {
-    m_container.reverse();
+    for (size_type i = 0, j = m_size; i + 1 < j; ++i, --j) {
+        std::swap((*this)[i], (*this)[j - 1]);
+    }
 }
 
 template <typename T>
 typename Deque<T>::size_type Deque<T>::remove(const T& value) {
-    return m_container.remove(value);
+    const T target(value);  // value may be an element of this deque
+    size_type write = 0;
+    for (size_type read = 0; read < m_size; ++read) {
+        if (!((*this)[read] == target)) {
+            if (write != read) {
+                (*this)[write] = std::move((*this)[read]);
+            }
+            ++write;
+        }
+    }
+    size_type removed = m_size - write;
+    while (m_size > write) {
+        pop_back();
+    }
+    return removed;
 }
 
 template <typename T>
 typename Deque<T>::size_type Deque<T>::find(const T& value) const {
-    return m_container.find(value);
+    for (size_type i = 0; i < m_size; ++i) {
+        if ((*this)[i] == value) {
+            return i;
+        }
+    }
+    return m_size;
 }
 
 template <typename T>
 bool Deque<T>::contains(const T& value) const {
-    return m_container.contains(value);
+    return find(value) != m_size;
+}
+
+// Private helpers
+template <typename T>
+void Deque<T>::allocate_block(size_type slot) {
+    BlockAllocator alloc;
+    m_map[slot] = BlockTraits::allocate(alloc, BLOCK_SIZE);
+}
+
+template <typename T>
+void Deque<T>::reserve_map(bool at_front) {
+    // Slots [first, last) hold the elements (or the start position if empty)
+    size_type first = m_start >> BLOCK_SHIFT;
+    size_type last = m_size == 0 ? first + 1 : ((m_start + m_size - 1) >> BLOCK_SHIFT) + 1;
+    if (m_map_size == 0) {
+        last = first;
+    }
+    size_type used = last - first;
+    size_type needed = used + 1;
+
+    size_type new_size = m_map_size;
+    if (new_size < 2 * needed) {
+        new_size = std::max(MIN_MAP_SIZE, 2 * std::max(m_map_size, needed));
+    }
+
+    T** new_map = new T*[new_size]();
+    size_type new_first = (new_size - needed) / 2 + (at_front ? 1 : 0);
+    for (size_type i = 0; i < used; ++i) {
+        new_map[new_first + i] = m_map[first + i];
+    }
+
+    // Hand spare blocks to the free slots on the growing side first
+    size_type front_slot = new_first;
+    size_type back_slot = new_first + used;
+    BlockAllocator alloc;
+    for (size_type i = 0; i < m_map_size; ++i) {
+        if (!m_map[i] || (i >= first && i < last)) {
+            continue;
+        }
+        bool front_free = front_slot > 0;
+        bool back_free = back_slot < new_size;
+        if (front_free && (at_front || !back_free)) {
+            new_map[--front_slot] = m_map[i];
+        } else if (back_free) {
+            new_map[back_slot++] = m_map[i];
+        } else {
+            BlockTraits::deallocate(alloc, m_map[i], BLOCK_SIZE);
+        }
+    }
+
+    delete[] m_map;
+    m_map = new_map;
+    m_map_size = new_size;
+    m_start = (new_first << BLOCK_SHIFT) + (m_start & BLOCK_MASK);
+}
+
+template <typename T>
+void Deque<T>::release() noexcept {
+    BlockAllocator alloc;
+    for (size_type i = 0; i < m_map_size; ++i) {
+        if (m_map[i]) {
+            BlockTraits::deallocate(alloc, m_map[i], BLOCK_SIZE);
+        }
+    }
+    delete[] m_map;
+    m_map = nullptr;
+    m_map_size = 0;
 }
 
 // Explicit template instantiations for common types
@@ -219,6 +364,7 @@ template class Deque<long long>;
 template class Deque<unsigned int>;
 template class Deque<unsigned long>;
 template class Deque<unsigned long long>;
+template class Deque<std::string>;
 
 } // namespace linear
 } // namespace mylib
\ No newline at end of file
@@ -12,49 +12,56 @@ namespace mylib {
 namespace linear {
 
 // Constructors
-template <typename T>
-LinkedList<T>::LinkedList() 
-    : m_head(nullptr), m_tail(nullptr), m_size(0) {
+template <typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList() 
+    : m_head(nullptr), m_tail(nullptr), m_size(0), m_alloc() {
 }
 
-template <typename T>
-LinkedList<T>::LinkedList(size_type count, const T& value)
-    : m_head(nullptr), m_tail(nullptr), m_size(0) {
+template <typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList(const Allocator& alloc)
+    : m_head(nullptr), m_tail(nullptr), m_size(0), m_alloc(alloc) {
+}
+
+template <typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList(size_type count, const T& value)
+    : m_head(nullptr), m_tail(nullptr), m_size(0), m_alloc() {
     for (size_type i = 0; i < count; ++i) {
         push_back(value);
     }
 }
 
-template <typename T>
-LinkedList<T>::LinkedList(std::initializer_list<T> init)
-    : m_head(nullptr), m_tail(nullptr), m_size(0) {
+template <typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList(std::initializer_list<T> init)
+    : m_head(nullptr), m_tail(nullptr), m_size(0), m_alloc() {
     for (const auto& item : init) {
         push_back(item);
     }
 }
 
-template <typename T>
-LinkedList<T>::LinkedList(const LinkedList& other)
-    : m_head(nullptr), m_tail(nullptr), m_size(0) {
+template <typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList(const LinkedList& other)
+    : m_head(nullptr), m_tail(nullptr), m_size(0),
+      m_alloc(NodeTraits::select_on_container_copy_construction(other.m_alloc)) {
     copy_from(other);
 }
 
-template <typename T>
-LinkedList<T>::LinkedList(LinkedList&& other) noexcept
-    : m_head(other.m_head), m_tail(other.m_tail), m_size(other.m_size) {
+template <typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList(LinkedList&& other) noexcept
+    : m_head(other.m_head), m_tail(other.m_tail), m_size(other.m_size),
+      m_alloc(other.m_alloc) {
     other.m_head = nullptr;
     other.m_tail = nullptr;
     other.m_size = 0;
 }
 
-template <typename T>
-LinkedList<T>::~LinkedList() {
+template <typename T, typename Allocator>
+LinkedList<T, Allocator>::~LinkedList() {
     clear();
 }
 
 // Assignment operators
-template <typename T>
-LinkedList<T>& LinkedList<T>::operator=(const LinkedList& other) {
+template <typename T, typename Allocator>
+LinkedList<T, Allocator>& LinkedList<T, Allocator>::operator=(const LinkedList& other) {
     if (this != &other) {
         clear();
         copy_from(other);
@@ -62,10 +69,22 @@ LinkedList<T>& LinkedList<T>::operator=(const LinkedList& other) {
     return *this;
 }
 
-template <typename T>
-LinkedList<T>& LinkedList<T>::operator=(LinkedList&& other) noexcept {
+template <typename T, typename Allocator>
+LinkedList<T, Allocator>& LinkedList<T, Allocator>::operator=(LinkedList&& other) noexcept {
     if (this != &other) {
         clear();
+        if (!NodeTraits::propagate_on_container_move_assignment::value &&
+            !(m_alloc == other.m_alloc)) {
+            // Nodes cannot change allocators: move element by element
+            for (Node* current = other.m_head; current; current = current->next) {
+                push_back(std::move(current->data));
+            }
+            other.clear();
+            return *this;
+        }
+        if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+            m_alloc = other.m_alloc;
+        }
         m_head = other.m_head;
         m_tail = other.m_tail;
         m_size = other.m_size;
@@ -77,93 +96,154 @@ LinkedList<T>& LinkedList<T>::operator=(LinkedList&& other) noexcept {
     return *this;
 }
 
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::allocator_type LinkedList<T, Allocator>::get_allocator() const {
+    return allocator_type(m_alloc);
+}
+
 // Element access
-template <typename T>
-typename LinkedList<T>::reference LinkedList<T>::at(size_type index) {
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::reference LinkedList<T, Allocator>::at(size_type index) {
     if (index >= m_size) {
         throw std::out_of_range("LinkedList::at: index out of range");
     }
     return get_node(index)->data;
 }
 
-template <typename T>
-typename LinkedList<T>::const_reference LinkedList<T>::at(size_type index) const {
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::const_reference LinkedList<T, Allocator>::at(size_type index) const {
     if (index >= m_size) {
         throw std::out_of_range("LinkedList::at: index out of range");
     }
     return get_node(index)->data;
 }
 
-template <typename T>
-typename LinkedList<T>::reference LinkedList<T>::operator[](size_type index) {
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::reference LinkedList<T, Allocator>::operator[](size_type index) {
     return get_node(index)->data;
 }
 
-template <typename T>
-typename LinkedList<T>::const_reference LinkedList<T>::operator[](size_type index) const {
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::const_reference LinkedList<T, Allocator>::operator[](size_type index) const {
     return get_node(index)->data;
 }
 
-template <typename T>
-typename LinkedList<T>::reference LinkedList<T>::front() {
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::reference LinkedList<T, Allocator>::front() {
     if (empty()) {
         throw std::out_of_range("LinkedList::front: list is empty");
     }
     return m_head->data;
 }
 
-template <typename T>
-typename LinkedList<T>::const_reference LinkedList<T>::front() const {
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::const_reference LinkedList<T, Allocator>::front() const {
     if (empty()) {
         throw std::out_of_range("LinkedList::front: list is empty");
     }
     return m_head->data;
 }
 
-template <typename T>
-typename LinkedList<T>::reference LinkedList<T>::back() {
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::reference LinkedList<T, Allocator>::back() {
     if (empty()) {
         throw std::out_of_range("LinkedList::back: list is empty");
     }
     return m_tail->data;
 }
 
-template <typename T>
-typename LinkedList<T>::const_reference LinkedList<T>::back() const {
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::const_reference LinkedList<T, Allocator>::back() const {
     if (empty()) {
         throw std::out_of_range("LinkedList::back: list is empty");
     }
     return m_tail->data;
 }
 
+// Iterators
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::begin() noexcept {
+    return iterator(m_head, this);
+}
+
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::const_iterator LinkedList<T, Allocator>::begin() const noexcept {
+    return const_iterator(m_head, this);
+}
+
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::const_iterator LinkedList<T, Allocator>::cbegin() const noexcept {
+    return begin();
+}
+
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::end() noexcept {
+    return iterator(nullptr, this);
+}
+
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::const_iterator LinkedList<T, Allocator>::end() const noexcept {
+    return const_iterator(nullptr, this);
+}
+
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::const_iterator LinkedList<T, Allocator>::cend() const noexcept {
+    return end();
+}
+
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::reverse_iterator LinkedList<T, Allocator>::rbegin() noexcept {
+    return reverse_iterator(end());
+}
+
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::const_reverse_iterator LinkedList<T, Allocator>::rbegin() const noexcept {
+    return const_reverse_iterator(end());
+}
+
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::reverse_iterator LinkedList<T, Allocator>::rend() noexcept {
+    return reverse_iterator(begin());
+}
+
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::const_reverse_iterator LinkedList<T, Allocator>::rend() const noexcept {
+    return const_reverse_iterator(begin());
+}
+
 // Capacity
-template <typename T>
-bool LinkedList<T>::empty() const noexcept {
+template <typename T, typename Allocator>
+bool LinkedList<T, Allocator>::empty() const noexcept {
     return m_size == 0;
 }
 
-template <typename T>
-typename LinkedList<T>::size_type LinkedList<T>::size() const noexcept {
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::size_type LinkedList<T, Allocator>::size() const noexcept {
     return m_size;
 }
 
 // Modifiers
-template <typename T>
-void LinkedList<T>::clear() noexcept {
-    Node* current = m_head;
-    while (current) {
-        Node* next = current->next;
-        delete current;
-        current = next;
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::clear() noexcept {
+    if (std::is_trivially_destructible<Node>::value && BulkRelease::exclusive(m_alloc)) {
+        // Sole owner of a pool: drop every slab without visiting the nodes
+        BulkRelease::release(m_alloc);
+    } else {
+        Node* current = m_head;
+        while (current) {
+            Node* next = current->next;
+            destroy_node(current);
+            current = next;
+        }
     }
     m_head = nullptr;
     m_tail = nullptr;
     m_size = 0;
 }
 
-template <typename T>
-void LinkedList<T>::push_front(const T& value) {
-    Node* new_node = new Node(value);
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::push_front(const T& value) {
+    Node* new_node = create_node(value);
     
     if (empty()) {
         m_head = m_tail = new_node;
@@ -176,9 +256,9 @@ void LinkedList<T>::push_front(const T& value) {
     ++m_size;
 }
 
-template <typename T>
-void LinkedList<T>::push_front(T&& value) {
-    Node* new_node = new Node(std::move(value));
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::push_front(T&& value) {
+    Node* new_node = create_node(std::move(value));
     
     if (empty()) {
         m_head = m_tail = new_node;
@@ -191,9 +271,9 @@ void LinkedList<T>::push_front(T&& value) {
     ++m_size;
 }
 
-template <typename T>
-void LinkedList<T>::push_back(const T& value) {
-    Node* new_node = new Node(value);
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::push_back(const T& value) {
+    Node* new_node = create_node(value);
     
     if (empty()) {
         m_head = m_tail = new_node;
@@ -206,9 +286,9 @@ void LinkedList<T>::push_back(const T& value) {
     ++m_size;
 }
 
-template <typename T>
-void LinkedList<T>::push_back(T&& value) {
-    Node* new_node = new Node(std::move(value));
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::push_back(T&& value) {
+    Node* new_node = create_node(std::move(value));
     
     if (empty()) {
         m_head = m_tail = new_node;
@@ -221,8 +301,8 @@ void LinkedList<T>::push_back(T&& value) {
     ++m_size;
 }
 
-template <typename T>
-void LinkedList<T>::pop_front() {
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::pop_front() {
     if (empty()) {
         throw std::out_of_range("LinkedList::pop_front: list is empty");
     }
@@ -236,12 +316,12 @@ void LinkedList<T>::pop_front() {
         m_tail = nullptr;
     }
     
-    delete old_head;
+    destroy_node(old_head);
     --m_size;
 }
 
-template <typename T>
-void LinkedList<T>::pop_back() {
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::pop_back() {
     if (empty()) {
         throw std::out_of_range("LinkedList::pop_back: list is empty");
     }
@@ -255,12 +335,12 @@ void LinkedList<T>::pop_back() {
         m_head = nullptr;
     }
     
-    delete old_tail;
+    destroy_node(old_tail);
     --m_size;
 }
 
-template <typename T>
-void LinkedList<T>::insert(size_type index, const T& value) {
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::insert(size_type index, const T& value) {
     if (index > m_size) {
         throw std::out_of_range("LinkedList::insert: index out of range");
     }
@@ -275,7 +355,7 @@ void LinkedList<T>::insert(size_type index, const T& value) {
         return;
     }
     
-    Node* new_node = new Node(value);
+    Node* new_node = create_node(value);
     Node* current = get_node(index);
     
     new_node->next = current;
@@ -286,8 +366,8 @@ void LinkedList<T>::insert(size_type index, const T& value) {
     ++m_size;
 }
 
-template <typename T>
-void LinkedList<T>::insert(size_type index, T&& value) {
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::insert(size_type index, T&& value) {
     if (index > m_size) {
         throw std::out_of_range("LinkedList::insert: index out of range");
     }
@@ -302,7 +382,7 @@ void LinkedList<T>::insert(size_type index, T&& value) {
         return;
     }
     
-    Node* new_node = new Node(std::move(value));
+    Node* new_node = create_node(std::move(value));
     Node* current = get_node(index);
     
     new_node->next = current;
@@ -313,8 +393,8 @@ void LinkedList<T>::insert(size_type index, T&& value) {
     ++m_size;
 }
 
-template <typename T>
-void LinkedList<T>::erase(size_type index) {
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::erase(size_type index) {
     if (index >= m_size) {
         throw std::out_of_range("LinkedList::erase: index out of range");
     }
@@ -333,12 +413,133 @@ void LinkedList<T>::erase(size_type index) {
     current->prev->next = current->next;
     current->next->prev = current->prev;
     
-    delete current;
+    destroy_node(current);
     --m_size;
 }
 
-template <typename T>
-void LinkedList<T>::resize(size_type count) {
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::iterator
+LinkedList<T, Allocator>::insert(const_iterator pos, const T& value) {
+    Node* node = create_node(value);
+    link_before(const_cast<Node*>(pos.m_node), node, node);
+    ++m_size;
+    return iterator(node, this);
+}
+
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::iterator
+LinkedList<T, Allocator>::insert(const_iterator pos, T&& value) {
+    Node* node = create_node(std::move(value));
+    link_before(const_cast<Node*>(pos.m_node), node, node);
+    ++m_size;
+    return iterator(node, this);
+}
+
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::erase(const_iterator pos) {
+    Node* node = const_cast<Node*>(pos.m_node);
+    Node* next = node->next;
+    unlink_range(node, node);
+    destroy_node(node);
+    --m_size;
+    return iterator(next, this);
+}
+
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::iterator
+LinkedList<T, Allocator>::erase(const_iterator first, const_iterator last) {
+    while (first != last) {
+        first = erase(first);
+    }
+    return iterator(const_cast<Node*>(last.m_node), this);
+}
+
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::splice(const_iterator pos, LinkedList& other) {
+    if (&other == this) {
+        throw std::invalid_argument("LinkedList::splice: cannot splice a list into itself");
+    }
+    if (other.empty()) {
+        return;
+    }
+    if (!(m_alloc == other.m_alloc)) {
+        // Nodes cannot change allocators: move element by element
+        for (Node* current = other.m_head; current; current = current->next) {
+            insert(pos, std::move(current->data));
+        }
+        other.clear();
+        return;
+    }
+    link_before(const_cast<Node*>(pos.m_node), other.m_head, other.m_tail);
+    m_size += other.m_size;
+    other.m_head = nullptr;
+    other.m_tail = nullptr;
+    other.m_size = 0;
+}
+
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::splice(const_iterator pos, LinkedList& other, const_iterator it) {
+    Node* node = const_cast<Node*>(it.m_node);
+    Node* target = const_cast<Node*>(pos.m_node);
+    if (&other == this) {
+        if (node == target || node->next == target) {
+            return;   // Already in place
+        }
+        unlink_range(node, node);
+        link_before(target, node, node);
+        return;
+    }
+    if (!(m_alloc == other.m_alloc)) {
+        insert(pos, std::move(node->data));
+        other.erase(it);
+        return;
+    }
+    other.unlink_range(node, node);
+    --other.m_size;
+    link_before(target, node, node);
+    ++m_size;
+}
+
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::splice(const_iterator pos, LinkedList& other,
+                                      const_iterator first, const_iterator last) {
+    if (first == last) {
+        return;
+    }
+    if (&other != this && !(m_alloc == other.m_alloc)) {
+        while (first != last) {
+            insert(pos, std::move(const_cast<Node*>(first.m_node)->data));
+            first = other.erase(first);
+        }
+        return;
+    }
+
+    Node* head = const_cast<Node*>(first.m_node);
+    Node* tail = last.m_node ? const_cast<Node*>(last.m_node)->prev : other.m_tail;
+    if (&other != this) {
+        size_type count = 1;
+        for (Node* current = head; current != tail; current = current->next) {
+            ++count;
+        }
+        other.m_size -= count;
+        m_size += count;
+    }
+    other.unlink_range(head, tail);
+    link_before(const_cast<Node*>(pos.m_node), head, tail);
+}
+
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::merge(LinkedList& other) {
+    merge(other, std::less<T>());
+}
+
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::sort() {
+    sort(std::less<T>());
+}
+
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::resize(size_type count) {
     while (m_size > count) {
         pop_back();
     }
@@ -348,8 +549,8 @@ void LinkedList<T>::resize(size_type count) {
     }
 }
 
-template <typename T>
-void LinkedList<T>::resize(size_type count, const T& value) {
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::resize(size_type count, const T& value) {
     while (m_size > count) {
         pop_back();
     }
@@ -359,15 +560,18 @@ void LinkedList<T>::resize(size_type count, const T& value) {
     }
 }
 
-template <typename T>
-void LinkedList<T>::swap(LinkedList& other) noexcept {
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::swap(LinkedList& other) noexcept {
     std::swap(m_head, other.m_head);
     std::swap(m_tail, other.m_tail);
     std::swap(m_size, other.m_size);
+    if constexpr (NodeTraits::propagate_on_container_swap::value) {
+        std::swap(m_alloc, other.m_alloc);
+    }
 }
 
-template <typename T>
-void LinkedList<T>::reverse() noexcept {
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::reverse() noexcept {
     if (m_size <= 1) {
         return;
     }
@@ -387,8 +591,8 @@ void LinkedList<T>::reverse() noexcept {
     m_tail = temp;
 }
 
-template <typename T>
-typename LinkedList<T>::size_type LinkedList<T>::remove(const T& value) {
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::size_type LinkedList<T, Allocator>::remove(const T& value) {
     size_type removed_count = 0;
     Node* current = m_head;
     
@@ -403,7 +607,7 @@ typename LinkedList<T>::size_type LinkedList<T>::remove(const T& value) {
             } else {
                 current->prev->next = current->next;
                 current->next->prev = current->prev;
-                delete current;
+                destroy_node(current);
                 --m_size;
             }
             ++removed_count;
@@ -415,8 +619,8 @@ typename LinkedList<T>::size_type LinkedList<T>::remove(const T& value) {
     return removed_count;
 }
 
-template <typename T>
-typename LinkedList<T>::size_type LinkedList<T>::find(const T& value) const {
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::size_type LinkedList<T, Allocator>::find(const T& value) const {
     Node* current = m_head;
     size_type index = 0;
     
@@ -431,14 +635,20 @@ typename LinkedList<T>::size_type LinkedList<T>::find(const T& value) const {
     return m_size;
 }
 
-template <typename T>
-bool LinkedList<T>::contains(const T& value) const {
+template <typename T, typename Allocator>
+bool LinkedList<T, Allocator>::contains(const T& value) const {
     return find(value) != m_size;
 }
 
 // Private helper methods
-template <typename T>
-typename LinkedList<T>::Node* LinkedList<T>::get_node(size_type index) const {
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::destroy_node(Node* node) noexcept {
+    NodeTraits::destroy(m_alloc, node);
+    NodeTraits::deallocate(m_alloc, node, 1);
+}
+
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::Node* LinkedList<T, Allocator>::get_node(size_type index) const {
     Node* current;
     
     // Optimize by starting from the closer end
@@ -457,8 +667,8 @@ typename LinkedList<T>::Node* LinkedList<T>::get_node(size_type index) const {
     return current;
 }
 
-template <typename T>
-void LinkedList<T>::copy_from(const LinkedList& other) {
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::copy_from(const LinkedList& other) {
     Node* current = other.m_head;
     while (current) {
         push_back(current->data);
@@ -466,6 +676,63 @@ void LinkedList<T>::copy_from(const LinkedList& other) {
     }
 }
 
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::link_before(Node* pos, Node* first, Node* last) noexcept {
+    Node* prev = pos ? pos->prev : m_tail;
+    first->prev = prev;
+    last->next = pos;
+    if (prev) {
+        prev->next = first;
+    } else {
+        m_head = first;
+    }
+    if (pos) {
+        pos->prev = last;
+    } else {
+        m_tail = last;
+    }
+}
+
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::unlink_range(Node* first, Node* last) noexcept {
+    if (first->prev) {
+        first->prev->next = last->next;
+    } else {
+        m_head = last->next;
+    }
+    if (last->next) {
+        last->next->prev = first->prev;
+    } else {
+        m_tail = first->prev;
+    }
+    first->prev = nullptr;
+    last->next = nullptr;
+}
+
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::relink_prev(Node* first) noexcept {
+    Node* prev = nullptr;
+    for (Node* current = first; current; current = current->next) {
+        current->prev = prev;
+        prev = current;
+    }
+    m_head = first;
+    m_tail = prev;
+}
+
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::Node* LinkedList<T, Allocator>::append_run(Node* first, Node* second) noexcept {
+    if (!first) {
+        return second;
+    }
+    Node* last = first;
+    while (last->next) {
+        last = last->next;
+    }
+    last->next = second;
+    return first;
+}
+
 // Explicit template instantiations for common types
 template class LinkedList<int>;
 template class LinkedList<double>;
@@ -477,5 +744,9 @@ template class LinkedList<unsigned int>;
 template class LinkedList<unsigned long>;
 template class LinkedList<unsigned long long>;
 
+// Pool-backed lists
+template class LinkedList<int, memory::PoolAllocator<int>>;
+template class LinkedList<long long, memory::PoolAllocator<long long>>;
+
 } // namespace linear
 } // namespace mylib
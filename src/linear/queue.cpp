@@ -7,30 +7,68 @@
  */
 
 #include "linear/queue.hpp"
+#include <string>
 
 namespace mylib {
 namespace linear {
 
 // Constructors
 template <typename T>
-Queue<T>::Queue() : m_container() {
+Queue<T>::Queue()
+    : m_data(nullptr), m_capacity(0), m_head(0), m_size(0), m_bounded(false) {
 }
 
 template <typename T>
-Queue<T>::Queue(const Queue& other) 
-    : m_container(other.m_container) {
+Queue<T> Queue<T>::bounded(size_type capacity) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Queue::bounded: capacity must be positive");
+    }
+    Queue queue;
+    queue.reallocate(capacity);
+    queue.m_bounded = true;
+    return queue;
+}
+
+template <typename T>
+Queue<T>::Queue(const Queue& other) : Queue() {
+    size_type capacity = other.m_bounded ? other.m_capacity : other.m_size;
+    if (capacity > 0) {
+        reallocate(capacity);
+    }
+    m_bounded = other.m_bounded;
+    for (size_type i = 0; i < other.m_size; ++i) {
+        push_impl(other.m_data[other.wrap(other.m_head + i)]);
+    }
 }
 
 template <typename T>
-Queue<T>::Queue(Queue&& other) noexcept 
-    : m_container(std::move(other.m_container)) {
+Queue<T>::Queue(Queue&& other) noexcept
+    : m_data(other.m_data)
+    , m_capacity(other.m_capacity)
+    , m_head(other.m_head)
+    , m_size(other.m_size)
+    , m_bounded(other.m_bounded) {
+    other.m_data = nullptr;
+    other.m_capacity = 0;
+    other.m_head = 0;
+    other.m_size = 0;
+    other.m_bounded = false;
+}
+
+// Destructor
+template <typename T>
+Queue<T>::~Queue() {
+    clear();
+    Alloc alloc;
+    AllocTraits::deallocate(alloc, m_data, m_capacity);
 }
 
 // Assignment operators
 template <typename T>
 Queue<T>& Queue<T>::operator=(const Queue& other) {
     if (this != &other) {
-        m_container = other.m_container;
+        Queue temp(other);
+        swap(temp);
     }
     return *this;
 }
@@ -38,82 +76,97 @@ Queue<T>& Queue<T>::operator=(const Queue& other) {
 template <typename T>
 Queue<T>& Queue<T>::operator=(Queue&& other) noexcept {
     if (this != &other) {
-        m_container = std::move(other.m_container);
+        Queue temp(std::move(other));
+        swap(temp);
     }
     return *this;
 }
 
-// Element access
+// Capacity
 template <typename T>
-typename Queue<T>::reference Queue<T>::front() {
-    if (empty()) {
-        throw std::out_of_range("Queue::front: queue is empty");
-    }
-    return m_container.front();
+typename Queue<T>::size_type Queue<T>::capacity() const noexcept {
+    return m_capacity;
 }
 
 template <typename T>
-typename Queue<T>::const_reference Queue<T>::front() const {
-    if (empty()) {
-        throw std::out_of_range("Queue::front: queue is empty");
-    }
-    return m_container.front();
+bool Queue<T>::is_bounded() const noexcept {
+    return m_bounded;
 }
 
 template <typename T>
-typename Queue<T>::reference Queue<T>::back() {
-    if (empty()) {
-        throw std::out_of_range("Queue::back: queue is empty");
+void Queue<T>::reserve(size_type new_capacity) {
+    if (new_capacity <= m_capacity) {
+        return;
     }
-    return m_container.back();
-}
-
-template <typename T>
-typename Queue<T>::const_reference Queue<T>::back() const {
-    if (empty()) {
-        throw std::out_of_range("Queue::back: queue is empty");
+    if (m_bounded) {
+        throw std::length_error("Queue::reserve: capacity of a bounded queue is fixed");
     }
-    return m_container.back();
-}
-
-// Capacity
-template <typename T>
-bool Queue<T>::empty() const noexcept {
-    return m_container.empty();
-}
-
-template <typename T>
-typename Queue<T>::size_type Queue<T>::size() const noexcept {
-    return m_container.size();
+    reallocate(new_capacity);
 }
 
 // Modifiers
 template <typename T>
-void Queue<T>::push(const T& value) {
-    m_container.push_back(value);
+void Queue<T>::clear() noexcept {
+    Alloc alloc;
+    for (size_type i = 0; i < m_size; ++i) {
+        AllocTraits::destroy(alloc, m_data + wrap(m_head + i));
+    }
+    m_head = 0;
+    m_size = 0;
 }
 
 template <typename T>
-void Queue<T>::push(T&& value) {
-    m_container.push_back(std::move(value));
+void Queue<T>::swap(Queue& other) noexcept {
+    std::swap(m_data, other.m_data);
+    std::swap(m_capacity, other.m_capacity);
+    std::swap(m_head, other.m_head);
+    std::swap(m_size, other.m_size);
+    std::swap(m_bounded, other.m_bounded);
 }
 
+// Private helpers
 template <typename T>
-void Queue<T>::pop() {
-    if (empty()) {
-        throw std::out_of_range("Queue::pop: queue is empty");
+typename Queue<T>::size_type Queue<T>::grow_capacity() const {
+    if (m_bounded) {
+        throw std::length_error("Queue::push: queue is full");
     }
-    m_container.pop_front();
+    return m_capacity < MIN_CAPACITY ? MIN_CAPACITY : m_capacity * 2;
 }
 
 template <typename T>
-void Queue<T>::clear() noexcept {
-    m_container.clear();
+void Queue<T>::reallocate(size_type new_capacity) {
+    Alloc alloc;
+    T* new_data = AllocTraits::allocate(alloc, new_capacity);
+    try {
+        adopt(new_data, new_capacity);
+    } catch (...) {
+        AllocTraits::deallocate(alloc, new_data, new_capacity);
+        throw;
+    }
 }
 
 template <typename T>
-void Queue<T>::swap(Queue& other) noexcept {
-    m_container.swap(other.m_container);
+void Queue<T>::adopt(T* new_data, size_type new_capacity) {
+    Alloc alloc;
+    size_type moved = 0;
+    try {
+        for (; moved < m_size; ++moved) {
+            AllocTraits::construct(alloc, new_data + moved,
+                                   std::move_if_noexcept(m_data[wrap(m_head + moved)]));
+        }
+    } catch (...) {
+        for (size_type i = 0; i < moved; ++i) {
+            AllocTraits::destroy(alloc, new_data + i);
+        }
+        throw;
+    }
+    size_type count = m_size;
+    clear();
+    AllocTraits::deallocate(alloc, m_data, m_capacity);
+    m_data = new_data;
+    m_capacity = new_capacity;
+    m_head = 0;
+    m_size = count;
 }
 
 // Explicit template instantiations for common types
@@ -126,6 +179,7 @@ template class Queue<long long>;
 template class Queue<unsigned int>;
 template class Queue<unsigned long>;
 template class Queue<unsigned long long>;
+template class Queue<std::string>;
 
 } // namespace linear
 } // namespace mylib
\ No newline at end of file
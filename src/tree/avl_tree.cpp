@@ -14,53 +14,71 @@ namespace mylib {
 namespace tree {
 
 // Constructors
-template <typename T>
-AVLTree<T>::AVLTree()
-    : m_root(nullptr), m_size(0) {
+template <typename T, typename Allocator>
+AVLTree<T, Allocator>::AVLTree()
+    : m_root(nullptr), m_size(0), m_alloc() {
 }
 
-template <typename T>
-AVLTree<T>::AVLTree(std::initializer_list<T> init)
-    : m_root(nullptr), m_size(0) {
+template <typename T, typename Allocator>
+AVLTree<T, Allocator>::AVLTree(const Allocator& alloc)
+    : m_root(nullptr), m_size(0), m_alloc(alloc) {
+}
+
+template <typename T, typename Allocator>
+AVLTree<T, Allocator>::AVLTree(std::initializer_list<T> init)
+    : m_root(nullptr), m_size(0), m_alloc() {
     for (const auto& item : init) {
         insert(item);
     }
 }
 
-template <typename T>
-AVLTree<T>::AVLTree(const AVLTree& other)
-    : m_root(nullptr), m_size(0) {
+template <typename T, typename Allocator>
+AVLTree<T, Allocator>::AVLTree(const AVLTree& other)
+    : m_root(nullptr), m_size(0),
+      m_alloc(NodeTraits::select_on_container_copy_construction(other.m_alloc)) {
     m_root = copy_tree(other.m_root);
     m_size = other.m_size;
 }
 
-template <typename T>
-AVLTree<T>::AVLTree(AVLTree&& other) noexcept
-    : m_root(other.m_root), m_size(other.m_size) {
+template <typename T, typename Allocator>
+AVLTree<T, Allocator>::AVLTree(AVLTree&& other) noexcept
+    : m_root(other.m_root), m_size(other.m_size), m_alloc(other.m_alloc) {
     other.m_root = nullptr;
     other.m_size = 0;
 }
 
-template <typename T>
-AVLTree<T>::~AVLTree() {
-    destroy(m_root);
+template <typename T, typename Allocator>
+AVLTree<T, Allocator>::~AVLTree() {
+    destroy_all();
 }
 
 // Assignment operators
-template <typename T>
-AVLTree<T>& AVLTree<T>::operator=(const AVLTree& other) {
+template <typename T, typename Allocator>
+AVLTree<T, Allocator>& AVLTree<T, Allocator>::operator=(const AVLTree& other) {
     if (this != &other) {
-        destroy(m_root);
+        destroy_all();
         m_root = copy_tree(other.m_root);
         m_size = other.m_size;
     }
     return *this;
 }
 
-template <typename T>
-AVLTree<T>& AVLTree<T>::operator=(AVLTree&& other) noexcept {
+template <typename T, typename Allocator>
+AVLTree<T, Allocator>& AVLTree<T, Allocator>::operator=(AVLTree&& other) noexcept {
     if (this != &other) {
-        destroy(m_root);
+        destroy_all();
+        m_size = 0;
+        if (!NodeTraits::propagate_on_container_move_assignment::value &&
+            !(m_alloc == other.m_alloc)) {
+            // Nodes cannot change allocators: copy the shape node by node
+            m_root = copy_tree(other.m_root);
+            m_size = other.m_size;
+            other.clear();
+            return *this;
+        }
+        if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+            m_alloc = other.m_alloc;
+        }
         m_root = other.m_root;
         m_size = other.m_size;
         other.m_root = nullptr;
@@ -69,48 +87,54 @@ AVLTree<T>& AVLTree<T>::operator=(AVLTree&& other) noexcept {
     return *this;
 }
 
+template <typename T, typename Allocator>
+typename AVLTree<T, Allocator>::allocator_type
+AVLTree<T, Allocator>::get_allocator() const {
+    return allocator_type(m_alloc);
+}
+
 // Capacity
-template <typename T>
-bool AVLTree<T>::empty() const noexcept {
+template <typename T, typename Allocator>
+bool AVLTree<T, Allocator>::empty() const noexcept {
     return m_size == 0;
 }
 
-template <typename T>
-typename AVLTree<T>::size_type AVLTree<T>::size() const noexcept {
+template <typename T, typename Allocator>
+typename AVLTree<T, Allocator>::size_type AVLTree<T, Allocator>::size() const noexcept {
     return m_size;
 }
 
-template <typename T>
-typename AVLTree<T>::size_type AVLTree<T>::height() const noexcept {
+template <typename T, typename Allocator>
+typename AVLTree<T, Allocator>::size_type AVLTree<T, Allocator>::height() const noexcept {
     return static_cast<size_type>(get_height(m_root));
 }
 
 // Height helpers
-template <typename T>
-int AVLTree<T>::get_height(Node* node) const noexcept {
+template <typename T, typename Allocator>
+int AVLTree<T, Allocator>::get_height(Node* node) const noexcept {
     return node ? node->height : 0;
 }
 
-template <typename T>
-void AVLTree<T>::update_height(Node* node) noexcept {
+template <typename T, typename Allocator>
+void AVLTree<T, Allocator>::update_height(Node* node) noexcept {
     if (node) {
         node->height = 1 + std::max(get_height(node->left), get_height(node->right));
     }
 }
 
-template <typename T>
-int AVLTree<T>::get_balance(Node* node) const noexcept {
+template <typename T, typename Allocator>
+int AVLTree<T, Allocator>::get_balance(Node* node) const noexcept {
     return node ? get_height(node->left) - get_height(node->right) : 0;
 }
 
-template <typename T>
-int AVLTree<T>::balance_factor() const noexcept {
+template <typename T, typename Allocator>
+int AVLTree<T, Allocator>::balance_factor() const noexcept {
     return get_balance(m_root);
 }
 
 // Rotation operations
-template <typename T>
-typename AVLTree<T>::Node* AVLTree<T>::rotate_right(Node* y) {
+template <typename T, typename Allocator>
+typename AVLTree<T, Allocator>::Node* AVLTree<T, Allocator>::rotate_right(Node* y) {
     //       y                x
     //      / \             /   \
     //     x   T3   -->    T1    y
@@ -131,8 +155,8 @@ typename AVLTree<T>::Node* AVLTree<T>::rotate_right(Node* y) {
     return x;  // New root
 }
 
-template <typename T>
-typename AVLTree<T>::Node* AVLTree<T>::rotate_left(Node* x) {
+template <typename T, typename Allocator>
+typename AVLTree<T, Allocator>::Node* AVLTree<T, Allocator>::rotate_left(Node* x) {
     //     x                  y
     //    / \               /   \
     //   T1  y     -->     x    T3
@@ -153,8 +177,8 @@ typename AVLTree<T>::Node* AVLTree<T>::rotate_left(Node* x) {
     return y;  // New root
 }
 
-template <typename T>
-typename AVLTree<T>::Node* AVLTree<T>::rebalance(Node* node) {
+template <typename T, typename Allocator>
+typename AVLTree<T, Allocator>::Node* AVLTree<T, Allocator>::rebalance(Node* node) {
     if (!node) {
         return nullptr;
     }
@@ -193,8 +217,8 @@ typename AVLTree<T>::Node* AVLTree<T>::rebalance(Node* node) {
 }
 
 // Modifiers
-template <typename T>
-bool AVLTree<T>::insert(const T& value) {
+template <typename T, typename Allocator>
+bool AVLTree<T, Allocator>::insert(const T& value) {
     bool inserted = false;
     m_root = insert_recursive(m_root, value, inserted);
     if (inserted) {
@@ -203,8 +227,8 @@ bool AVLTree<T>::insert(const T& value) {
     return inserted;
 }
 
-template <typename T>
-bool AVLTree<T>::insert(T&& value) {
+template <typename T, typename Allocator>
+bool AVLTree<T, Allocator>::insert(T&& value) {
     bool inserted = false;
     m_root = insert_recursive(m_root, std::move(value), inserted);
     if (inserted) {
@@ -213,8 +237,8 @@ bool AVLTree<T>::insert(T&& value) {
     return inserted;
 }
 
-template <typename T>
-bool AVLTree<T>::remove(const T& value) {
+template <typename T, typename Allocator>
+bool AVLTree<T, Allocator>::remove(const T& value) {
     bool removed = false;
     m_root = remove_recursive(m_root, value, removed);
     if (removed) {
@@ -223,28 +247,30 @@ bool AVLTree<T>::remove(const T& value) {
     return removed;
 }
 
-template <typename T>
-void AVLTree<T>::clear() noexcept {
-    destroy(m_root);
-    m_root = nullptr;
+template <typename T, typename Allocator>
+void AVLTree<T, Allocator>::clear() noexcept {
+    destroy_all();
     m_size = 0;
 }
 
-template <typename T>
-void AVLTree<T>::swap(AVLTree& other) noexcept {
+template <typename T, typename Allocator>
+void AVLTree<T, Allocator>::swap(AVLTree& other) noexcept {
     std::swap(m_root, other.m_root);
     std::swap(m_size, other.m_size);
+    if constexpr (NodeTraits::propagate_on_container_swap::value) {
+        std::swap(m_alloc, other.m_alloc);
+    }
 }
 
 // Recursive insert
-template <typename T>
-typename AVLTree<T>::Node* AVLTree<T>::insert_recursive(
+template <typename T, typename Allocator>
+typename AVLTree<T, Allocator>::Node* AVLTree<T, Allocator>::insert_recursive(
     Node* node, const T& value, bool& inserted) {
     
     // Base case: found insertion point
     if (!node) {
         inserted = true;
-        return new Node(value);
+        return create_node(value);
     }
     
     // BST insertion
@@ -261,13 +287,13 @@ typename AVLTree<T>::Node* AVLTree<T>::insert_recursive(
     return rebalance(node);
 }
 
-template <typename T>
-typename AVLTree<T>::Node* AVLTree<T>::insert_recursive(
+template <typename T, typename Allocator>
+typename AVLTree<T, Allocator>::Node* AVLTree<T, Allocator>::insert_recursive(
     Node* node, T&& value, bool& inserted) {
     
     if (!node) {
         inserted = true;
-        return new Node(std::move(value));
+        return create_node(std::move(value));
     }
     
     if (value < node->data) {
@@ -282,8 +308,8 @@ typename AVLTree<T>::Node* AVLTree<T>::insert_recursive(
 }
 
 // Recursive remove
-template <typename T>
-typename AVLTree<T>::Node* AVLTree<T>::remove_recursive(
+template <typename T, typename Allocator>
+typename AVLTree<T, Allocator>::Node* AVLTree<T, Allocator>::remove_recursive(
     Node* node, const T& value, bool& removed) {
     
     if (!node) {
@@ -305,11 +331,11 @@ typename AVLTree<T>::Node* AVLTree<T>::remove_recursive(
             
             if (!child) {
                 // No child case
-                delete node;
+                destroy_node(node);
                 return nullptr;
             } else {
                 // One child case
-                delete node;
+                destroy_node(node);
                 return child;
             }
         }
@@ -329,27 +355,27 @@ typename AVLTree<T>::Node* AVLTree<T>::remove_recursive(
 }
 
 // Lookup
-template <typename T>
-bool AVLTree<T>::contains(const T& value) const {
+template <typename T, typename Allocator>
+bool AVLTree<T, Allocator>::contains(const T& value) const {
     return search(m_root, value) != nullptr;
 }
 
-template <typename T>
-const T* AVLTree<T>::find(const T& value) const {
+template <typename T, typename Allocator>
+const T* AVLTree<T, Allocator>::find(const T& value) const {
     Node* node = search(m_root, value);
     return node ? &(node->data) : nullptr;
 }
 
-template <typename T>
-typename AVLTree<T>::const_reference AVLTree<T>::min() const {
+template <typename T, typename Allocator>
+typename AVLTree<T, Allocator>::const_reference AVLTree<T, Allocator>::min() const {
     if (empty()) {
         throw std::out_of_range("AVLTree::min: tree is empty");
     }
     return find_min(m_root)->data;
 }
 
-template <typename T>
-typename AVLTree<T>::const_reference AVLTree<T>::max() const {
+template <typename T, typename Allocator>
+typename AVLTree<T, Allocator>::const_reference AVLTree<T, Allocator>::max() const {
     if (empty()) {
         throw std::out_of_range("AVLTree::max: tree is empty");
     }
@@ -357,8 +383,8 @@ typename AVLTree<T>::const_reference AVLTree<T>::max() const {
 }
 
 // Search helpers
-template <typename T>
-typename AVLTree<T>::Node* AVLTree<T>::search(Node* node, const T& value) const {
+template <typename T, typename Allocator>
+typename AVLTree<T, Allocator>::Node* AVLTree<T, Allocator>::search(Node* node, const T& value) const {
     while (node) {
         if (value < node->data) {
             node = node->left;
@@ -371,16 +397,16 @@ typename AVLTree<T>::Node* AVLTree<T>::search(Node* node, const T& value) const
     return nullptr;
 }
 
-template <typename T>
-typename AVLTree<T>::Node* AVLTree<T>::find_min(Node* node) const {
+template <typename T, typename Allocator>
+typename AVLTree<T, Allocator>::Node* AVLTree<T, Allocator>::find_min(Node* node) const {
     while (node && node->left) {
         node = node->left;
     }
     return node;
 }
 
-template <typename T>
-typename AVLTree<T>::Node* AVLTree<T>::find_max(Node* node) const {
+template <typename T, typename Allocator>
+typename AVLTree<T, Allocator>::Node* AVLTree<T, Allocator>::find_max(Node* node) const {
     while (node && node->right) {
         node = node->right;
     }
@@ -388,23 +414,23 @@ typename AVLTree<T>::Node* AVLTree<T>::find_max(Node* node) const {
 }
 
 // Traversal
-template <typename T>
-void AVLTree<T>::inorder(std::function<void(const T&)> visitor) const {
+template <typename T, typename Allocator>
+void AVLTree<T, Allocator>::inorder(std::function<void(const T&)> visitor) const {
     inorder_recursive(m_root, visitor);
 }
 
-template <typename T>
-void AVLTree<T>::preorder(std::function<void(const T&)> visitor) const {
+template <typename T, typename Allocator>
+void AVLTree<T, Allocator>::preorder(std::function<void(const T&)> visitor) const {
     preorder_recursive(m_root, visitor);
 }
 
-template <typename T>
-void AVLTree<T>::postorder(std::function<void(const T&)> visitor) const {
+template <typename T, typename Allocator>
+void AVLTree<T, Allocator>::postorder(std::function<void(const T&)> visitor) const {
     postorder_recursive(m_root, visitor);
 }
 
-template <typename T>
-void AVLTree<T>::levelorder(std::function<void(const T&)> visitor) const {
+template <typename T, typename Allocator>
+void AVLTree<T, Allocator>::levelorder(std::function<void(const T&)> visitor) const {
     if (!m_root) {
         return;
     }
@@ -428,8 +454,8 @@ void AVLTree<T>::levelorder(std::function<void(const T&)> visitor) const {
 }
 
 // Traversal helpers
-template <typename T>
-void AVLTree<T>::inorder_recursive(
+template <typename T, typename Allocator>
+void AVLTree<T, Allocator>::inorder_recursive(
     Node* node, std::function<void(const T&)>& visitor) const {
     
     if (node) {
@@ -439,8 +465,8 @@ void AVLTree<T>::inorder_recursive(
     }
 }
 
-template <typename T>
-void AVLTree<T>::preorder_recursive(
+template <typename T, typename Allocator>
+void AVLTree<T, Allocator>::preorder_recursive(
     Node* node, std::function<void(const T&)>& visitor) const {
     
     if (node) {
@@ -450,8 +476,8 @@ void AVLTree<T>::preorder_recursive(
     }
 }
 
-template <typename T>
-void AVLTree<T>::postorder_recursive(
+template <typename T, typename Allocator>
+void AVLTree<T, Allocator>::postorder_recursive(
     Node* node, std::function<void(const T&)>& visitor) const {
     
     if (node) {
@@ -462,13 +488,13 @@ void AVLTree<T>::postorder_recursive(
 }
 
 // Validation
-template <typename T>
-bool AVLTree<T>::is_balanced() const {
+template <typename T, typename Allocator>
+bool AVLTree<T, Allocator>::is_balanced() const {
     return is_balanced_recursive(m_root);
 }
 
-template <typename T>
-bool AVLTree<T>::is_balanced_recursive(Node* node) const {
+template <typename T, typename Allocator>
+bool AVLTree<T, Allocator>::is_balanced_recursive(Node* node) const {
     if (!node) {
         return true;
     }
@@ -481,13 +507,13 @@ bool AVLTree<T>::is_balanced_recursive(Node* node) const {
     return is_balanced_recursive(node->left) && is_balanced_recursive(node->right);
 }
 
-template <typename T>
-bool AVLTree<T>::is_valid() const {
+template <typename T, typename Allocator>
+bool AVLTree<T, Allocator>::is_valid() const {
     return is_valid_recursive(m_root, nullptr, nullptr);
 }
 
-template <typename T>
-bool AVLTree<T>::is_valid_recursive(
+template <typename T, typename Allocator>
+bool AVLTree<T, Allocator>::is_valid_recursive(
     Node* node, const T* min_val, const T* max_val) const {
     
     if (!node) {
@@ -506,22 +532,39 @@ bool AVLTree<T>::is_valid_recursive(
 }
 
 // Memory management
-template <typename T>
-void AVLTree<T>::destroy(Node* node) noexcept {
+template <typename T, typename Allocator>
+void AVLTree<T, Allocator>::destroy(Node* node) noexcept {
     if (node) {
         destroy(node->left);
         destroy(node->right);
-        delete node;
+        destroy_node(node);
     }
 }
 
-template <typename T>
-typename AVLTree<T>::Node* AVLTree<T>::copy_tree(Node* node) const {
+template <typename T, typename Allocator>
+void AVLTree<T, Allocator>::destroy_node(Node* node) noexcept {
+    NodeTraits::destroy(m_alloc, node);
+    NodeTraits::deallocate(m_alloc, node, 1);
+}
+
+template <typename T, typename Allocator>
+void AVLTree<T, Allocator>::destroy_all() noexcept {
+    if (std::is_trivially_destructible<Node>::value && BulkRelease::exclusive(m_alloc)) {
+        // Sole owner of a pool: drop every slab without visiting the nodes
+        BulkRelease::release(m_alloc);
+    } else {
+        destroy(m_root);
+    }
+    m_root = nullptr;
+}
+
+template <typename T, typename Allocator>
+typename AVLTree<T, Allocator>::Node* AVLTree<T, Allocator>::copy_tree(Node* node) {
     if (!node) {
         return nullptr;
     }
     
-    Node* new_node = new Node(node->data);
+    Node* new_node = create_node(node->data);
     new_node->height = node->height;
     new_node->left = copy_tree(node->left);
     new_node->right = copy_tree(node->right);
@@ -540,5 +583,9 @@ template class AVLTree<unsigned int>;
 template class AVLTree<unsigned long>;
 template class AVLTree<unsigned long long>;
 
+// Pool-backed trees
+template class AVLTree<int, memory::PoolAllocator<int>>;
+template class AVLTree<long long, memory::PoolAllocator<long long>>;
+
 } // namespace tree
 } // namespace mylib
\ No newline at end of file
@@ -13,53 +13,71 @@ namespace mylib {
 namespace tree {
 
 // Constructors
-template <typename T>
-BinarySearchTree<T>::BinarySearchTree()
-    : m_root(nullptr), m_size(0) {
+template <typename T, typename Allocator>
+BinarySearchTree<T, Allocator>::BinarySearchTree()
+    : m_root(nullptr), m_size(0), m_alloc() {
 }
 
-template <typename T>
-BinarySearchTree<T>::BinarySearchTree(std::initializer_list<T> init)
-    : m_root(nullptr), m_size(0) {
+template <typename T, typename Allocator>
+BinarySearchTree<T, Allocator>::BinarySearchTree(const Allocator& alloc)
+    : m_root(nullptr), m_size(0), m_alloc(alloc) {
+}
+
+template <typename T, typename Allocator>
+BinarySearchTree<T, Allocator>::BinarySearchTree(std::initializer_list<T> init)
+    : m_root(nullptr), m_size(0), m_alloc() {
     for (const auto& item : init) {
         insert(item);
     }
 }
 
-template <typename T>
-BinarySearchTree<T>::BinarySearchTree(const BinarySearchTree& other)
-    : m_root(nullptr), m_size(0) {
+template <typename T, typename Allocator>
+BinarySearchTree<T, Allocator>::BinarySearchTree(const BinarySearchTree& other)
+    : m_root(nullptr), m_size(0),
+      m_alloc(NodeTraits::select_on_container_copy_construction(other.m_alloc)) {
     m_root = copy_tree(other.m_root);
     m_size = other.m_size;
 }
 
-template <typename T>
-BinarySearchTree<T>::BinarySearchTree(BinarySearchTree&& other) noexcept
-    : m_root(other.m_root), m_size(other.m_size) {
+template <typename T, typename Allocator>
+BinarySearchTree<T, Allocator>::BinarySearchTree(BinarySearchTree&& other) noexcept
+    : m_root(other.m_root), m_size(other.m_size), m_alloc(other.m_alloc) {
     other.m_root = nullptr;
     other.m_size = 0;
 }
 
-template <typename T>
-BinarySearchTree<T>::~BinarySearchTree() {
-    destroy(m_root);
+template <typename T, typename Allocator>
+BinarySearchTree<T, Allocator>::~BinarySearchTree() {
+    destroy_all();
 }
 
 // Assignment operators
-template <typename T>
-BinarySearchTree<T>& BinarySearchTree<T>::operator=(const BinarySearchTree& other) {
+template <typename T, typename Allocator>
+BinarySearchTree<T, Allocator>& BinarySearchTree<T, Allocator>::operator=(const BinarySearchTree& other) {
     if (this != &other) {
-        destroy(m_root);
+        destroy_all();
         m_root = copy_tree(other.m_root);
         m_size = other.m_size;
     }
     return *this;
 }
 
-template <typename T>
-BinarySearchTree<T>& BinarySearchTree<T>::operator=(BinarySearchTree&& other) noexcept {
+template <typename T, typename Allocator>
+BinarySearchTree<T, Allocator>& BinarySearchTree<T, Allocator>::operator=(BinarySearchTree&& other) noexcept {
     if (this != &other) {
-        destroy(m_root);
+        destroy_all();
+        m_size = 0;
+        if (!NodeTraits::propagate_on_container_move_assignment::value &&
+            !(m_alloc == other.m_alloc)) {
+            // Nodes cannot change allocators: copy the shape node by node
+            m_root = copy_tree(other.m_root);
+            m_size = other.m_size;
+            other.clear();
+            return *this;
+        }
+        if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+            m_alloc = other.m_alloc;
+        }
         m_root = other.m_root;
         m_size = other.m_size;
         other.m_root = nullptr;
@@ -68,25 +86,31 @@ BinarySearchTree<T>& BinarySearchTree<T>::operator=(BinarySearchTree&& other) no
     return *this;
 }
 
+template <typename T, typename Allocator>
+typename BinarySearchTree<T, Allocator>::allocator_type
+BinarySearchTree<T, Allocator>::get_allocator() const {
+    return allocator_type(m_alloc);
+}
+
 // Capacity
-template <typename T>
-bool BinarySearchTree<T>::empty() const noexcept {
+template <typename T, typename Allocator>
+bool BinarySearchTree<T, Allocator>::empty() const noexcept {
     return m_size == 0;
 }
 
-template <typename T>
-typename BinarySearchTree<T>::size_type BinarySearchTree<T>::size() const noexcept {
+template <typename T, typename Allocator>
+typename BinarySearchTree<T, Allocator>::size_type BinarySearchTree<T, Allocator>::size() const noexcept {
     return m_size;
 }
 
-template <typename T>
-typename BinarySearchTree<T>::size_type BinarySearchTree<T>::height() const noexcept {
+template <typename T, typename Allocator>
+typename BinarySearchTree<T, Allocator>::size_type BinarySearchTree<T, Allocator>::height() const noexcept {
     return height_recursive(m_root);
 }
 
 // Modifiers
-template <typename T>
-bool BinarySearchTree<T>::insert(const T& value) {
+template <typename T, typename Allocator>
+bool BinarySearchTree<T, Allocator>::insert(const T& value) {
     bool inserted = false;
     m_root = insert_recursive(m_root, value, inserted);
     if (inserted) {
@@ -95,8 +119,8 @@ bool BinarySearchTree<T>::insert(const T& value) {
     return inserted;
 }
 
-template <typename T>
-bool BinarySearchTree<T>::insert(T&& value) {
+template <typename T, typename Allocator>
+bool BinarySearchTree<T, Allocator>::insert(T&& value) {
     bool inserted = false;
     m_root = insert_recursive(m_root, std::move(value), inserted);
     if (inserted) {
@@ -105,8 +129,8 @@ bool BinarySearchTree<T>::insert(T&& value) {
     return inserted;
 }
 
-template <typename T>
-bool BinarySearchTree<T>::remove(const T& value) {
+template <typename T, typename Allocator>
+bool BinarySearchTree<T, Allocator>::remove(const T& value) {
     bool removed = false;
     m_root = remove_recursive(m_root, value, removed);
     if (removed) {
@@ -115,41 +139,43 @@ bool BinarySearchTree<T>::remove(const T& value) {
     return removed;
 }
 
-template <typename T>
-void BinarySearchTree<T>::clear() noexcept {
-    destroy(m_root);
-    m_root = nullptr;
+template <typename T, typename Allocator>
+void BinarySearchTree<T, Allocator>::clear() noexcept {
+    destroy_all();
     m_size = 0;
 }
 
-template <typename T>
-void BinarySearchTree<T>::swap(BinarySearchTree& other) noexcept {
+template <typename T, typename Allocator>
+void BinarySearchTree<T, Allocator>::swap(BinarySearchTree& other) noexcept {
     std::swap(m_root, other.m_root);
     std::swap(m_size, other.m_size);
+    if constexpr (NodeTraits::propagate_on_container_swap::value) {
+        std::swap(m_alloc, other.m_alloc);
+    }
 }
 
 // Lookup
-template <typename T>
-bool BinarySearchTree<T>::contains(const T& value) const {
+template <typename T, typename Allocator>
+bool BinarySearchTree<T, Allocator>::contains(const T& value) const {
     return search(m_root, value) != nullptr;
 }
 
-template <typename T>
-const T* BinarySearchTree<T>::find(const T& value) const {
+template <typename T, typename Allocator>
+const T* BinarySearchTree<T, Allocator>::find(const T& value) const {
     Node* node = search(m_root, value);
     return node ? &(node->data) : nullptr;
 }
 
-template <typename T>
-typename BinarySearchTree<T>::const_reference BinarySearchTree<T>::min() const {
+template <typename T, typename Allocator>
+typename BinarySearchTree<T, Allocator>::const_reference BinarySearchTree<T, Allocator>::min() const {
     if (empty()) {
         throw std::out_of_range("BinarySearchTree::min: tree is empty");
     }
     return find_min(m_root)->data;
 }
 
-template <typename T>
-typename BinarySearchTree<T>::const_reference BinarySearchTree<T>::max() const {
+template <typename T, typename Allocator>
+typename BinarySearchTree<T, Allocator>::const_reference BinarySearchTree<T, Allocator>::max() const {
     if (empty()) {
         throw std::out_of_range("BinarySearchTree::max: tree is empty");
     }
@@ -157,23 +183,23 @@ typename BinarySearchTree<T>::const_reference BinarySearchTree<T>::max() const {
 }
 
 // Traversal
-template <typename T>
-void BinarySearchTree<T>::inorder(std::function<void(const T&)> visitor) const {
+template <typename T, typename Allocator>
+void BinarySearchTree<T, Allocator>::inorder(std::function<void(const T&)> visitor) const {
     inorder_recursive(m_root, visitor);
 }
 
-template <typename T>
-void BinarySearchTree<T>::preorder(std::function<void(const T&)> visitor) const {
+template <typename T, typename Allocator>
+void BinarySearchTree<T, Allocator>::preorder(std::function<void(const T&)> visitor) const {
     preorder_recursive(m_root, visitor);
 }
 
-template <typename T>
-void BinarySearchTree<T>::postorder(std::function<void(const T&)> visitor) const {
+template <typename T, typename Allocator>
+void BinarySearchTree<T, Allocator>::postorder(std::function<void(const T&)> visitor) const {
     postorder_recursive(m_root, visitor);
 }
 
-template <typename T>
-void BinarySearchTree<T>::levelorder(std::function<void(const T&)> visitor) const {
+template <typename T, typename Allocator>
+void BinarySearchTree<T, Allocator>::levelorder(std::function<void(const T&)> visitor) const {
     if (!m_root) {
         return;
     }
@@ -197,8 +223,8 @@ void BinarySearchTree<T>::levelorder(std::function<void(const T&)> visitor) cons
 }
 
 // Advanced operations
-template <typename T>
-const T* BinarySearchTree<T>::successor(const T& value) const {
+template <typename T, typename Allocator>
+const T* BinarySearchTree<T, Allocator>::successor(const T& value) const {
     Node* current = m_root;
     Node* successor_node = nullptr;
     
@@ -224,8 +250,8 @@ const T* BinarySearchTree<T>::successor(const T& value) const {
     return successor_node ? &(successor_node->data) : nullptr;
 }
 
-template <typename T>
-const T* BinarySearchTree<T>::predecessor(const T& value) const {
+template <typename T, typename Allocator>
+const T* BinarySearchTree<T, Allocator>::predecessor(const T& value) const {
     Node* current = m_root;
     Node* predecessor_node = nullptr;
     
@@ -251,19 +277,19 @@ const T* BinarySearchTree<T>::predecessor(const T& value) const {
     return predecessor_node ? &(predecessor_node->data) : nullptr;
 }
 
-template <typename T>
-bool BinarySearchTree<T>::is_valid() const {
+template <typename T, typename Allocator>
+bool BinarySearchTree<T, Allocator>::is_valid() const {
     return is_valid_recursive(m_root, nullptr, nullptr);
 }
 
 // Private helper functions
-template <typename T>
-typename BinarySearchTree<T>::Node* BinarySearchTree<T>::insert_recursive(
+template <typename T, typename Allocator>
+typename BinarySearchTree<T, Allocator>::Node* BinarySearchTree<T, Allocator>::insert_recursive(
     Node* node, const T& value, bool& inserted) {
     
     if (!node) {
         inserted = true;
-        return new Node(value);
+        return create_node(value);
     }
     
     if (value < node->data) {
@@ -276,13 +302,13 @@ typename BinarySearchTree<T>::Node* BinarySearchTree<T>::insert_recursive(
     return node;
 }
 
-template <typename T>
-typename BinarySearchTree<T>::Node* BinarySearchTree<T>::insert_recursive(
+template <typename T, typename Allocator>
+typename BinarySearchTree<T, Allocator>::Node* BinarySearchTree<T, Allocator>::insert_recursive(
     Node* node, T&& value, bool& inserted) {
     
     if (!node) {
         inserted = true;
-        return new Node(std::move(value));
+        return create_node(std::move(value));
     }
     
     if (value < node->data) {
@@ -295,8 +321,8 @@ typename BinarySearchTree<T>::Node* BinarySearchTree<T>::insert_recursive(
     return node;
 }
 
-template <typename T>
-typename BinarySearchTree<T>::Node* BinarySearchTree<T>::remove_recursive(
+template <typename T, typename Allocator>
+typename BinarySearchTree<T, Allocator>::Node* BinarySearchTree<T, Allocator>::remove_recursive(
     Node* node, const T& value, bool& removed) {
     
     if (!node) {
@@ -313,19 +339,19 @@ typename BinarySearchTree<T>::Node* BinarySearchTree<T>::remove_recursive(
         
         // Case 1: No children (leaf node)
         if (!node->left && !node->right) {
-            delete node;
+            destroy_node(node);
             return nullptr;
         }
         
         // Case 2: One child
         if (!node->left) {
             Node* right_child = node->right;
-            delete node;
+            destroy_node(node);
             return right_child;
         }
         if (!node->right) {
             Node* left_child = node->left;
-            delete node;
+            destroy_node(node);
             return left_child;
         }
         
@@ -341,24 +367,24 @@ typename BinarySearchTree<T>::Node* BinarySearchTree<T>::remove_recursive(
     return node;
 }
 
-template <typename T>
-typename BinarySearchTree<T>::Node* BinarySearchTree<T>::find_min(Node* node) const {
+template <typename T, typename Allocator>
+typename BinarySearchTree<T, Allocator>::Node* BinarySearchTree<T, Allocator>::find_min(Node* node) const {
     while (node && node->left) {
         node = node->left;
     }
     return node;
 }
 
-template <typename T>
-typename BinarySearchTree<T>::Node* BinarySearchTree<T>::find_max(Node* node) const {
+template <typename T, typename Allocator>
+typename BinarySearchTree<T, Allocator>::Node* BinarySearchTree<T, Allocator>::find_max(Node* node) const {
     while (node && node->right) {
         node = node->right;
     }
     return node;
 }
 
-template <typename T>
-typename BinarySearchTree<T>::Node* BinarySearchTree<T>::search(
+template <typename T, typename Allocator>
+typename BinarySearchTree<T, Allocator>::Node* BinarySearchTree<T, Allocator>::search(
     Node* node, const T& value) const {
     
     while (node) {
@@ -373,8 +399,8 @@ typename BinarySearchTree<T>::Node* BinarySearchTree<T>::search(
     return nullptr;  // Not found
 }
 
-template <typename T>
-typename BinarySearchTree<T>::size_type BinarySearchTree<T>::height_recursive(
+template <typename T, typename Allocator>
+typename BinarySearchTree<T, Allocator>::size_type BinarySearchTree<T, Allocator>::height_recursive(
     Node* node) const noexcept {
     
     if (!node) {
@@ -387,30 +413,47 @@ typename BinarySearchTree<T>::size_type BinarySearchTree<T>::height_recursive(
     return 1 + (left_height > right_height ? left_height : right_height);
 }
 
-template <typename T>
-void BinarySearchTree<T>::destroy(Node* node) noexcept {
+template <typename T, typename Allocator>
+void BinarySearchTree<T, Allocator>::destroy(Node* node) noexcept {
     if (node) {
         destroy(node->left);
         destroy(node->right);
-        delete node;
+        destroy_node(node);
     }
 }
 
-template <typename T>
-typename BinarySearchTree<T>::Node* BinarySearchTree<T>::copy_tree(Node* node) const {
+template <typename T, typename Allocator>
+void BinarySearchTree<T, Allocator>::destroy_node(Node* node) noexcept {
+    NodeTraits::destroy(m_alloc, node);
+    NodeTraits::deallocate(m_alloc, node, 1);
+}
+
+template <typename T, typename Allocator>
+void BinarySearchTree<T, Allocator>::destroy_all() noexcept {
+    if (std::is_trivially_destructible<Node>::value && BulkRelease::exclusive(m_alloc)) {
+        // Sole owner of a pool: drop every slab without visiting the nodes
+        BulkRelease::release(m_alloc);
+    } else {
+        destroy(m_root);
+    }
+    m_root = nullptr;
+}
+
+template <typename T, typename Allocator>
+typename BinarySearchTree<T, Allocator>::Node* BinarySearchTree<T, Allocator>::copy_tree(Node* node) {
     if (!node) {
         return nullptr;
     }
     
-    Node* new_node = new Node(node->data);
+    Node* new_node = create_node(node->data);
     new_node->left = copy_tree(node->left);
     new_node->right = copy_tree(node->right);
     
     return new_node;
 }
 
-template <typename T>
-void BinarySearchTree<T>::inorder_recursive(
+template <typename T, typename Allocator>
+void BinarySearchTree<T, Allocator>::inorder_recursive(
     Node* node, std::function<void(const T&)>& visitor) const {
     
     if (node) {
@@ -420,8 +463,8 @@ void BinarySearchTree<T>::inorder_recursive(
     }
 }
 
-template <typename T>
-void BinarySearchTree<T>::preorder_recursive(
+template <typename T, typename Allocator>
+void BinarySearchTree<T, Allocator>::preorder_recursive(
     Node* node, std::function<void(const T&)>& visitor) const {
     
     if (node) {
@@ -431,8 +474,8 @@ void BinarySearchTree<T>::preorder_recursive(
     }
 }
 
-template <typename T>
-void BinarySearchTree<T>::postorder_recursive(
+template <typename T, typename Allocator>
+void BinarySearchTree<T, Allocator>::postorder_recursive(
     Node* node, std::function<void(const T&)>& visitor) const {
     
     if (node) {
@@ -442,8 +485,8 @@ void BinarySearchTree<T>::postorder_recursive(
     }
 }
 
-template <typename T>
-bool BinarySearchTree<T>::is_valid_recursive(
+template <typename T, typename Allocator>
+bool BinarySearchTree<T, Allocator>::is_valid_recursive(
     Node* node, const T* min_val, const T* max_val) const {
     
     if (!node) {
@@ -474,5 +517,9 @@ template class BinarySearchTree<unsigned int>;
 template class BinarySearchTree<unsigned long>;
 template class BinarySearchTree<unsigned long long>;
 
+// Pool-backed trees
+template class BinarySearchTree<int, memory::PoolAllocator<int>>;
+template class BinarySearchTree<long long, memory::PoolAllocator<long long>>;
+
 } // namespace tree
 } // namespace mylib
\ No newline at end of file
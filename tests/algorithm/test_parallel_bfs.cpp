@@ -0,0 +1,217 @@
+/**
+ * @file test_parallel_bfs.cpp
+ * @brief Test suite for DirectionOptimizingBfs class
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ */
+
+#include "algorithm/parallel_bfs.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <random>
+#include <stdexcept>
+
+using namespace mylib::algorithm;
+using mylib::graph::CsrGraph;
+
+// Test result counter
+int tests_passed = 0;
+int tests_failed = 0;
+
+// Helper macro for testing
+#define TEST(name) \
+    std::cout << "Testing: " << name << "... "; \
+    try {
+
+#define END_TEST \
+        std::cout << "✓ PASSED" << std::endl; \
+        tests_passed++; \
+    } catch (const std::exception& e) { \
+        std::cout << "✗ FAILED: " << e.what() << std::endl; \
+        tests_failed++; \
+    }
+
+using Graph = CsrGraph<int, int>;
+using Bfs = DirectionOptimizingBfs<int, int>;
+
+/**
+ * @brief Random graph with a few hub vertices, so bottom-up steps kick in
+ */
+Graph skewed_graph(int n, int m, bool directed, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<Graph::Edge> edges;
+    for (int v = 0; v < n; ++v) {
+        edges.emplace_back(v, v, 1);    // Every vertex exists
+    }
+    for (int i = 0; i < m; ++i) {
+        int from = static_cast<int>(rng() % n);
+        // Half the arcs touch one of 16 hubs
+        int to = (i % 2 == 0) ? static_cast<int>(rng() % 16) : static_cast<int>(rng() % n);
+        edges.emplace_back(from, to, 1);
+    }
+    return Graph(edges, directed);
+}
+
+/**
+ * @brief Plain queue BFS levels for comparison
+ */
+std::vector<Bfs::level_type> reference_levels(const Graph& graph, Graph::id_type source) {
+    std::vector<Bfs::level_type> level(graph.vertex_count(), Bfs::NO_LEVEL);
+    std::vector<Graph::id_type> queue{source};
+    level[source] = 0;
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        Graph::id_type u = queue[head];
+        for (std::size_t e = graph.offsets()[u]; e < graph.offsets()[u + 1]; ++e) {
+            Graph::id_type v = graph.targets()[e];
+            if (level[v] == Bfs::NO_LEVEL) {
+                level[v] = level[u] + 1;
+                queue.push_back(v);
+            }
+        }
+    }
+    return level;
+}
+
+/**
+ * @brief Every reached vertex hangs off a parent one level closer through a real arc
+ */
+bool valid_tree(const Graph& graph, const Bfs::Result& result, Graph::id_type source) {
+    std::size_t reached = 0;
+    for (Graph::id_type v = 0; v < graph.vertex_count(); ++v) {
+        if (result.level[v] == Bfs::NO_LEVEL) {
+            if (result.parent[v] != Bfs::NO_PARENT) {
+                return false;
+            }
+            continue;
+        }
+        ++reached;
+        if (v == source) {
+            if (result.parent[v] != source || result.level[v] != 0) {
+                return false;
+            }
+            continue;
+        }
+        Graph::id_type p = result.parent[v];
+        if (p == Bfs::NO_PARENT || result.level[p] + 1 != result.level[v]) {
+            return false;
+        }
+        bool arc = false;
+        for (std::size_t e = graph.offsets()[p]; e < graph.offsets()[p + 1]; ++e) {
+            arc = arc || graph.targets()[e] == v;
+        }
+        if (!arc) {
+            return false;
+        }
+    }
+    return reached == result.reached;
+}
+
+// ============================================
+// Correctness Tests
+// ============================================
+
+void test_matches_reference() {
+    TEST("Levels match a plain BFS, directed and undirected")
+    for (bool directed : {true, false}) {
+        Graph graph = skewed_graph(5000, 40000, directed, directed ? 1u : 2u);
+        Bfs bfs(graph);
+        for (Graph::id_type source : {0u, 17u, 4999u}) {
+            auto result = bfs.run(source);
+            assert(result.level == reference_levels(graph, source));
+            assert(valid_tree(graph, result, source));
+        }
+    }
+    END_TEST
+}
+
+void test_forced_directions() {
+    TEST("Top-down only and bottom-up from the first level agree")
+    Graph graph = skewed_graph(3000, 20000, true, 3);
+    auto expected = reference_levels(graph, 5);
+
+    Bfs top_down(graph);
+    top_down.set_alpha(1e-9);
+    auto td = top_down.run(5);
+    assert(td.bottom_up_steps == 0 && td.level == expected);
+
+    Bfs bottom_up(graph);
+    bottom_up.set_alpha(1e30).set_beta(1e30);
+    auto bu = bottom_up.run(5);
+    assert(bu.top_down_steps == 0 && bu.level == expected);
+    assert(valid_tree(graph, bu, 5));
+
+    // Default thresholds switch on this skewed graph
+    auto hybrid = Bfs(graph).run(5);
+    assert(hybrid.bottom_up_steps > 0 && hybrid.top_down_steps > 0);
+    assert(hybrid.level == expected);
+    END_TEST
+}
+
+void test_unreachable_and_errors() {
+    TEST("Unreached vertices and an out-of-range source")
+    using Edge = Graph::Edge;
+    Graph graph(std::vector<Edge>{{0, 1, 1}, {1, 2, 1}, {3, 4, 1}}, true);
+    Bfs bfs(graph);
+    auto result = bfs.run(graph.id_of(1));
+    assert(result.reached == 2);
+    assert(result.level[graph.id_of(2)] == 1);
+    assert(result.level[graph.id_of(0)] == Bfs::NO_LEVEL);
+    assert(result.parent[graph.id_of(4)] == Bfs::NO_PARENT);
+
+    bool thrown = false;
+    try { bfs.run(5); } catch (const std::out_of_range&) { thrown = true; }
+    assert(thrown);
+    END_TEST
+}
+
+// ============================================
+// Parallel Tests
+// ============================================
+
+void test_parallel_matches_sequential() {
+    TEST("Parallel runs on a ThreadPool give the same levels")
+    ThreadPool pool(4);
+    for (bool directed : {true, false}) {
+        Graph graph = skewed_graph(200000, 1000000, directed, directed ? 4u : 5u);
+        Bfs bfs(graph);
+        auto expected = reference_levels(graph, 0);
+        for (int round = 0; round < 3; ++round) {
+            auto result = bfs.run(0, pool);
+            assert(result.level == expected);
+            assert(valid_tree(graph, result, 0));
+        }
+        Bfs top_down(graph);
+        top_down.set_alpha(1e-9);
+        assert(top_down.run(0, pool).level == expected);
+    }
+    END_TEST
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "DirectionOptimizingBfs Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::cout << std::endl << "--- Correctness Tests ---" << std::endl;
+    test_matches_reference();
+    test_forced_directions();
+    test_unreachable_and_errors();
+
+    std::cout << std::endl << "--- Parallel Tests ---" << std::endl;
+    test_parallel_matches_sequential();
+
+    // Print summary
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Test Results" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "✓ Passed: " << tests_passed << std::endl;
+    std::cout << "✗ Failed: " << tests_failed << std::endl;
+    std::cout << "Total: " << (tests_passed + tests_failed) << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return tests_failed > 0 ? 1 : 0;
+}
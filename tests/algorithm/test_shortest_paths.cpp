@@ -0,0 +1,281 @@
+/**
+ * @file test_shortest_paths.cpp
+ * @brief Test suite for BidirectionalDijkstra, AStar, AltIndex and dial_dijkstra
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ */
+
+#include "algorithm/shortest_paths.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <random>
+#include <stdexcept>
+#include <algorithm>
+#include <cstdlib>
+
+using namespace mylib::algorithm;
+using mylib::graph::CsrGraph;
+
+// Test result counter
+int tests_passed = 0;
+int tests_failed = 0;
+
+// Helper macro for testing
+#define TEST(name) \
+    std::cout << "Testing: " << name << "... "; \
+    try {
+
+#define END_TEST \
+        std::cout << "✓ PASSED" << std::endl; \
+        tests_passed++; \
+    } catch (const std::exception& e) { \
+        std::cout << "✗ FAILED: " << e.what() << std::endl; \
+        tests_failed++; \
+    }
+
+using Graph = CsrGraph<int, int>;
+using Bidirectional = BidirectionalDijkstra<int, int>;
+
+/**
+ * @brief Random graph over vertices 0..n-1 with weights in [0, max_weight]
+ */
+Graph random_graph(int n, int m, int max_weight, bool directed, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<Graph::Edge> edges;
+    for (int v = 0; v < n; ++v) {
+        edges.emplace_back(v, v, 1);    // Every vertex exists
+    }
+    for (int i = 0; i < m; ++i) {
+        edges.emplace_back(static_cast<int>(rng() % n), static_cast<int>(rng() % n),
+                           static_cast<int>(rng() % (max_weight + 1)));
+    }
+    return Graph(edges, directed);
+}
+
+/**
+ * @brief path starts at source, ends at target, follows arcs and costs distance
+ */
+bool valid_path(const Graph& graph, const std::vector<Graph::id_type>& path,
+                Graph::id_type source, Graph::id_type target, int distance) {
+    if (path.empty() || path.front() != source || path.back() != target) {
+        return false;
+    }
+    int total = 0;
+    for (std::size_t i = 0; i + 1 < path.size(); ++i) {
+        int cheapest = -1;
+        for (std::size_t e = graph.offsets()[path[i]]; e < graph.offsets()[path[i] + 1]; ++e) {
+            if (graph.targets()[e] == path[i + 1] && (cheapest < 0 || graph.weights()[e] < cheapest)) {
+                cheapest = graph.weights()[e];
+            }
+        }
+        if (cheapest < 0) {
+            return false;
+        }
+        total += cheapest;
+    }
+    return total == distance;
+}
+
+// ============================================
+// Bidirectional Dijkstra Tests
+// ============================================
+
+void test_bidirectional_matches_dijkstra() {
+    TEST("Bidirectional distances match dijkstra_all, directed and undirected")
+    for (bool directed : {true, false}) {
+        Graph graph = random_graph(400, 1200, 20, directed, directed ? 1u : 2u);
+        Bidirectional query(graph);
+        std::mt19937 rng(3);
+        for (int round = 0; round < 20; ++round) {
+            Graph::id_type source = rng() % 400;
+            std::vector<int> expected = graph.dijkstra_all(graph.vertex_of(source));
+            for (Graph::id_type target = 0; target < 400; target += 7) {
+                auto result = query.run(source, target);
+                assert(result.distance == expected[target]);
+                if (expected[target] == Graph::infinity()) {
+                    assert(result.path.empty());
+                } else {
+                    assert(valid_path(graph, result.path, source, target, result.distance));
+                }
+            }
+        }
+    }
+    END_TEST
+}
+
+void test_bidirectional_edge_cases() {
+    TEST("Same endpoints, unreachable target and bad ids")
+    using Edge = Graph::Edge;
+    Graph graph(std::vector<Edge>{{0, 1, 4}, {1, 2, 1}, {0, 2, 9}, {3, 0, 1}}, true);
+    Bidirectional query(graph);
+    auto id = [&](int v) { return graph.id_of(v); };
+
+    auto self = query.run(id(1), id(1));
+    assert(self.distance == 0 && self.path.size() == 1);
+
+    auto route = query.run(id(0), id(2));
+    assert(route.distance == 5);
+    assert((route.path == std::vector<Graph::id_type>{id(0), id(1), id(2)}));
+
+    auto none = query.run(id(2), id(3));
+    assert(none.distance == Graph::infinity() && none.path.empty());
+
+    bool thrown = false;
+    try { query.run(0, 4); } catch (const std::out_of_range&) { thrown = true; }
+    assert(thrown);
+    END_TEST
+}
+
+// ============================================
+// A* and ALT Tests
+// ============================================
+
+void test_astar_on_grid() {
+    TEST("A* with a Manhattan heuristic is exact and settles less than h = 0")
+    const int width = 30;
+    std::mt19937 rng(8);
+    std::vector<Graph::Edge> edges;
+    for (int v = 0; v < width * width; ++v) {
+        if (v % width + 1 < width) {
+            edges.emplace_back(v, v + 1, 1 + static_cast<int>(rng() % 5));
+        }
+        if (v + width < width * width) {
+            edges.emplace_back(v, v + width, 1 + static_cast<int>(rng() % 5));
+        }
+    }
+    Graph graph(edges, false);
+    AStar<int, int> search(graph);
+
+    const int target = width * width - 1;
+    const Graph::id_type t = graph.id_of(target);
+    // Every step costs at least 1, so the Manhattan distance never overestimates
+    auto manhattan = [&](Graph::id_type id) {
+        int v = graph.vertex_of(id);
+        return std::abs(v % width - target % width) + std::abs(v / width - target / width);
+    };
+    std::vector<int> expected = graph.dijkstra_all(target);
+    std::size_t guided = 0;
+    std::size_t plain = 0;
+    for (int source = 0; source < width * width; source += 37) {
+        auto fast = search.run(graph.id_of(source), t, manhattan);
+        auto slow = search.run(graph.id_of(source), t);
+        assert(fast.distance == expected[graph.id_of(source)] && slow.distance == fast.distance);
+        assert(valid_path(graph, fast.path, graph.id_of(source), t, fast.distance));
+        guided += fast.settled;
+        plain += slow.settled;
+    }
+    assert(guided < plain);
+    END_TEST
+}
+
+void test_alt_matches_dijkstra() {
+    TEST("ALT bounds are admissible and queries exact, directed and undirected")
+    for (bool directed : {true, false}) {
+        Graph graph = random_graph(500, 1500, 30, directed, directed ? 9u : 10u);
+        AltIndex<int, int> alt(graph, 6);
+        assert(alt.landmarks().size() == 6);
+        std::vector<Graph::id_type> landmarks = alt.landmarks();
+        std::sort(landmarks.begin(), landmarks.end());
+        assert(std::unique(landmarks.begin(), landmarks.end()) == landmarks.end());
+
+        AStar<int, int> search(graph);
+        std::size_t guided = 0;
+        std::size_t plain = 0;
+        for (Graph::id_type source = 0; source < 500; source += 23) {
+            std::vector<int> expected = graph.dijkstra_all(graph.vertex_of(source));
+            for (Graph::id_type target = 1; target < 500; target += 41) {
+                auto fast = search.run(source, target, alt.heuristic(target));
+                assert(fast.distance == expected[target]);
+                if (fast.distance != Graph::infinity()) {
+                    assert(valid_path(graph, fast.path, source, target, fast.distance));
+                    assert(alt.lower_bound(source, target) <= fast.distance);
+                }
+                guided += fast.settled;
+                plain += search.run(source, target).settled;
+            }
+        }
+        assert(guided < plain);
+    }
+    END_TEST
+}
+
+void test_alt_edge_cases() {
+    TEST("ALT caps landmarks at the vertex count; A* rejects bad ids")
+    using Edge = Graph::Edge;
+    Graph graph(std::vector<Edge>{{0, 1, 2}, {1, 2, 3}}, true);
+    AltIndex<int, int> alt(graph, 10);
+    assert(alt.landmarks().size() == 3);
+    AStar<int, int> search(graph);
+    auto route = search.run(0, 2, alt.heuristic(2));
+    assert(route.distance == 5 && route.path.size() == 3);
+    assert(search.run(2, 0, alt.heuristic(0)).path.empty());
+    assert(search.run(1, 1).distance == 0);
+
+    bool thrown = false;
+    try { search.run(0, 3); } catch (const std::out_of_range&) { thrown = true; }
+    assert(thrown);
+
+    AltIndex<int, int> none(Graph(), 4);
+    assert(none.landmarks().empty());
+    END_TEST
+}
+
+// ============================================
+// Dial Tests
+// ============================================
+
+void test_dial_matches_dijkstra() {
+    TEST("Dial's bucket queue matches dijkstra_all, including zero weights")
+    for (bool directed : {true, false}) {
+        Graph graph = random_graph(2000, 8000, 9, directed, directed ? 4u : 5u);
+        for (Graph::id_type source : {0u, 999u}) {
+            assert(dial_dijkstra(graph, source) == graph.dijkstra_all(graph.vertex_of(source)));
+        }
+    }
+    END_TEST
+}
+
+void test_dial_errors() {
+    TEST("Dial rejects negative weights and bad sources")
+    using Edge = Graph::Edge;
+    Graph negative(std::vector<Edge>{{0, 1, 2}, {1, 2, -1}}, true);
+    int thrown = 0;
+    try { dial_dijkstra(negative, 0); } catch (const std::invalid_argument&) { ++thrown; }
+    try { dial_dijkstra(negative, 3); } catch (const std::out_of_range&) { ++thrown; }
+    assert(thrown == 2);
+    END_TEST
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "Shortest Paths Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::cout << std::endl << "--- Bidirectional Dijkstra Tests ---" << std::endl;
+    test_bidirectional_matches_dijkstra();
+    test_bidirectional_edge_cases();
+
+    std::cout << std::endl << "--- A* and ALT Tests ---" << std::endl;
+    test_astar_on_grid();
+    test_alt_matches_dijkstra();
+    test_alt_edge_cases();
+
+    std::cout << std::endl << "--- Dial Tests ---" << std::endl;
+    test_dial_matches_dijkstra();
+    test_dial_errors();
+
+    // Print summary
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Test Results" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "✓ Passed: " << tests_passed << std::endl;
+    std::cout << "✗ Failed: " << tests_failed << std::endl;
+    std::cout << "Total: " << (tests_passed + tests_failed) << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return tests_failed > 0 ? 1 : 0;
+}
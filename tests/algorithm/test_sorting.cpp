@@ -640,6 +640,72 @@ void test_stats_comparison() {
     END_TEST
 }
 
+// ============================================
+// Parallel Sort Tests
+// ============================================
+
+void test_parallel_quick_sort_large() {
+    TEST("Parallel QuickSort large dataset (200000)")
+    ThreadPool pool(4);
+    std::vector<int> v(200000);
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> dist(-1000, 1000);  // many duplicates
+    for (int& x : v) {
+        x = dist(gen);
+    }
+    std::vector<int> expected = v;
+    std::sort(expected.begin(), expected.end());
+
+    Sorter<int>().set_parallel_threshold(1000).parallel_quick_sort(v, pool);
+    assert(v == expected);
+    END_TEST
+}
+
+void test_parallel_quick_sort_descending_strings() {
+    TEST("Parallel QuickSort descending strings")
+    ThreadPool pool(3);
+    std::vector<std::string> words;
+    for (int i = 0; i < 5000; ++i) {
+        words.push_back("w" + std::to_string((i * 7919) % 5000));
+    }
+    std::vector<std::string> expected = words;
+    std::sort(expected.begin(), expected.end(), std::greater<std::string>());
+
+    Sorter<std::string>().descending().set_parallel_threshold(64).parallel_quick_sort(words, pool);
+    assert(words == expected);
+    END_TEST
+}
+
+void test_parallel_quick_sort_small_and_empty() {
+    TEST("Parallel QuickSort below the threshold and empty input")
+    ThreadPool pool(2);
+    std::vector<int> small = {5, 3, 9, 1, 7};
+    Sorter<int>().parallel_quick_sort(small, pool);
+    assert(is_sorted_asc(small));
+
+    std::vector<int> empty;
+    Sorter<int>().parallel_quick_sort(empty, pool);
+    assert(empty.empty());
+    END_TEST
+}
+
+void test_parallel_quick_sort_stats() {
+    TEST("Parallel QuickSort statistics match the sequential sort")
+    ThreadPool pool(4);
+    std::vector<int> v1(50000);
+    std::iota(v1.begin(), v1.end(), 0);
+    mylib::algorithm::shuffle(v1.begin(), v1.end(), 11);
+    std::vector<int> v2 = v1;
+
+    // Same pivots and partitions, only the order of work differs
+    auto sequential = Sorter<int>::with_stats().quick_sort(v1);
+    auto parallel = Sorter<int>::with_stats().set_parallel_threshold(500).parallel_quick_sort(v2, pool);
+    assert(v1 == v2);
+    assert(parallel.comparisons == sequential.comparisons);
+    assert(parallel.swaps == sequential.swaps);
+    END_TEST
+}
+
 // ============================================
 // Practical Use Cases
 // ============================================
@@ -789,6 +855,13 @@ int main() {
     std::cout << std::endl << "--- Statistics Tests ---" << std::endl;
     test_stats_comparison();
 
+    // Parallel sort tests
+    std::cout << std::endl << "--- Parallel Sort Tests ---" << std::endl;
+    test_parallel_quick_sort_large();
+    test_parallel_quick_sort_descending_strings();
+    test_parallel_quick_sort_small_and_empty();
+    test_parallel_quick_sort_stats();
+
     // Practical use cases
     std::cout << std::endl << "--- Practical Use Cases ---" << std::endl;
     test_sort_by_multiple_criteria();
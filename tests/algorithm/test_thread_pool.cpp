@@ -0,0 +1,258 @@
+/**
+ * @file test_thread_pool.cpp
+ * @brief Test suite for ThreadPool and TaskGroup classes
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ */
+
+#include "algorithm/thread_pool.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <stdexcept>
+
+using namespace mylib::algorithm;
+
+// Test result counter
+int tests_passed = 0;
+int tests_failed = 0;
+
+// Helper macro for testing
+#define TEST(name) \
+    std::cout << "Testing: " << name << "... "; \
+    try {
+
+#define END_TEST \
+        std::cout << "✓ PASSED" << std::endl; \
+        tests_passed++; \
+    } catch (const std::exception& e) { \
+        std::cout << "✗ FAILED: " << e.what() << std::endl; \
+        tests_failed++; \
+    }
+
+/**
+ * @brief Fork-join Fibonacci: one task per call above the cutoff
+ */
+long long parallel_fib(ThreadPool& pool, int n) {
+    if (n < 12) {
+        return n < 2 ? n : parallel_fib(pool, n - 1) + parallel_fib(pool, n - 2);
+    }
+    long long a = 0;
+    long long b = 0;
+    TaskGroup group(pool);
+    group.run([&pool, &a, n] { a = parallel_fib(pool, n - 1); });
+    b = parallel_fib(pool, n - 2);
+    group.wait();
+    return a + b;
+}
+
+// ============================================
+// ThreadPool Tests
+// ============================================
+
+void test_thread_count() {
+    TEST("Thread count")
+    ThreadPool pool(3);
+    assert(pool.thread_count() == 3);
+    ThreadPool automatic;
+    assert(automatic.thread_count() == ThreadPool::default_thread_count());
+    assert(automatic.thread_count() >= 1);
+    END_TEST
+}
+
+void test_submit_future() {
+    TEST("submit returns a future with the result")
+    ThreadPool pool(2);
+    auto answer = pool.submit([] { return 6 * 7; });
+    auto text = pool.submit([] { return std::string("pool"); });
+    assert(answer.get() == 42);
+    assert(text.get() == "pool");
+    END_TEST
+}
+
+void test_submit_exception() {
+    TEST("submit delivers exceptions through the future")
+    ThreadPool pool(2);
+    auto failing = pool.submit([]() -> int { throw std::runtime_error("boom"); });
+    bool thrown = false;
+    try {
+        failing.get();
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    END_TEST
+}
+
+void test_destructor_runs_queued_tasks() {
+    TEST("Destructor runs every queued task")
+    std::atomic<int> counter{0};
+    {
+        ThreadPool pool(2);
+        for (int i = 0; i < 1000; ++i) {
+            pool.submit([&counter] { counter.fetch_add(1); });
+        }
+    }
+    assert(counter.load() == 1000);
+    END_TEST
+}
+
+void test_submit_from_many_threads() {
+    TEST("Concurrent submit from outside threads")
+    ThreadPool pool(3);
+    std::atomic<long long> sum{0};
+    std::vector<std::thread> submitters;
+    for (int t = 0; t < 4; ++t) {
+        submitters.emplace_back([&pool, &sum, t] {
+            TaskGroup group(pool);
+            for (int i = 0; i < 2500; ++i) {
+                group.run([&sum, t, i] { sum.fetch_add(t * 10000 + i); });
+            }
+            group.wait();
+        });
+    }
+    for (auto& thread : submitters) {
+        thread.join();
+    }
+    long long expected = 0;
+    for (int t = 0; t < 4; ++t) {
+        for (int i = 0; i < 2500; ++i) {
+            expected += t * 10000 + i;
+        }
+    }
+    assert(sum.load() == expected);
+    END_TEST
+}
+
+// ============================================
+// TaskGroup Tests
+// ============================================
+
+void test_group_wait() {
+    TEST("TaskGroup waits for all tasks")
+    ThreadPool pool(4);
+    std::vector<int> results(100, 0);
+    TaskGroup group(pool);
+    for (int i = 0; i < 100; ++i) {
+        group.run([&results, i] { results[i] = i * i; });
+    }
+    group.wait();
+    for (int i = 0; i < 100; ++i) {
+        assert(results[i] == i * i);
+    }
+    // A waited group can be reused
+    group.run([&results] { results[0] = -1; });
+    group.wait();
+    assert(results[0] == -1);
+    END_TEST
+}
+
+void test_nested_fork_join() {
+    TEST("Nested fork-join recursion")
+    ThreadPool pool(4);
+    assert(parallel_fib(pool, 25) == 75025);
+    END_TEST
+}
+
+void test_single_worker_nested() {
+    TEST("Nested fork-join on a single worker does not deadlock")
+    ThreadPool pool(1);
+    long long result = pool.submit([&pool] { return parallel_fib(pool, 20); }).get();
+    assert(result == 6765);
+    END_TEST
+}
+
+void test_group_exception() {
+    TEST("TaskGroup rethrows the first task exception")
+    ThreadPool pool(2);
+    std::atomic<int> finished{0};
+    TaskGroup group(pool);
+    for (int i = 0; i < 50; ++i) {
+        group.run([&finished, i] {
+            if (i == 10) {
+                throw std::logic_error("task failed");
+            }
+            finished.fetch_add(1);
+        });
+    }
+    bool thrown = false;
+    try {
+        group.wait();
+    } catch (const std::logic_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(finished.load() == 49);
+    // The error is reported once
+    group.wait();
+    END_TEST
+}
+
+/**
+ * @brief Callable whose copy constructor throws
+ */
+struct ThrowingCopy {
+    std::atomic<int>* counter;
+    explicit ThrowingCopy(std::atomic<int>* c) : counter(c) {}
+    ThrowingCopy(const ThrowingCopy&) { throw std::runtime_error("copy failed"); }
+    void operator()() const { counter->fetch_add(1); }
+};
+
+void test_group_run_throws() {
+    TEST("TaskGroup::run that throws leaves wait() balanced")
+    ThreadPool pool(2);
+    std::atomic<int> finished{0};
+    {
+        TaskGroup group(pool);
+        group.run([&finished] { finished.fetch_add(1); });
+        ThrowingCopy bad(&finished);
+        bool thrown = false;
+        try {
+            group.run(bad);   // Copying into the task throws
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+        group.wait();         // Returns: the failed task was never counted
+        assert(finished.load() == 1);
+        group.run([&finished] { finished.fetch_add(1); });
+    }                         // Destructor waits for the last task only
+    assert(finished.load() == 2);
+    END_TEST
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "ThreadPool Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::cout << std::endl << "--- ThreadPool Tests ---" << std::endl;
+    test_thread_count();
+    test_submit_future();
+    test_submit_exception();
+    test_destructor_runs_queued_tasks();
+    test_submit_from_many_threads();
+
+    std::cout << std::endl << "--- TaskGroup Tests ---" << std::endl;
+    test_group_wait();
+    test_nested_fork_join();
+    test_single_worker_nested();
+    test_group_exception();
+    test_group_run_throws();
+
+    // Print summary
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Test Results" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "✓ Passed: " << tests_passed << std::endl;
+    std::cout << "✗ Failed: " << tests_failed << std::endl;
+    std::cout << "Total: " << (tests_passed + tests_failed) << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,328 @@
+/**
+ * @file test_csr_graph.cpp
+ * @brief Test suite for CsrGraph class
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ */
+
+#include "graph/csr_graph.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace mylib::graph;
+
+// Test result counter
+int tests_passed = 0;
+int tests_failed = 0;
+
+// Helper macro for testing
+#define TEST(name) \
+    std::cout << "Testing: " << name << "... "; \
+    try {
+
+#define END_TEST \
+        std::cout << "✓ PASSED" << std::endl; \
+        tests_passed++; \
+    } catch (const std::exception& e) { \
+        std::cout << "✗ FAILED: " << e.what() << std::endl; \
+        tests_failed++; \
+    }
+
+/**
+ * @brief Random graph on n vertices with m edge attempts and weights 1..9
+ */
+Graph<int, int> random_graph(int n, int m, bool directed, unsigned seed) {
+    Graph<int, int> graph(directed);
+    std::mt19937 rng(seed);
+    for (int v = 0; v < n; ++v) {
+        graph.add_vertex(v);
+    }
+    for (int i = 0; i < m; ++i) {
+        graph.add_edge(static_cast<int>(rng() % n), static_cast<int>(rng() % n),
+                       static_cast<int>(rng() % 9) + 1);
+    }
+    return graph;
+}
+
+template <typename G>
+std::vector<int> bfs_order(const G& graph, int start) {
+    std::vector<int> order;
+    graph.bfs(start, [&order](const int& v) { order.push_back(v); });
+    return order;
+}
+
+template <typename G>
+std::vector<int> dfs_order(const G& graph, int start) {
+    std::vector<int> order;
+    graph.dfs(start, [&order](const int& v) { order.push_back(v); });
+    return order;
+}
+
+/**
+ * @brief Components as sorted vertex lists, sorted, for order-free comparison
+ */
+std::vector<std::vector<int>> normalized(std::vector<std::vector<int>> components) {
+    for (auto& component : components) {
+        std::sort(component.begin(), component.end());
+    }
+    std::sort(components.begin(), components.end());
+    return components;
+}
+
+// ============================================
+// Construction Tests
+// ============================================
+
+void test_from_graph_layout() {
+    TEST("Conversion from Graph: ids, offsets, targets, weights")
+    Graph<std::string, int> graph(true);
+    graph.add_edge("a", "b", 4);
+    graph.add_edge("a", "c", 2);
+    graph.add_edge("c", "b", 1);
+    graph.add_vertex("lonely");
+
+    CsrGraph<std::string, int> csr(graph);
+    assert(csr.is_directed());
+    assert(csr.vertex_count() == 4 && csr.edge_count() == 3);
+    assert(csr.offsets().size() == 5 && csr.offsets().back() == 3);
+    assert(csr.targets().size() == 3 && csr.weights().size() == 3);
+
+    for (const std::string& v : graph.vertices()) {
+        auto id = csr.id_of(v);
+        assert(csr.vertex_of(id) == v);
+        assert(csr.degree(id) == graph.out_degree(v));
+        // Neighbours keep Graph's order
+        auto expected = graph.neighbors_with_weights(v);
+        for (std::size_t k = 0; k < expected.size(); ++k) {
+            std::size_t e = csr.offsets()[id] + k;
+            assert(csr.vertex_of(csr.targets()[e]) == expected[k].first);
+            assert(csr.weights()[e] == expected[k].second);
+        }
+    }
+    assert(csr.degree(csr.id_of("lonely")) == 0);
+    END_TEST
+}
+
+void test_from_edge_list() {
+    TEST("Construction from an edge list (undirected stores both arcs)")
+    using Edge = CsrGraph<int, int>::Edge;
+    std::vector<Edge> edges = {{10, 20, 1}, {20, 30, 2}, {30, 30, 5}, {10, 20, 7}};
+    CsrGraph<int, int> csr(edges, false);
+    assert(!csr.is_directed());
+    assert(csr.vertex_count() == 3 && csr.edge_count() == 4);
+    // Two arcs per edge, one for the self-loop, parallel edges kept
+    assert(csr.targets().size() == 7);
+    // Ids follow first appearance
+    assert(csr.id_of(10) == 0 && csr.id_of(20) == 1 && csr.id_of(30) == 2);
+    assert(csr.degree(0) == 2 && csr.degree(1) == 3 && csr.degree(2) == 2);
+
+    CsrGraph<int, int> directed(edges);
+    assert(directed.is_directed() && directed.targets().size() == 4);
+    assert(directed.degree(2) == 1);
+    END_TEST
+}
+
+void test_lookup_errors() {
+    TEST("Unknown vertices and ids")
+    Graph<int> graph;
+    graph.add_edge(1, 2);
+    CsrGraph<int> csr(graph);
+    assert(csr.has_vertex(1) && !csr.has_vertex(3));
+    bool thrown = false;
+    try { csr.id_of(3); } catch (const std::out_of_range&) { thrown = true; }
+    assert(thrown);
+    thrown = false;
+    try { csr.vertex_of(2); } catch (const std::out_of_range&) { thrown = true; }
+    assert(thrown);
+
+    // Traversals from an unknown vertex do nothing, like Graph
+    assert(bfs_order(CsrGraph<int, int>(), 5).empty());
+    assert(csr.dijkstra(1, 3).first.empty());
+    assert(csr.dijkstra_all(3).empty());
+
+    CsrGraph<int> empty;
+    assert(empty.empty() && empty.offsets().size() == 1);
+    END_TEST
+}
+
+void test_transpose() {
+    TEST("transpose reverses arcs and keeps ids and weights")
+    Graph<int, int> graph = random_graph(100, 400, true, 6u);
+    CsrGraph<int, int> csr(graph);
+    CsrGraph<int, int> reversed = csr.transpose();
+    assert(reversed.vertex_count() == csr.vertex_count());
+    assert(reversed.edge_count() == csr.edge_count());
+    for (int v = 0; v < 100; ++v) {
+        assert(reversed.id_of(v) == csr.id_of(v));
+    }
+    for (std::size_t u = 0; u < reversed.vertex_count(); ++u) {
+        for (std::size_t e = reversed.offsets()[u]; e < reversed.offsets()[u + 1]; ++e) {
+            int from = reversed.vertex_of(reversed.targets()[e]);
+            int to = reversed.vertex_of(static_cast<CsrGraph<int, int>::id_type>(u));
+            assert(graph.get_weight(from, to) == reversed.weights()[e]);
+        }
+    }
+    END_TEST
+}
+
+// ============================================
+// Traversal Tests
+// ============================================
+
+void test_traversals_match_graph() {
+    TEST("bfs/dfs visit in the same order as the source Graph")
+    for (bool directed : {true, false}) {
+        Graph<int, int> graph = random_graph(200, 600, directed, directed ? 1u : 2u);
+        CsrGraph<int, int> csr(graph);
+        for (int start : {0, 17, 199}) {
+            assert(bfs_order(csr, start) == bfs_order(graph, start));
+            assert(dfs_order(csr, start) == dfs_order(graph, start));
+        }
+    }
+    END_TEST
+}
+
+// ============================================
+// Shortest Path Tests
+// ============================================
+
+void test_dijkstra_matches_graph() {
+    TEST("dijkstra and dijkstra_all agree with Graph")
+    for (bool directed : {true, false}) {
+        Graph<int, int> graph = random_graph(300, 900, directed, directed ? 3u : 4u);
+        CsrGraph<int, int> csr(graph);
+        auto expected = graph.dijkstra_all(0);
+        auto dist = csr.dijkstra_all(0);
+        assert(dist.size() == csr.vertex_count());
+        for (int v = 0; v < 300; ++v) {
+            assert(dist[csr.id_of(v)] == expected[v]);
+        }
+
+        for (int to : {1, 50, 299}) {
+            auto [path, length] = csr.dijkstra(0, to);
+            auto reference = graph.dijkstra(0, to);
+            assert(length == reference.second);
+            assert(path.empty() == reference.first.empty());
+            // Paths may differ on ties; check this one is valid and that long
+            if (!path.empty()) {
+                assert(path.front() == 0 && path.back() == to);
+                int total = 0;
+                for (std::size_t i = 0; i + 1 < path.size(); ++i) {
+                    total += graph.get_weight(path[i], path[i + 1]);
+                }
+                assert(total == length);
+            }
+        }
+    }
+    END_TEST
+}
+
+void test_dijkstra_unreachable() {
+    TEST("dijkstra reports unreachable vertices")
+    Graph<char, double> graph(true);
+    graph.add_edge('a', 'b', 1.5);
+    graph.add_edge('c', 'a', 1.0);
+    CsrGraph<char, double> csr(graph);
+    assert(csr.dijkstra('b', 'a').first.empty());
+    auto same = csr.dijkstra('a', 'a');
+    assert(same.first.size() == 1 && same.second == 0.0);
+    auto dist = csr.dijkstra_all('a');
+    assert(dist[csr.id_of('b')] == 1.5);
+    assert((dist[csr.id_of('c')] == CsrGraph<char, double>::infinity()));
+    END_TEST
+}
+
+// ============================================
+// Graph Properties Tests
+// ============================================
+
+void test_topological_sort() {
+    TEST("topological_sort orders every arc and rejects cycles")
+    Graph<int, int> dag(true);
+    std::mt19937 rng(5);
+    for (int i = 0; i < 400; ++i) {
+        int a = static_cast<int>(rng() % 100);
+        int b = static_cast<int>(rng() % 100);
+        if (a != b) {
+            dag.add_edge(std::min(a, b), std::max(a, b));
+        }
+    }
+    CsrGraph<int, int> csr(dag);
+    auto order = csr.topological_sort();
+    assert(order.size() == dag.vertex_count());
+    std::vector<std::size_t> position(100);
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        position[order[i]] = i;
+    }
+    for (const auto& edge : dag.edges()) {
+        assert(position[edge.from] < position[edge.to]);
+    }
+
+    dag.add_edge(99, 0);
+    bool thrown = false;
+    try { CsrGraph<int, int>(dag).topological_sort(); } catch (const std::runtime_error&) { thrown = true; }
+    assert(thrown);
+
+    thrown = false;
+    try { CsrGraph<int, int>(random_graph(5, 5, false, 6)).topological_sort(); }
+    catch (const std::runtime_error&) { thrown = true; }
+    assert(thrown);
+    END_TEST
+}
+
+void test_connected_components() {
+    TEST("connected_components match Graph (weak for directed)")
+    for (bool directed : {true, false}) {
+        Graph<int, int> graph = random_graph(300, 200, directed, directed ? 7u : 8u);
+        CsrGraph<int, int> csr(graph);
+        assert(normalized(csr.connected_components()) == normalized(graph.connected_components()));
+    }
+
+    // A directed chain is one weak component even though 2 cannot reach 0
+    Graph<int, int> chain(true);
+    chain.add_edge(0, 1);
+    chain.add_edge(2, 1);
+    assert((CsrGraph<int, int>(chain).connected_components().size() == 1));
+    END_TEST
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "CsrGraph Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::cout << std::endl << "--- Construction Tests ---" << std::endl;
+    test_from_graph_layout();
+    test_from_edge_list();
+    test_lookup_errors();
+    test_transpose();
+
+    std::cout << std::endl << "--- Traversal Tests ---" << std::endl;
+    test_traversals_match_graph();
+
+    std::cout << std::endl << "--- Shortest Path Tests ---" << std::endl;
+    test_dijkstra_matches_graph();
+    test_dijkstra_unreachable();
+
+    std::cout << std::endl << "--- Graph Properties Tests ---" << std::endl;
+    test_topological_sort();
+    test_connected_components();
+
+    // Print summary
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Test Results" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "✓ Passed: " << tests_passed << std::endl;
+    std::cout << "✗ Failed: " << tests_failed << std::endl;
+    std::cout << "Total: " << (tests_passed + tests_failed) << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -805,6 +805,88 @@ void test_bfs_large() {
     END_TEST
 }
 
+// ============================================
+// Dense Vertex Id Tests
+// ============================================
+
+/**
+ * @brief Same random topology with vertex v renamed to map(v)
+ */
+template <typename Map>
+Graph<long, int> relabeled_graph(Map map) {
+    Graph<long, int> graph(true);
+    unsigned state = 12345;
+    auto next = [&state]() { state = state * 1103515245u + 12345u; return (state >> 8) % 200; };
+    for (int v = 0; v < 200; ++v) {
+        graph.add_vertex(map(v));
+    }
+    for (int i = 0; i < 700; ++i) {
+        long from = static_cast<long>(next());
+        long to = static_cast<long>(next());
+        graph.add_edge(map(from), map(to), static_cast<int>(next() % 9) + 1);
+    }
+    return graph;
+}
+
+void test_dense_and_sparse_ids_agree() {
+    TEST("Dense, negative and sparse integer ids give the same results")
+    // Compact ids take the flat-array path, widely spread ids the hash path
+    auto dense = relabeled_graph([](long v) { return v; });
+    auto negative = relabeled_graph([](long v) { return v - 100; });
+    auto sparse = relabeled_graph([](long v) { return v * 1000003L; });
+
+    std::vector<long> dense_order;
+    std::vector<long> negative_order;
+    std::vector<long> sparse_order;
+    dense.bfs(0, [&](const long& v) { dense_order.push_back(v); });
+    negative.bfs(-100, [&](const long& v) { negative_order.push_back(v + 100); });
+    sparse.bfs(0, [&](const long& v) { sparse_order.push_back(v / 1000003L); });
+    assert(dense_order == negative_order && dense_order == sparse_order);
+
+    dense_order.clear();
+    sparse_order.clear();
+    dense.dfs(7, [&](const long& v) { dense_order.push_back(v); });
+    sparse.dfs(7 * 1000003L, [&](const long& v) { sparse_order.push_back(v / 1000003L); });
+    assert(dense_order == sparse_order);
+
+    auto dense_dist = dense.dijkstra_all(0);
+    auto sparse_dist = sparse.dijkstra_all(0);
+    assert(dense_dist.size() == 200 && sparse_dist.size() == 200);
+    for (long v = 0; v < 200; ++v) {
+        assert(dense_dist[v] == sparse_dist[v * 1000003L]);
+        assert(dense.has_path(0, v) == sparse.has_path(0, v * 1000003L));
+        assert(dense.shortest_path_bfs(0, v).size() ==
+               sparse.shortest_path_bfs(0, v * 1000003L).size());
+        assert(dense.dijkstra(0, v).second == negative.dijkstra(-100, v - 100).second);
+    }
+    END_TEST
+}
+
+void test_dense_ids_after_mutation() {
+    TEST("Dense id state survives removal, copy, swap and clear")
+    Graph<int> graph(false);
+    for (int i = 0; i < 100; ++i) {
+        graph.add_edge(i, i + 1, 1.0);
+    }
+    graph.remove_vertex(50);
+    Graph<int> copy = graph;
+    assert(!copy.has_path(0, 100));
+    assert(copy.dijkstra(0, 49).second == 49.0);
+
+    // Reusing the object with ids far from the old range
+    graph.clear();
+    graph.add_edge(-1000000, -999999, 2.0);
+    assert(graph.shortest_path_bfs(-1000000, -999999).size() == 2);
+    graph.swap(copy);
+    assert(graph.has_path(51, 100) && copy.has_path(-999999, -1000000));
+
+    Graph<char, int> letters(true);
+    letters.add_edge('x', 'a', 3);
+    letters.add_edge('a', 'm', 4);
+    assert(letters.dijkstra('x', 'm').second == 7);
+    END_TEST
+}
+
 // ============================================
 // Practical Use Cases
 // ============================================
@@ -959,6 +1041,11 @@ int main() {
     test_dense_graph();
     test_bfs_large();
 
+    // Dense vertex ids
+    std::cout << std::endl << "--- Dense Vertex Id Tests ---" << std::endl;
+    test_dense_and_sparse_ids_agree();
+    test_dense_ids_after_mutation();
+
     // Practical use cases
     std::cout << std::endl << "--- Practical Use Cases ---" << std::endl;
     test_social_network();
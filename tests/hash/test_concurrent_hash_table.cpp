@@ -0,0 +1,354 @@
+/**
+ * @file test_concurrent_hash_table.cpp
+ * @brief Test suite for ConcurrentHashTable class
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ */
+
+#include "hash/concurrent_hash_table.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+using namespace mylib::hash;
+
+// Test result counter
+int tests_passed = 0;
+int tests_failed = 0;
+
+// Helper macro for testing
+#define TEST(name) \
+    std::cout << "Testing: " << name << "... "; \
+    try {
+
+#define END_TEST \
+        std::cout << "✓ PASSED" << std::endl; \
+        tests_passed++; \
+    } catch (const std::exception& e) { \
+        std::cout << "✗ FAILED: " << e.what() << std::endl; \
+        tests_failed++; \
+    }
+
+const int THREAD_COUNT = 8;
+
+/**
+ * @brief Run body(thread_index) on THREAD_COUNT threads and join them
+ */
+template <typename Body>
+void run_threads(Body body) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREAD_COUNT; ++t) {
+        threads.emplace_back(body, t);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+// ============================================
+// Constructor Tests
+// ============================================
+
+void test_default_constructor() {
+    TEST("Default constructor")
+    ConcurrentHashTable<int, int> table;
+    assert(table.empty());
+    assert(table.size() == 0);
+    assert((table.shard_count() == ConcurrentHashTable<int, int>::DEFAULT_SHARD_COUNT));
+    END_TEST
+}
+
+void test_shard_count() {
+    TEST("Shard count rounds up to power of two")
+    ConcurrentHashTable<int, int> table(10);
+    assert(table.shard_count() == 16);
+
+    ConcurrentHashTable<int, int> single(1);
+    assert(single.shard_count() == 1);
+    single.insert(1, 1);
+    assert(single.shard_of(1) == 0);
+
+    bool thrown = false;
+    try {
+        ConcurrentHashTable<int, int> invalid(0);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    END_TEST
+}
+
+void test_shard_distribution() {
+    TEST("Keys spread over all shards")
+    ConcurrentHashTable<int, int> table(16);
+    std::vector<int> per_shard(16, 0);
+    for (int i = 0; i < 16000; ++i) {
+        per_shard[table.shard_of(i)]++;
+    }
+    for (int n : per_shard) {
+        assert(n > 500 && n < 1500);
+    }
+    END_TEST
+}
+
+// ============================================
+// Single-threaded API Tests
+// ============================================
+
+void test_insert_and_find() {
+    TEST("Insert and find")
+    ConcurrentHashTable<std::string, int> table;
+    auto result = table.insert("one", 1);
+    assert(result.first && result.second);
+    result = table.insert("one", 100);
+    assert(result.first && !result.second);
+
+    auto value = table.find("one");
+    assert(value.has_value());
+    assert(*value == 1);
+    assert(!table.find("two").has_value());
+    assert(table.contains("one"));
+    assert(table.count("one") == 1);
+    assert(table.count("two") == 0);
+    END_TEST
+}
+
+void test_insert_or_assign() {
+    TEST("Insert or assign")
+    ConcurrentHashTable<int, std::string> table;
+    assert(table.insert_or_assign(1, "a"));
+    assert(!table.insert_or_assign(1, "b"));
+    assert(*table.find(1) == "b");
+    assert(table.size() == 1);
+    END_TEST
+}
+
+void test_emplace_and_erase() {
+    TEST("Emplace and erase")
+    ConcurrentHashTable<int, std::string> table;
+    auto result = table.emplace(5, 3, 'x');
+    assert(result.second);
+    assert(*table.find(5) == "xxx");
+    assert(table.erase(5));
+    assert(!table.erase(5));
+    assert(table.empty());
+    END_TEST
+}
+
+void test_compute_if_absent() {
+    TEST("Compute if absent")
+    ConcurrentHashTable<int, int> table;
+    int calls = 0;
+    assert(table.compute_if_absent(7, [&calls]() { ++calls; return 49; }) == 49);
+    assert(table.compute_if_absent(7, [&calls]() { ++calls; return 0; }) == 49);
+    assert(calls == 1);
+    END_TEST
+}
+
+void test_upsert_and_update() {
+    TEST("Upsert and update")
+    ConcurrentHashTable<std::string, int> table;
+    auto inc = [](int& c) { ++c; };
+    assert(table.upsert("a", inc, 1));
+    assert(!table.upsert("a", inc, 1));
+    assert(!table.upsert("a", inc, 1));
+    assert(*table.find("a") == 3);
+
+    assert(table.update("a", [](int& c) { c *= 10; }));
+    assert(!table.update("b", [](int& c) { c *= 10; }));
+    assert(*table.find("a") == 30);
+    END_TEST
+}
+
+void test_visit() {
+    TEST("Visit")
+    ConcurrentHashTable<int, std::vector<int>> table;
+    table.insert(1, std::vector<int>{1, 2, 3});
+    std::size_t length = 0;
+    assert(table.visit(1, [&length](const std::vector<int>& v) { length = v.size(); }));
+    assert(length == 3);
+    assert(!table.visit(2, [&length](const std::vector<int>&) { length = 0; }));
+    assert(length == 3);
+    END_TEST
+}
+
+void test_clear_and_reserve() {
+    TEST("Clear and reserve")
+    ConcurrentHashTable<int, int> table(8);
+    table.reserve(10000);
+    for (int i = 0; i < 1000; ++i) {
+        table.insert(i, i);
+    }
+    assert(table.size() == 1000);
+    table.clear();
+    assert(table.empty());
+    assert(!table.contains(10));
+    END_TEST
+}
+
+void test_iteration() {
+    TEST("Iteration across shards")
+    ConcurrentHashTable<int, int> table;
+    for (int i = 0; i < 500; ++i) {
+        table.insert(i, i * 2);
+    }
+    auto keys = table.keys();
+    std::sort(keys.begin(), keys.end());
+    assert(keys.size() == 500);
+    for (int i = 0; i < 500; ++i) {
+        assert(keys[i] == i);
+    }
+
+    table.for_each([](const int&, int& value) { value += 1; });
+    long long sum = 0;
+    const auto& view = table;
+    view.for_each([&sum](const int&, const int& value) { sum += value; });
+    assert(sum == 500LL * 499 + 500);
+    assert(table.values().size() == 500);
+    END_TEST
+}
+
+// ============================================
+// Multi-threaded Tests
+// ============================================
+
+void test_concurrent_disjoint_inserts() {
+    TEST("Concurrent inserts of disjoint ranges")
+    ConcurrentHashTable<int, int> table(16);
+    const int per_thread = 5000;
+    run_threads([&table](int t) {
+        for (int i = 0; i < per_thread; ++i) {
+            int key = t * per_thread + i;
+            assert(table.insert(key, key).second);
+        }
+    });
+    assert(table.size() == static_cast<std::size_t>(THREAD_COUNT * per_thread));
+    for (int key = 0; key < THREAD_COUNT * per_thread; ++key) {
+        assert(*table.find(key) == key);
+    }
+    END_TEST
+}
+
+void test_concurrent_same_key_insert() {
+    TEST("Exactly one thread wins each contended insert")
+    ConcurrentHashTable<int, int> table(4);
+    std::atomic<int> wins{0};
+    run_threads([&table, &wins](int t) {
+        for (int key = 0; key < 1000; ++key) {
+            if (table.insert(key, t).second) {
+                wins.fetch_add(1);
+            }
+        }
+    });
+    assert(wins.load() == 1000);
+    assert(table.size() == 1000);
+    END_TEST
+}
+
+void test_concurrent_upsert_counters() {
+    TEST("Concurrent upsert counters")
+    ConcurrentHashTable<int, long long> table(8);
+    const int rounds = 2000;
+    run_threads([&table](int) {
+        for (int i = 0; i < rounds; ++i) {
+            table.upsert(i % 100, [](long long& c) { ++c; }, 1LL);
+        }
+    });
+    long long total = 0;
+    table.for_each([&total](const int&, const long long& c) { total += c; });
+    assert(total == static_cast<long long>(THREAD_COUNT) * rounds);
+    assert(*table.find(0) == static_cast<long long>(THREAD_COUNT) * rounds / 100);
+    END_TEST
+}
+
+void test_concurrent_compute_if_absent() {
+    TEST("Concurrent compute_if_absent runs factory once per key")
+    ConcurrentHashTable<int, int> table(8);
+    std::atomic<int> calls{0};
+    run_threads([&table, &calls](int) {
+        for (int key = 0; key < 500; ++key) {
+            int value = table.compute_if_absent(key, [&calls, key]() {
+                calls.fetch_add(1);
+                return key * 3;
+            });
+            assert(value == key * 3);
+        }
+    });
+    assert(calls.load() == 500);
+    END_TEST
+}
+
+void test_concurrent_readers_and_writers() {
+    TEST("Readers see consistent values during writes")
+    ConcurrentHashTable<int, int> table(16);
+    // Invariant: every stored value is a multiple of 7 greater than the key
+    for (int key = 0; key < 1000; ++key) {
+        table.insert(key, key + 7);
+    }
+    std::atomic<bool> failed{false};
+    run_threads([&table, &failed](int t) {
+        for (int i = 0; i < 5000; ++i) {
+            int key = (i * 31 + t) % 1000;
+            if (t % 2 == 0) {
+                auto value = table.find(key);
+                if (value && (*value - key) % 7 != 0) {
+                    failed = true;
+                }
+            } else if (i % 3 == 0) {
+                table.erase(key);
+            } else {
+                table.insert_or_assign(key, key + 7 * (i % 5 + 1));
+            }
+        }
+    });
+    assert(!failed.load());
+    table.for_each([](const int& key, const int& value) {
+        assert((value - key) % 7 == 0);
+    });
+    END_TEST
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "ConcurrentHashTable Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::cout << std::endl << "--- Constructor Tests ---" << std::endl;
+    test_default_constructor();
+    test_shard_count();
+    test_shard_distribution();
+
+    std::cout << std::endl << "--- Single-threaded API Tests ---" << std::endl;
+    test_insert_and_find();
+    test_insert_or_assign();
+    test_emplace_and_erase();
+    test_compute_if_absent();
+    test_upsert_and_update();
+    test_visit();
+    test_clear_and_reserve();
+    test_iteration();
+
+    std::cout << std::endl << "--- Multi-threaded Tests ---" << std::endl;
+    test_concurrent_disjoint_inserts();
+    test_concurrent_same_key_insert();
+    test_concurrent_upsert_counters();
+    test_concurrent_compute_if_absent();
+    test_concurrent_readers_and_writers();
+
+    // Print summary
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Test Results" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "✓ Passed: " << tests_passed << std::endl;
+    std::cout << "✗ Failed: " << tests_failed << std::endl;
+    std::cout << "Total: " << (tests_passed + tests_failed) << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,314 @@
+/**
+ * @file test_frozen_hash_index.cpp
+ * @brief Test suite for FrozenHashIndex class
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ */
+
+#include "hash/frozen_hash_index.hpp"
+#include "hash/hash_table.hpp"
+#include "hash/open_hash_table.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace mylib::hash;
+
+// Test result counter
+int tests_passed = 0;
+int tests_failed = 0;
+
+// Helper macro for testing
+#define TEST(name) \
+    std::cout << "Testing: " << name << "... "; \
+    try {
+
+#define END_TEST \
+        std::cout << "✓ PASSED" << std::endl; \
+        tests_passed++; \
+    } catch (const std::exception& e) { \
+        std::cout << "✗ FAILED: " << e.what() << std::endl; \
+        tests_failed++; \
+    }
+
+const char* INDEX_PATH = "test_frozen_hash_index.idx";
+
+using Index = FrozenHashIndex<long long, long long>;
+
+/**
+ * @struct Record
+ * @brief Trivially copyable value with padding
+ */
+struct Record {
+    std::uint32_t id;
+    double score;
+    char tag[5];
+};
+
+/**
+ * @brief Build a table mapping i -> i * 3 for i in [0, n)
+ */
+HashTable<long long, long long> make_table(long long n) {
+    HashTable<long long, long long> table;
+    for (long long i = 0; i < n; ++i) {
+        table.insert(i, i * 3);
+    }
+    return table;
+}
+
+/**
+ * @brief Assert that an invalid image is rejected with runtime_error
+ */
+template <typename F>
+void expect_rejected(F load) {
+    bool thrown = false;
+    try {
+        load();
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+// ============================================
+// Round-trip Tests
+// ============================================
+
+void test_file_round_trip() {
+    TEST("Save and load round trip")
+    auto table = make_table(10000);
+    Index::save(table, INDEX_PATH);
+
+    Index index = Index::load(INDEX_PATH);
+    assert(index.mapped());
+    assert(index.size() == table.size());
+    assert(index.bucket_count() == table.size());
+    for (long long i = 0; i < 10000; ++i) {
+        const long long* value = index.find(i);
+        assert(value != nullptr && *value == i * 3);
+    }
+    for (long long i = 10000; i < 11000; ++i) {
+        assert(index.find(i) == nullptr);
+    }
+    std::remove(INDEX_PATH);
+    END_TEST
+}
+
+void test_memory_view() {
+    TEST("View over an in-memory image")
+    auto table = make_table(500);
+    std::vector<char> image = Index::serialize(table);
+
+    Index index = Index::view(image.data(), image.size());
+    assert(!index.mapped());
+    assert(index.image_size() == image.size());
+    assert(index.size() == 500);
+    assert(index.at(499) == 1497);
+    END_TEST
+}
+
+void test_position_independent() {
+    TEST("Image is position-independent")
+    auto table = make_table(1000);
+    std::vector<char> image = Index::serialize(table);
+
+    // Copy to a different address (64-byte aligned) and query there
+    std::vector<std::uint64_t> storage(image.size() / 8 + 16);
+    char* moved = reinterpret_cast<char*>(storage.data()) + 64;
+    std::memcpy(moved, image.data(), image.size());
+    std::fill(image.begin(), image.end(), 0);
+
+    Index index = Index::view(moved, image.size());
+    for (long long i = 0; i < 1000; ++i) {
+        assert(*index.find(i) == i * 3);
+    }
+    END_TEST
+}
+
+void test_struct_values_from_open_table() {
+    TEST("Struct values frozen from OpenHashTable")
+    OpenHashTable<int, Record> table;
+    for (int i = 0; i < 300; ++i) {
+        Record r{static_cast<std::uint32_t>(i), i * 0.5, "abcd"};
+        table.insert(i, r);
+    }
+    std::vector<char> image = FrozenHashIndex<int, Record>::serialize(table);
+    auto index = FrozenHashIndex<int, Record>::view(image.data(), image.size());
+
+    assert(index.size() == 300);
+    for (int i = 0; i < 300; ++i) {
+        const Record* r = index.find(i);
+        assert(r != nullptr);
+        assert(r->id == static_cast<std::uint32_t>(i));
+        assert(r->score == i * 0.5);
+        assert(std::strcmp(r->tag, "abcd") == 0);
+    }
+    END_TEST
+}
+
+void test_serialize_deterministic() {
+    TEST("Serializing the same table twice gives identical bytes")
+    auto table = make_table(2000);
+    assert(Index::serialize(table) == Index::serialize(table));
+    END_TEST
+}
+
+void test_empty_table() {
+    TEST("Empty table")
+    HashTable<long long, long long> table;
+    std::vector<char> image = Index::serialize(table);
+    Index index = Index::view(image.data(), image.size());
+    assert(index.empty());
+    assert(index.find(1) == nullptr);
+    assert(!index.contains(0));
+    END_TEST
+}
+
+// ============================================
+// Lookup API Tests
+// ============================================
+
+void test_lookup_api() {
+    TEST("contains, count, at and for_each")
+    auto table = make_table(100);
+    std::vector<char> image = Index::serialize(table);
+    Index index = Index::view(image.data(), image.size());
+
+    assert(index.contains(42));
+    assert(index.count(42) == 1);
+    assert(index.count(420) == 0);
+
+    bool thrown = false;
+    try {
+        index.at(420);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    long long sum = 0;
+    std::size_t visited = 0;
+    index.for_each([&](const long long& key, const long long& value) {
+        assert(value == key * 3);
+        sum += key;
+        ++visited;
+    });
+    assert(visited == 100);
+    assert(sum == 4950);
+    END_TEST
+}
+
+void test_move() {
+    TEST("Move construction and assignment")
+    auto table = make_table(100);
+    Index::save(table, INDEX_PATH);
+
+    Index a = Index::load(INDEX_PATH);
+    Index b(std::move(a));
+    assert(a.empty() && !a.mapped());
+    assert(b.mapped() && *b.find(7) == 21);
+
+    Index c;
+    c = std::move(b);
+    assert(b.empty());
+    assert(*c.find(99) == 297);
+    std::remove(INDEX_PATH);
+    END_TEST
+}
+
+// ============================================
+// Validation Tests
+// ============================================
+
+void test_missing_file() {
+    TEST("Missing file is rejected")
+    expect_rejected([]() { Index::load("does_not_exist.idx"); });
+    END_TEST
+}
+
+void test_corrupt_images() {
+    TEST("Corrupt or mismatched images are rejected")
+    auto table = make_table(100);
+    std::vector<char> image = Index::serialize(table);
+
+    std::vector<char> bad_magic = image;
+    bad_magic[0] = 'X';
+    expect_rejected([&]() { Index::view(bad_magic.data(), bad_magic.size()); });
+
+    expect_rejected([&]() { Index::view(image.data(), image.size() / 2); });
+    expect_rejected([&]() { Index::view(image.data(), 8); });
+
+    // Same file read back with a different value type
+    expect_rejected([&]() {
+        FrozenHashIndex<long long, int>::view(image.data(), image.size());
+    });
+
+    // Valid header, corrupt inner bucket offsets
+    mylib::hash::detail::FrozenHeader header;
+    std::memcpy(&header, image.data(), sizeof(header));
+    auto offset_at = [&](std::vector<char>& bytes, std::size_t b) {
+        return bytes.data() + header.offsets_offset + b * sizeof(std::uint64_t);
+    };
+    std::vector<char> far_offset = image;
+    const std::uint64_t huge = std::uint64_t{1} << 40;
+    for (std::size_t b = 1; b < header.bucket_count; ++b) {
+        std::memcpy(offset_at(far_offset, b), &huge, sizeof(huge));
+    }
+    expect_rejected([&]() { Index::view(far_offset.data(), far_offset.size()); });
+
+    std::vector<char> decreasing = image;
+    std::uint64_t mid = 0;
+    std::memcpy(&mid, offset_at(decreasing, header.bucket_count / 2), sizeof(mid));
+    const std::uint64_t past = mid + 2;
+    std::memcpy(offset_at(decreasing, header.bucket_count / 2 - 1), &past, sizeof(past));
+    expect_rejected([&]() { Index::view(decreasing.data(), decreasing.size()); });
+
+    // Truncated file on disk
+    {
+        std::ofstream out(INDEX_PATH, std::ios::binary | std::ios::trunc);
+        out.write(image.data(), 100);
+    }
+    expect_rejected([]() { Index::load(INDEX_PATH); });
+    std::remove(INDEX_PATH);
+    END_TEST
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "FrozenHashIndex Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::cout << std::endl << "--- Round-trip Tests ---" << std::endl;
+    test_file_round_trip();
+    test_memory_view();
+    test_position_independent();
+    test_struct_values_from_open_table();
+    test_serialize_deterministic();
+    test_empty_table();
+
+    std::cout << std::endl << "--- Lookup API Tests ---" << std::endl;
+    test_lookup_api();
+    test_move();
+
+    std::cout << std::endl << "--- Validation Tests ---" << std::endl;
+    test_missing_file();
+    test_corrupt_images();
+
+    // Print summary
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Test Results" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "✓ Passed: " << tests_passed << std::endl;
+    std::cout << "✗ Failed: " << tests_failed << std::endl;
+    std::cout << "Total: " << (tests_passed + tests_failed) << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -7,15 +7,40 @@
  */
 
 #include "hash/hash_table.hpp"
+#include "memory/node_pool.hpp"
 #include <iostream>
 #include <cassert>
 #include <string>
 #include <vector>
 #include <algorithm>
 #include <random>
+#include <string_view>
+#include <cstdlib>
+#include <new>
+#include <functional>
+#include <iterator>
 
 using namespace mylib::hash;
 
+// Count heap allocations so tests can assert a path does not allocate
+static std::size_t g_allocations = 0;
+
+void* operator new(std::size_t size) {
+    ++g_allocations;
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
 // Test result counter
 int tests_passed = 0;
 int tests_failed = 0;
@@ -344,6 +369,57 @@ void test_count() {
     END_TEST
 }
 
+void test_find_batch() {
+    TEST("find_batch() matches find()")
+    HashTable<int, std::string> table;
+    for (int i = 0; i < 1000; i += 2) {
+        table.insert(i, std::to_string(i));
+    }
+    
+    // Not a multiple of FIND_BATCH_CHUNK, half hits and half misses
+    std::vector<int> keys;
+    for (int i = 0; i < 203; ++i) {
+        keys.push_back((i * 37) % 1000);
+    }
+    std::vector<std::string*> results(keys.size());
+    table.find_batch(keys.data(), keys.size(), results.data());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        assert(results[i] == table.find(keys[i]));
+        assert((results[i] != nullptr) == (keys[i] % 2 == 0));
+    }
+    
+    const auto& view = table;
+    std::vector<const std::string*> const_results;
+    view.find_batch(keys, const_results);
+    assert(const_results.size() == keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        assert(const_results[i] == results[i]);
+    }
+    
+    view.find_batch(std::vector<int>(), const_results);
+    assert(const_results.empty());
+    END_TEST
+}
+
+void test_find_batch_while_rehashing() {
+    TEST("find_batch() during incremental rehash")
+    HashTable<long long, long long> table;
+    table.incremental_rehash(true, 1);
+    std::vector<long long> keys;
+    for (long long i = 0; i < 5000; ++i) {
+        table.insert(i, i * i);
+        keys.push_back(i);
+    }
+    assert(table.rehashing());
+    
+    std::vector<long long*> results;
+    table.find_batch(keys, results);
+    for (long long i = 0; i < 5000; ++i) {
+        assert(results[i] != nullptr && *results[i] == i * i);
+    }
+    END_TEST
+}
+
 // ============================================
 // Capacity Tests
 // ============================================
@@ -504,6 +580,398 @@ void test_auto_rehash() {
     END_TEST
 }
 
+// ============================================
+// Incremental Rehash Tests
+// ============================================
+
+void test_incremental_rehash_toggle() {
+    TEST("incremental_rehash() enable/disable")
+    HashTable<int, int> table;
+    assert(!table.incremental_rehash());
+    assert(!table.rehashing());
+    
+    table.incremental_rehash(true, 4);
+    assert(table.incremental_rehash());
+    
+    bool thrown = false;
+    try {
+        table.incremental_rehash(true, 0);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    END_TEST
+}
+
+void test_incremental_rehash_migration() {
+    TEST("Incremental rehash keeps old and new buckets live")
+    HashTable<int, int> table(16);
+    table.incremental_rehash(true, 1);
+    
+    bool saw_migration = false;
+    for (int i = 0; i < 1000; ++i) {
+        table.insert(i, i * 3);
+        saw_migration = saw_migration || table.rehashing();
+        // Every key must be reachable mid-migration
+        if (i % 97 == 0) {
+            for (int j = 0; j <= i; ++j) {
+                assert(table.contains(j));
+                assert(table.at(j) == j * 3);
+            }
+        }
+    }
+    assert(saw_migration);
+    assert(table.size() == 1000);
+    
+    table.finish_rehash();
+    assert(!table.rehashing());
+    size_t total_in_buckets = 0;
+    for (size_t i = 0; i < table.bucket_count(); ++i) {
+        total_in_buckets += table.bucket_size(i);
+    }
+    assert(total_in_buckets == 1000);
+    END_TEST
+}
+
+void test_incremental_rehash_erase_and_iterate() {
+    TEST("Erase and iteration during incremental rehash")
+    HashTable<int, int> table(8);
+    table.incremental_rehash(true, 1);
+    
+    for (int i = 0; i < 200; ++i) {
+        table[i] = i;
+    }
+    for (int i = 0; i < 200; i += 2) {
+        assert(table.erase(i));
+        assert(!table.contains(i));
+    }
+    assert(table.size() == 100);
+    
+    std::vector<int> keys = table.keys();
+    std::sort(keys.begin(), keys.end());
+    assert(keys.size() == 100);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        assert(keys[i] == static_cast<int>(i * 2 + 1));
+    }
+    
+    long long sum = 0;
+    table.for_each([&sum](const int&, const int& value) { sum += value; });
+    assert(sum == 100LL * 100);
+    END_TEST
+}
+
+void test_incremental_rehash_references_stable() {
+    TEST("Value references survive incremental and full rehash")
+    HashTable<int, int> table(4);
+    table.incremental_rehash(true, 2);
+    
+    int& first = table[0];
+    first = 42;
+    for (int i = 1; i < 500; ++i) {
+        table[i] = i;
+    }
+    assert(&first == table.find(0));
+    table.rehash(4096);
+    assert(&first == table.find(0));
+    assert(first == 42);
+    END_TEST
+}
+
+void test_incremental_rehash_copy_move_swap() {
+    TEST("Copy, move and swap during incremental rehash")
+    HashTable<int, int> table(8);
+    table.incremental_rehash(true, 1);
+    for (int i = 0; i < 50; ++i) {
+        table[i] = i;
+    }
+    
+    HashTable<int, int> copy(table);
+    HashTable<int, int> moved(std::move(table));
+    assert(copy.size() == 50 && moved.size() == 50);
+    assert(table.empty() && !table.rehashing());
+    
+    HashTable<int, int> other;
+    other.swap(copy);
+    for (int i = 0; i < 50; ++i) {
+        assert(other.at(i) == i);
+        assert(moved.at(i) == i);
+    }
+    assert(copy.empty());
+    
+    other.incremental_rehash(false);
+    assert(!other.rehashing());
+    assert(other.size() == 50);
+    END_TEST
+}
+
+void test_incremental_rehash_matches_sync() {
+    TEST("Incremental and synchronous rehash agree on random operations")
+    HashTable<int, int> sync;
+    HashTable<int, int> incremental;
+    incremental.incremental_rehash(true, 1);
+    
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> key_dist(0, 5000);
+    std::uniform_int_distribution<int> op_dist(0, 9);
+    for (int i = 0; i < 50000; ++i) {
+        int key = key_dist(rng);
+        int op = op_dist(rng);
+        if (op < 6) {
+            assert(sync.insert_or_assign(key, i) == incremental.insert_or_assign(key, i));
+        } else if (op < 8) {
+            assert(sync.erase(key) == incremental.erase(key));
+        } else {
+            const int* a = sync.find(key);
+            const int* b = incremental.find(key);
+            assert((a == nullptr) == (b == nullptr));
+            assert(a == nullptr || *a == *b);
+        }
+        assert(sync.size() == incremental.size());
+    }
+    END_TEST
+}
+
+// ============================================
+// Bucket Policy Tests
+// ============================================
+
+using Pow2Table = HashTable<int, int, std::hash<int>, std::equal_to<int>, PowerOfTwoBucketPolicy>;
+using FastRangeTable = HashTable<int, int, std::hash<int>, std::equal_to<int>, FastRangeBucketPolicy>;
+
+struct AvalanchingHash {
+    using is_avalanching = void;
+    std::size_t operator()(int key) const { return static_cast<std::size_t>(key); }
+};
+
+/**
+ * @brief Largest bucket after inserting keys (all must be present)
+ */
+template <typename Table>
+size_t max_bucket_size(const Table& table) {
+    size_t longest = 0;
+    for (size_t i = 0; i < table.bucket_count(); ++i) {
+        longest = std::max(longest, table.bucket_size(i));
+    }
+    return longest;
+}
+
+void test_bucket_policy_rounding() {
+    TEST("Bucket policy rounding")
+    assert(PrimeBucketPolicy::round_bucket_count(16) == 17);
+    assert(PrimeBucketPolicy::round_bucket_count(0) == 2);
+    assert(PowerOfTwoBucketPolicy::round_bucket_count(100) == 128);
+    assert(PowerOfTwoBucketPolicy::round_bucket_count(64) == 64);
+    assert(FastRangeBucketPolicy::round_bucket_count(100) == 100);
+    assert(FastRangeBucketPolicy::round_bucket_count(0) == 1);
+    
+    for (size_t h : {size_t(0), size_t(1), size_t(12345), ~size_t(0)}) {
+        assert(PowerOfTwoBucketPolicy::index(h, 64) < 64);
+        assert(FastRangeBucketPolicy::index(h, 100) < 100);
+    }
+    assert(FastRangeBucketPolicy::index(~size_t(0), 100) == 99);
+    
+    static_assert(detail::is_avalanching<AvalanchingHash>::value, "declared avalanching");
+    static_assert(!detail::is_avalanching<std::hash<int>>::value, "std::hash is not marked");
+    END_TEST
+}
+
+void test_power_of_two_policy() {
+    TEST("PowerOfTwoBucketPolicy operations")
+    Pow2Table table(100);
+    assert(table.bucket_count() == 128);
+    
+    for (int i = 0; i < 10000; ++i) {
+        table.insert(i, i * 2);
+    }
+    size_t count = table.bucket_count();
+    assert((count & (count - 1)) == 0);
+    for (int i = 0; i < 10000; ++i) {
+        assert(table.at(i) == i * 2);
+    }
+    for (int i = 0; i < 10000; i += 2) {
+        assert(table.erase(i));
+    }
+    assert(table.size() == 5000);
+    
+    table.rehash(70000);
+    assert(table.bucket_count() == 131072);
+    assert(table.contains(9999) && !table.contains(9998));
+    END_TEST
+}
+
+void test_fastrange_policy() {
+    TEST("FastRangeBucketPolicy operations")
+    FastRangeTable table(1000);
+    assert(table.bucket_count() == 1000);
+    
+    for (int i = 0; i < 10000; ++i) {
+        table[i] = i + 1;
+    }
+    for (int i = 0; i < 10000; ++i) {
+        assert(*table.find(i) == i + 1);
+    }
+    assert(table.load_factor() <= table.max_load_factor());
+    
+    // Identity hash is mixed before the multiply-high reduction
+    int key = 777;
+    assert(table.bucket(key) ==
+           FastRangeBucketPolicy::index(detail::mix_hash(std::hash<int>()(key)), table.bucket_count()));
+    END_TEST
+}
+
+void test_policy_hash_quality_guard() {
+    TEST("Identity hashes do not cluster under fast policies")
+    // Sequential and strided integer keys are the classic failure cases
+    Pow2Table pow2(4096);
+    FastRangeTable fastrange(4096);
+    for (int i = 0; i < 3000; ++i) {
+        pow2[i * 1024] = i;
+        fastrange[i] = i;
+    }
+    assert(pow2.bucket_count() == 4096);
+    assert(fastrange.bucket_count() == 4096);
+    assert(max_bucket_size(pow2) <= 8);
+    assert(max_bucket_size(fastrange) <= 8);
+    END_TEST
+}
+
+void test_policies_match_prime() {
+    TEST("All bucket policies agree on random operations")
+    HashTable<long long, long long> prime;
+    HashTable<long long, long long, std::hash<long long>, std::equal_to<long long>,
+              PowerOfTwoBucketPolicy> pow2;
+    HashTable<long long, long long, std::hash<long long>, std::equal_to<long long>,
+              FastRangeBucketPolicy> fastrange;
+    pow2.incremental_rehash(true);
+    
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<long long> key_dist(0, 20000);
+    for (int i = 0; i < 30000; ++i) {
+        long long key = key_dist(rng) << (i % 3 == 0 ? 20 : 0);
+        if (i % 4 == 3) {
+            bool erased = prime.erase(key);
+            assert(pow2.erase(key) == erased);
+            assert(fastrange.erase(key) == erased);
+        } else {
+            bool inserted = prime.insert_or_assign(key, i);
+            assert(pow2.insert_or_assign(key, i) == inserted);
+            assert(fastrange.insert_or_assign(key, i) == inserted);
+        }
+    }
+    assert(pow2.size() == prime.size());
+    assert(fastrange.size() == prime.size());
+    prime.for_each([&](const long long& key, const long long& value) {
+        assert(pow2.at(key) == value);
+        assert(fastrange.at(key) == value);
+    });
+    END_TEST
+}
+
+// ============================================
+// Heterogeneous Lookup Tests
+// ============================================
+
+using RouteTable = HashTable<std::string, int, StringHash, std::equal_to<>>;
+
+void test_transparent_find() {
+    TEST("Transparent find/contains/count with string_view and const char*")
+    RouteTable table;
+    const std::string long_key = "/api/v1/users/profile/settings/notifications";
+    table[long_key] = 1;
+    table["/health"] = 2;
+    
+    std::string_view view = long_key;
+    assert(table.find(view) != nullptr);
+    assert(*table.find(view) == 1);
+    assert(table.find(std::string_view("/missing")) == nullptr);
+    assert(table.contains("/health"));
+    assert(table.count(std::string_view("/health")) == 1);
+    assert(table.count("/nope") == 0);
+    
+    // Same entry whichever key type is used
+    assert(table.find(view) == table.find(long_key));
+    
+    const RouteTable& view_table = table;
+    assert(*view_table.find(view) == 1);
+    END_TEST
+}
+
+void test_transparent_at_and_erase() {
+    TEST("Transparent at() and erase()")
+    RouteTable table;
+    table["alpha"] = 1;
+    table["beta"] = 2;
+    
+    assert(table.at(std::string_view("alpha")) == 1);
+    table.at("beta") = 20;
+    assert(table.at(std::string("beta")) == 20);
+    
+    bool thrown = false;
+    try {
+        table.at(std::string_view("gamma"));
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    assert(table.erase(std::string_view("alpha")));
+    assert(!table.erase("alpha"));
+    assert(table.size() == 1);
+    END_TEST
+}
+
+void test_transparent_erase_by_iterator() {
+    TEST("Transparent table still erases by iterator")
+    RouteTable table;
+    for (int i = 0; i < 50; ++i) {
+        table["/route/" + std::to_string(i)] = i;
+    }
+    // Both iterator kinds take the positional overload, not erase(const K&)
+    auto next = table.erase(table.begin());
+    assert(table.size() == 49);
+    RouteTable::const_iterator pos = next;
+    table.erase(pos);
+    assert(table.size() == 48);
+    for (auto it = table.begin(); it != table.end();) {
+        it = it->second % 2 == 0 ? table.erase(it) : std::next(it);
+    }
+    for (const auto& entry : table) {
+        assert(entry.second % 2 == 1);
+    }
+    END_TEST
+}
+
+void test_transparent_lookup_does_not_allocate() {
+    TEST("Transparent lookup does not allocate")
+    RouteTable table;
+    const std::string long_key(64, 'x');
+    table[long_key] = 7;
+    table.incremental_rehash(true);
+    for (int i = 0; i < 100; ++i) {
+        table[std::to_string(i) + long_key] = i;
+    }
+    
+    const char* raw = long_key.c_str();
+    std::string_view view = long_key;
+    size_t before = g_allocations;
+    int sum = 0;
+    for (int i = 0; i < 100; ++i) {
+        sum += *table.find(view);
+        sum += table.contains(raw) ? 1 : 0;
+        sum += static_cast<int>(table.count(view));
+        sum += table.at(view);
+    }
+    assert(g_allocations == before);
+    assert(sum == 100 * (7 + 1 + 1 + 7));
+    
+    // The plain std::string overload still copies a const char* key
+    before = g_allocations;
+    HashTable<std::string, int> plain;
+    plain[long_key] = 1;
+    assert(g_allocations > before);
+    END_TEST
+}
+
 // ============================================
 // Bucket Interface Tests
 // ============================================
@@ -602,6 +1070,246 @@ void test_values() {
     END_TEST
 }
 
+// ============================================
+// Iterator and Node Handle Tests
+// ============================================
+
+void test_iterators() {
+    TEST("begin()/end() visit every entry")
+    HashTable<int, int> table;
+    assert(table.begin() == table.end());
+    
+    table.incremental_rehash(true, 1);
+    for (int i = 0; i < 1000; ++i) {
+        table.insert(i, i * 2);
+    }
+    assert(table.rehashing());  // Entries split between old and new buckets
+    
+    std::vector<int> seen;
+    for (auto& [key, value] : table) {
+        assert(value == key * 2);
+        value += 1;
+        seen.push_back(key);
+    }
+    std::sort(seen.begin(), seen.end());
+    assert(seen.size() == 1000);
+    for (int i = 0; i < 1000; ++i) {
+        assert(seen[i] == i);
+    }
+    
+    const auto& view = table;
+    HashTable<int, int>::const_iterator it = table.begin();  // iterator -> const_iterator
+    assert(it == view.cbegin());
+    assert(static_cast<size_t>(std::distance(view.begin(), view.end())) == table.size());
+    assert(std::count_if(view.begin(), view.end(),
+                         [](const auto& entry) { return entry.second % 2 == 1; }) == 1000);
+    END_TEST
+}
+
+void test_erase_iterator() {
+    TEST("erase(iterator) while iterating")
+    HashTable<int, int> table;
+    table.incremental_rehash(true, 1);
+    for (int i = 0; i < 500; ++i) {
+        table.insert(i, i);
+    }
+    
+    for (auto it = table.begin(); it != table.end();) {
+        if (it->first % 2 == 0) {
+            it = table.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    assert(table.size() == 250);
+    for (int i = 0; i < 500; ++i) {
+        assert(table.contains(i) == (i % 2 == 1));
+    }
+    END_TEST
+}
+
+void test_template_for_each() {
+    TEST("for_each() visitor does not allocate")
+    HashTable<int, int> table;
+    for (int i = 0; i < 100; ++i) {
+        table.insert(i, i);
+    }
+    
+    long long sum = 0;
+    int pad[8] = {};  // Capture too large for std::function's small buffer
+    size_t before = g_allocations;
+    table.for_each([&sum, pad](const int& key, int& value) {
+        value += pad[0];
+        sum += key;
+    });
+    assert(g_allocations == before);
+    assert(sum == 4950);
+    
+    // Explicit std::function still selects the type-erased overload
+    std::function<void(const int&, const int&)> func = [&sum](const int&, const int& value) {
+        sum -= value;
+    };
+    static_cast<const HashTable<int, int>&>(table).for_each(func);
+    assert(sum == 0);
+    END_TEST
+}
+
+void test_extract_and_insert_node() {
+    TEST("extract() and insert(node) move entries without copying")
+    HashTable<std::string, std::string> source;
+    HashTable<std::string, std::string> target;
+    source.insert("key", std::string(100, 'v'));
+    const std::string* address = source.find("key");
+    
+    size_t before = g_allocations;
+    auto node = source.extract("key");
+    assert(!node.empty());
+    assert(node.key() == "key");
+    assert(&node.mapped() == address);
+    assert(source.empty());
+    
+    auto result = target.insert(std::move(node));
+    assert(result.first && result.second);
+    assert(node.empty());
+    assert(target.find("key") == address);
+    assert(g_allocations == before);
+    
+    assert(!source.extract("missing"));
+    assert(!target.insert(HashTable<std::string, std::string>::node_type()).first);
+    
+    // A duplicate key leaves the node with the caller
+    source.insert("key", "other");
+    auto dup = source.extract(source.begin());
+    result = target.insert(std::move(dup));
+    assert(result.first && !result.second);
+    assert(!dup.empty() && dup.mapped() == "other");
+    assert(target.at("key") == std::string(100, 'v'));
+    END_TEST
+}
+
+void test_drain_with_extract() {
+    TEST("Drain a table with extract(iterator)")
+    HashTable<int, std::string> table;
+    for (int i = 0; i < 200; ++i) {
+        table.insert(i, std::to_string(i));
+    }
+    
+    std::vector<std::string> drained;
+    for (auto it = table.begin(); it != table.end();) {
+        auto node = table.extract(it++);
+        drained.push_back(std::move(node.mapped()));
+    }
+    assert(table.empty());
+    assert(table.begin() == table.end());
+    assert(drained.size() == 200);
+    END_TEST
+}
+
+void test_merge() {
+    TEST("merge() splices absent keys")
+    HashTable<int, int> a;
+    HashTable<int, int> b;
+    for (int i = 0; i < 100; ++i) {
+        a.insert(i, i);
+    }
+    for (int i = 50; i < 300; ++i) {
+        b.insert(i, -i);
+    }
+    const int* moved = b.find(200);
+    
+    a.merge(b);
+    assert(a.size() == 300);
+    assert(b.size() == 50);     // Keys 50..99 were already in a
+    assert(a.at(75) == 75);
+    assert(b.at(75) == -75);
+    assert(a.find(200) == moved);
+    assert(a.load_factor() <= a.max_load_factor());
+    
+    a.merge(a);
+    assert(a.size() == 300);
+    a.merge(std::move(b));
+    assert(a.size() == 300);
+    END_TEST
+}
+
+// ============================================
+// Allocator Tests
+// ============================================
+
+using PoolTable = HashTable<int, int, std::hash<int>, std::equal_to<int>, PrimeBucketPolicy,
+                            mylib::memory::PoolAllocator<std::pair<const int, int>>>;
+
+void test_pool_allocator() {
+    TEST("Pool allocator: entries come from the pool across rehashes")
+    PoolTable table;
+    auto pool = table.get_allocator().pool();
+    for (int i = 0; i < 5000; ++i) {
+        table.insert(i, i * 2);
+    }
+    assert(table.size() == 5000);
+    assert(pool->in_use() == 5000);
+    table.rehash(20000);
+    assert(pool->in_use() == 5000);
+    for (int i = 0; i < 5000; i += 2) {
+        assert(table.erase(i));
+    }
+    assert(pool->in_use() == 2500);
+    assert(table.at(4999) == 9998);
+    
+    PoolTable copy(table);
+    assert(copy.get_allocator() != table.get_allocator());
+    assert(copy.get_allocator().pool()->in_use() == 2500);
+    assert(copy.at(1) == 2);
+    
+    table.clear();
+    assert(pool->in_use() == 0);
+    assert(copy.size() == 2500);
+    END_TEST
+}
+
+void test_pool_allocator_node_transfer() {
+    TEST("Pool allocator: node handles and merge across pools")
+    PoolTable a;
+    PoolTable b;
+    for (int i = 0; i < 100; ++i) {
+        a.insert(i, i);
+    }
+    for (int i = 50; i < 300; ++i) {
+        b.insert(i, -i);
+    }
+    auto a_pool = a.get_allocator().pool();
+    auto b_pool = b.get_allocator().pool();
+    
+    // Different pools: entries are moved into the target's pool
+    a.merge(b);
+    assert(a.size() == 300 && b.size() == 50);
+    assert(a.at(200) == -200 && a.at(75) == 75);
+    assert(a_pool->in_use() == 300);
+    assert(b_pool->in_use() == 50);
+    
+    // A duplicate leaves the node with the caller; after erasing, the
+    // node's entry is moved into a's pool
+    auto node = b.extract(75);
+    assert(node.mapped() == -75);
+    auto result = a.insert(std::move(node));
+    assert(result.first && !result.second && !node.empty());
+    a.erase(75);
+    result = a.insert(std::move(node));
+    assert(result.second && node.empty());
+    assert(a.at(75) == -75);
+    assert(a_pool->in_use() == 300);
+    assert(b_pool->in_use() == 49);
+    
+    // Same pool: nodes are spliced
+    PoolTable c(a.get_allocator());
+    c.insert(1000, 1);
+    const int* address = c.find(1000);
+    a.merge(c);
+    assert(c.empty() && a.find(1000) == address);
+    END_TEST
+}
+
+
 // ============================================
 // String Key Tests
 // ============================================
@@ -891,6 +1599,8 @@ int main() {
     test_find();
     test_contains();
     test_count();
+    test_find_batch();
+    test_find_batch_while_rehashing();
 
     // Capacity tests
     std::cout << std::endl << "--- Capacity Tests ---" << std::endl;
@@ -910,6 +1620,30 @@ int main() {
     test_reserve();
     test_auto_rehash();
 
+    // Incremental rehash tests
+    std::cout << std::endl << "--- Incremental Rehash Tests ---" << std::endl;
+    test_incremental_rehash_toggle();
+    test_incremental_rehash_migration();
+    test_incremental_rehash_erase_and_iterate();
+    test_incremental_rehash_references_stable();
+    test_incremental_rehash_copy_move_swap();
+    test_incremental_rehash_matches_sync();
+
+    // Bucket policy tests
+    std::cout << std::endl << "--- Bucket Policy Tests ---" << std::endl;
+    test_bucket_policy_rounding();
+    test_power_of_two_policy();
+    test_fastrange_policy();
+    test_policy_hash_quality_guard();
+    test_policies_match_prime();
+
+    // Heterogeneous lookup tests
+    std::cout << std::endl << "--- Heterogeneous Lookup Tests ---" << std::endl;
+    test_transparent_find();
+    test_transparent_at_and_erase();
+    test_transparent_erase_by_iterator();
+    test_transparent_lookup_does_not_allocate();
+
     // Bucket interface tests
     std::cout << std::endl << "--- Bucket Interface Tests ---" << std::endl;
     test_bucket();
@@ -922,6 +1656,15 @@ int main() {
     test_keys();
     test_values();
 
+    // Iterator and node handle tests
+    std::cout << std::endl << "--- Iterator and Node Handle Tests ---" << std::endl;
+    test_iterators();
+    test_erase_iterator();
+    test_template_for_each();
+    test_extract_and_insert_node();
+    test_drain_with_extract();
+    test_merge();
+
     // String tests
     std::cout << std::endl << "--- String Tests ---" << std::endl;
     test_string_keys();
@@ -946,6 +1689,12 @@ int main() {
     test_cache_simulation();
     test_two_sum_problem();
 
+    // Allocator tests
+    std::cout << std::endl << "--- Allocator Tests ---" << std::endl;
+    test_pool_allocator();
+    test_pool_allocator_node_transfer();
+
+
     // Print summary
     std::cout << std::endl;
     std::cout << "========================================" << std::endl;
@@ -0,0 +1,518 @@
+/**
+ * @file test_open_hash_table.cpp
+ * @brief Test suite for OpenHashTable class
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ */
+
+#include "hash/open_hash_table.hpp"
+#include "hash/hash_table.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <random>
+
+using namespace mylib::hash;
+
+// Test result counter
+int tests_passed = 0;
+int tests_failed = 0;
+
+// Helper macro for testing
+#define TEST(name) \
+    std::cout << "Testing: " << name << "... "; \
+    try {
+
+#define END_TEST \
+        std::cout << "✓ PASSED" << std::endl; \
+        tests_passed++; \
+    } catch (const std::exception& e) { \
+        std::cout << "✗ FAILED: " << e.what() << std::endl; \
+        tests_failed++; \
+    }
+
+/**
+ * @brief Hash that sends every key to the same home slot
+ */
+struct ConstantHash {
+    std::size_t operator()(int) const { return 42; }
+};
+
+// ============================================
+// Constructor Tests
+// ============================================
+
+void test_default_constructor() {
+    TEST("Default constructor")
+    OpenHashTable<int, int> table;
+    assert(table.empty());
+    assert(table.size() == 0);
+    assert(table.bucket_count() > 0);
+    END_TEST
+}
+
+void test_bucket_count_constructor() {
+    TEST("Constructor rounds bucket count to power of two")
+    OpenHashTable<int, int> table(100);
+    assert(table.bucket_count() >= 100);
+    assert((table.bucket_count() & (table.bucket_count() - 1)) == 0);
+    END_TEST
+}
+
+void test_initializer_list() {
+    TEST("Initializer list constructor")
+    OpenHashTable<std::string, int> table = {
+        {"one", 1},
+        {"two", 2},
+        {"three", 3}
+    };
+    assert(table.size() == 3);
+    assert(table["one"] == 1);
+    assert(table["two"] == 2);
+    assert(table["three"] == 3);
+    END_TEST
+}
+
+void test_copy_constructor() {
+    TEST("Copy constructor")
+    OpenHashTable<int, std::string> table1;
+    for (int i = 0; i < 50; ++i) {
+        table1[i] = std::to_string(i);
+    }
+
+    OpenHashTable<int, std::string> table2(table1);
+    assert(table2.size() == 50);
+    assert(table2[7] == "7");
+
+    table2[7] = "seven";
+    assert(table1[7] == "7");
+    END_TEST
+}
+
+void test_move_constructor() {
+    TEST("Move constructor")
+    OpenHashTable<int, int> table1;
+    table1[1] = 100;
+    table1[2] = 200;
+
+    OpenHashTable<int, int> table2(std::move(table1));
+    assert(table2.size() == 2);
+    assert(table2[1] == 100);
+    assert(table1.empty());
+
+    // Moved-from table is still usable
+    assert(!table1.contains(1));
+    table1[5] = 500;
+    assert(table1.at(5) == 500);
+    END_TEST
+}
+
+void test_assignment() {
+    TEST("Copy and move assignment")
+    OpenHashTable<int, int> table1;
+    table1[1] = 100;
+    table1[2] = 200;
+
+    OpenHashTable<int, int> table2;
+    table2[9] = 9;
+    table2 = table1;
+    assert(table2.size() == 2);
+    assert(!table2.contains(9));
+    table2[1] = 999;
+    assert(table1[1] == 100);
+
+    OpenHashTable<int, int> table3;
+    table3 = std::move(table2);
+    assert(table3.size() == 2);
+    assert(table3[1] == 999);
+    assert(table2.empty());
+    END_TEST
+}
+
+// ============================================
+// Element Access and Modifier Tests
+// ============================================
+
+void test_operator_brackets() {
+    TEST("operator[] access and default insert")
+    OpenHashTable<std::string, int> table;
+    table["apple"] = 5;
+    int& val = table["newkey"];
+    assert(val == 0);
+    val = 42;
+    assert(table["newkey"] == 42);
+    assert(table["apple"] == 5);
+    assert(table.size() == 2);
+    END_TEST
+}
+
+void test_at_exception() {
+    TEST("at() throws on missing key")
+    OpenHashTable<int, int> table;
+    table[1] = 100;
+    assert(table.at(1) == 100);
+
+    bool exception_thrown = false;
+    try {
+        table.at(999);
+    } catch (const std::out_of_range&) {
+        exception_thrown = true;
+    }
+    assert(exception_thrown);
+    END_TEST
+}
+
+void test_insert() {
+    TEST("insert() and duplicates")
+    OpenHashTable<int, int> table;
+    auto result = table.insert(1, 100);
+    assert(result.first && result.second);
+
+    result = table.insert(1, 200);
+    assert(result.first && !result.second);
+    assert(table[1] == 100);
+    assert(table.size() == 1);
+    END_TEST
+}
+
+void test_insert_or_assign() {
+    TEST("insert_or_assign()")
+    OpenHashTable<int, int> table;
+    assert(table.insert_or_assign(1, 100));
+    assert(!table.insert_or_assign(1, 200));
+    assert(table[1] == 200);
+    END_TEST
+}
+
+void test_emplace() {
+    TEST("emplace() constructs value in place")
+    OpenHashTable<int, std::string> table;
+    auto result = table.emplace(1, 3, 'x');
+    assert(result.second);
+    assert(table[1] == "xxx");
+
+    result = table.emplace(1, 5, 'y');
+    assert(!result.second);
+    assert(table[1] == "xxx");
+    END_TEST
+}
+
+void test_move_only_value() {
+    TEST("Move-only values")
+    OpenHashTable<int, std::unique_ptr<int>> table;
+    for (int i = 0; i < 100; ++i) {
+        table.insert(int(i), std::make_unique<int>(i * 2));
+    }
+    assert(table.size() == 100);
+    for (int i = 0; i < 100; ++i) {
+        assert(*table.at(i) == i * 2);
+    }
+    END_TEST
+}
+
+void test_insert_aliasing_element() {
+    TEST("Inserting a copy of an element survives the rehash it triggers")
+    const std::string source(40, 's');
+    OpenHashTable<int, std::string> table;
+    table.insert(0, source);
+    // Each loop crosses several growth points; every new value is read
+    // from an element of the table
+    for (int i = 1; i < 300; ++i) {
+        switch (i % 3) {
+        case 0: table.insert(i, *table.find(0)); break;
+        case 1: table.insert_or_assign(i, *table.find(i - 1)); break;
+        default: table.emplace(i, table.at(i - 1)); break;
+        }
+    }
+    for (int i = 0; i < 300; ++i) {
+        assert(table.at(i) == source);
+    }
+
+    // A key read from a value of the table
+    OpenHashTable<std::string, std::string> names;
+    names.insert("k0", "k1");
+    for (int i = 1; i < 300; ++i) {
+        const std::string& next = names.at("k" + std::to_string(i - 1));
+        names.insert(next, "k" + std::to_string(i + 1));
+    }
+    assert(names.size() == 300);
+    for (int i = 0; i < 300; ++i) {
+        assert(names.at("k" + std::to_string(i)) == "k" + std::to_string(i + 1));
+    }
+    END_TEST
+}
+
+void test_erase() {
+    TEST("erase()")
+    OpenHashTable<int, int> table;
+    table[1] = 100;
+    table[2] = 200;
+    table[3] = 300;
+
+    assert(table.erase(2));
+    assert(!table.erase(2));
+    assert(table.size() == 2);
+    assert(!table.contains(2));
+    assert(table.contains(1));
+    assert(table.contains(3));
+    END_TEST
+}
+
+void test_clear_and_swap() {
+    TEST("clear() and swap()")
+    OpenHashTable<int, int> table1;
+    table1[1] = 100;
+    table1[2] = 200;
+    size_t buckets = table1.bucket_count();
+
+    OpenHashTable<int, int> table2;
+    table2[10] = 1000;
+
+    table1.swap(table2);
+    assert(table1.size() == 1);
+    assert(table2.size() == 2);
+    assert(table1[10] == 1000);
+
+    table2.clear();
+    assert(table2.empty());
+    assert(table2.bucket_count() == buckets);
+    table2[3] = 3;
+    assert(table2.size() == 1);
+    END_TEST
+}
+
+// ============================================
+// Probing and Rehash Tests
+// ============================================
+
+void test_collisions() {
+    TEST("All keys colliding on one home slot")
+    OpenHashTable<int, int, ConstantHash> table;
+    for (int i = 0; i < 200; ++i) {
+        table[i] = i;
+    }
+    assert(table.size() == 200);
+    for (int i = 0; i < 200; ++i) {
+        assert(table.at(i) == i);
+    }
+    for (int i = 0; i < 200; i += 2) {
+        assert(table.erase(i));
+    }
+    for (int i = 0; i < 200; ++i) {
+        assert(table.contains(i) == (i % 2 == 1));
+    }
+    END_TEST
+}
+
+void test_tombstone_churn() {
+    TEST("Insert/erase churn does not grow table unboundedly")
+    OpenHashTable<int, int> table;
+    for (int i = 0; i < 64; ++i) {
+        table[i] = i;
+    }
+    size_t buckets = table.bucket_count();
+
+    for (int round = 0; round < 100; ++round) {
+        for (int i = 0; i < 64; ++i) {
+            table.erase(round * 64 + i);
+            table[(round + 1) * 64 + i] = i;
+        }
+    }
+    assert(table.size() == 64);
+    assert(table.bucket_count() <= buckets * 2);
+    for (int i = 0; i < 64; ++i) {
+        assert(table.at(100 * 64 + i) == i);
+    }
+    END_TEST
+}
+
+void test_rehash_and_reserve() {
+    TEST("rehash() and reserve()")
+    OpenHashTable<int, int> table;
+    for (int i = 0; i < 10; ++i) {
+        table[i] = i * 10;
+    }
+    table.rehash(1000);
+    assert(table.bucket_count() >= 1000);
+    for (int i = 0; i < 10; ++i) {
+        assert(table.at(i) == i * 10);
+    }
+
+    OpenHashTable<int, int> reserved;
+    reserved.reserve(1000);
+    size_t buckets = reserved.bucket_count();
+    for (int i = 0; i < 1000; ++i) {
+        reserved[i] = i;
+    }
+    assert(reserved.bucket_count() == buckets);
+    END_TEST
+}
+
+void test_max_load_factor() {
+    TEST("max_load_factor() bounds")
+    OpenHashTable<int, int> table;
+    for (int i = 0; i < 100; ++i) {
+        table[i] = i;
+    }
+    table.max_load_factor(0.5f);
+    assert(table.max_load_factor() == 0.5f);
+    assert(table.load_factor() <= 0.5f);
+
+    bool exception_thrown = false;
+    try {
+        table.max_load_factor(1.0f);
+    } catch (const std::invalid_argument&) {
+        exception_thrown = true;
+    }
+    assert(exception_thrown);
+    END_TEST
+}
+
+void test_bucket_interface() {
+    TEST("bucket() and bucket_size()")
+    OpenHashTable<int, int> table;
+    for (int i = 0; i < 10; ++i) {
+        table[i] = i;
+    }
+    assert(table.bucket(3) < table.bucket_count());
+
+    size_t total = 0;
+    for (size_t i = 0; i < table.bucket_count(); ++i) {
+        total += table.bucket_size(i);
+    }
+    assert(total == table.size());
+    END_TEST
+}
+
+// ============================================
+// Iteration Tests
+// ============================================
+
+void test_iteration() {
+    TEST("for_each(), keys() and values()")
+    OpenHashTable<int, int> table;
+    table[1] = 100;
+    table[2] = 200;
+    table[3] = 300;
+
+    table.for_each([](const int&, int& value) { value += 1; });
+
+    int sum = 0;
+    const auto& const_table = table;
+    const_table.for_each([&sum](const int&, const int& value) { sum += value; });
+    assert(sum == 603);
+
+    auto keys = table.keys();
+    std::sort(keys.begin(), keys.end());
+    assert((keys == std::vector<int>{1, 2, 3}));
+    assert(table.values().size() == 3);
+    END_TEST
+}
+
+// ============================================
+// Differential Test
+// ============================================
+
+void test_matches_chained_table() {
+    TEST("Random operations match HashTable")
+    OpenHashTable<int, int> open;
+    HashTable<int, int> chained;
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> key_dist(0, 2000);
+    std::uniform_int_distribution<int> op_dist(0, 3);
+
+    for (int i = 0; i < 50000; ++i) {
+        int key = key_dist(rng);
+        switch (op_dist(rng)) {
+            case 0:
+                assert(open.insert(key, i) == chained.insert(key, i));
+                break;
+            case 1:
+                assert(open.insert_or_assign(key, i) == chained.insert_or_assign(key, i));
+                break;
+            case 2:
+                assert(open.erase(key) == chained.erase(key));
+                break;
+            default: {
+                const int* a = open.find(key);
+                const int* b = chained.find(key);
+                assert((a == nullptr) == (b == nullptr));
+                assert(a == nullptr || *a == *b);
+                break;
+            }
+        }
+        assert(open.size() == chained.size());
+    }
+    END_TEST
+}
+
+void test_large_dataset() {
+    TEST("Large dataset (100000 elements)")
+    OpenHashTable<int, int> table;
+    const int N = 100000;
+    for (int i = 0; i < N; ++i) {
+        table[i] = i * 2;
+    }
+    assert(table.size() == static_cast<size_t>(N));
+    assert(table.load_factor() <= table.max_load_factor());
+    for (int i = 0; i < N; ++i) {
+        assert(table.at(i) == i * 2);
+    }
+    assert(!table.contains(N));
+    END_TEST
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "OpenHashTable Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::cout << std::endl << "--- Constructor Tests ---" << std::endl;
+    test_default_constructor();
+    test_bucket_count_constructor();
+    test_initializer_list();
+    test_copy_constructor();
+    test_move_constructor();
+    test_assignment();
+
+    std::cout << std::endl << "--- Access and Modifier Tests ---" << std::endl;
+    test_operator_brackets();
+    test_at_exception();
+    test_insert();
+    test_insert_or_assign();
+    test_emplace();
+    test_move_only_value();
+    test_insert_aliasing_element();
+    test_erase();
+    test_clear_and_swap();
+
+    std::cout << std::endl << "--- Probing and Rehash Tests ---" << std::endl;
+    test_collisions();
+    test_tombstone_churn();
+    test_rehash_and_reserve();
+    test_max_load_factor();
+    test_bucket_interface();
+
+    std::cout << std::endl << "--- Iteration Tests ---" << std::endl;
+    test_iteration();
+
+    std::cout << std::endl << "--- Stress Tests ---" << std::endl;
+    test_matches_chained_table();
+    test_large_dataset();
+
+    // Print summary
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Test Results" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "✓ Passed: " << tests_passed << std::endl;
+    std::cout << "✗ Failed: " << tests_failed << std::endl;
+    std::cout << "Total: " << (tests_passed + tests_failed) << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -10,6 +10,8 @@
 #include <iostream>
 #include <cassert>
 #include <string>
+#include <deque>
+#include <random>
 
 using namespace mylib::linear;
 
@@ -478,6 +480,131 @@ void test_clear_and_reuse() {
     END_TEST
 }
 
+void test_random_access_across_blocks() {
+    TEST("Random access across block boundaries matches std::deque")
+    Deque<int> deque;
+    std::deque<int> model;
+    std::mt19937 rng(7);
+    for (int i = 0; i < 20000; ++i) {
+        switch (rng() % 4) {
+        case 0: deque.push_front(i); model.push_front(i); break;
+        case 1: deque.push_back(i); model.push_back(i); break;
+        case 2:
+            if (!model.empty()) { deque.pop_front(); model.pop_front(); }
+            break;
+        default:
+            deque.push_back(-i); model.push_back(-i);
+            break;
+        }
+    }
+    assert(deque.size() == model.size());
+    for (std::size_t i = 0; i < model.size(); ++i) {
+        assert(deque[i] == model[i]);
+    }
+    assert(deque.at(model.size() - 1) == model.back());
+    END_TEST
+}
+
+void test_references_stable() {
+    TEST("References stay valid across pushes at both ends")
+    Deque<int> deque;
+    deque.push_back(42);
+    int* first = &deque.front();
+    for (int i = 0; i < 10000; ++i) {
+        deque.push_back(i);
+        deque.push_front(-i);
+    }
+    assert(first == &deque[10000]);
+    assert(*first == 42);
+    END_TEST
+}
+
+void test_steady_state_reuses_blocks() {
+    TEST("Queue at a steady size reuses its blocks")
+    Deque<int> deque;
+    for (int i = 0; i < 1000; ++i) {
+        deque.push_back(i);
+    }
+    for (int i = 0; i < 5000; ++i) {
+        deque.push_back(i);
+        deque.pop_front();
+    }
+    std::size_t capacity = deque.capacity();
+    for (int i = 0; i < 100000; ++i) {
+        deque.push_back(i);
+        deque.pop_front();
+    }
+    assert(deque.capacity() == capacity);
+    assert(deque.size() == 1000);
+    assert(deque.front() == 99000 && deque.back() == 99999);
+    END_TEST
+}
+
+void test_shrink_to_fit() {
+    TEST("shrink_to_fit() frees spare blocks")
+    Deque<int> deque;
+    for (int i = 0; i < 10000; ++i) {
+        deque.push_back(i);
+    }
+    std::size_t full = deque.capacity();
+    for (int i = 0; i < 9990; ++i) {
+        deque.pop_front();
+    }
+    assert(deque.capacity() == full);
+    deque.shrink_to_fit();
+    assert(deque.capacity() < full);
+    assert(deque.capacity() >= deque.size());
+    assert(deque.front() == 9990 && deque.back() == 9999);
+    deque.clear();
+    deque.shrink_to_fit();
+    assert(deque.capacity() == 0);
+    deque.push_front(1);
+    assert(deque.front() == 1);
+    END_TEST
+}
+
+void test_insert_erase_middle_large() {
+    TEST("insert() and erase() in the middle of a multi-block deque")
+    Deque<int> deque;
+    std::deque<int> model;
+    for (int i = 0; i < 3000; ++i) {
+        deque.push_back(i);
+        model.push_back(i);
+    }
+    for (int i = 0; i < 200; ++i) {
+        std::size_t pos = (static_cast<std::size_t>(i) * 7919) % model.size();
+        deque.insert(pos, -i);
+        model.insert(model.begin() + pos, -i);
+        pos = (static_cast<std::size_t>(i) * 104729) % model.size();
+        deque.erase(pos);
+        model.erase(model.begin() + pos);
+    }
+    assert(deque.size() == model.size());
+    for (std::size_t i = 0; i < model.size(); ++i) {
+        assert(deque[i] == model[i]);
+    }
+    END_TEST
+}
+
+void test_string_elements() {
+    TEST("Deque<std::string> constructs and destroys elements")
+    Deque<std::string> deque;
+    for (int i = 0; i < 1000; ++i) {
+        deque.push_back(std::string(40, static_cast<char>('a' + i % 26)));
+        deque.push_front(std::to_string(i));
+    }
+    deque.insert(1000, "middle");
+    assert(deque[1000] == "middle");
+    assert(deque.front() == "999");
+    Deque<std::string> copy(deque);
+    deque.erase(1000);
+    assert(copy.size() == 2001 && deque.size() == 2000);
+    assert(copy.remove("middle") == 1);
+    deque.clear();
+    assert(deque.empty() && copy.size() == 2000);
+    END_TEST
+}
+
 // Main test runner
 int main() {
     std::cout << "========================================" << std::endl;
@@ -523,6 +650,13 @@ int main() {
     test_sliding_window_simulation();
     test_clear_and_reuse();
 
+    test_random_access_across_blocks();
+    test_references_stable();
+    test_steady_state_reuses_blocks();
+    test_shrink_to_fit();
+    test_insert_erase_middle_large();
+    test_string_elements();
+
     // Print summary
     std::cout << std::endl;
     std::cout << "========================================" << std::endl;
@@ -0,0 +1,477 @@
+/**
+ * @file test_dynamic_array_v2.cpp
+ * @brief Test suite for the header-only DynamicArray (v2)
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ */
+
+#include "linear/dynamic_array/dynamic_array.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <list>
+#include <sstream>
+#include <iterator>
+#include <cstring>
+#include <cstdint>
+
+using namespace mylib::linear;
+
+// Test result counter
+int tests_passed = 0;
+int tests_failed = 0;
+
+// Helper macro for testing
+#define TEST(name) \
+    std::cout << "Testing: " << name << "... "; \
+    try {
+
+#define END_TEST \
+        std::cout << "✓ PASSED" << std::endl; \
+        tests_passed++; \
+    } catch (const std::exception& e) { \
+        std::cout << "✗ FAILED: " << e.what() << std::endl; \
+        tests_failed++; \
+    }
+
+/**
+ * @struct Tracked
+ * @brief Counts live instances to catch leaks and double destruction
+ */
+struct Tracked {
+    static int live;
+    int value;
+
+    Tracked(int v = 0) : value(v) { ++live; }
+    Tracked(const Tracked& other) : value(other.value) { ++live; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++live; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) = default;
+    ~Tracked() { --live; }
+};
+
+int Tracked::live = 0;
+
+/**
+ * @struct SelfRef
+ * @brief Points into itself, so it must be moved element by element
+ */
+struct SelfRef {
+    int value;
+    int* self;
+
+    SelfRef(int v = 0) : value(v), self(&value) {}
+    SelfRef(const SelfRef& other) : value(other.value), self(&value) {}
+    SelfRef& operator=(const SelfRef& other) {
+        value = other.value;
+        return *this;
+    }
+    bool intact() const { return self == &value; }
+};
+
+static_assert(is_trivially_relocatable_v<int>, "int relocates by memcpy");
+static_assert(is_trivially_relocatable_v<std::unique_ptr<int>>, "unique_ptr relocates by memcpy");
+static_assert(is_trivially_relocatable_v<DynamicArray<int>>, "DynamicArray relocates by memcpy");
+static_assert(!is_trivially_relocatable_v<SelfRef>, "self-referencing types must not");
+
+// ============================================
+// Relocation Tests
+// ============================================
+
+void test_grow_trivial() {
+    TEST("Growing an int array keeps every element")
+    DynamicArray<int> arr;
+    for (int i = 0; i < 10000; ++i) {
+        arr.push_back(i);
+    }
+    assert(arr.size() == 10000);
+    for (int i = 0; i < 10000; ++i) {
+        assert(arr[i] == i);
+    }
+    arr.shrink_to_fit();
+    assert(arr.capacity() == 10000);
+    assert(arr.back() == 9999);
+    END_TEST
+}
+
+void test_grow_unique_ptr() {
+    TEST("Growing a unique_ptr array relocates ownership")
+    DynamicArray<std::unique_ptr<int>> arr;
+    for (int i = 0; i < 1000; ++i) {
+        arr.push_back(std::make_unique<int>(i));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        assert(*arr[i] == i);
+    }
+    arr.reserve(5000);
+    assert(*arr[999] == 999);
+    END_TEST
+}
+
+void test_grow_self_referencing() {
+    TEST("Self-referencing elements are rebuilt on growth")
+    DynamicArray<SelfRef> arr;
+    for (int i = 0; i < 100; ++i) {
+        arr.emplace_back(i);
+    }
+    for (int i = 0; i < 100; ++i) {
+        assert(arr[i].value == i);
+        assert(arr[i].intact());
+    }
+    END_TEST
+}
+
+void test_push_back_own_element_on_growth() {
+    TEST("push_back of an own element survives reallocation")
+    DynamicArray<std::string> arr;
+    arr.push_back(std::string(40, 'x'));
+    while (arr.size() < arr.capacity()) {
+        arr.push_back("filler");
+    }
+    arr.push_back(arr[0]);
+    assert(arr.back() == std::string(40, 'x'));
+    arr.resize(arr.capacity() + 1, arr[0]);
+    assert(arr.back() == std::string(40, 'x'));
+    END_TEST
+}
+
+// ============================================
+// Insert / Erase Tests
+// ============================================
+
+void test_insert_trivial() {
+    TEST("insert shifts trivially relocatable elements")
+    DynamicArray<int> arr = {1, 2, 4, 5};
+    auto it = arr.insert(arr.begin() + 2, 3);
+    assert(*it == 3);
+    arr.insert(arr.begin(), 0);
+    arr.insert(arr.end(), 6);
+    assert(arr.size() == 7);
+    for (int i = 0; i < 7; ++i) {
+        assert(arr[i] == i);
+    }
+    END_TEST
+}
+
+void test_insert_own_element() {
+    TEST("insert of an own element copies it before shifting")
+    DynamicArray<std::string> arr;
+    arr.reserve(8);
+    arr.push_back("a");
+    arr.push_back("b");
+    arr.push_back("c");
+    arr.insert(arr.begin(), arr[2]);
+    assert(arr[0] == "c" && arr[1] == "a" && arr[3] == "c");
+    while (arr.size() < arr.capacity()) {
+        arr.push_back("z");
+    }
+    arr.insert(arr.begin() + 1, arr[1]);
+    assert(arr[1] == "a" && arr[2] == "a");
+    END_TEST
+}
+
+void test_insert_self_referencing() {
+    TEST("insert moves non-relocatable elements one by one")
+    DynamicArray<SelfRef> arr;
+    for (int i = 0; i < 10; ++i) {
+        arr.emplace_back(i * 2);
+    }
+    arr.emplace(arr.begin() + 3, 5);
+    assert(arr.size() == 11);
+    assert(arr[3].value == 5 && arr[4].value == 6);
+    for (const SelfRef& item : arr) {
+        assert(item.intact());
+    }
+    END_TEST
+}
+
+void test_erase() {
+    TEST("erase removes single elements and ranges")
+    DynamicArray<std::unique_ptr<int>> arr;
+    for (int i = 0; i < 10; ++i) {
+        arr.push_back(std::make_unique<int>(i));
+    }
+    auto it = arr.erase(arr.begin());
+    assert(**it == 1);
+    it = arr.erase(arr.begin() + 2, arr.begin() + 5);
+    assert(**it == 6);
+    assert(arr.size() == 6);
+    it = arr.erase(arr.end() - 1);
+    assert(it == arr.end());
+    assert(*arr[0] == 1 && *arr[1] == 2 && *arr[2] == 6 && *arr.back() == 8);
+    assert(arr.erase(arr.begin(), arr.begin()) == arr.begin());
+    END_TEST
+}
+
+// ============================================
+// Bulk Append / Insert Tests
+// ============================================
+
+void test_append_pointer_range() {
+    TEST("append copies a raw buffer and grows once")
+    const unsigned char packet[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    DynamicArray<unsigned char> buffer;
+    buffer.append(packet, sizeof(packet));
+    assert(buffer.size() == 10);
+    assert(buffer.capacity() == 10);
+    buffer.append(packet + 2, packet + 5);
+    assert(buffer.size() == 13);
+    assert(std::memcmp(buffer.data(), packet, 10) == 0);
+    assert(buffer[10] == 3 && buffer[12] == 5);
+    buffer.append(packet, 0);
+    assert(buffer.size() == 13);
+    END_TEST
+}
+
+void test_append_own_elements() {
+    TEST("append of an own range survives reallocation")
+    DynamicArray<int> ints = {1, 2, 3};
+    ints.shrink_to_fit();
+    ints.append(ints.begin(), ints.end());
+    assert(ints.size() == 6);
+    assert(ints[3] == 1 && ints[5] == 3);
+
+    DynamicArray<std::string> strings;
+    strings.push_back(std::string(40, 'a'));
+    strings.push_back(std::string(40, 'b'));
+    strings.shrink_to_fit();
+    strings.append(strings.begin(), strings.end());
+    assert(strings.size() == 4);
+    assert(strings[2] == std::string(40, 'a') && strings[3] == std::string(40, 'b'));
+    END_TEST
+}
+
+void test_append_iterator_kinds() {
+    TEST("append accepts forward and single-pass ranges")
+    std::list<std::string> words = {"alpha", "beta", "gamma"};
+    DynamicArray<std::string> arr;
+    arr.append(words.begin(), words.end());
+    assert(arr.size() == 3 && arr[1] == "beta");
+
+    std::istringstream input("4 5 6");
+    DynamicArray<int> nums;
+    nums.append(std::istream_iterator<int>(input), std::istream_iterator<int>());
+    assert(nums.size() == 3 && nums[0] == 4 && nums[2] == 6);
+    END_TEST
+}
+
+void test_range_insert() {
+    TEST("Range insert places elements before pos")
+    DynamicArray<int> arr = {1, 2, 7, 8};
+    arr.reserve(20);
+    const int middle[] = {3, 4, 5, 6};
+    auto it = arr.insert(arr.begin() + 2, middle, middle + 4);
+    assert(*it == 3);
+    assert(arr.size() == 8);
+    for (int i = 0; i < 8; ++i) {
+        assert(arr[i] == i + 1);
+    }
+
+    // Own elements, within capacity and with growth
+    arr.insert(arr.begin(), arr.begin() + 6, arr.end());
+    assert(arr.size() == 10 && arr[0] == 7 && arr[1] == 8 && arr[2] == 1);
+    arr.shrink_to_fit();
+    arr.insert(arr.end(), arr.begin(), arr.begin() + 3);
+    assert(arr.size() == 13 && arr[10] == 7 && arr[12] == 1);
+
+    std::vector<std::string> source = {"b", "c"};
+    DynamicArray<std::string> strings = {"a", "d"};
+    strings.insert(strings.begin() + 1, source.begin(), source.end());
+    assert(strings.size() == 4 && strings[1] == "b" && strings[2] == "c" && strings[3] == "d");
+
+    std::istringstream input("9 10");
+    auto at = arr.insert(arr.begin() + 1, std::istream_iterator<int>(input), std::istream_iterator<int>());
+    assert(*at == 9 && arr[2] == 10 && arr[3] == 8);
+    END_TEST
+}
+
+void test_resize_without_zeroing() {
+    TEST("resize_uninitialized / resize_default_init skip value-init")
+    DynamicArray<int> buffer;
+    buffer.resize_uninitialized(64);
+    assert(buffer.size() == 64);
+    for (int i = 0; i < 64; ++i) {
+        buffer[i] = i;
+    }
+    buffer.resize_uninitialized(16);
+    assert(buffer.size() == 16 && buffer.back() == 15);
+
+    Tracked::live = 0;
+    {
+        DynamicArray<Tracked> objects;
+        objects.resize_default_init(10);
+        assert(Tracked::live == 10 && objects[9].value == 0);
+        objects.resize_default_init(3);
+        assert(Tracked::live == 3);
+    }
+    assert(Tracked::live == 0);
+    END_TEST
+}
+
+// ============================================
+// Allocation Policy Tests
+// ============================================
+
+/// Maps buffers from 16 KiB so the tests cross the threshold quickly
+using SmallHugePages = HugePageAllocation<64, 16 * 1024>;
+
+template <typename Array>
+bool is_aligned(const Array& arr, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(arr.data()) % alignment == 0;
+}
+
+void test_aligned_policy() {
+    TEST("AlignedAllocation keeps data() on the requested boundary")
+    DynamicArray<float, AlignedAllocation<64>> arr;
+    static_assert(DynamicArray<float, AlignedAllocation<64>>::ALIGNMENT == 64, "policy alignment");
+    static_assert(DynamicArray<double>::ALIGNMENT == alignof(double), "default alignment");
+    for (int i = 0; i < 5000; ++i) {
+        arr.push_back(static_cast<float>(i));
+        assert(is_aligned(arr, 64));
+    }
+    arr.insert(arr.begin(), -1.0f);
+    arr.shrink_to_fit();
+    assert(is_aligned(arr, 64));
+    assert(arr.size() == 5001 && arr[0] == -1.0f && arr[5000] == 4999.0f);
+
+    DynamicArray<float, AlignedAllocation<64>> copy(arr);
+    assert(is_aligned(copy, 64) && copy == arr);
+    END_TEST
+}
+
+void test_huge_page_policy_growth() {
+    TEST("HugePageAllocation grows across the threshold and by remapping")
+    DynamicArray<std::uint64_t, SmallHugePages> arr;
+    for (std::uint64_t i = 0; i < 200000; ++i) {
+        arr.push_back(i * 3);
+        assert(is_aligned(arr, 64));
+    }
+    for (std::uint64_t i = 0; i < 200000; ++i) {
+        assert(arr[i] == i * 3);
+    }
+    arr.append(arr.begin(), arr.begin() + 1000);
+    assert(arr.size() == 201000 && arr[200999] == 999 * 3);
+
+    // Back below the threshold: relocated into a heap block
+    arr.resize(100);
+    arr.shrink_to_fit();
+    assert(arr.capacity() == 100 && arr[99] == 99 * 3);
+    END_TEST
+}
+
+void test_huge_page_policy_objects() {
+    TEST("HugePageAllocation holds relocatable and non-relocatable types")
+    DynamicArray<std::unique_ptr<int>, SmallHugePages> owners;
+    DynamicArray<std::string, SmallHugePages> strings;
+    for (int i = 0; i < 20000; ++i) {
+        owners.push_back(std::make_unique<int>(i));
+        strings.push_back(std::to_string(i));
+    }
+    for (int i = 0; i < 20000; i += 997) {
+        assert(*owners[i] == i);
+        assert(strings[i] == std::to_string(i));
+    }
+    auto moved = std::move(strings);
+    assert(strings.empty() && moved.size() == 20000);
+    END_TEST
+}
+
+// ============================================
+// Lifetime Tests
+// ============================================
+
+void test_element_lifetimes() {
+    TEST("Every constructed element is destroyed exactly once")
+    Tracked::live = 0;
+    {
+        DynamicArray<Tracked> arr;
+        for (int i = 0; i < 50; ++i) {
+            arr.emplace_back(i);
+        }
+        assert(Tracked::live == 50);
+        arr.pop_back();
+        assert(Tracked::live == 49);
+        arr.insert(arr.begin() + 10, Tracked(-1));
+        assert(Tracked::live == 50);
+        arr.erase(arr.begin(), arr.begin() + 5);
+        assert(Tracked::live == 45);
+        arr.resize(20);
+        assert(Tracked::live == 20);
+        arr.resize(30, Tracked(7));
+        assert(Tracked::live == 30);
+
+        DynamicArray<Tracked> copy(arr);
+        assert(Tracked::live == 60);
+        copy.clear();
+        assert(Tracked::live == 30);
+        copy = arr;
+        arr = std::move(copy);
+        assert(Tracked::live == 30);
+        arr.shrink_to_fit();
+        assert(Tracked::live == 30);
+    }
+    assert(Tracked::live == 0);
+    END_TEST
+}
+
+void test_swap() {
+    TEST("swap exchanges buffers")
+    DynamicArray<std::unique_ptr<int>> a;
+    DynamicArray<std::unique_ptr<int>> b;
+    a.push_back(std::make_unique<int>(1));
+    int* owned = a[0].get();
+    swap(a, b);
+    assert(a.empty());
+    assert(b.size() == 1 && b[0].get() == owned);
+    END_TEST
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "DynamicArray (v2) Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::cout << std::endl << "--- Relocation Tests ---" << std::endl;
+    test_grow_trivial();
+    test_grow_unique_ptr();
+    test_grow_self_referencing();
+    test_push_back_own_element_on_growth();
+
+    std::cout << std::endl << "--- Insert / Erase Tests ---" << std::endl;
+    test_insert_trivial();
+    test_insert_own_element();
+    test_insert_self_referencing();
+    test_erase();
+
+    std::cout << std::endl << "--- Bulk Append / Insert Tests ---" << std::endl;
+    test_append_pointer_range();
+    test_append_own_elements();
+    test_append_iterator_kinds();
+    test_range_insert();
+    test_resize_without_zeroing();
+
+    std::cout << std::endl << "--- Allocation Policy Tests ---" << std::endl;
+    test_aligned_policy();
+    test_huge_page_policy_growth();
+    test_huge_page_policy_objects();
+
+    std::cout << std::endl << "--- Lifetime Tests ---" << std::endl;
+    test_element_lifetimes();
+    test_swap();
+
+    // Print summary
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Test Results" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "✓ Passed: " << tests_passed << std::endl;
+    std::cout << "✗ Failed: " << tests_failed << std::endl;
+    std::cout << "Total: " << (tests_passed + tests_failed) << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return tests_failed > 0 ? 1 : 0;
+}
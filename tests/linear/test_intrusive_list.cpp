@@ -0,0 +1,273 @@
+/**
+ * @file test_intrusive_list.cpp
+ * @brief Test suite for IntrusiveList class
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ */
+
+#include "linear/intrusive_list.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <iterator>
+#include <stdexcept>
+
+using namespace mylib::linear;
+
+// Test result counter
+int tests_passed = 0;
+int tests_failed = 0;
+
+// Helper macro for testing
+#define TEST(name) \
+    std::cout << "Testing: " << name << "... "; \
+    try {
+
+#define END_TEST \
+        std::cout << "✓ PASSED" << std::endl; \
+        tests_passed++; \
+    } catch (const std::exception& e) { \
+        std::cout << "✗ FAILED: " << e.what() << std::endl; \
+        tests_failed++; \
+    }
+
+struct ByAge {};
+struct BySize {};
+
+/**
+ * @struct Entry
+ * @brief Object that can be on one untagged and two tagged lists at once
+ */
+struct Entry : IntrusiveListHook<>, IntrusiveListHook<ByAge>, IntrusiveListHook<BySize> {
+    int id;
+    std::string payload;
+
+    explicit Entry(int id = 0) : id(id), payload(64, 'x') {}
+};
+
+template <typename List>
+std::vector<int> ids(const List& list) {
+    std::vector<int> result;
+    for (const Entry& entry : list) {
+        result.push_back(entry.id);
+    }
+    return result;
+}
+
+// ============================================
+// Basic Operation Tests
+// ============================================
+
+void test_push_pop() {
+    TEST("push/pop at both ends link and unlink in place")
+    std::vector<Entry> entries;
+    for (int i = 0; i < 4; ++i) {
+        entries.emplace_back(i);
+    }
+    IntrusiveList<Entry> list;
+    assert(list.empty());
+    list.push_back(entries[1]);
+    list.push_back(entries[2]);
+    list.push_front(entries[0]);
+    list.push_back(entries[3]);
+    assert(list.size() == 4);
+    assert(&list.front() == &entries[0] && &list.back() == &entries[3]);
+    assert((ids(list) == std::vector<int>{0, 1, 2, 3}));
+    assert(entries[2].IntrusiveListHook<>::is_linked());
+
+    list.pop_front();
+    list.pop_back();
+    assert((ids(list) == std::vector<int>{1, 2}));
+    assert(!entries[0].IntrusiveListHook<>::is_linked());
+    assert(!entries[3].IntrusiveListHook<>::is_linked());
+    END_TEST
+}
+
+void test_errors() {
+    TEST("Empty-list and double-link errors")
+    Entry entry(1);
+    IntrusiveList<Entry> list;
+    bool thrown = false;
+    try { list.front(); } catch (const std::out_of_range&) { thrown = true; }
+    assert(thrown);
+    thrown = false;
+    try { list.pop_back(); } catch (const std::out_of_range&) { thrown = true; }
+    assert(thrown);
+
+    list.push_back(entry);
+    IntrusiveList<Entry> other;
+    thrown = false;
+    try { other.push_back(entry); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown);
+    assert(list.size() == 1 && other.empty());
+    END_TEST
+}
+
+void test_insert_erase_iterators() {
+    TEST("insert/erase/remove at iterators, bidirectional traversal")
+    std::vector<Entry> entries;
+    for (int i = 0; i < 5; ++i) {
+        entries.emplace_back(i);
+    }
+    IntrusiveList<Entry> list;
+    list.push_back(entries[0]);
+    list.push_back(entries[4]);
+    auto it = list.insert(std::next(list.begin()), entries[2]);
+    list.insert(it, entries[1]);
+    list.insert(std::prev(list.end()), entries[3]);
+    assert((ids(list) == std::vector<int>{0, 1, 2, 3, 4}));
+
+    std::vector<int> reversed;
+    for (auto rit = list.rbegin(); rit != list.rend(); ++rit) {
+        reversed.push_back(rit->id);
+    }
+    assert((reversed == std::vector<int>{4, 3, 2, 1, 0}));
+
+    it = list.erase(list.iterator_to(entries[2]));
+    assert(&*it == &entries[3]);
+    list.remove(entries[0]);
+    assert((ids(list) == std::vector<int>{1, 3, 4}));
+    assert(!entries[2].IntrusiveListHook<>::is_linked());
+
+    // Unlinked entries can be linked again
+    list.push_front(entries[2]);
+    assert(list.front().id == 2 && list.size() == 4);
+    END_TEST
+}
+
+// ============================================
+// Splice / LRU Tests
+// ============================================
+
+void test_lru_touch() {
+    TEST("LRU: touch moves an entry to the front in O(1)")
+    std::vector<Entry> entries;
+    for (int i = 0; i < 5; ++i) {
+        entries.emplace_back(i);
+    }
+    IntrusiveList<Entry> lru;
+    for (Entry& entry : entries) {
+        lru.push_front(entry);
+    }
+    assert((ids(lru) == std::vector<int>{4, 3, 2, 1, 0}));
+
+    auto touch = [&lru](Entry& entry) {
+        lru.splice(lru.begin(), lru, lru.iterator_to(entry));
+    };
+    touch(entries[1]);
+    touch(entries[3]);
+    touch(entries[3]);
+    assert((ids(lru) == std::vector<int>{3, 1, 4, 2, 0}));
+    assert(lru.size() == 5);
+
+    // Evict the least recently used
+    Entry& victim = lru.back();
+    lru.pop_back();
+    assert(victim.id == 0 && lru.size() == 4);
+    END_TEST
+}
+
+void test_splice_between_lists() {
+    TEST("splice whole lists and single elements between lists")
+    std::vector<Entry> entries;
+    for (int i = 0; i < 6; ++i) {
+        entries.emplace_back(i);
+    }
+    IntrusiveList<Entry> a;
+    IntrusiveList<Entry> b;
+    for (int i = 0; i < 3; ++i) {
+        a.push_back(entries[i]);
+        b.push_back(entries[i + 3]);
+    }
+    a.splice(std::next(a.begin()), b);
+    assert(b.empty() && a.size() == 6);
+    assert((ids(a) == std::vector<int>{0, 3, 4, 5, 1, 2}));
+
+    b.splice(b.end(), a, a.iterator_to(entries[4]));
+    assert(a.size() == 5 && b.size() == 1 && b.front().id == 4);
+
+    IntrusiveList<Entry> moved(std::move(a));
+    assert(a.empty() && moved.size() == 5);
+    swap(moved, b);
+    assert(moved.size() == 1 && b.size() == 5);
+    assert((ids(b) == std::vector<int>{0, 3, 5, 1, 2}));
+    END_TEST
+}
+
+void test_tagged_hooks() {
+    TEST("One object on several lists through tagged hooks")
+    Entry young(1);
+    Entry old(2);
+    young.payload.assign(10, 'y');
+    old.payload.assign(1000, 'o');
+
+    IntrusiveList<Entry, ByAge> by_age;
+    IntrusiveList<Entry, BySize> by_size;
+    IntrusiveList<Entry> all;
+    by_age.push_back(old);
+    by_age.push_back(young);
+    by_size.push_back(young);
+    by_size.push_back(old);
+    all.push_back(young);
+    all.push_back(old);
+    assert(by_age.front().id == 2 && by_size.front().id == 1 && all.front().id == 1);
+
+    by_age.remove(old);
+    assert(by_age.size() == 1 && by_size.size() == 2 && all.size() == 2);
+    assert(!static_cast<IntrusiveListHook<ByAge>&>(old).is_linked());
+    assert(static_cast<IntrusiveListHook<BySize>&>(old).is_linked());
+    END_TEST
+}
+
+void test_copy_and_clear() {
+    TEST("Copies start unlinked; clear() and destruction unlink")
+    Entry original(7);
+    Entry copy(0);
+    {
+        IntrusiveList<Entry> list;
+        list.push_back(original);
+        Entry duplicate = original;
+        assert(!duplicate.IntrusiveListHook<>::is_linked());
+        copy = original;
+        assert(!copy.IntrusiveListHook<>::is_linked() && copy.id == 7);
+        list.push_back(copy);
+        list.clear();
+        assert(list.empty());
+        assert(!original.IntrusiveListHook<>::is_linked());
+        list.push_back(original);
+    }
+    // The list's destructor unlinked it
+    assert(!original.IntrusiveListHook<>::is_linked());
+    END_TEST
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "IntrusiveList Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::cout << std::endl << "--- Basic Operation Tests ---" << std::endl;
+    test_push_pop();
+    test_errors();
+    test_insert_erase_iterators();
+
+    std::cout << std::endl << "--- Splice / LRU Tests ---" << std::endl;
+    test_lru_touch();
+    test_splice_between_lists();
+    test_tagged_hooks();
+    test_copy_and_clear();
+
+    // Print summary
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Test Results" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "✓ Passed: " << tests_passed << std::endl;
+    std::cout << "✗ Failed: " << tests_failed << std::endl;
+    std::cout << "Total: " << (tests_passed + tests_failed) << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -7,9 +7,15 @@
  */
 
 #include "linear/linked_list.hpp"
+#include "memory/node_pool.hpp"
 #include <iostream>
 #include <cassert>
 #include <string>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <numeric>
+#include <stdexcept>
 
 using namespace mylib::linear;
 
@@ -449,6 +455,235 @@ void test_clear_and_reuse() {
     END_TEST
 }
 
+// Test: pooled nodes
+void test_pool_allocator() {
+    TEST("Pool allocator: nodes recycled and released on clear")
+    using PoolList = LinkedList<int, mylib::memory::PoolAllocator<int>>;
+    PoolList list;
+    for (int i = 0; i < 1000; ++i) {
+        list.push_back(i);
+    }
+    auto pool = list.get_allocator().pool();
+    assert(pool->in_use() == 1000);
+    list.remove(500);
+    list.pop_front();
+    assert(pool->in_use() == 998);
+    list.push_back(7);
+    assert(pool->in_use() == 999);
+
+    PoolList copy(list);
+    assert(copy.get_allocator() != list.get_allocator());
+    assert(copy.size() == list.size() && copy.back() == 7);
+
+    // pool is also held here, so clear() walks the nodes
+    list.clear();
+    assert(pool->in_use() == 0);
+    assert(copy.size() == 999);
+    END_TEST
+}
+
+// Test: bulk release of an exclusively owned pool
+void test_pool_bulk_release() {
+    TEST("Pool allocator: exclusive pool dropped in bulk")
+    LinkedList<int, mylib::memory::PoolAllocator<int>> list;
+    for (int i = 0; i < 5000; ++i) {
+        list.push_back(i);
+    }
+    std::weak_ptr<mylib::memory::NodePool> pool = list.get_allocator().pool();
+    assert(pool.lock()->slab_count() > 0);
+    list.clear();
+    assert(list.empty());
+    assert(pool.lock()->slab_count() == 0);
+
+    list.push_back(1);
+    list.push_front(0);
+    assert(list.size() == 2 && list[0] == 0 && list[1] == 1);
+    END_TEST
+}
+
+// Test: bidirectional iterators
+void test_iterators() {
+    TEST("Iterators: forward, backward and reverse")
+    LinkedList<int> list = {1, 2, 3, 4, 5};
+    assert(std::accumulate(list.begin(), list.end(), 0) == 15);
+    auto it = list.end();
+    --it;
+    assert(*it == 5);
+    assert(*std::prev(it, 2) == 3);
+    std::vector<int> reversed(list.rbegin(), list.rend());
+    assert((reversed == std::vector<int>{5, 4, 3, 2, 1}));
+    for (int& value : list) {
+        value *= 10;
+    }
+    const LinkedList<int>& view = list;
+    LinkedList<int>::const_iterator first = list.begin();
+    assert(first == view.cbegin() && *first == 10);
+    assert(std::distance(view.begin(), view.end()) == 5);
+    END_TEST
+}
+
+// Test: O(1) insert/erase at an iterator
+void test_iterator_insert_erase() {
+    TEST("Iterator insert/erase")
+    LinkedList<int> list = {1, 3, 5};
+    auto it = list.insert(std::next(list.begin()), 2);
+    assert(*it == 2 && list.size() == 4);
+    list.insert(list.end(), 6);
+    list.insert(list.begin(), 0);
+    assert(list.front() == 0 && list.back() == 6);
+
+    it = list.erase(std::find(list.begin(), list.end(), 3));
+    assert(*it == 5 && list.size() == 5);
+    it = list.erase(list.begin(), std::next(list.begin(), 2));
+    assert(*it == 2 && list.front() == 2);
+    list.erase(list.begin(), list.end());
+    assert(list.empty());
+    list.push_back(9);
+    assert(list.front() == 9 && list.back() == 9);
+    END_TEST
+}
+
+// Test: splice whole lists, single elements and ranges
+void test_splice() {
+    TEST("splice relinks nodes without moving elements")
+    LinkedList<int> list = {1, 2, 3};
+    LinkedList<int> other = {10, 20, 30};
+    const int* address = &other.front();
+    list.splice(std::next(list.begin()), other);
+    assert(other.empty() && list.size() == 6);
+    assert(&*std::next(list.begin()) == address);
+    assert(list[1] == 10 && list[3] == 30 && list[4] == 2);
+
+    // Single element within the same list: move the last to the front
+    list.splice(list.begin(), list, std::prev(list.end()));
+    assert(list.front() == 3 && list.back() == 2 && list.size() == 6);
+
+    // Range into another list
+    LinkedList<int> target = {100};
+    list.splice(list.end(), list, list.begin());   // Rotate the 3 back
+    target.splice(target.begin(), list, list.begin(), std::next(list.begin(), 3));
+    assert(target.size() == 4 && list.size() == 3);
+    assert(target.front() == 1 && target.back() == 100);
+    assert(list.front() == 30 && list.back() == 3);
+
+    bool thrown = false;
+    try {
+        list.splice(list.begin(), list);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    END_TEST
+}
+
+// Test: splice between lists with different pools moves the elements
+void test_splice_different_allocators() {
+    TEST("splice between different pools")
+    using PoolList = LinkedList<int, mylib::memory::PoolAllocator<int>>;
+    PoolList a;
+    a.push_back(1);
+    a.push_back(2);
+    PoolList b(a);
+    assert(a.get_allocator() != b.get_allocator());
+    a.splice(a.end(), b);
+    assert(a.size() == 4 && b.empty());
+    assert(a.get_allocator().pool()->in_use() == 4);
+    b.push_back(7);
+    a.splice(a.begin(), b, b.begin());
+    assert(a.front() == 7 && b.empty());
+    END_TEST
+}
+
+// Test: relinking merge sort
+void test_sort() {
+    TEST("sort relinks nodes and is stable")
+    LinkedList<long long> list;
+    std::vector<long long> expected;
+    std::mt19937 rng(11);
+    for (int i = 0; i < 1000; ++i) {
+        long long value = static_cast<long long>(rng() % 500);
+        list.push_back(value);
+        expected.push_back(value);
+    }
+    std::vector<const long long*> addresses;
+    for (const long long& value : list) {
+        addresses.push_back(&value);
+    }
+    std::vector<long long> before(list.begin(), list.end());
+
+    list.sort();
+    std::sort(expected.begin(), expected.end());
+    assert(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+    assert(*std::prev(list.end()) == expected.back() && list.back() == expected.back());
+    // Nodes were relinked, not rewritten
+    for (std::size_t i = 0; i < addresses.size(); ++i) {
+        assert(*addresses[i] == before[i]);
+    }
+
+    // Stability: sort by tens digit, ties keep their order
+    LinkedList<int> digits = {31, 12, 35, 17, 33, 10};
+    digits.sort([](int a, int b) { return a / 10 < b / 10; });
+    std::vector<int> sorted(digits.begin(), digits.end());
+    assert((sorted == std::vector<int>{12, 17, 10, 31, 35, 33}));
+    std::vector<int> backwards(digits.rbegin(), digits.rend());
+    assert((backwards == std::vector<int>{33, 35, 31, 10, 17, 12}));
+    END_TEST
+}
+
+// Test: a throwing comparator leaves every element in the list
+void test_sort_throwing_comparator() {
+    TEST("sort keeps all elements if the comparator throws")
+    LinkedList<int> list;
+    for (int i = 0; i < 300; ++i) {
+        list.push_back((i * 37) % 300);
+    }
+    int budget = 1000;
+    bool thrown = false;
+    try {
+        list.sort([&budget](int a, int b) {
+            if (--budget == 0) {
+                throw std::runtime_error("comparator failed");
+            }
+            return a < b;
+        });
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(list.size() == 300);
+    std::vector<int> values(list.begin(), list.end());
+    std::vector<int> backwards(list.rbegin(), list.rend());
+    assert(values.size() == 300 && backwards.size() == 300);
+    std::sort(values.begin(), values.end());
+    for (int i = 0; i < 300; ++i) {
+        assert(values[i] == i);
+    }
+    list.sort();
+    assert(list.front() == 0 && list.back() == 299);
+    END_TEST
+}
+
+// Test: merge of sorted lists
+void test_merge() {
+    TEST("merge sorted lists by relinking")
+    LinkedList<int> a = {1, 3, 5, 7};
+    LinkedList<int> b = {0, 3, 4, 8, 9};
+    const int* three_of_b = &*std::next(b.begin());
+    a.merge(b);
+    assert(b.empty() && a.size() == 9);
+    std::vector<int> merged(a.begin(), a.end());
+    assert((merged == std::vector<int>{0, 1, 3, 3, 4, 5, 7, 8, 9}));
+    // Stable: the 3 from b comes after the 3 already in a
+    assert(&*std::next(a.begin(), 3) == three_of_b);
+    assert(a.back() == 9);
+
+    LinkedList<int> empty;
+    a.merge(empty);
+    empty.merge(a);
+    assert(a.empty() && empty.size() == 9);
+    END_TEST
+}
+
 // Main test runner
 int main() {
     std::cout << "========================================" << std::endl;
@@ -491,6 +726,17 @@ int main() {
     test_alternating_ends();
     test_clear_and_reuse();
 
+    test_pool_allocator();
+    test_pool_bulk_release();
+
+    test_iterators();
+    test_iterator_insert_erase();
+    test_splice();
+    test_splice_different_allocators();
+    test_sort();
+    test_sort_throwing_comparator();
+    test_merge();
+
     // Print summary
     std::cout << std::endl;
     std::cout << "========================================" << std::endl;
@@ -0,0 +1,402 @@
+/**
+ * @file test_lockfree_queue.cpp
+ * @brief Test suite for SpscQueue and MpmcQueue classes
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ */
+
+#include "linear/lockfree_queue.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <stdexcept>
+
+using namespace mylib::linear;
+
+// Test result counter
+int tests_passed = 0;
+int tests_failed = 0;
+
+// Helper macro for testing
+#define TEST(name) \
+    std::cout << "Testing: " << name << "... "; \
+    try {
+
+#define END_TEST \
+        std::cout << "✓ PASSED" << std::endl; \
+        tests_passed++; \
+    } catch (const std::exception& e) { \
+        std::cout << "✗ FAILED: " << e.what() << std::endl; \
+        tests_failed++; \
+    }
+
+const int ITEMS_PER_PRODUCER = 100000;
+
+/**
+ * @brief Encode (producer, sequence) into one value
+ */
+long long encode(int producer, int seq) {
+    return static_cast<long long>(producer) * ITEMS_PER_PRODUCER + seq;
+}
+
+// ============================================
+// SpscQueue Tests
+// ============================================
+
+void test_spsc_capacity() {
+    TEST("SpscQueue capacity rounding and zero capacity")
+    SpscQueue<int> queue(5);
+    assert(queue.capacity() == 8);
+    assert(queue.empty());
+    assert(queue.size_approx() == 0);
+
+    bool thrown = false;
+    try {
+        SpscQueue<int> bad(0);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    END_TEST
+}
+
+void test_spsc_push_pop_fifo() {
+    TEST("SpscQueue FIFO order, full and empty")
+    SpscQueue<int> queue(4);
+    for (int i = 0; i < 4; ++i) {
+        assert(queue.try_push(i));
+    }
+    assert(!queue.try_push(99));
+    assert(queue.size_approx() == 4);
+
+    int value = -1;
+    for (int i = 0; i < 4; ++i) {
+        assert(queue.try_pop(value));
+        assert(value == i);
+    }
+    assert(!queue.try_pop(value));
+    assert(value == 3);
+
+    // Wrap around many times
+    for (int i = 0; i < 1000; ++i) {
+        assert(queue.try_push(i));
+        assert(queue.try_pop(value) && value == i);
+    }
+    END_TEST
+}
+
+void test_spsc_batch() {
+    TEST("SpscQueue batch push and pop")
+    SpscQueue<int> queue(8);
+    int items[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    assert(queue.try_push_batch(items, 3) == 3);
+    assert(queue.try_push_batch(items + 3, 7) == 5);  // only 5 slots left
+    assert(queue.try_push_batch(items, 1) == 0);
+
+    int out[10] = {};
+    assert(queue.try_pop_batch(out, 6) == 6);
+    assert(queue.try_pop_batch(out + 6, 10) == 2);
+    for (int i = 0; i < 8; ++i) {
+        assert(out[i] == i);
+    }
+    assert(queue.try_pop_batch(out, 4) == 0);
+
+    // Zero-count batches are no-ops
+    assert(queue.try_push_batch(items, 0) == 0 && queue.try_pop_batch(out, 0) == 0);
+    assert(queue.try_push_batch(items, 1) == 1 && queue.try_pop_batch(out, 0) == 0);
+    assert(queue.try_pop_batch(out, 4) == 1);
+    END_TEST
+}
+
+void test_spsc_move_only_and_destruction() {
+    TEST("SpscQueue with move-only and non-trivial types")
+    SpscQueue<std::unique_ptr<int>> queue(4);
+    assert(queue.try_push(std::make_unique<int>(7)));
+    assert(queue.try_emplace(new int(8)));
+    std::unique_ptr<int> out;
+    assert(queue.try_pop(out) && *out == 7);
+
+    // Remaining elements are destroyed with the queue (checked under ASan)
+    SpscQueue<std::string> strings(2);
+    assert(strings.try_push(std::string(100, 'x')));
+    assert(strings.try_emplace(3, 'y'));
+    std::string rejected(50, 'z');
+    assert(!strings.try_push(std::move(rejected)));
+    assert(rejected.size() == 50);
+    END_TEST
+}
+
+void test_spsc_threaded_stress() {
+    TEST("SpscQueue producer/consumer stress")
+    SpscQueue<long long> queue(64);
+    const int count = 1000000;
+
+    std::thread producer([&]() {
+        long long batch[16];
+        int next = 0;
+        while (next < count) {
+            if (next % 3 == 0) {
+                int n = 0;
+                for (; n < 16 && next + n < count; ++n) {
+                    batch[n] = next + n;
+                }
+                next += static_cast<int>(queue.try_push_batch(batch, n));
+            } else if (queue.try_push(next)) {
+                ++next;
+            }
+            if (next < count && queue.size_approx() == queue.capacity()) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    long long expected = 0;
+    bool ordered = true;
+    long long buffer[32];
+    while (expected < count) {
+        std::size_t n = queue.try_pop_batch(buffer, 32);
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            ordered = ordered && buffer[i] == expected;
+            ++expected;
+        }
+    }
+    producer.join();
+    assert(ordered);
+    assert(queue.empty());
+    END_TEST
+}
+
+// ============================================
+// MpmcQueue Tests
+// ============================================
+
+void test_mpmc_push_pop_fifo() {
+    TEST("MpmcQueue FIFO order, full and empty")
+    MpmcQueue<int> queue(3);
+    assert(queue.capacity() == 4);
+    for (int i = 0; i < 4; ++i) {
+        assert(queue.try_push(i));
+    }
+    assert(!queue.try_push(99));
+
+    int value = -1;
+    for (int i = 0; i < 4; ++i) {
+        assert(queue.try_pop(value) && value == i);
+    }
+    assert(!queue.try_pop(value));
+    assert(queue.empty());
+
+    for (int i = 0; i < 1000; ++i) {
+        assert(queue.try_push(i));
+        assert(queue.try_pop(value) && value == i);
+    }
+
+    bool thrown = false;
+    try {
+        MpmcQueue<int> bad(0);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    END_TEST
+}
+
+void test_mpmc_batch() {
+    TEST("MpmcQueue batch push and pop")
+    MpmcQueue<std::string> queue(8);
+    std::vector<std::string> items;
+    for (int i = 0; i < 10; ++i) {
+        items.push_back("item" + std::to_string(i));
+    }
+    assert(queue.try_push_batch(items.data(), 6) == 6);
+    assert(queue.try_push_batch(items.data() + 6, 4) == 2);
+    assert(queue.try_push_batch(items.data(), 1) == 0);
+    assert(queue.size_approx() == 8);
+
+    std::vector<std::string> out(8);
+    assert(queue.try_pop_batch(out.data(), 3) == 3);
+    assert(queue.try_pop_batch(out.data() + 3, 8) == 5);
+    for (int i = 0; i < 8; ++i) {
+        assert(out[i] == items[i]);
+    }
+    assert(queue.try_pop_batch(out.data(), 8) == 0);
+
+    // Zero-count batches are no-ops, whether the queue is empty or not
+    assert(queue.try_push_batch(items.data(), 0) == 0);
+    assert(queue.try_pop_batch(out.data(), 0) == 0);
+
+    // Leave elements behind for the destructor
+    assert(queue.try_push_batch(items.data(), 5) == 5);
+    assert(queue.try_push_batch(items.data(), 0) == 0);
+    assert(queue.try_pop_batch(out.data(), 0) == 0);
+    assert(queue.size_approx() == 5);
+    END_TEST
+}
+
+/**
+ * @brief Element whose copy throws once copies_left reaches zero
+ */
+struct FlakyCopy {
+    static int copies_left;
+    int id = 0;
+    FlakyCopy() = default;
+    explicit FlakyCopy(int i) : id(i) {}
+    FlakyCopy(const FlakyCopy& other) : id(other.id) {
+        if (copies_left-- == 0) {
+            throw std::runtime_error("copy failed");
+        }
+    }
+    FlakyCopy(FlakyCopy&& other) noexcept : id(other.id) {}
+    FlakyCopy& operator=(const FlakyCopy&) = default;
+    FlakyCopy& operator=(FlakyCopy&&) noexcept = default;
+};
+int FlakyCopy::copies_left = 0;
+
+void test_mpmc_throwing_copy() {
+    TEST("MpmcQueue: a throwing copy leaves no claimed cell behind")
+    MpmcQueue<FlakyCopy> queue(8);
+    FlakyCopy items[4] = {FlakyCopy(0), FlakyCopy(1), FlakyCopy(2), FlakyCopy(3)};
+
+    FlakyCopy::copies_left = 0;
+    bool thrown = false;
+    try { queue.try_push(items[0]); } catch (const std::runtime_error&) { thrown = true; }
+    assert(thrown && queue.empty());
+
+    // The third copy throws: the first two are pushed
+    FlakyCopy::copies_left = 2;
+    thrown = false;
+    try { queue.try_push_batch(items, 4); } catch (const std::runtime_error&) { thrown = true; }
+    assert(thrown && queue.size_approx() == 2);
+
+    // Consumers are not blocked by a half-built cell
+    FlakyCopy::copies_left = 100;
+    assert(queue.try_push(items[3]));
+    FlakyCopy out;
+    for (int expected : {0, 1, 3}) {
+        assert(queue.try_pop(out) && out.id == expected);
+    }
+    assert(!queue.try_pop(out));
+    assert(queue.try_push_batch(items, 4) == 4);   // Left for the destructor
+    END_TEST
+}
+
+void test_mpmc_threaded_stress() {
+    TEST("MpmcQueue multi-producer/multi-consumer stress")
+    const int producers = 4;
+    const int consumers = 4;
+    MpmcQueue<long long> queue(128);
+    std::atomic<int> consumed{0};
+    const int total = producers * ITEMS_PER_PRODUCER;
+
+    // Per consumer: how many items of each producer it saw, and the last
+    // sequence seen per producer (must increase: a producer's items are FIFO)
+    std::vector<std::vector<long long>> sums(consumers, std::vector<long long>(producers, 0));
+    std::vector<int> order_violations(consumers, 0);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&queue, p]() {
+            long long batch[8];
+            int seq = 0;
+            while (seq < ITEMS_PER_PRODUCER) {
+                if (seq % 2 == 0) {
+                    int n = 0;
+                    for (; n < 8 && seq + n < ITEMS_PER_PRODUCER; ++n) {
+                        batch[n] = encode(p, seq + n);
+                    }
+                    std::size_t pushed = queue.try_push_batch(batch, n);
+                    seq += static_cast<int>(pushed);
+                    if (pushed == 0) {
+                        std::this_thread::yield();
+                    }
+                } else if (queue.try_push(encode(p, seq))) {
+                    ++seq;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&, c]() {
+            std::vector<long long> last(producers, -1);
+            long long buffer[8];
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                std::size_t n = (c % 2 == 0) ? queue.try_pop_batch(buffer, 8)
+                                             : (queue.try_pop(buffer[0]) ? 1 : 0);
+                if (n == 0) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                for (std::size_t i = 0; i < n; ++i) {
+                    int producer = static_cast<int>(buffer[i] / ITEMS_PER_PRODUCER);
+                    long long seq = buffer[i] % ITEMS_PER_PRODUCER;
+                    if (seq <= last[producer]) {
+                        ++order_violations[c];
+                    }
+                    last[producer] = seq;
+                    sums[c][producer] += seq;
+                }
+                consumed.fetch_add(static_cast<int>(n), std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    assert(consumed.load() == total);
+    const long long expected_sum =
+        static_cast<long long>(ITEMS_PER_PRODUCER) * (ITEMS_PER_PRODUCER - 1) / 2;
+    for (int p = 0; p < producers; ++p) {
+        long long sum = 0;
+        for (int c = 0; c < consumers; ++c) {
+            sum += sums[c][p];
+        }
+        assert(sum == expected_sum);
+    }
+    for (int c = 0; c < consumers; ++c) {
+        assert(order_violations[c] == 0);
+    }
+    assert(queue.empty());
+    END_TEST
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "Lock-free Queue Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::cout << std::endl << "--- SpscQueue Tests ---" << std::endl;
+    test_spsc_capacity();
+    test_spsc_push_pop_fifo();
+    test_spsc_batch();
+    test_spsc_move_only_and_destruction();
+    test_spsc_threaded_stress();
+
+    std::cout << std::endl << "--- MpmcQueue Tests ---" << std::endl;
+    test_mpmc_push_pop_fifo();
+    test_mpmc_batch();
+    test_mpmc_throwing_copy();
+    test_mpmc_threaded_stress();
+
+    // Print summary
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Test Results" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "✓ Passed: " << tests_passed << std::endl;
+    std::cout << "✗ Failed: " << tests_failed << std::endl;
+    std::cout << "Total: " << (tests_passed + tests_failed) << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -10,6 +10,8 @@
 #include <iostream>
 #include <cassert>
 #include <string>
+#include <queue>
+#include <stdexcept>
 
 using namespace mylib::linear;
 
@@ -420,6 +422,175 @@ void test_alternating_operations() {
     END_TEST
 }
 
+void test_wraparound_growth() {
+    TEST("Growth while wrapped keeps FIFO order")
+    Queue<int> queue;
+    std::queue<int> model;
+    int next = 0;
+    for (int round = 0; round < 200; ++round) {
+        // Push more than we pop so the buffer grows while its head is mid-buffer
+        for (int i = 0; i < 7; ++i) {
+            queue.push(next);
+            model.push(next);
+            ++next;
+        }
+        for (int i = 0; i < 5; ++i) {
+            assert(queue.front() == model.front());
+            queue.pop();
+            model.pop();
+        }
+        assert(queue.back() == model.back());
+    }
+    assert(queue.size() == model.size());
+    while (!model.empty()) {
+        assert(queue.front() == model.front());
+        queue.pop();
+        model.pop();
+    }
+    assert(queue.empty());
+    END_TEST
+}
+
+void test_steady_state_no_growth() {
+    TEST("Steady push/pop does not grow the buffer")
+    Queue<int> queue;
+    for (int i = 0; i < 100; ++i) {
+        queue.push(i);
+    }
+    std::size_t capacity = queue.capacity();
+    for (int i = 0; i < 100000; ++i) {
+        queue.push(i);
+        queue.pop();
+    }
+    assert(queue.capacity() == capacity);
+    assert(queue.front() == 99900);
+    END_TEST
+}
+
+void test_bounded_mode() {
+    TEST("Bounded queue reports full and never grows")
+    auto queue = Queue<int>::bounded(3);
+    assert(queue.is_bounded());
+    assert(queue.capacity() == 3);
+    assert(queue.empty() && !queue.full());
+    assert(queue.try_push(1));
+    assert(queue.try_push(2));
+    queue.push(3);
+    assert(queue.full());
+    assert(!queue.try_push(4));
+
+    bool exception_thrown = false;
+    try {
+        queue.push(4);
+    } catch (const std::length_error&) {
+        exception_thrown = true;
+    }
+    assert(exception_thrown);
+    assert(queue.size() == 3 && queue.back() == 3);
+
+    // Wrap around the fixed buffer
+    for (int i = 4; i < 100; ++i) {
+        queue.pop();
+        assert(queue.try_push(i));
+        assert(queue.full());
+    }
+    assert(queue.front() == 97 && queue.back() == 99);
+    assert(queue.capacity() == 3);
+
+    exception_thrown = false;
+    try {
+        queue.reserve(10);
+    } catch (const std::length_error&) {
+        exception_thrown = true;
+    }
+    assert(exception_thrown);
+
+    exception_thrown = false;
+    try {
+        Queue<int>::bounded(0);
+    } catch (const std::invalid_argument&) {
+        exception_thrown = true;
+    }
+    assert(exception_thrown);
+    END_TEST
+}
+
+void test_bounded_copy() {
+    TEST("Copying a bounded queue keeps its capacity")
+    auto queue = Queue<int>::bounded(4);
+    queue.push(1);
+    queue.push(2);
+    Queue<int> copy(queue);
+    assert(copy.is_bounded() && copy.capacity() == 4);
+    assert(copy.front() == 1 && copy.back() == 2);
+    copy.push(3);
+    copy.push(4);
+    assert(copy.full() && !queue.full());
+
+    Queue<int> unbounded;
+    unbounded = copy;
+    assert(unbounded.is_bounded() && unbounded.full());
+    END_TEST
+}
+
+void test_try_pop_and_reserve() {
+    TEST("try_pop() and reserve()")
+    Queue<int> queue;
+    int out = -1;
+    assert(!queue.try_pop(out));
+    assert(out == -1);
+
+    queue.reserve(1000);
+    std::size_t capacity = queue.capacity();
+    assert(capacity >= 1000);
+    for (int i = 0; i < 1000; ++i) {
+        queue.push(i);
+    }
+    assert(queue.capacity() == capacity);
+    assert(queue.try_pop(out) && out == 0);
+    assert(queue.try_pop(out) && out == 1);
+    assert(queue.size() == 998);
+    END_TEST
+}
+
+void test_string_elements() {
+    TEST("Queue<std::string> moves elements across growth")
+    Queue<std::string> queue;
+    for (int i = 0; i < 1000; ++i) {
+        queue.push(std::string(30, 'x') + std::to_string(i));
+        if (i % 3 == 0) {
+            queue.pop();
+        }
+    }
+    Queue<std::string> copy(queue);
+    std::string out;
+    assert(queue.try_pop(out));
+    assert(out == copy.front());
+    assert(copy.back() == std::string(30, 'x') + "999");
+    queue.clear();
+    assert(queue.empty() && copy.size() == 666);
+    END_TEST
+}
+
+void test_push_own_element_when_full() {
+    TEST("Pushing an element of a full queue survives the growth")
+    Queue<std::string> queue;
+    for (int i = 0; i < 16; ++i) {
+        queue.push(std::string(40, static_cast<char>('a' + i)));
+    }
+    assert(queue.size() == queue.capacity());
+    queue.push(queue.front());
+    assert(queue.back() == std::string(40, 'a'));
+    assert(queue.size() == 17 && queue.front() == queue.back());
+
+    while (queue.size() < queue.capacity()) {
+        queue.push(std::string(40, 'z'));
+    }
+    queue.push(std::move(queue.back()));   // Moved from after it was read
+    assert(queue.back() == std::string(40, 'z'));
+    END_TEST
+}
+
 // Main test runner
 int main() {
     std::cout << "========================================" << std::endl;
@@ -455,6 +626,14 @@ int main() {
     test_continuous_operations();
     test_alternating_operations();
 
+    test_wraparound_growth();
+    test_steady_state_no_growth();
+    test_bounded_mode();
+    test_bounded_copy();
+    test_try_pop_and_reserve();
+    test_string_elements();
+    test_push_own_element_when_full();
+
     // Print summary
     std::cout << std::endl;
     std::cout << "========================================" << std::endl;
@@ -0,0 +1,301 @@
+/**
+ * @file test_small_dynamic_array.cpp
+ * @brief Test suite for SmallDynamicArray class
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ */
+
+#include "linear/dynamic_array/small_dynamic_array.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <memory>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace mylib::linear;
+
+// Test result counter
+int tests_passed = 0;
+int tests_failed = 0;
+
+// Helper macro for testing
+#define TEST(name) \
+    std::cout << "Testing: " << name << "... "; \
+    try {
+
+#define END_TEST \
+        std::cout << "✓ PASSED" << std::endl; \
+        tests_passed++; \
+    } catch (const std::exception& e) { \
+        std::cout << "✗ FAILED: " << e.what() << std::endl; \
+        tests_failed++; \
+    }
+
+/**
+ * @struct Tracked
+ * @brief Counts live instances to catch leaks and double destruction
+ */
+struct Tracked {
+    static int live;
+    int value;
+
+    Tracked(int v = 0) : value(v) { ++live; }
+    Tracked(const Tracked& other) : value(other.value) { ++live; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++live; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) = default;
+    ~Tracked() { --live; }
+};
+
+int Tracked::live = 0;
+
+// ============================================
+// Inline Storage Tests
+// ============================================
+
+void test_default_is_inline() {
+    TEST("Default array uses the inline buffer")
+    SmallDynamicArray<int, 8> arr;
+    assert(arr.empty());
+    assert(arr.size() == 0);
+    assert(arr.capacity() == 8);
+    assert(arr.is_inline());
+    assert(arr.begin() == arr.end());
+    END_TEST
+}
+
+void test_push_within_inline_capacity() {
+    TEST("Pushes up to N stay inline")
+    SmallDynamicArray<int, 4> arr;
+    const int* inline_ptr = arr.data();
+    for (int i = 0; i < 4; ++i) {
+        arr.push_back(i * 10);
+    }
+    assert(arr.is_inline());
+    assert(arr.data() == inline_ptr);
+    assert(arr.size() == 4);
+    assert(arr[3] == 30);
+    assert(arr.front() == 0 && arr.back() == 30);
+    END_TEST
+}
+
+void test_spill_to_heap() {
+    TEST("N+1-th element spills to the heap")
+    SmallDynamicArray<std::string, 2> arr;
+    arr.push_back("alpha");
+    arr.push_back("beta");
+    arr.emplace_back(5, 'g');
+    assert(!arr.is_inline());
+    assert(arr.capacity() >= 3);
+    assert(arr.size() == 3);
+    assert(arr[0] == "alpha" && arr[1] == "beta" && arr[2] == "ggggg");
+    for (int i = 0; i < 100; ++i) {
+        arr.push_back(std::to_string(i));
+    }
+    assert(arr.size() == 103);
+    assert(arr[102] == "99");
+    END_TEST
+}
+
+void test_push_back_own_element_on_spill() {
+    TEST("push_back of an own element while spilling")
+    SmallDynamicArray<std::string, 2> arr = {"first", "second"};
+    arr.push_back(arr[0]);
+    assert(arr.size() == 3);
+    assert(arr[2] == "first");
+    arr.resize(50, arr[1]);
+    assert(arr[49] == "second");
+    END_TEST
+}
+
+void test_shrink_to_fit_returns_inline() {
+    TEST("shrink_to_fit moves small contents back inline")
+    SmallDynamicArray<int, 4> arr;
+    for (int i = 0; i < 20; ++i) {
+        arr.push_back(i);
+    }
+    assert(!arr.is_inline());
+    while (arr.size() > 3) {
+        arr.pop_back();
+    }
+    arr.shrink_to_fit();
+    assert(arr.is_inline());
+    assert(arr.capacity() == 4);
+    assert(arr[0] == 0 && arr[2] == 2);
+
+    for (int i = 0; i < 20; ++i) {
+        arr.push_back(i);
+    }
+    arr.pop_back();
+    arr.shrink_to_fit();
+    assert(!arr.is_inline());
+    assert(arr.capacity() == arr.size());
+    END_TEST
+}
+
+// ============================================
+// Copy / Move Tests
+// ============================================
+
+void test_copy() {
+    TEST("Copy construction and assignment")
+    SmallDynamicArray<std::string, 3> small = {"a", "b"};
+    SmallDynamicArray<std::string, 3> big = {"1", "2", "3", "4", "5"};
+
+    SmallDynamicArray<std::string, 3> small_copy(small);
+    SmallDynamicArray<std::string, 3> big_copy(big);
+    assert(small_copy == small && small_copy.is_inline());
+    assert(big_copy == big && !big_copy.is_inline());
+    assert(big_copy.data() != big.data());
+
+    small_copy = big;
+    assert(small_copy == big);
+    big_copy = small;
+    assert(big_copy == small && big_copy.is_inline());
+    big_copy = big_copy;
+    assert(big_copy == small);
+    END_TEST
+}
+
+void test_move() {
+    TEST("Move steals a heap buffer and moves inline elements")
+    SmallDynamicArray<std::unique_ptr<int>, 2> inline_arr;
+    inline_arr.push_back(std::make_unique<int>(1));
+    SmallDynamicArray<std::unique_ptr<int>, 2> moved_inline(std::move(inline_arr));
+    assert(inline_arr.empty() && inline_arr.is_inline());
+    assert(moved_inline.size() == 1 && *moved_inline[0] == 1);
+
+    SmallDynamicArray<std::unique_ptr<int>, 2> heap_arr;
+    for (int i = 0; i < 5; ++i) {
+        heap_arr.push_back(std::make_unique<int>(i));
+    }
+    const std::unique_ptr<int>* buffer = heap_arr.data();
+    SmallDynamicArray<std::unique_ptr<int>, 2> moved_heap(std::move(heap_arr));
+    assert(moved_heap.data() == buffer);
+    assert(heap_arr.empty() && heap_arr.is_inline());
+
+    moved_inline = std::move(moved_heap);
+    assert(moved_inline.size() == 5 && *moved_inline[4] == 4);
+    END_TEST
+}
+
+void test_swap_mixed() {
+    TEST("Swap between inline and heap arrays")
+    SmallDynamicArray<int, 4> a = {1, 2};
+    SmallDynamicArray<int, 4> b = {9, 8, 7, 6, 5, 4};
+    swap(a, b);
+    assert(a.size() == 6 && a[0] == 9 && !a.is_inline());
+    assert(b.size() == 2 && b[1] == 2 && b.is_inline());
+
+    SmallDynamicArray<int, 4> c = {3, 3, 3, 3, 3, 3, 3};
+    const int* a_buffer = a.data();
+    a.swap(c);
+    assert(c.data() == a_buffer);
+    assert(a.size() == 7);
+    END_TEST
+}
+
+// ============================================
+// Lifetime / Contract Tests
+// ============================================
+
+void test_element_lifetimes() {
+    TEST("Every constructed element is destroyed exactly once")
+    Tracked::live = 0;
+    {
+        SmallDynamicArray<Tracked, 4> arr;
+        for (int i = 0; i < 3; ++i) {
+            arr.emplace_back(i);
+        }
+        assert(Tracked::live == 3);
+        arr.pop_back();
+        assert(Tracked::live == 2);
+        for (int i = 0; i < 10; ++i) {
+            arr.emplace_back(i);
+        }
+        assert(Tracked::live == 12);
+        arr.resize(5);
+        assert(Tracked::live == 5);
+        SmallDynamicArray<Tracked, 4> copy = arr;
+        assert(Tracked::live == 10);
+        copy.clear();
+        assert(Tracked::live == 5);
+        arr.shrink_to_fit();
+        assert(Tracked::live == 5);
+    }
+    assert(Tracked::live == 0);
+    END_TEST
+}
+
+void test_iterator_and_data_contract() {
+    TEST("Iterators, data() and STL algorithms")
+    SmallDynamicArray<int, 16> arr(10, 0);
+    std::iota(arr.begin(), arr.end(), 1);
+    assert(arr.data() == &arr[0]);
+    assert(arr.end() - arr.begin() == 10);
+    assert(std::accumulate(arr.cbegin(), arr.cend(), 0) == 55);
+    std::reverse(arr.begin(), arr.end());
+    assert(arr.front() == 10);
+    assert(*arr.rbegin() == 1);
+    std::sort(arr.begin(), arr.end());
+    assert(std::is_sorted(arr.data(), arr.data() + arr.size()));
+
+    bool thrown = false;
+    try {
+        arr.at(10);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    END_TEST
+}
+
+void test_comparison() {
+    TEST("Comparison operators")
+    SmallDynamicArray<int, 2> a = {1, 2, 3};
+    SmallDynamicArray<int, 2> b = {1, 2, 3};
+    SmallDynamicArray<int, 2> c = {1, 2};
+    assert(a == b);
+    assert(a != c);
+    assert(c < a && a > c);
+    assert(a <= b && a >= b);
+    END_TEST
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "SmallDynamicArray Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::cout << std::endl << "--- Inline Storage Tests ---" << std::endl;
+    test_default_is_inline();
+    test_push_within_inline_capacity();
+    test_spill_to_heap();
+    test_push_back_own_element_on_spill();
+    test_shrink_to_fit_returns_inline();
+
+    std::cout << std::endl << "--- Copy / Move Tests ---" << std::endl;
+    test_copy();
+    test_move();
+    test_swap_mixed();
+
+    std::cout << std::endl << "--- Lifetime / Contract Tests ---" << std::endl;
+    test_element_lifetimes();
+    test_iterator_and_data_contract();
+    test_comparison();
+
+    // Print summary
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Test Results" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "✓ Passed: " << tests_passed << std::endl;
+    std::cout << "✗ Failed: " << tests_failed << std::endl;
+    std::cout << "Total: " << (tests_passed + tests_failed) << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return tests_failed > 0 ? 1 : 0;
+}
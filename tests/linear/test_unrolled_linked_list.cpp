@@ -0,0 +1,368 @@
+/**
+ * @file test_unrolled_linked_list.cpp
+ * @brief Test suite for UnrolledLinkedList class
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ */
+
+#include "linear/unrolled_linked_list.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <list>
+#include <random>
+#include <numeric>
+#include <stdexcept>
+
+using namespace mylib::linear;
+
+// Test result counter
+int tests_passed = 0;
+int tests_failed = 0;
+
+// Helper macro for testing
+#define TEST(name) \
+    std::cout << "Testing: " << name << "... "; \
+    try {
+
+#define END_TEST \
+        std::cout << "✓ PASSED" << std::endl; \
+        tests_passed++; \
+    } catch (const std::exception& e) { \
+        std::cout << "✗ FAILED: " << e.what() << std::endl; \
+        tests_failed++; \
+    }
+
+/**
+ * @struct Tracked
+ * @brief Counts live instances to catch leaks and double destruction
+ */
+struct Tracked {
+    static int live;
+    int value;
+
+    Tracked(int v = 0) : value(v) { ++live; }
+    Tracked(const Tracked& other) : value(other.value) { ++live; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++live; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) = default;
+    ~Tracked() { --live; }
+
+    bool operator==(const Tracked& other) const { return value == other.value; }
+};
+
+int Tracked::live = 0;
+
+/**
+ * @brief Check that list holds exactly the elements of expected, in order
+ */
+template <typename List, typename Expected>
+bool same_elements(const List& list, const Expected& expected) {
+    if (list.size() != expected.size()) {
+        return false;
+    }
+    auto it = expected.begin();
+    for (const auto& value : list) {
+        if (!(value == *it++)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================
+// Basic Operation Tests
+// ============================================
+
+void test_push_and_access() {
+    TEST("push_back/push_front and indexed access")
+    UnrolledLinkedList<int, 4> list;
+    assert(list.empty());
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    list.push_front(-1);
+    list.push_front(-2);
+    assert(list.size() == 12);
+    assert(list.front() == -2);
+    assert(list.back() == 9);
+    for (int i = 0; i < 12; ++i) {
+        assert(list[i] == i - 2);
+        assert(list.at(i) == i - 2);
+    }
+    // 10 push_backs fill 3 nodes; the full head gets a new node in front
+    assert(list.node_count() == 4);
+    END_TEST
+}
+
+void test_pop_frees_nodes() {
+    TEST("pop_front/pop_back free empty nodes")
+    UnrolledLinkedList<int, 4> list = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    assert(list.node_count() == 3);
+    list.pop_back();
+    assert(list.node_count() == 2);
+    list.pop_front();
+    list.pop_front();
+    list.pop_front();
+    list.pop_front();
+    assert(list.node_count() == 1);
+    assert(list.front() == 5 && list.back() == 8);
+    while (!list.empty()) {
+        list.pop_back();
+    }
+    assert(list.node_count() == 0);
+    END_TEST
+}
+
+void test_exceptions() {
+    TEST("Out-of-range and empty-list errors")
+    UnrolledLinkedList<int, 8> list = {1, 2, 3};
+    bool thrown = false;
+    try { list.at(3); } catch (const std::out_of_range&) { thrown = true; }
+    assert(thrown);
+    thrown = false;
+    try { list.insert(4, 0); } catch (const std::out_of_range&) { thrown = true; }
+    assert(thrown);
+    thrown = false;
+    try { list.erase(3); } catch (const std::out_of_range&) { thrown = true; }
+    assert(thrown);
+    list.clear();
+    thrown = false;
+    try { list.front(); } catch (const std::out_of_range&) { thrown = true; }
+    assert(thrown);
+    thrown = false;
+    try { list.pop_back(); } catch (const std::out_of_range&) { thrown = true; }
+    assert(thrown);
+    END_TEST
+}
+
+// ============================================
+// Insert / Erase Tests
+// ============================================
+
+void test_insert_splits_full_node() {
+    TEST("insert into a full node splits it")
+    UnrolledLinkedList<int, 4> list = {0, 1, 2, 3};
+    assert(list.node_count() == 1);
+    list.insert(1, 10);
+    assert(list.node_count() == 2);
+    assert(same_elements(list, std::vector<int>{0, 10, 1, 2, 3}));
+    list.insert(4, 20);
+    assert(same_elements(list, std::vector<int>{0, 10, 1, 2, 20, 3}));
+    END_TEST
+}
+
+void test_erase_merges_nodes() {
+    TEST("erase merges underfull neighbours")
+    UnrolledLinkedList<int, 8> list;
+    for (int i = 0; i < 16; ++i) {
+        list.push_back(i);
+    }
+    assert(list.node_count() == 2);
+    // Drain the first node below half; it cannot merge until both fit
+    for (int i = 0; i < 5; ++i) {
+        list.erase(0);
+    }
+    assert(list.node_count() == 2);
+    list.erase(list.size() - 1);
+    // 3 + 7 > 8: still two nodes
+    assert(list.node_count() == 2);
+    list.erase(list.size() - 1);
+    list.erase(0);
+    // 2 + 6 <= 8: merged
+    assert(list.node_count() == 1);
+    assert(same_elements(list, std::vector<int>{6, 7, 8, 9, 10, 11, 12, 13}));
+    END_TEST
+}
+
+void test_random_against_std_list() {
+    TEST("Random insert/erase matches std::list")
+    UnrolledLinkedList<int, 8> list;
+    std::list<int> reference;
+    std::mt19937 rng(7);
+    for (int step = 0; step < 20000; ++step) {
+        std::size_t size = reference.size();
+        int op = static_cast<int>(rng() % 10);
+        if (op < 6 || size == 0) {
+            std::size_t index = size ? rng() % (size + 1) : 0;
+            list.insert(index, step);
+            reference.insert(std::next(reference.begin(), static_cast<long>(index)), step);
+        } else {
+            std::size_t index = rng() % size;
+            list.erase(index);
+            reference.erase(std::next(reference.begin(), static_cast<long>(index)));
+        }
+        if (step % 997 == 0) {
+            assert(same_elements(list, reference));
+        }
+    }
+    assert(same_elements(list, reference));
+    std::size_t index = 0;
+    for (int value : reference) {
+        assert(list[index++] == value);
+    }
+    // No empty nodes survive, and merging keeps most nodes well filled
+    assert(list.node_count() <= list.size());
+    assert(list.node_count() * 8 <= 4 * list.size() + 8);
+    END_TEST
+}
+
+void test_insert_own_element() {
+    TEST("insert/push_front of an element of the list")
+    UnrolledLinkedList<std::string, 4> list = {"a", "b", "c", "d"};
+    list.insert(0, list[3]);
+    list.push_front(list.back());
+    list.insert(2, list[2]);
+    assert(same_elements(list, std::vector<std::string>{"d", "d", "a", "a", "b", "c", "d"}));
+    END_TEST
+}
+
+// ============================================
+// Splice Tests
+// ============================================
+
+void test_splice_at_boundaries() {
+    TEST("splice at the ends and at a node boundary relinks nodes")
+    UnrolledLinkedList<int, 4> list = {0, 1, 2, 3, 4, 5, 6, 7};
+    UnrolledLinkedList<int, 4> tail = {8, 9};
+    const int* first_of_tail = &tail.front();
+    list.splice(list.size(), tail);
+    assert(tail.empty() && tail.node_count() == 0);
+    assert(&list[8] == first_of_tail);
+
+    UnrolledLinkedList<int, 4> head = {-2, -1};
+    list.splice(0, head);
+    UnrolledLinkedList<int, 4> middle = {100, 101};
+    const int* first_of_middle = &middle.front();
+    // Index 6 is the first element of the third node
+    list.splice(6, middle);
+    assert(&list[6] == first_of_middle);
+    assert(list.node_count() == 5);
+    assert(same_elements(list, std::vector<int>{-2, -1, 0, 1, 2, 3, 100, 101, 4, 5, 6, 7, 8, 9}));
+    END_TEST
+}
+
+void test_splice_inside_node() {
+    TEST("splice inside a node splits it")
+    UnrolledLinkedList<int, 8> list = {0, 1, 2, 3, 4, 5};
+    UnrolledLinkedList<int, 8> other = {10, 11, 12};
+    list.splice(2, other);
+    assert(list.node_count() == 3);
+    assert(same_elements(list, std::vector<int>{0, 1, 10, 11, 12, 2, 3, 4, 5}));
+
+    bool thrown = false;
+    try { list.splice(0, list); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown);
+    END_TEST
+}
+
+// ============================================
+// Copy / Move / Lifetime Tests
+// ============================================
+
+void test_copy_move_swap() {
+    TEST("Copy, move and swap")
+    UnrolledLinkedList<int, 4> a;
+    for (int i = 0; i < 20; ++i) {
+        a.insert(a.size() / 2, i);
+    }
+    UnrolledLinkedList<int, 4> b = a;
+    assert(same_elements(b, std::vector<int>(a.begin(), a.end())));
+    assert(b.node_count() == 5);   // Copies are packed full
+
+    UnrolledLinkedList<int, 4> c = std::move(b);
+    assert(b.empty() && c.size() == 20);
+    b = c;
+    assert(b.size() == 20);
+    c = std::move(b);
+    assert(c.size() == 20 && b.empty());
+
+    UnrolledLinkedList<int, 4> d = {1};
+    swap(c, d);
+    assert(c.size() == 1 && d.size() == 20);
+    END_TEST
+}
+
+void test_element_lifetimes() {
+    TEST("Every element is destroyed exactly once")
+    {
+        UnrolledLinkedList<Tracked, 4> list;
+        for (int i = 0; i < 50; ++i) {
+            list.insert(list.size() / 3, Tracked(i));
+        }
+        assert(Tracked::live == 50);
+        for (int i = 0; i < 20; ++i) {
+            list.erase(list.size() / 2);
+        }
+        assert(Tracked::live == 30);
+        UnrolledLinkedList<Tracked, 4> other(list);
+        other.resize(10);
+        list.splice(5, other);
+        assert(Tracked::live == 40);
+        assert(list.remove(Tracked(list[7])) >= 1);
+        assert(Tracked::live == static_cast<int>(list.size()));
+    }
+    assert(Tracked::live == 0);
+    END_TEST
+}
+
+void test_find_remove_resize() {
+    TEST("find, contains, remove and resize")
+    UnrolledLinkedList<int, 4> list;
+    for (int i = 0; i < 30; ++i) {
+        list.push_back(i % 3);
+    }
+    assert(list.find(2) == 2);
+    assert(list.find(7) == list.size());
+    assert(!list.contains(7));
+    assert(list.remove(0) == 10);
+    assert(list.size() == 20 && !list.contains(0));
+    assert(list.remove(list[0]) == 10);
+    assert(list.size() == 10);
+    list.resize(12);
+    assert(list.back() == 0);
+    list.resize(3, 9);
+    assert(same_elements(list, std::vector<int>{2, 2, 2}));
+    assert(std::accumulate(list.cbegin(), list.cend(), 0) == 6);
+    END_TEST
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "UnrolledLinkedList Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::cout << std::endl << "--- Basic Operation Tests ---" << std::endl;
+    test_push_and_access();
+    test_pop_frees_nodes();
+    test_exceptions();
+
+    std::cout << std::endl << "--- Insert / Erase Tests ---" << std::endl;
+    test_insert_splits_full_node();
+    test_erase_merges_nodes();
+    test_random_against_std_list();
+    test_insert_own_element();
+
+    std::cout << std::endl << "--- Splice Tests ---" << std::endl;
+    test_splice_at_boundaries();
+    test_splice_inside_node();
+
+    std::cout << std::endl << "--- Copy / Move / Lifetime Tests ---" << std::endl;
+    test_copy_move_swap();
+    test_element_lifetimes();
+    test_find_remove_resize();
+
+    // Print summary
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Test Results" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "✓ Passed: " << tests_passed << std::endl;
+    std::cout << "✗ Failed: " << tests_failed << std::endl;
+    std::cout << "Total: " << (tests_passed + tests_failed) << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return tests_failed > 0 ? 1 : 0;
+}
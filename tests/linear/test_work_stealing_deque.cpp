@@ -0,0 +1,190 @@
+/**
+ * @file test_work_stealing_deque.cpp
+ * @brief Test suite for WorkStealingDeque class
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ */
+
+#include "linear/work_stealing_deque.hpp"
+#include <iostream>
+#include <cassert>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <stdexcept>
+
+using namespace mylib::linear;
+
+// Test result counter
+int tests_passed = 0;
+int tests_failed = 0;
+
+// Helper macro for testing
+#define TEST(name) \
+    std::cout << "Testing: " << name << "... "; \
+    try {
+
+#define END_TEST \
+        std::cout << "✓ PASSED" << std::endl; \
+        tests_passed++; \
+    } catch (const std::exception& e) { \
+        std::cout << "✗ FAILED: " << e.what() << std::endl; \
+        tests_failed++; \
+    }
+
+// ============================================
+// Single-thread Tests
+// ============================================
+
+void test_empty_deque() {
+    TEST("Empty deque")
+    WorkStealingDeque<int> deque;
+    assert(deque.empty());
+    assert(deque.size_approx() == 0);
+    assert(!deque.pop().has_value());
+    assert(!deque.steal().has_value());
+
+    bool thrown = false;
+    try {
+        WorkStealingDeque<int> bad(0);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    END_TEST
+}
+
+void test_owner_lifo_thief_fifo() {
+    TEST("Owner pops newest, thief steals oldest")
+    WorkStealingDeque<int> deque;
+    for (int i = 0; i < 5; ++i) {
+        deque.push(i);
+    }
+    assert(deque.size_approx() == 5);
+    assert(*deque.pop() == 4);
+    assert(*deque.steal() == 0);
+    assert(*deque.steal() == 1);
+    assert(*deque.pop() == 3);
+    assert(*deque.pop() == 2);
+    assert(!deque.pop().has_value());
+    assert(!deque.steal().has_value());
+
+    // Usable again after being emptied
+    deque.push(7);
+    assert(*deque.steal() == 7);
+    assert(deque.empty());
+    END_TEST
+}
+
+void test_growth() {
+    TEST("Ring grows and keeps order")
+    WorkStealingDeque<int> deque(4);
+    assert(deque.capacity() == 4);
+    // Offset top so the live range wraps before growing
+    deque.push(-1);
+    deque.push(-2);
+    assert(*deque.steal() == -1);
+    assert(*deque.steal() == -2);
+    for (int i = 0; i < 1000; ++i) {
+        deque.push(i);
+    }
+    assert(deque.capacity() >= 1000);
+    assert(deque.size_approx() == 1000);
+    for (int i = 0; i < 500; ++i) {
+        assert(*deque.steal() == i);
+    }
+    for (int i = 999; i >= 500; --i) {
+        assert(*deque.pop() == i);
+    }
+    assert(deque.empty());
+    END_TEST
+}
+
+// ============================================
+// Concurrency Tests
+// ============================================
+
+void test_concurrent_steal_exactly_once() {
+    TEST("Owner and thieves take every element exactly once")
+    const int total = 200000;
+    const int thieves = 3;
+    WorkStealingDeque<int> deque(8);
+    std::vector<std::atomic<int>> taken(total);
+    for (auto& t : taken) {
+        t.store(0);
+    }
+    std::atomic<int> taken_count{0};
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thieves; ++t) {
+        threads.emplace_back([&]() {
+            while (!done.load()) {
+                if (std::optional<int> item = deque.steal()) {
+                    taken[*item].fetch_add(1);
+                    taken_count.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Owner: push in bursts, pop some back (races for the last element)
+    int next = 0;
+    while (next < total) {
+        for (int k = 0; k < 16 && next < total; ++k) {
+            deque.push(next++);
+        }
+        for (int k = 0; k < 10; ++k) {
+            if (std::optional<int> item = deque.pop()) {
+                taken[*item].fetch_add(1);
+                taken_count.fetch_add(1);
+            }
+        }
+    }
+    while (std::optional<int> item = deque.pop()) {
+        taken[*item].fetch_add(1);
+        taken_count.fetch_add(1);
+    }
+    while (taken_count.load() < total) {
+        std::this_thread::yield();
+    }
+    done.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    assert(taken_count.load() == total);
+    for (int i = 0; i < total; ++i) {
+        assert(taken[i].load() == 1);
+    }
+    END_TEST
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "WorkStealingDeque Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::cout << std::endl << "--- Single-thread Tests ---" << std::endl;
+    test_empty_deque();
+    test_owner_lifo_thief_fifo();
+    test_growth();
+
+    std::cout << std::endl << "--- Concurrency Tests ---" << std::endl;
+    test_concurrent_steal_exactly_once();
+
+    // Print summary
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Test Results" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "✓ Passed: " << tests_passed << std::endl;
+    std::cout << "✗ Failed: " << tests_failed << std::endl;
+    std::cout << "Total: " << (tests_passed + tests_failed) << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,217 @@
+/**
+ * @file test_node_pool.cpp
+ * @brief Test suite for NodePool and PoolAllocator
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ */
+
+#include "memory/node_pool.hpp"
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <set>
+#include <vector>
+
+using namespace mylib::memory;
+
+// Test result counter
+int tests_passed = 0;
+int tests_failed = 0;
+
+// Helper macro for testing
+#define TEST(name) \
+    std::cout << "Testing: " << name << "... "; \
+    try {
+
+#define END_TEST \
+        std::cout << "✓ PASSED" << std::endl; \
+        tests_passed++; \
+    } catch (const std::exception& e) { \
+        std::cout << "✗ FAILED: " << e.what() << std::endl; \
+        tests_failed++; \
+    }
+
+// ============================================
+// NodePool Tests
+// ============================================
+
+void test_accepts() {
+    TEST("accepts() limits size and alignment")
+    assert(NodePool::accepts(1, 1));
+    assert(NodePool::accepts(24, alignof(void*)));
+    assert(NodePool::accepts(NodePool::MAX_BLOCK_BYTES, 8));
+    assert(!NodePool::accepts(NodePool::MAX_BLOCK_BYTES + 1, 8));
+    assert(!NodePool::accepts(32, 64));
+    END_TEST
+}
+
+void test_allocate_aligned_distinct() {
+    TEST("Blocks are aligned and do not overlap")
+    NodePool pool;
+    std::set<std::uintptr_t> seen;
+    for (int i = 0; i < 1000; ++i) {
+        void* p = pool.allocate(24);
+        auto address = reinterpret_cast<std::uintptr_t>(p);
+        assert(address % NodePool::GRANULE == 0);
+        assert(seen.insert(address).second);
+        std::fill_n(static_cast<char*>(p), 24, static_cast<char>(i));
+    }
+    assert(pool.in_use() == 1000);
+    // Neighbouring blocks are at least one block apart
+    std::uintptr_t previous = 0;
+    for (std::uintptr_t address : seen) {
+        assert(previous == 0 || address - previous >= 24);
+        previous = address;
+    }
+    END_TEST
+}
+
+void test_free_list_reuse() {
+    TEST("Freed blocks are reused by the same size class")
+    NodePool pool;
+    void* a = pool.allocate(32);
+    void* b = pool.allocate(32);
+    pool.deallocate(a, 32);
+    assert(pool.in_use() == 1);
+    assert(pool.allocate(32) == a);
+
+    // A different size class does not take the block
+    pool.deallocate(b, 32);
+    void* c = pool.allocate(64);
+    assert(c != b);
+    assert(pool.allocate(32) == b);
+    END_TEST
+}
+
+void test_slab_growth_and_release() {
+    TEST("Slabs grow on demand and release() frees them all")
+    NodePool pool;
+    assert(pool.slab_count() == 0);
+    pool.allocate(16);
+    assert(pool.slab_count() == 1);
+    for (int i = 0; i < 100000; ++i) {
+        pool.allocate(16);
+    }
+    std::size_t slabs = pool.slab_count();
+    // Doubling slabs keep the count logarithmic in the block count
+    assert(slabs > 1 && slabs < 20);
+
+    pool.release();
+    assert(pool.slab_count() == 0);
+    assert(pool.in_use() == 0);
+    void* p = pool.allocate(16);
+    assert(p != nullptr && pool.slab_count() == 1);
+    END_TEST
+}
+
+// ============================================
+// PoolAllocator Tests
+// ============================================
+
+void test_allocator_copies_share_pool() {
+    TEST("Allocator copies and rebinds share the pool")
+    PoolAllocator<int> a;
+    PoolAllocator<int> b = a;
+    PoolAllocator<double> c(a);
+    PoolAllocator<int> other;
+    assert(a == b);
+    assert(a != other);
+    assert(c.pool() == a.pool());
+    assert(a.select_on_container_copy_construction() != a);
+
+    int* p = a.allocate(1);
+    double* q = c.allocate(1);
+    assert(a.pool()->in_use() == 2);
+    b.deallocate(p, 1);
+    c.deallocate(q, 1);
+    assert(a.pool()->in_use() == 0);
+    END_TEST
+}
+
+void test_allocator_large_requests() {
+    TEST("Large arrays bypass the pool")
+    PoolAllocator<std::uint64_t> alloc;
+    std::uint64_t* small = alloc.allocate(4);
+    std::uint64_t* large = alloc.allocate(1000);
+    assert(alloc.pool()->in_use() == 1);
+    for (int i = 0; i < 1000; ++i) {
+        large[i] = static_cast<std::uint64_t>(i);
+    }
+    assert(large[999] == 999);
+    alloc.deallocate(large, 1000);
+    alloc.deallocate(small, 4);
+    assert(alloc.pool()->in_use() == 0);
+    END_TEST
+}
+
+void test_bulk_release_traits() {
+    TEST("bulk_release_traits reports exclusive ownership")
+    PoolAllocator<int> a;
+    assert(bulk_release_traits<PoolAllocator<int>>::exclusive(a));
+    {
+        PoolAllocator<int> b = a;
+        assert(!bulk_release_traits<PoolAllocator<int>>::exclusive(a));
+    }
+    a.allocate(1);
+    bulk_release_traits<PoolAllocator<int>>::release(a);
+    assert(a.pool()->slab_count() == 0);
+
+    std::allocator<int> plain;
+    assert(!bulk_release_traits<std::allocator<int>>::exclusive(plain));
+
+    // Blocks the pool refuses come from ::operator new; release() cannot free them
+    struct Large { char bytes[NodePool::MAX_BLOCK_BYTES + 8]; };
+    PoolAllocator<Large> large;
+    assert(!bulk_release_traits<PoolAllocator<Large>>::exclusive(large));
+    END_TEST
+}
+
+void test_standard_containers() {
+    TEST("Works as the allocator of standard node containers")
+    PoolAllocator<int> alloc;
+    std::list<int, PoolAllocator<int>> list(alloc);
+    std::map<int, int, std::less<int>, PoolAllocator<std::pair<const int, int>>> map(alloc);
+    for (int i = 0; i < 1000; ++i) {
+        list.push_back(i);
+        map[i] = -i;
+    }
+    assert(alloc.pool()->in_use() == 2000);
+    list.clear();
+    map.clear();
+    assert(alloc.pool()->in_use() == 0);
+    END_TEST
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "NodePool Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::cout << std::endl << "--- NodePool Tests ---" << std::endl;
+    test_accepts();
+    test_allocate_aligned_distinct();
+    test_free_list_reuse();
+    test_slab_growth_and_release();
+
+    std::cout << std::endl << "--- PoolAllocator Tests ---" << std::endl;
+    test_allocator_copies_share_pool();
+    test_allocator_large_requests();
+    test_bulk_release_traits();
+    test_standard_containers();
+
+    // Print summary
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Test Results" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "✓ Passed: " << tests_passed << std::endl;
+    std::cout << "✗ Failed: " << tests_failed << std::endl;
+    std::cout << "Total: " << (tests_passed + tests_failed) << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -7,6 +7,7 @@
  */
 
 #include "tree/binary_search_tree.hpp"
+#include "memory/node_pool.hpp"
 #include <iostream>
 #include <cassert>
 #include <vector>
@@ -665,6 +666,37 @@ void test_skewed_tree_right() {
     END_TEST
 }
 
+// Test: pooled nodes
+void test_pool_allocator() {
+    TEST("Pool allocator: insert, remove, copy and bulk clear")
+    using PoolTree = BinarySearchTree<int, mylib::memory::PoolAllocator<int>>;
+    PoolTree tree;
+    for (int i = 0; i < 2000; ++i) {
+        tree.insert((i * 7919) % 2000);
+    }
+    assert(tree.size() == 2000);
+    assert(tree.get_allocator().pool()->in_use() == 2000);
+    for (int i = 0; i < 2000; i += 2) {
+        assert(tree.remove(i));
+    }
+    assert(tree.get_allocator().pool()->in_use() == 1000);
+    assert(tree.is_valid());
+
+    PoolTree copy(tree);
+    assert(copy.get_allocator() != tree.get_allocator());
+    assert(copy.size() == 1000 && copy.contains(1) && !copy.contains(2));
+
+    // Only this tree owns its pool: clear() drops the slabs in one go
+    std::weak_ptr<mylib::memory::NodePool> pool = tree.get_allocator().pool();
+    tree.clear();
+    assert(tree.empty());
+    assert(pool.lock()->slab_count() == 0);
+    tree.insert(42);
+    assert(tree.contains(42));
+    assert(copy.size() == 1000);
+    END_TEST
+}
+
 // Main test runner
 int main() {
     std::cout << "========================================" << std::endl;
@@ -729,6 +761,9 @@ int main() {
     test_large_dataset();
     test_with_doubles();
 
+    // Allocator tests
+    test_pool_allocator();
+
     // Print summary
     std::cout << std::endl;
     std::cout << "========================================" << std::endl;
@@ -0,0 +1,190 @@
+/**
+ * @file test_indexed_heap.cpp
+ * @brief Test suite for IndexedHeap class
+ * @author Jinhyeok
+ * @date 2026-10-16
+ * @version 1.0.0
+ */
+
+#include "tree/indexed_heap.hpp"
+#include <iostream>
+#include <cassert>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <random>
+
+using namespace mylib::tree;
+
+// Test result counter
+int tests_passed = 0;
+int tests_failed = 0;
+
+// Helper macro for testing
+#define TEST(name) \
+    std::cout << "Testing: " << name << "... "; \
+    try {
+
+#define END_TEST \
+        std::cout << "✓ PASSED" << std::endl; \
+        tests_passed++; \
+    } catch (const std::exception& e) { \
+        std::cout << "✗ FAILED: " << e.what() << std::endl; \
+        tests_failed++; \
+    }
+
+// ============================================
+// Basic Tests
+// ============================================
+
+void test_push_and_extract() {
+    TEST("Push and extract in priority order")
+    MinIndexedHeap<int> heap;
+    assert(heap.empty());
+    heap.push(3, 30);
+    heap.push(0, 50);
+    heap.push(7, 10);   // Grows the position table
+    heap.push(2, 40);
+    assert(heap.size() == 4);
+    assert(heap.is_valid());
+    assert(heap.top_key() == 7 && heap.top_priority() == 10);
+    assert(heap.contains(0) && !heap.contains(1) && !heap.contains(100));
+
+    std::vector<std::size_t> order;
+    while (!heap.empty()) {
+        order.push_back(heap.extract().first);
+    }
+    assert((order == std::vector<std::size_t>{7, 3, 2, 0}));
+    END_TEST
+}
+
+void test_max_heap_default() {
+    TEST("Default comparator gives a max heap, as Heap does")
+    IndexedHeap<double> heap(4);
+    heap.push(0, 1.5);
+    heap.push(1, 9.0);
+    heap.push(2, 4.0);
+    assert(heap.top_key() == 1);
+    heap.decrease_key(0, 20.0);   // Towards the top
+    assert(heap.top_key() == 0);
+    END_TEST
+}
+
+void test_decrease_key_and_update() {
+    TEST("decrease_key, update and erase keep one entry per key")
+    MinIndexedHeap<int, 2> heap;
+    for (std::size_t key = 0; key < 10; ++key) {
+        heap.push(key, 100 + static_cast<int>(key));
+    }
+    heap.decrease_key(9, 1);
+    assert(heap.top_key() == 9 && heap.size() == 10);
+    heap.update(9, 500);          // Down
+    heap.update(5, 2);            // Up
+    assert(heap.top_key() == 5);
+    assert(heap.priority(9) == 500);
+    assert(heap.erase(5) && !heap.erase(5));
+    assert(heap.top_key() == 0 && heap.size() == 9);
+    assert(heap.is_valid());
+
+    heap.clear();
+    assert(heap.empty() && !heap.contains(0));
+    heap.push(0, 7);              // Keys are free again after clear
+    assert(heap.top_priority() == 7);
+    END_TEST
+}
+
+void test_errors() {
+    TEST("Errors on empty heap, duplicate push and wrong-way decrease_key")
+    MinIndexedHeap<int> heap;
+    int thrown = 0;
+    try { heap.top_key(); } catch (const std::out_of_range&) { ++thrown; }
+    try { heap.pop(); } catch (const std::out_of_range&) { ++thrown; }
+    try { heap.priority(3); } catch (const std::out_of_range&) { ++thrown; }
+    heap.push(3, 10);
+    try { heap.push(3, 5); } catch (const std::invalid_argument&) { ++thrown; }
+    try { heap.decrease_key(3, 11); } catch (const std::invalid_argument&) { ++thrown; }
+    try { heap.decrease_key(4, 1); } catch (const std::out_of_range&) { ++thrown; }
+    assert(thrown == 6);
+    assert(heap.priority(3) == 10);
+    END_TEST
+}
+
+// ============================================
+// Stress Tests
+// ============================================
+
+void test_random_against_reference() {
+    TEST("Random operations match a reference")
+    std::mt19937 rng(7);
+    MinIndexedHeap<int, 4> heap;
+    std::vector<int> reference(500, -1);   // -1: not queued
+    for (int step = 0; step < 20000; ++step) {
+        std::size_t key = rng() % reference.size();
+        int priority = static_cast<int>(rng() % 10000);
+        switch (rng() % 4) {
+        case 0:
+            if (reference[key] < 0) {
+                heap.push(key, priority);
+                reference[key] = priority;
+            }
+            break;
+        case 1:
+            if (reference[key] >= 0 && priority <= reference[key]) {
+                heap.decrease_key(key, priority);
+                reference[key] = priority;
+            }
+            break;
+        case 2:
+            if (reference[key] >= 0) {
+                heap.update(key, priority);
+                reference[key] = priority;
+            }
+            break;
+        default:
+            if (!heap.empty()) {
+                auto top = heap.extract();
+                int smallest = 1 << 30;
+                for (int p : reference) {
+                    if (p >= 0) {
+                        smallest = std::min(smallest, p);
+                    }
+                }
+                assert(top.second == smallest && reference[top.first] == smallest);
+                reference[top.first] = -1;
+            }
+            break;
+        }
+    }
+    assert(heap.is_valid());
+    std::size_t queued = static_cast<std::size_t>(
+        std::count_if(reference.begin(), reference.end(), [](int p) { return p >= 0; }));
+    assert(heap.size() == queued);
+    END_TEST
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "IndexedHeap Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::cout << std::endl << "--- Basic Tests ---" << std::endl;
+    test_push_and_extract();
+    test_max_heap_default();
+    test_decrease_key_and_update();
+    test_errors();
+
+    std::cout << std::endl << "--- Stress Tests ---" << std::endl;
+    test_random_against_reference();
+
+    // Print summary
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Test Results" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "✓ Passed: " << tests_passed << std::endl;
+    std::cout << "✗ Failed: " << tests_failed << std::endl;
+    std::cout << "Total: " << (tests_passed + tests_failed) << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -7,6 +7,7 @@
  */
 
 #include "tree/red_black_tree.hpp"
+#include "memory/node_pool.hpp"
 #include <iostream>
 #include <cassert>
 #include <string>
@@ -808,6 +809,36 @@ void test_compare_with_std_set() {
     END_TEST
 }
 
+// Test: pooled nodes
+void test_pool_allocator() {
+    TEST("Pool allocator: insert, erase, copy and bulk clear")
+    using PoolTree = RedBlackTree<int, std::less<int>, mylib::memory::PoolAllocator<int>>;
+    PoolTree tree;
+    for (int i = 0; i < 2000; ++i) {
+        tree.insert((i * 7919) % 2000);
+    }
+    assert(tree.get_allocator().pool()->in_use() == 2000);
+    for (int i = 0; i < 2000; i += 2) {
+        assert(tree.erase(i));
+    }
+    assert(tree.get_allocator().pool()->in_use() == 1000);
+    assert(tree.verify());
+
+    PoolTree copy(tree);
+    assert(copy.get_allocator() != tree.get_allocator());
+    assert(copy.size() == 1000 && copy.verify());
+
+    PoolTree moved(std::move(copy));
+    assert(moved.size() == 1000 && moved.contains(1999));
+
+    std::weak_ptr<mylib::memory::NodePool> pool = tree.get_allocator().pool();
+    tree.clear();
+    assert(pool.lock()->slab_count() == 0);
+    tree.insert(5);
+    assert(tree.size() == 1 && tree.verify());
+    END_TEST
+}
+
 // Main test runner
 int main() {
     std::cout << "========================================" << std::endl;
@@ -899,6 +930,10 @@ int main() {
     std::cout << std::endl << "--- Comparison Tests ---" << std::endl;
     test_compare_with_std_set();
 
+    // Allocator tests
+    std::cout << std::endl << "--- Allocator Tests ---" << std::endl;
+    test_pool_allocator();
+
     // Print summary
     std::cout << std::endl;
     std::cout << "========================================" << std::endl;
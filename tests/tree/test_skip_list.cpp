@@ -7,12 +7,14 @@
  */
 
 #include "tree/skip_list.hpp"
+#include "memory/node_pool.hpp"
 #include <iostream>
 #include <cassert>
 #include <vector>
 #include <string>
 #include <algorithm>
 #include <numeric>
+#include <array>
 
 using namespace mylib::tree;
 
@@ -644,6 +646,132 @@ void test_expected_levels() {
     END_TEST
 }
 
+void test_pool_allocator() {
+    TEST("Pool allocator: nodes and towers from the pool")
+    using PoolSkipList = SkipList<int, std::less<int>, mylib::memory::PoolAllocator<int>>;
+    PoolSkipList list;
+    auto pool = list.get_allocator().pool();
+    // Head node plus its tower
+    assert(pool->in_use() == 2);
+    for (int i = 0; i < 1000; ++i) {
+        list.insert(i);
+    }
+    assert(pool->in_use() == 2 + 2 * 1000);
+    for (int i = 0; i < 1000; i += 2) {
+        assert(list.remove(i));
+    }
+    assert(pool->in_use() == 2 + 2 * 500);
+
+    PoolSkipList copy(list);
+    assert(copy.get_allocator() != list.get_allocator());
+    assert(copy.size() == 500 && copy.contains(999) && !copy.contains(0));
+
+    list.clear();
+    assert(pool->in_use() == 2);
+    list.insert(3);
+    assert(list.contains(3) && list.size() == 1);
+    END_TEST
+}
+
+/**
+ * @brief Allocator that does not propagate on move assignment; instances
+ *        with different tags are unequal. Counts live blocks per tag.
+ */
+template <typename T>
+struct TaggedAllocator {
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::false_type;
+    using is_always_equal = std::false_type;
+
+    static inline long live[4] = {0, 0, 0, 0};
+    int tag = 0;
+
+    TaggedAllocator() = default;
+    explicit TaggedAllocator(int t) : tag(t) {}
+    template <typename U>
+    TaggedAllocator(const TaggedAllocator<U>& other) : tag(other.tag) {}
+
+    T* allocate(std::size_t n) {
+        ++TaggedAllocator<char>::live[tag];
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, std::size_t n) {
+        --TaggedAllocator<char>::live[tag];
+        std::allocator<T>().deallocate(p, n);
+    }
+    friend bool operator==(const TaggedAllocator& a, const TaggedAllocator& b) { return a.tag == b.tag; }
+    friend bool operator!=(const TaggedAllocator& a, const TaggedAllocator& b) { return a.tag != b.tag; }
+};
+
+void test_move_assign_unequal_allocators() {
+    TEST("Move assignment between unequal, non-propagating allocators")
+    using TaggedList = SkipList<int, std::less<int>, TaggedAllocator<int>>;
+    {
+        TaggedList target(16, 0.5, std::less<int>(), TaggedAllocator<int>(1));
+        TaggedList source(16, 0.5, std::less<int>(), TaggedAllocator<int>(2));
+        for (int i = 0; i < 100; ++i) {
+            target.insert(-i);
+            source.insert(i);
+        }
+        target = std::move(source);
+        assert(target.get_allocator().tag == 1);
+        assert(target.size() == 100 && target.contains(99) && !target.contains(-1));
+        assert(source.empty());
+        source.insert(7);   // The moved-from list stays usable
+        assert(source.contains(7));
+
+        // Same tag: nodes are taken over without reallocation
+        TaggedList other(16, 0.5, std::less<int>(), TaggedAllocator<int>(1));
+        other.insert(5);
+        long before = TaggedAllocator<char>::live[1];
+        target = std::move(other);
+        assert(target.size() == 1 && target.contains(5));
+        assert(TaggedAllocator<char>::live[1] < before);
+    }
+    // Every block went back to the allocator it came from
+    assert(TaggedAllocator<char>::live[1] == 0 && TaggedAllocator<char>::live[2] == 0);
+    END_TEST
+}
+
+void test_pool_allocator_oversized() {
+    TEST("Pool allocator: nodes and towers too large for the pool are not leaked")
+    // Neither path may drop the pool in bulk; blocks outside it would leak
+    using Block = std::array<char, 512>;
+    {
+        SkipList<Block, std::less<Block>, mylib::memory::PoolAllocator<Block>> list;
+        Block block{};
+        for (int i = 0; i < 1000; ++i) {
+            block[0] = static_cast<char>(i / 128);
+            block[1] = static_cast<char>(i % 128);
+            list.insert(block);
+        }
+        assert(list.size() == 1000);
+        list.clear();
+        assert(list.empty());
+        list.insert(block);
+        assert(list.contains(block));
+    }
+
+    using PoolSkipList = SkipList<int, std::less<int>, mylib::memory::PoolAllocator<int>>;
+    {
+        // The head tower holds 41 pointers, more than a pool block
+        PoolSkipList list(40, 0.5);
+        auto pool = list.get_allocator().pool();
+        assert(pool->in_use() == 1);
+        for (int i = 0; i < 2000; ++i) {
+            list.insert(i);
+        }
+        list.clear();
+        assert(list.empty() && pool->in_use() == 1);
+        for (int i = 0; i < 2000; ++i) {
+            list.insert(i);
+        }
+        assert(list.size() == 2000 && list.contains(1999));
+    }
+    END_TEST
+}
+
+
 // ============================================
 // Main Test Runner
 // ============================================
@@ -731,6 +859,12 @@ int main() {
     test_level_distribution_properties();
     test_expected_levels();
     
+    std::cout << std::endl << "--- Allocator Tests ---" << std::endl;
+    test_pool_allocator();
+    test_pool_allocator_oversized();
+    test_move_assign_unequal_allocators();
+    
+
     // Print summary
     std::cout << std::endl;
     std::cout << "========================================" << std::endl;
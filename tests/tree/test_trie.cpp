@@ -7,6 +7,7 @@
  */
 
 #include "tree/trie.hpp"
+#include "memory/node_pool.hpp"
 #include <iostream>
 #include <cassert>
 #include <string>
@@ -775,6 +776,31 @@ void test_word_game() {
     END_TEST
 }
 
+// Test: pooled nodes
+void test_pool_allocator() {
+    TEST("Pool allocator: nodes and child maps from the pool")
+    using PoolTrie = Trie<char, mylib::memory::PoolAllocator<char>>;
+    PoolTrie trie;
+    auto pool = trie.get_allocator().pool();
+    std::size_t empty_use = pool->in_use();
+    trie.insert("apple");
+    trie.insert("apply");
+    trie.insert("banana");
+    assert(pool->in_use() > empty_use);
+    assert(trie.search("apply") && trie.starts_with("ban"));
+
+    PoolTrie copy(trie);
+    assert(copy.get_allocator() != trie.get_allocator());
+    assert(copy.size() == 3 && copy.search("banana"));
+
+    assert(trie.remove("banana"));
+    trie.clear();
+    assert(pool->in_use() == empty_use);
+    assert(trie.empty() && !trie.search("apple"));
+    assert(copy.search("apple"));
+    END_TEST
+}
+
 // Main test runner
 int main() {
     std::cout << "========================================" << std::endl;
@@ -859,6 +885,10 @@ int main() {
     test_ip_prefix_matching();
     test_word_game();
 
+    // Allocator tests
+    std::cout << std::endl << "--- Allocator Tests ---" << std::endl;
+    test_pool_allocator();
+
     // Print summary
     std::cout << std::endl;
     std::cout << "========================================" << std::endl;